@@ -1,18 +1,32 @@
 #include <benchmark/benchmark.h>
+#include <atomic>
 #include <filesystem>
 #include <memory>
+#include <random>
+#include <thread>
 
 #include "benchmark_helpers.hpp"
 
+#include "../tiffconcept/include/tiffconcept/compressors/compressor_lzw.hpp"
 #include "../tiffconcept/include/tiffconcept/compressors/compressor_standard.hpp"
 #include "../tiffconcept/include/tiffconcept/compressors/compressor_zstd.hpp"
 #include "../tiffconcept/include/tiffconcept/decompressors/decompressor_standard.hpp"
+#include "../tiffconcept/include/tiffconcept/decompressors/decompressor_lzw.hpp"
 #include "../tiffconcept/include/tiffconcept/decompressors/decompressor_zstd.hpp"
+#ifdef HAVE_ZLIB
+#include "../tiffconcept/include/tiffconcept/compressors/compressor_deflate.hpp"
+#include "../tiffconcept/include/tiffconcept/decompressors/decompressor_deflate.hpp"
+#endif
 #include "../tiffconcept/include/tiffconcept/image_reader.hpp"
 #include "../tiffconcept/include/tiffconcept/image_writer.hpp"
 #include "../tiffconcept/include/tiffconcept/ifd.hpp"
+#include "../tiffconcept/include/tiffconcept/lowlevel/byteswap.hpp"
+#include "../tiffconcept/include/tiffconcept/lowlevel/predictor.hpp"
+#include "../tiffconcept/include/tiffconcept/page_index.hpp"
 #include "../tiffconcept/include/tiffconcept/parsing.hpp"
 #include "../tiffconcept/include/tiffconcept/readers/reader_buffer.hpp"
+#include "../tiffconcept/include/tiffconcept/readers/reader_simulated_remote.hpp"
+#include "../tiffconcept/include/tiffconcept/readers/reader_stream.hpp"
 #include "../tiffconcept/include/tiffconcept/tag_extraction.hpp"
 #include "../tiffconcept/include/tiffconcept/types/tag_spec.hpp"
 #include "../tiffconcept/include/tiffconcept/types/tag_spec_examples.hpp"
@@ -73,10 +87,11 @@ using FastReaderType = FastReader<T, DecompSpec>;
 // ============================================================================
 
 static void BM_Metadata_ParseIFD_SinglePage(benchmark::State& state) {
-    // Parameters: width, format, endianness
+    // Parameters: width, format, endianness, speculative (1 = single read of the IFD)
     uint32_t width = state.range(0);
     TiffFormat format = static_cast<TiffFormat>(state.range(1));
     Endianness endian = static_cast<Endianness>(state.range(2));
+    const std::size_t speculative_read_size = state.range(3) != 0 ? ifd::default_speculative_read_size : 0;
     
     ImageConfig config{width, width, 1, 3, 64, 64};
     StorageConfig storage{false, true, CompressionType::None, PredictorType::None, endian, format};
@@ -97,7 +112,7 @@ static void BM_Metadata_ParseIFD_SinglePage(benchmark::State& state) {
                 return;
             }
             auto ifd = ifd::read_ifd<FileReader, TiffFormatType::Classic, std::endian::little>(
-                file_reader, ifd_offset.value());
+                file_reader, ifd_offset.value(), speculative_read_size);
             if (!ifd.is_ok()) {
                 state.SkipWithError("Failed to read IFD " + ifd.error().message);
                 return;
@@ -110,7 +125,7 @@ static void BM_Metadata_ParseIFD_SinglePage(benchmark::State& state) {
                 return;
             }
             auto ifd = ifd::read_ifd<FileReader, TiffFormatType::BigTIFF, std::endian::little>(
-                file_reader, ifd_offset.value());
+                file_reader, ifd_offset.value(), speculative_read_size);
             if (!ifd.is_ok()) {
                 state.SkipWithError("Failed to read IFD " + ifd.error().message);
                 return;
@@ -123,7 +138,7 @@ static void BM_Metadata_ParseIFD_SinglePage(benchmark::State& state) {
                 return;
             }
             auto ifd = ifd::read_ifd<FileReader, TiffFormatType::Classic, std::endian::big>(
-                file_reader, ifd_offset.value());
+                file_reader, ifd_offset.value(), speculative_read_size);
             if (!ifd.is_ok()) {
                 state.SkipWithError("Failed to read IFD " + ifd.error().message);
                 return;
@@ -136,7 +151,7 @@ static void BM_Metadata_ParseIFD_SinglePage(benchmark::State& state) {
                 return;
             }
             auto ifd = ifd::read_ifd<FileReader, TiffFormatType::BigTIFF, std::endian::big>(
-                file_reader, ifd_offset.value());
+                file_reader, ifd_offset.value(), speculative_read_size);
             if (!ifd.is_ok()) {
                 state.SkipWithError("Failed to read IFD " + ifd.error().message);
                 return;
@@ -545,6 +560,272 @@ static void BM_LibTIFF_Metadata_ExtractAllPages(benchmark::State& state) {
 }
 #endif // HAVE_LIBTIFF
 
+// Multipage file of num_pages copies of a 512x512 tiled page (the generator
+// writes a single page per file), each IFD pointing to the next copy
+static Result<ifd::IFDOffset> build_ifd_chain(uint32_t num_pages, std::vector<std::byte>& chain_data) {
+    ImageConfig config{512, 512, 1, 1, 64, 64};
+    StorageConfig storage{false, true, CompressionType::None, PredictorType::None};
+    
+    TempFileManager temp_mgr;
+    TiffGenerator<uint8_t> gen(temp_mgr);
+    auto filepath = gen.create_file("ifd_chain", config, storage, 1,
+                                    ImagePattern::Constant);
+    
+    MmapReader local_reader(filepath.string());
+    auto ifd_offset = ifd::get_first_ifd_offset<MmapReader, TiffFormatType::Classic, std::endian::little>(local_reader);
+    if (!ifd_offset.is_ok()) {
+        return ifd_offset.error();
+    }
+    auto page_ifd = ifd::read_ifd<MmapReader, TiffFormatType::Classic, std::endian::little>(
+        local_reader, ifd_offset.value());
+    if (!page_ifd.is_ok()) {
+        return page_ifd.error();
+    }
+    auto file_size = local_reader.size();
+    if (!file_size.is_ok()) {
+        return file_size.error();
+    }
+    auto file_view = local_reader.read(0, file_size.value());
+    if (!file_view.is_ok()) {
+        return file_view.error();
+    }
+    
+    const std::size_t next_pointer_pos = ifd_offset.value().value + page_ifd.value().size_in_bytes() - sizeof(uint32_t);
+    chain_data.clear();
+    chain_data.reserve(file_size.value() * num_pages);
+    for (uint32_t page = 0; page < num_pages; ++page) {
+        const std::size_t page_start = chain_data.size();
+        chain_data.insert(chain_data.end(), file_view.value().data().begin(), file_view.value().data().end());
+        const uint32_t next = page + 1 < num_pages
+            ? static_cast<uint32_t>(page_start + file_size.value() + ifd_offset.value().value)
+            : 0;
+        std::memcpy(chain_data.data() + page_start + next_pointer_pos, &next, sizeof(next));  // Little-endian host
+    }
+    return ifd_offset;
+}
+
+static void BM_Metadata_WalkIFDChain(benchmark::State& state) {
+    // Parameters: latency_us, speculative (1 = single read per IFD)
+    // Walks the IFD chain of a 256-page file behind a SimulatedRemoteReader:
+    // every read is a sequential round trip, as the next offset is only
+    // known once the current IFD is read.
+    const auto latency = std::chrono::microseconds(state.range(0));
+    const std::size_t speculative_read_size = state.range(1) != 0 ? ifd::default_speculative_read_size : 0;
+    const uint32_t num_pages = 256;
+    
+    std::vector<std::byte> chain_data;
+    auto first_offset = build_ifd_chain(num_pages, chain_data);
+    if (!first_offset.is_ok()) {
+        state.SkipWithError("Failed to build IFD chain");
+        return;
+    }
+    
+    SimulatedRemoteReader<BufferReader> remote(
+        BufferReader(std::span<const std::byte>(chain_data)), {.latency = latency});
+    ifd::IFD<TiffFormatType::Classic, std::endian::little> current_ifd;
+    
+    for (auto _ : state) {
+        uint32_t pages_read = 0;
+        ifd::IFDOffset current = first_offset.value();
+        while (current) {
+            auto result = ifd::read_ifd_into<SimulatedRemoteReader<BufferReader>, TiffFormatType::Classic, std::endian::little>(
+                remote, current, current_ifd, speculative_read_size);
+            if (!result.is_ok()) {
+                state.SkipWithError("Failed to read IFD");
+                return;
+            }
+            current = current_ifd.next_ifd_offset;
+            ++pages_read;
+        }
+        if (pages_read != num_pages) {
+            state.SkipWithError("Unexpected number of pages");
+            return;
+        }
+        benchmark::DoNotOptimize(current_ifd);
+    }
+    
+    state.SetItemsProcessed(state.iterations() * num_pages);
+    state.counters["requests"] = benchmark::Counter(
+        static_cast<double>(remote.stats().requests), benchmark::Counter::kAvgIterations);
+}
+
+static void BM_Metadata_RandomPage(benchmark::State& state) {
+    // Parameters: latency_us, indexed (0 = walk the IFD chain to the page,
+    // 1 = reload a PageIndex blob and read the page directly)
+    // Opens a 1024-page file behind a SimulatedRemoteReader at a random page,
+    // as a viewer jumping inside a large acquisition does.
+    const auto latency = std::chrono::microseconds(state.range(0));
+    const bool indexed = state.range(1) != 0;
+    const uint32_t num_pages = 1024;
+    
+    std::vector<std::byte> chain_data;
+    auto first_offset = build_ifd_chain(num_pages, chain_data);
+    if (!first_offset.is_ok()) {
+        state.SkipWithError("Failed to build IFD chain");
+        return;
+    }
+    
+    // The index is built once, locally, as a previous open would have
+    BufferReader local_reader{std::span<const std::byte>(chain_data)};
+    const FileStamp stamp{chain_data.size(), 0};
+    auto index = PageIndex::build<BufferReader, TiffFormatType::Classic, std::endian::little>(local_reader, stamp);
+    if (!index.is_ok() || index.value().size() != num_pages) {
+        state.SkipWithError("Failed to build page index");
+        return;
+    }
+    const std::vector<std::byte> index_blob = index.value().serialize();
+    
+    SimulatedRemoteReader<BufferReader> remote(std::move(local_reader), {.latency = latency});
+    ifd::IFD<TiffFormatType::Classic, std::endian::little> page_ifd;
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<uint32_t> page_dist(0, num_pages - 1);
+    
+    for (auto _ : state) {
+        const uint32_t target_page = page_dist(rng);
+        ifd::IFDOffset offset = first_offset.value();
+        if (indexed) {
+            auto reloaded = PageIndex::deserialize(index_blob, stamp);
+            if (!reloaded.is_ok()) {
+                state.SkipWithError("Failed to reload page index");
+                return;
+            }
+            offset = reloaded.value().page(target_page).value().offset;
+        } else {
+            for (uint32_t page = 0; page < target_page; ++page) {
+                auto result = ifd::read_ifd_into<SimulatedRemoteReader<BufferReader>, TiffFormatType::Classic, std::endian::little>(
+                    remote, offset, page_ifd, ifd::default_speculative_read_size);
+                if (!result.is_ok()) {
+                    state.SkipWithError("Failed to read IFD");
+                    return;
+                }
+                offset = page_ifd.next_ifd_offset;
+            }
+        }
+        auto result = ifd::read_ifd_into<SimulatedRemoteReader<BufferReader>, TiffFormatType::Classic, std::endian::little>(
+            remote, offset, page_ifd, ifd::default_speculative_read_size);
+        if (!result.is_ok()) {
+            state.SkipWithError("Failed to read IFD");
+            return;
+        }
+        benchmark::DoNotOptimize(page_ifd);
+    }
+    
+    state.SetItemsProcessed(state.iterations());
+    state.counters["requests"] = benchmark::Counter(
+        static_cast<double>(remote.stats().requests), benchmark::Counter::kAvgIterations);
+}
+
+template <typename Spec>
+static void BM_Metadata_ExtractTags_TileArrays(benchmark::State& state) {
+    // Parameters: width
+    // Extracts the tags of a single-channel page of 16x16 tiles from an
+    // MmapReader and updates a TiledImageInfo from them. MinTiledSpec copies
+    // the tile arrays into vectors, MinTiledViewSpec keeps views of the mapping.
+    uint32_t width = state.range(0);
+    
+    ImageConfig config{width, width, 1, 1, 16, 16};
+    StorageConfig storage{false, true, CompressionType::None, PredictorType::None};
+    
+    TempFileManager temp_mgr;
+    TiffGenerator<uint8_t> gen(temp_mgr);
+    auto filepath = gen.create_file("extract_tags_tile_arrays", config, storage, 1,
+                                    ImagePattern::Gradient);
+    
+    MmapReader reader(filepath.string());
+    auto ifd_offset = ifd::get_first_ifd_offset<MmapReader, TiffFormatType::Classic, std::endian::little>(reader);
+    if (!ifd_offset.is_ok()) {
+        state.SkipWithError("Failed to get IFD offset");
+        return;
+    }
+    auto ifd = ifd::read_ifd<MmapReader, TiffFormatType::Classic, std::endian::little>(
+        reader, ifd_offset.value());
+    if (!ifd.is_ok()) {
+        state.SkipWithError("Failed to read IFD");
+        return;
+    }
+    
+    ExtractedTags<Spec> metadata;
+    TiledImageInfo<uint8_t> image_info;
+    
+    for (auto _ : state) {
+        auto result = metadata.template extract<MmapReader, TiffFormatType::Classic, std::endian::little>(
+            reader, std::span(ifd.value().tags));
+        if (!result.is_ok()) {
+            state.SkipWithError("Failed to extract tags");
+            return;
+        }
+        auto update = image_info.update_from_metadata(metadata);
+        if (!update.is_ok()) {
+            state.SkipWithError("Failed to update image info");
+            return;
+        }
+        benchmark::DoNotOptimize(image_info);
+    }
+    
+    state.SetItemsProcessed(state.iterations());
+    state.counters["tiles"] = static_cast<double>(image_info.num_tiles());
+}
+
+static void BM_Metadata_ExtractTags_Remote(benchmark::State& state) {
+    // Parameters: latency_us
+    // Extracts the tags of a tiled RGB page (BitsPerSample, TileOffsets and
+    // TileByteCounts stored out of line) behind a SimulatedRemoteReader, the
+    // IFD itself being already read. The out-of-line tag data is fetched in
+    // coalesced requests (see the requests counter).
+    const auto latency = std::chrono::microseconds(state.range(0));
+    
+    ImageConfig config{2048, 2048, 1, 3, 128, 128};
+    StorageConfig storage{false, true, CompressionType::None, PredictorType::None};
+    
+    TempFileManager temp_mgr;
+    TiffGenerator<uint8_t> gen(temp_mgr);
+    auto filepath = gen.create_file("extract_tags_remote", config, storage, 1,
+                                    ImagePattern::Gradient);
+    
+    MmapReader local_reader(filepath.string());
+    auto file_size = local_reader.size();
+    if (!file_size.is_ok()) {
+        state.SkipWithError("Failed to get file size");
+        return;
+    }
+    auto file_view = local_reader.read(0, file_size.value());
+    if (!file_view.is_ok()) {
+        state.SkipWithError("Failed to read file");
+        return;
+    }
+    const std::vector<std::byte> file_data(file_view.value().data().begin(), file_view.value().data().end());
+    
+    auto ifd_offset = ifd::get_first_ifd_offset<MmapReader, TiffFormatType::Classic, std::endian::little>(local_reader);
+    if (!ifd_offset.is_ok()) {
+        state.SkipWithError("Failed to get IFD offset");
+        return;
+    }
+    auto ifd = ifd::read_ifd<MmapReader, TiffFormatType::Classic, std::endian::little>(
+        local_reader, ifd_offset.value());
+    if (!ifd.is_ok()) {
+        state.SkipWithError("Failed to read IFD");
+        return;
+    }
+    
+    SimulatedRemoteReader<BufferReader> remote(
+        BufferReader(std::span<const std::byte>(file_data)), {.latency = latency});
+    ExtractedTags<MinTiledSpec> metadata;
+    
+    for (auto _ : state) {
+        auto result = metadata.extract<SimulatedRemoteReader<BufferReader>, TiffFormatType::Classic, std::endian::little>(
+            remote, std::span(ifd.value().tags));
+        if (!result.is_ok()) {
+            state.SkipWithError("Failed to extract tags");
+            return;
+        }
+        benchmark::DoNotOptimize(metadata);
+    }
+    
+    state.SetItemsProcessed(state.iterations());
+    state.counters["requests"] = benchmark::Counter(
+        static_cast<double>(remote.stats().requests), benchmark::Counter::kAvgIterations);
+}
+
 // ============================================================================
 // Read Benchmarks - Size Variations
 // ============================================================================
@@ -636,6 +917,267 @@ static void BM_Read_SizeVariation(benchmark::State& state) {
     state.SetItemsProcessed(state.iterations());
 }
 
+// ============================================================================
+// Read Benchmarks - Worker Scaling
+// ============================================================================
+
+template <typename T, typename ReaderType>
+static void BM_Read_WorkerScaling(benchmark::State& state) {
+    // Parameters: width, worker threads
+    // ZSTD + horizontal predictor so that decoding dominates: throughput
+    // should grow with the number of workers until the cores are saturated.
+    uint32_t width = state.range(0);
+    size_t worker_threads = static_cast<size_t>(state.range(1));
+    
+    ImageConfig config{width, width, 1, 1, 256, 256};
+    StorageConfig storage{false, true, CompressionType::ZSTD, PredictorType::Horizontal, Endianness::Little};
+    
+    TempFileManager temp_mgr;
+    TiffGenerator<T> gen(temp_mgr);
+    auto filepath = gen.create_file("read_worker_scaling", config, storage, 1,
+                                    ImagePattern::Random);
+    
+    FileReader file_reader(filepath.string());
+    auto ifd_offset = ifd::get_first_ifd_offset<FileReader, TiffFormatType::Classic, std::endian::little>(file_reader);
+    auto ifd = ifd::read_ifd<FileReader, TiffFormatType::Classic, std::endian::little>(
+        file_reader, ifd_offset.value());
+    
+    ExtractedTags<MinTiledSpec> metadata;
+    auto extract_result = metadata.extract<FileReader, TiffFormatType::Classic, std::endian::little>(
+        file_reader, std::span(ifd.value().tags));
+    if (!extract_result.is_ok()) {
+        state.SkipWithError("Failed to extract tags " + extract_result.error().message);
+        return;
+    }
+    
+    TiledImageInfo<T> image_info;
+    extract_result = image_info.update_from_metadata(metadata);
+    if (!extract_result.is_ok()) {
+        state.SkipWithError("Failed to update image info from metadata " + extract_result.error().message);
+        return;
+    }
+    
+    auto region = image_info.shape().full_region();
+    std::vector<T> output(region.num_samples());
+    
+    typename ReaderType::Config reader_config{};
+    reader_config.worker_threads = worker_threads;
+    ReaderType reader(reader_config);
+    
+    for (auto _ : state) {
+        auto result = reader.template read_region<ImageLayoutSpec::DHWC>(
+            file_reader, metadata, region, output);
+        if (!result.is_ok()) {
+            state.SkipWithError("Read failed " + result.error().message);
+            return;
+        }
+        benchmark::DoNotOptimize(output);
+    }
+    
+    state.SetBytesProcessed(state.iterations() * output.size() * sizeof(T));
+    state.SetItemsProcessed(state.iterations());
+    state.counters["workers"] = static_cast<double>(worker_threads);
+}
+
+template <typename T, typename ReaderType>
+static void BM_Read_ConcurrentCallers(benchmark::State& state) {
+    // Parameters: width, concurrent callers
+    // One file reader and one image reader shared by all callers, each reading
+    // its own horizontal band. Small uncompressed tiles: the cost is dominated by
+    // submitting and reaping reads, so contention on the file reader shows.
+    uint32_t width = state.range(0);
+    size_t num_callers = static_cast<size_t>(state.range(1));
+
+    ImageConfig config{width, width, 1, 1, 64, 64};
+    StorageConfig storage{false, true, CompressionType::None, PredictorType::None, Endianness::Little};
+
+    TempFileManager temp_mgr;
+    TiffGenerator<T> gen(temp_mgr);
+    auto filepath = gen.create_file("read_concurrent_callers", config, storage, 1,
+                                    ImagePattern::Random);
+
+    FileReader file_reader(filepath.string());
+    auto ifd_offset = ifd::get_first_ifd_offset<FileReader, TiffFormatType::Classic, std::endian::little>(file_reader);
+    auto ifd = ifd::read_ifd<FileReader, TiffFormatType::Classic, std::endian::little>(
+        file_reader, ifd_offset.value());
+
+    ExtractedTags<MinTiledSpec> metadata;
+    auto extract_result = metadata.extract<FileReader, TiffFormatType::Classic, std::endian::little>(
+        file_reader, std::span(ifd.value().tags));
+    if (!extract_result.is_ok()) {
+        state.SkipWithError("Failed to extract tags " + extract_result.error().message);
+        return;
+    }
+
+    TiledImageInfo<T> image_info;
+    extract_result = image_info.update_from_metadata(metadata);
+    if (!extract_result.is_ok()) {
+        state.SkipWithError("Failed to update image info from metadata " + extract_result.error().message);
+        return;
+    }
+
+    const uint32_t band_height = width / static_cast<uint32_t>(num_callers);
+    std::vector<ImageRegion> regions;
+    std::vector<std::vector<T>> outputs(num_callers);
+    for (size_t c = 0; c < num_callers; ++c) {
+        regions.emplace_back(0, 0, static_cast<uint32_t>(c) * band_height, 0, 1, 1, band_height, width);
+        outputs[c].resize(regions.back().num_samples());
+    }
+
+    typename ReaderType::Config reader_config{};
+    reader_config.worker_threads = 1;
+    ReaderType reader(reader_config);
+
+    std::atomic<bool> failed{false};
+    for (auto _ : state) {
+        std::vector<std::thread> callers;
+        callers.reserve(num_callers);
+        for (size_t c = 0; c < num_callers; ++c) {
+            callers.emplace_back([&, c] {
+                auto result = reader.template read_region<ImageLayoutSpec::DHWC>(
+                    file_reader, metadata, regions[c], std::span<T>(outputs[c]));
+                if (!result.is_ok()) {
+                    failed.store(true);
+                }
+            });
+        }
+        for (auto& caller : callers) {
+            caller.join();
+        }
+        if (failed.load()) {
+            state.SkipWithError("Read failed");
+            return;
+        }
+        benchmark::DoNotOptimize(outputs);
+    }
+
+    state.SetBytesProcessed(state.iterations() * num_callers * outputs[0].size() * sizeof(T));
+    state.SetItemsProcessed(state.iterations() * num_callers);
+    state.counters["callers"] = static_cast<double>(num_callers);
+}
+
+// ============================================================================
+// Read Benchmarks - Codecs (Deflate, LZW)
+// ============================================================================
+
+#ifdef HAVE_LIBTIFF
+
+// Files are produced by libtiff so that both libraries decode the same
+// compressed streams.
+template <typename T>
+static std::filesystem::path create_codec_file(TempFileManager& temp_mgr, uint32_t width,
+                                               CompressionType compression, PredictorType predictor) {
+    ImageConfig config{width, width, 1, 1, 256, 256};
+    StorageConfig storage{false, true, compression, predictor, Endianness::Little};
+    LibTiffGenerator<T> gen(temp_mgr);
+    return gen.create_file("read_codec", config, storage, 1, ImagePattern::Gradient);
+}
+
+template <typename T, typename ReaderType, CompressionType Compression>
+static void BM_Read_Codec(benchmark::State& state) {
+    // Parameters: width, predictor
+    uint32_t width = state.range(0);
+    PredictorType predictor = static_cast<PredictorType>(state.range(1));
+    
+    TempFileManager temp_mgr;
+    auto filepath = create_codec_file<T>(temp_mgr, width, Compression, predictor);
+    
+    std::size_t bytes_processed = 0;
+    
+    // Reader reused across iterations: the codec state of each decoder is reused
+    ReaderType reader;
+    ExtractedTags<MinTiledSpec> metadata;
+    TiledImageInfo<T> image_info;
+    
+    for (auto _ : state) {
+        FileReader file_reader(filepath.string());
+        auto ifd_offset = ifd::get_first_ifd_offset<FileReader, TiffFormatType::Classic, std::endian::little>(file_reader);
+        auto ifd = ifd::read_ifd<FileReader, TiffFormatType::Classic, std::endian::little>(
+            file_reader, ifd_offset.value());
+        
+        auto extract_result = metadata.extract<FileReader, TiffFormatType::Classic, std::endian::little>(
+            file_reader, std::span(ifd.value().tags));
+        if (!extract_result.is_ok()) {
+            state.SkipWithError("Failed to extract tags " + extract_result.error().message);
+            return;
+        }
+        
+        extract_result = image_info.update_from_metadata(metadata);
+        if (!extract_result.is_ok()) {
+            state.SkipWithError("Failed to update image info from metadata " + extract_result.error().message);
+            return;
+        }
+        
+        auto region = image_info.shape().full_region();
+        std::vector<T> output(region.num_samples());
+        
+        auto result = reader.template read_region<ImageLayoutSpec::DHWC>(
+            file_reader, metadata, region, output);
+        if (!result.is_ok()) {
+            state.SkipWithError("Failed to read region");
+            return;
+        }
+        
+        benchmark::DoNotOptimize(output);
+        bytes_processed += output.size() * sizeof(T);
+    }
+    
+    state.SetBytesProcessed(bytes_processed);
+    state.SetItemsProcessed(state.iterations());
+}
+
+template <typename T, CompressionType Compression>
+static void BM_LibTIFF_Read_Codec(benchmark::State& state) {
+    // Parameters: width, predictor
+    uint32_t width = state.range(0);
+    PredictorType predictor = static_cast<PredictorType>(state.range(1));
+    
+    TempFileManager temp_mgr;
+    auto filepath = create_codec_file<T>(temp_mgr, width, Compression, predictor);
+    
+    std::size_t bytes_processed = 0;
+    
+    for (auto _ : state) {
+        TIFF* tif = TIFFOpen(filepath.string().c_str(), "r");
+        if (!tif) {
+            state.SkipWithError("Failed to open TIFF file");
+            return;
+        }
+        
+        uint32_t w, h, tile_width, tile_height;
+        TIFFGetField(tif, TIFFTAG_IMAGEWIDTH, &w);
+        TIFFGetField(tif, TIFFTAG_IMAGELENGTH, &h);
+        TIFFGetField(tif, TIFFTAG_TILEWIDTH, &tile_width);
+        TIFFGetField(tif, TIFFTAG_TILELENGTH, &tile_height);
+        
+        std::vector<T> buffer(static_cast<std::size_t>(w) * h);
+        std::vector<T> tile_buffer(static_cast<std::size_t>(tile_width) * tile_height);
+        
+        for (uint32_t y = 0; y < h; y += tile_height) {
+            for (uint32_t x = 0; x < w; x += tile_width) {
+                TIFFReadTile(tif, tile_buffer.data(), x, y, 0, 0);
+                
+                uint32_t th = std::min(tile_height, h - y);
+                uint32_t tw = std::min(tile_width, w - x);
+                for (uint32_t ty = 0; ty < th; ++ty) {
+                    std::memcpy(&buffer[(static_cast<std::size_t>(y) + ty) * w + x],
+                                &tile_buffer[static_cast<std::size_t>(ty) * tile_width],
+                                tw * sizeof(T));
+                }
+            }
+        }
+        
+        TIFFClose(tif);
+        benchmark::DoNotOptimize(buffer);
+        bytes_processed += buffer.size() * sizeof(T);
+    }
+    
+    state.SetBytesProcessed(bytes_processed);
+    state.SetItemsProcessed(state.iterations());
+}
+
+#endif // HAVE_LIBTIFF
+
 #ifdef HAVE_LIBTIFF
 
 // Read Benchmarks
@@ -774,18 +1316,173 @@ static void BM_Read_PartialRegion(benchmark::State& state) {
     state.SetItemsProcessed(state.iterations());
 }
 
-#ifdef HAVE_LIBTIFF
-
-template <typename T>
-static void BM_LibTIFF_Read_PartialRegion(benchmark::State& state) {
-    uint32_t image_width = state.range(0);
-    uint32_t region_width = state.range(1);
-    
-    ImageConfig config{image_width, image_width, 1, 3, 128, 128};
-    StorageConfig storage{false, true, CompressionType::None, PredictorType::None};
+template <typename T, typename ReaderType>
+static void BM_Read_ViewportPan(benchmark::State& state) {
+    // Parameters: tile_cache_mb (0 = no cache)
+    // A 512x512 viewport pans over a ZSTD image by a quarter viewport per
+    // iteration, so that consecutive reads share most of their tiles.
+    const size_t cache_mb = static_cast<size_t>(state.range(0));
+    const uint32_t image_width = 4096;
+    const uint32_t viewport = 512;
+    const uint32_t step = viewport / 4;
+    
+    ImageConfig config{image_width, image_width, 1, 1, 128, 128};
+    StorageConfig storage{false, true, CompressionType::ZSTD, PredictorType::None};
     
     TempFileManager temp_mgr;
-    LibTiffGenerator<T> gen(temp_mgr);
+    TiffGenerator<T> gen(temp_mgr);
+    auto filepath = gen.create_file("read_viewport", config, storage, 1,
+                                    ImagePattern::Gradient);
+    
+    FileReader file_reader(filepath.string());
+    auto ifd_offset = ifd::get_first_ifd_offset<FileReader, TiffFormatType::Classic, std::endian::little>(file_reader);
+    if (!ifd_offset.is_ok()) {
+        state.SkipWithError("Failed to get IFD offset");
+        return;
+    }
+    auto ifd = ifd::read_ifd<FileReader, TiffFormatType::Classic, std::endian::little>(
+        file_reader, ifd_offset.value());
+    if (!ifd.is_ok()) {
+        state.SkipWithError("Failed to read IFD");
+        return;
+    }
+    ExtractedTags<MinTiledSpec> metadata;
+    auto extract_ok = metadata.extract<FileReader, TiffFormatType::Classic, std::endian::little>(
+        file_reader, std::span(ifd.value().tags));
+    if (!extract_ok.is_ok()) {
+        state.SkipWithError("Failed to extract tags");
+        return;
+    }
+    
+    typename ReaderType::Config reader_config;
+    if (cache_mb > 0) {
+        reader_config.tile_cache = std::make_shared<DecodedTileCache<T>>(
+            typename DecodedTileCache<T>::Config{.max_bytes = cache_mb * 1024 * 1024});
+    }
+    ReaderType reader(reader_config);
+    const TileCacheScope scope{0, ifd_offset.value().value};
+    
+    std::vector<T> output(static_cast<size_t>(viewport) * viewport);
+    std::size_t bytes_processed = 0;
+    uint32_t position = 0;
+    
+    for (auto _ : state) {
+        // Diagonal pan, wrapping around the image
+        const uint32_t offset = position * step % (image_width - viewport);
+        ++position;
+        ImageRegion region(0, 0, offset, offset, 1, 1, viewport, viewport);
+        
+        auto result = reader.template read_region<ImageLayoutSpec::DHWC>(
+            file_reader, metadata, region, std::span<T>(output), scope);
+        if (!result.is_ok()) {
+            state.SkipWithError("Failed to read region");
+            return;
+        }
+        benchmark::DoNotOptimize(output.data());
+        bytes_processed += output.size() * sizeof(T);
+    }
+    
+    state.SetBytesProcessed(bytes_processed);
+    state.SetItemsProcessed(state.iterations());
+    if (reader_config.tile_cache) {
+        const auto stats = reader_config.tile_cache->stats();
+        state.counters["tile_hit_rate"] = stats.hits + stats.misses > 0
+            ? static_cast<double>(stats.hits) / static_cast<double>(stats.hits + stats.misses)
+            : 0.0;
+    }
+}
+
+template <typename T, typename ReaderType>
+static void BM_Read_RandomPatches(benchmark::State& state) {
+    // Parameters: batched (0 = one read_region per patch, 1 = read_regions)
+    // 64 random 256x256 patches of a 2048x2048 ZSTD image per iteration, as
+    // requested by a training data loader: patches share many tiles.
+    const bool batched = state.range(0) != 0;
+    const uint32_t image_width = 2048;
+    const uint32_t patch = 256;
+    const size_t num_patches = 64;
+    
+    ImageConfig config{image_width, image_width, 1, 1, 128, 128};
+    StorageConfig storage{false, true, CompressionType::ZSTD, PredictorType::None};
+    
+    TempFileManager temp_mgr;
+    TiffGenerator<T> gen(temp_mgr);
+    auto filepath = gen.create_file("read_patches", config, storage, 1,
+                                    ImagePattern::Gradient);
+    
+    FileReader file_reader(filepath.string());
+    auto ifd_offset = ifd::get_first_ifd_offset<FileReader, TiffFormatType::Classic, std::endian::little>(file_reader);
+    if (!ifd_offset.is_ok()) {
+        state.SkipWithError("Failed to get IFD offset");
+        return;
+    }
+    auto ifd = ifd::read_ifd<FileReader, TiffFormatType::Classic, std::endian::little>(
+        file_reader, ifd_offset.value());
+    if (!ifd.is_ok()) {
+        state.SkipWithError("Failed to read IFD");
+        return;
+    }
+    ExtractedTags<MinTiledSpec> metadata;
+    auto extract_ok = metadata.extract<FileReader, TiffFormatType::Classic, std::endian::little>(
+        file_reader, std::span(ifd.value().tags));
+    if (!extract_ok.is_ok()) {
+        state.SkipWithError("Failed to extract tags");
+        return;
+    }
+    
+    ReaderType reader;
+    std::vector<std::vector<T>> buffers(num_patches, std::vector<T>(static_cast<size_t>(patch) * patch));
+    std::vector<std::span<T>> outputs(buffers.begin(), buffers.end());
+    std::vector<ImageRegion> regions;
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<uint32_t> position(0, image_width - patch);
+    std::size_t bytes_processed = 0;
+    
+    for (auto _ : state) {
+        state.PauseTiming();
+        regions.clear();
+        for (size_t i = 0; i < num_patches; ++i) {
+            regions.emplace_back(0, 0, position(rng), position(rng), 1, 1, patch, patch);
+        }
+        state.ResumeTiming();
+        
+        if (batched) {
+            auto result = reader.template read_regions<ImageLayoutSpec::DHWC>(
+                file_reader, metadata, regions, outputs);
+            if (!result.is_ok()) {
+                state.SkipWithError("Failed to read regions");
+                return;
+            }
+        } else {
+            for (size_t i = 0; i < num_patches; ++i) {
+                auto result = reader.template read_region<ImageLayoutSpec::DHWC>(
+                    file_reader, metadata, regions[i], outputs[i]);
+                if (!result.is_ok()) {
+                    state.SkipWithError("Failed to read region");
+                    return;
+                }
+            }
+        }
+        benchmark::DoNotOptimize(buffers.data());
+        bytes_processed += num_patches * patch * patch * sizeof(T);
+    }
+    
+    state.SetBytesProcessed(bytes_processed);
+    state.SetItemsProcessed(state.iterations() * num_patches);
+}
+
+#ifdef HAVE_LIBTIFF
+
+template <typename T>
+static void BM_LibTIFF_Read_PartialRegion(benchmark::State& state) {
+    uint32_t image_width = state.range(0);
+    uint32_t region_width = state.range(1);
+    
+    ImageConfig config{image_width, image_width, 1, 3, 128, 128};
+    StorageConfig storage{false, true, CompressionType::None, PredictorType::None};
+    
+    TempFileManager temp_mgr;
+    LibTiffGenerator<T> gen(temp_mgr);
     auto filepath = gen.create_file("libtiff_read_partial", config, storage, 1,
                                     ImagePattern::Gradient);
     
@@ -846,6 +1543,191 @@ static void BM_LibTIFF_Read_PartialRegion(benchmark::State& state) {
 }
 #endif // HAVE_LIBTIFF
 
+// ============================================================================
+// Read Benchmarks - Simulated Remote Storage
+// ============================================================================
+
+template <typename T, typename ReaderType>
+static void BM_Read_RemoteBatching(benchmark::State& state) {
+    // Parameters: latency_us, max_batch_kb, max_gap_kb (-1 = AdaptiveBatchPlanner)
+    // A 1024x1024 region (8x8 tiles of 128x128) is read from the center of a
+    // 4096x4096 image behind a SimulatedRemoteReader with 8 connections and
+    // a 1 GB/s link. Tile rows of the region are 384 KiB apart in the file:
+    // only large gaps merge them into a single request.
+    const auto latency = std::chrono::microseconds(state.range(0));
+    const size_t max_batch_size = static_cast<size_t>(state.range(1)) * 1024;
+    const bool adaptive = state.range(2) < 0;
+    const size_t max_gap_size = adaptive ? 0 : static_cast<size_t>(state.range(2)) * 1024;
+    const uint32_t image_width = 4096;
+    const uint32_t region_width = 1024;
+    
+    ImageConfig config{image_width, image_width, 1, 1, 128, 128};
+    StorageConfig storage{false, true, CompressionType::None, PredictorType::None};
+    
+    TempFileManager temp_mgr;
+    TiffGenerator<T> gen(temp_mgr);
+    auto filepath = gen.create_file("read_remote", config, storage, 1,
+                                    ImagePattern::Gradient);
+    
+    // Metadata is read once, locally: only tile data goes through the simulation
+    MmapReader local_reader(filepath.string());
+    auto ifd_offset = ifd::get_first_ifd_offset<MmapReader, TiffFormatType::Classic, std::endian::little>(local_reader);
+    if (!ifd_offset.is_ok()) {
+        state.SkipWithError("Failed to get IFD offset");
+        return;
+    }
+    auto ifd = ifd::read_ifd<MmapReader, TiffFormatType::Classic, std::endian::little>(
+        local_reader, ifd_offset.value());
+    if (!ifd.is_ok()) {
+        state.SkipWithError("Failed to read IFD");
+        return;
+    }
+    ExtractedTags<MinTiledSpec> metadata;
+    auto extract_ok = metadata.extract<MmapReader, TiffFormatType::Classic, std::endian::little>(
+        local_reader, std::span(ifd.value().tags));
+    if (!extract_ok.is_ok()) {
+        state.SkipWithError("Failed to extract tags");
+        return;
+    }
+    
+    SimulatedRemoteReader<MmapReader> remote(
+        std::move(local_reader),
+        {.latency = latency, .bandwidth_bytes_per_second = 1000 * 1000 * 1000, .max_concurrent_requests = 8});
+    
+    typename ReaderType::Config reader_config;
+    reader_config.max_batch_size = max_batch_size;
+    reader_config.max_gap_size = max_gap_size;
+    if (adaptive) {
+        reader_config.batch_planner = std::make_shared<AdaptiveBatchPlanner>(
+            AdaptiveBatchPlanner::Config{.concurrency = 8});
+    }
+    ReaderType reader(reader_config);
+    
+    const uint32_t offset = (image_width - region_width) / 2;
+    ImageRegion region(0, 0, offset, offset, 1, 1, region_width, region_width);
+    std::vector<T> output(region.num_samples());
+    std::size_t bytes_processed = 0;
+    
+    for (auto _ : state) {
+        auto result = reader.template read_region<ImageLayoutSpec::DHWC>(
+            remote, metadata, region, std::span<T>(output));
+        if (!result.is_ok()) {
+            state.SkipWithError("Failed to read region");
+            return;
+        }
+        benchmark::DoNotOptimize(output.data());
+        bytes_processed += output.size() * sizeof(T);
+    }
+    
+    const BatchIoStats stats = reader.io_stats();
+    state.SetBytesProcessed(bytes_processed);
+    state.SetItemsProcessed(state.iterations());
+    state.counters["requests"] = benchmark::Counter(
+        static_cast<double>(stats.requests), benchmark::Counter::kAvgIterations);
+    state.counters["amplification"] = stats.amplification();
+}
+
+template <typename T, typename ReaderType>
+static void BM_Read_PageStack(benchmark::State& state) {
+    // Parameters: latency_us, stacked (0 = one read_region per page, 1 = read_pages)
+    // The same 256x256 region (2x2 tiles of 128x128) of the 32 pages of a
+    // z-stack is read behind a SimulatedRemoteReader with 8 connections.
+    const auto latency = std::chrono::microseconds(state.range(0));
+    const bool stacked = state.range(1) != 0;
+    const uint32_t num_pages = 32;
+    const uint32_t region_width = 256;
+    
+    ImageConfig config{512, 512, 1, 1, 128, 128};
+    StorageConfig storage{false, true, CompressionType::None, PredictorType::None};
+    
+    TempFileManager temp_mgr;
+    TiffGenerator<T> gen(temp_mgr);
+    auto filepath = gen.create_file("read_stack", config, storage, 1,
+                                    ImagePattern::Gradient);
+    
+    // Metadata is read once, locally
+    MmapReader local_reader(filepath.string());
+    auto ifd_offset = ifd::get_first_ifd_offset<MmapReader, TiffFormatType::Classic, std::endian::little>(local_reader);
+    if (!ifd_offset.is_ok()) {
+        state.SkipWithError("Failed to get IFD offset");
+        return;
+    }
+    auto ifd = ifd::read_ifd<MmapReader, TiffFormatType::Classic, std::endian::little>(
+        local_reader, ifd_offset.value());
+    if (!ifd.is_ok()) {
+        state.SkipWithError("Failed to read IFD");
+        return;
+    }
+    ExtractedTags<MinTiledSpec> metadata;
+    auto extract_ok = metadata.extract<MmapReader, TiffFormatType::Classic, std::endian::little>(
+        local_reader, std::span(ifd.value().tags));
+    if (!extract_ok.is_ok()) {
+        state.SkipWithError("Failed to extract tags");
+        return;
+    }
+    
+    // The stack is laid out as consecutive copies of the page (the generator
+    // writes a single page per file), each with its own tile offsets
+    auto file_size = local_reader.size();
+    if (!file_size.is_ok()) {
+        state.SkipWithError("Failed to get file size");
+        return;
+    }
+    auto file_view = local_reader.read(0, file_size.value());
+    if (!file_view.is_ok()) {
+        state.SkipWithError("Failed to read file");
+        return;
+    }
+    std::vector<std::byte> stack_data;
+    stack_data.reserve(file_size.value() * num_pages);
+    std::vector<ExtractedTags<MinTiledSpec>> pages(num_pages, metadata);
+    for (uint32_t page = 0; page < num_pages; ++page) {
+        stack_data.insert(stack_data.end(), file_view.value().data().begin(), file_view.value().data().end());
+        for (auto& tile_offset : pages[page].template get<TagCode::TileOffsets>()) {
+            tile_offset += static_cast<uint32_t>(page * file_size.value());
+        }
+    }
+    
+    SimulatedRemoteReader<BufferReader> remote(
+        BufferReader(std::span<const std::byte>(stack_data)),
+        {.latency = latency, .bandwidth_bytes_per_second = 1000 * 1000 * 1000, .max_concurrent_requests = 8});
+    ReaderType reader;
+    
+    const uint32_t offset = (config.width - region_width) / 2;
+    ImageRegion region(0, 0, offset, offset, 1, 1, region_width, region_width);
+    std::vector<T> output(region.num_samples() * num_pages);
+    std::size_t bytes_processed = 0;
+    
+    for (auto _ : state) {
+        if (stacked) {
+            auto result = reader.template read_pages<ImageLayoutSpec::DHWC>(
+                remote, std::span<const ExtractedTags<MinTiledSpec>>(pages), region, std::span<T>(output));
+            if (!result.is_ok()) {
+                state.SkipWithError("Failed to read pages");
+                return;
+            }
+        } else {
+            for (uint32_t page = 0; page < num_pages; ++page) {
+                auto result = reader.template read_region<ImageLayoutSpec::DHWC>(
+                    remote, pages[page], region,
+                    std::span<T>(output).subspan(page * region.num_samples(), region.num_samples()));
+                if (!result.is_ok()) {
+                    state.SkipWithError("Failed to read region");
+                    return;
+                }
+            }
+        }
+        benchmark::DoNotOptimize(output.data());
+        bytes_processed += output.size() * sizeof(T);
+    }
+    
+    const BatchIoStats stats = reader.io_stats();
+    state.SetBytesProcessed(bytes_processed);
+    state.SetItemsProcessed(state.iterations() * num_pages);
+    state.counters["requests"] = benchmark::Counter(
+        static_cast<double>(stats.requests), benchmark::Counter::kAvgIterations);
+}
+
 // ============================================================================
 // Read Benchmarks - 3D Volumes
 // ============================================================================
@@ -1053,6 +1935,154 @@ static void BM_LibTIFF_Read_MultiPage(benchmark::State& state) {
 }
 #endif // HAVE_LIBTIFF
 
+// ============================================================================
+// Write Benchmarks - Encoder Scaling
+// ============================================================================
+
+template <typename T>
+static void BM_Write_EncoderScaling(benchmark::State& state) {
+    // Parameters: width, encoder threads
+    // ZSTD + horizontal predictor into memory, so that encoding dominates
+    uint32_t width = state.range(0);
+    std::size_t encoder_threads = static_cast<std::size_t>(state.range(1));
+    
+    using CompSpec = CompressorSpec<NoneCompressorDesc, ZstdCompressorDesc>;
+    using Config = WriteConfig<IFDAtEnd, ImageOrderTiles, DirectWrite<BufferWriter>, LazyOffsets>;
+    using WriterType = ImageWriter<T, CompSpec, Config>;
+    
+    ImageConfig config{width, width, 1, 1, 256, 256};
+    ImageGenerator<T> image_gen;
+    auto image = image_gen.generate_random(config);
+    
+    WriterType writer(typename WriterType::Config{.encoder_threads = encoder_threads});
+    
+    for (auto _ : state) {
+        BufferWriter buffer_writer;
+        auto result = writer.template write_image<ImageLayoutSpec::DHWC>(
+            buffer_writer, std::span<const T>(image),
+            width, width, 1, 256, 256, 1, 1,
+            PlanarConfiguration::Chunky, CompressionScheme::ZSTD, Predictor::Horizontal, 0
+        );
+        if (!result.is_ok()) {
+            state.SkipWithError("Write failed " + result.error().message);
+            return;
+        }
+        benchmark::DoNotOptimize(buffer_writer);
+    }
+    
+    state.SetBytesProcessed(state.iterations() * image.size() * sizeof(T));
+    state.SetItemsProcessed(state.iterations());
+    state.counters["threads"] = static_cast<double>(encoder_threads);
+}
+
+// ============================================================================
+// Write Benchmarks - Codecs (Deflate, LZW)
+// ============================================================================
+
+template <typename T, typename CompSpec, CompressionScheme Scheme>
+static void BM_Write_Codec(benchmark::State& state) {
+    // Parameters: width, predictor
+    uint32_t width = state.range(0);
+    Predictor predictor = state.range(1) ? Predictor::Horizontal : Predictor::None;
+    
+    using Config = WriteConfig<IFDAtEnd, ImageOrderTiles, DirectWrite<StreamFileWriter>, TwoPassOffsets>;
+    using WriterType = TiffWriter<T, CompSpec, Config, TiffFormatType::Classic, std::endian::little>;
+    
+    ImageConfig config{width, width, 1, 1, 256, 256};
+    ImageGenerator<T> image_gen;
+    auto image = image_gen.generate_gradient(config);
+    
+    TempFileManager temp_mgr;
+    
+    ExtractedTags<PhotometricInterpretationTag> tags;
+    tags.template get<TagCode::PhotometricInterpretation>() = PhotometricInterpretation::MinIsBlack;
+    
+    // Writer reused across iterations: the codec context of the encoder is reused
+    WriterType writer;
+    std::size_t file_size = 0;
+    
+    for (auto _ : state) {
+        auto filepath = temp_mgr.get_temp_path("write_codec");
+        {
+            StreamFileWriter file_writer(filepath.string());
+            auto result = writer.template write_single_image<ImageLayoutSpec::DHWC>(
+                file_writer, std::span<const T>(image),
+                width, width, 256, 256, 1,
+                PlanarConfiguration::Chunky, Scheme, predictor, tags);
+            if (!result.is_ok()) {
+                state.SkipWithError("Write failed " + result.error().message);
+                return;
+            }
+        }
+        file_size = std::filesystem::file_size(filepath);
+    }
+    
+    state.SetBytesProcessed(state.iterations() * image.size() * sizeof(T));
+    state.SetItemsProcessed(state.iterations());
+    state.counters["ratio"] = static_cast<double>(image.size() * sizeof(T)) / static_cast<double>(file_size);
+}
+
+#ifdef HAVE_LIBTIFF
+
+template <typename T>
+static void BM_LibTIFF_Write_Codec(benchmark::State& state) {
+    // Parameters: width, predictor, libtiff compression code
+    uint32_t width = state.range(0);
+    bool use_predictor = state.range(1) != 0;
+    int compression = static_cast<int>(state.range(2));
+    
+    ImageConfig config{width, width, 1, 1, 256, 256};
+    ImageGenerator<T> gen;
+    auto image_data = gen.generate_gradient(config);
+    
+    TempFileManager temp_mgr;
+    std::vector<T> tile_buffer(static_cast<std::size_t>(config.tile_width) * config.tile_height);
+    std::size_t file_size = 0;
+    
+    for (auto _ : state) {
+        auto filepath = temp_mgr.get_temp_path("libtiff_write_codec");
+        TIFF* tif = TIFFOpen(filepath.string().c_str(), "w");
+        if (!tif) {
+            state.SkipWithError("Failed to open TIFF file");
+            return;
+        }
+        
+        TIFFSetField(tif, TIFFTAG_IMAGEWIDTH, config.width);
+        TIFFSetField(tif, TIFFTAG_IMAGELENGTH, config.height);
+        TIFFSetField(tif, TIFFTAG_SAMPLESPERPIXEL, 1);
+        TIFFSetField(tif, TIFFTAG_BITSPERSAMPLE, sizeof(T) * 8);
+        TIFFSetField(tif, TIFFTAG_COMPRESSION, compression);
+        TIFFSetField(tif, TIFFTAG_PREDICTOR, use_predictor ? PREDICTOR_HORIZONTAL : PREDICTOR_NONE);
+        TIFFSetField(tif, TIFFTAG_PHOTOMETRIC, PHOTOMETRIC_MINISBLACK);
+        TIFFSetField(tif, TIFFTAG_TILEWIDTH, config.tile_width);
+        TIFFSetField(tif, TIFFTAG_TILELENGTH, config.tile_height);
+        TIFFSetField(tif, TIFFTAG_PLANARCONFIG, PLANARCONFIG_CONTIG);
+        
+        for (uint32_t y = 0; y < config.height; y += config.tile_height) {
+            for (uint32_t x = 0; x < config.width; x += config.tile_width) {
+                uint32_t th = std::min(config.tile_height, config.height - y);
+                uint32_t tw = std::min(config.tile_width, config.width - x);
+                std::fill(tile_buffer.begin(), tile_buffer.end(), T{});
+                for (uint32_t ty = 0; ty < th; ++ty) {
+                    std::memcpy(&tile_buffer[static_cast<std::size_t>(ty) * config.tile_width],
+                                &image_data[(static_cast<std::size_t>(y) + ty) * config.width + x],
+                                tw * sizeof(T));
+                }
+                TIFFWriteTile(tif, tile_buffer.data(), x, y, 0, 0);
+            }
+        }
+        
+        TIFFClose(tif);
+        file_size = std::filesystem::file_size(filepath);
+    }
+    
+    state.SetBytesProcessed(state.iterations() * image_data.size() * sizeof(T));
+    state.SetItemsProcessed(state.iterations());
+    state.counters["ratio"] = static_cast<double>(image_data.size() * sizeof(T)) / static_cast<double>(file_size);
+}
+
+#endif // HAVE_LIBTIFF
+
 // ============================================================================
 // Write Benchmarks - Size and Channel Variations
 // ============================================================================
@@ -1192,16 +2222,111 @@ static void BM_LibTIFF_Write_MultiPage(benchmark::State& state) {
 #endif // HAVE_LIBTIFF
 
 
+// ============================================================================
+// Predictor Benchmarks
+// ============================================================================
+
+template <typename T, std::size_t SamplesPerPixel>
+static void BM_Predictor_DecodeHorizontal(benchmark::State& state) {
+    // Parameters: width, SIMD level limit (0 = scalar, 1 = SSE2, 2 = AVX2)
+    // One 256-row tile, decoded in place (the values drift, the work does not)
+    std::size_t width = static_cast<std::size_t>(state.range(0));
+    auto limit = static_cast<cpu::SimdLevel>(state.range(1));
+    if (limit > cpu::detected_simd_level()) {
+        state.SkipWithError("SIMD level not supported by this CPU");
+        return;
+    }
+    
+    const std::size_t height = 256;
+    const std::size_t stride = width * SamplesPerPixel;
+    ImageConfig config{static_cast<uint32_t>(width), static_cast<uint32_t>(height), 1,
+                       static_cast<uint16_t>(SamplesPerPixel), 256, 256};
+    ImageGenerator<T> image_gen;
+    auto data = image_gen.generate_random(config);
+    
+    cpu::set_simd_level_limit(limit);
+    for (auto _ : state) {
+        predictor::delta_decode_horizontal(std::span<T>(data), width, height, stride, SamplesPerPixel);
+        benchmark::DoNotOptimize(data.data());
+        benchmark::ClobberMemory();
+    }
+    cpu::set_simd_level_limit(cpu::SimdLevel::AVX2);
+    
+    state.SetBytesProcessed(state.iterations() * data.size() * sizeof(T));
+}
+
+template <typename T, std::size_t SamplesPerPixel, bool Encode>
+static void BM_Predictor_FloatingPoint(benchmark::State& state) {
+    // Parameters: width, SIMD level limit (0 = scalar, 1 = SSE2, 2 = AVX2)
+    // One 256-row tile, transformed in place (the values drift, the work does not)
+    std::size_t width = static_cast<std::size_t>(state.range(0));
+    auto limit = static_cast<cpu::SimdLevel>(state.range(1));
+    if (limit > cpu::detected_simd_level()) {
+        state.SkipWithError("SIMD level not supported by this CPU");
+        return;
+    }
+    
+    const std::size_t height = 256;
+    const std::size_t stride = width * SamplesPerPixel;
+    ImageConfig config{static_cast<uint32_t>(width), static_cast<uint32_t>(height), 1,
+                       static_cast<uint16_t>(SamplesPerPixel), 256, 256};
+    ImageGenerator<T> image_gen;
+    auto data = image_gen.generate_random(config);
+    
+    cpu::set_simd_level_limit(limit);
+    for (auto _ : state) {
+        if constexpr (Encode) {
+            predictor::delta_encode_floating_point(std::span<T>(data), width, height, stride, SamplesPerPixel);
+        } else {
+            predictor::delta_decode_floating_point(std::span<T>(data), width, height, stride, SamplesPerPixel);
+        }
+        benchmark::DoNotOptimize(data.data());
+        benchmark::ClobberMemory();
+    }
+    cpu::set_simd_level_limit(cpu::SimdLevel::AVX2);
+    
+    state.SetBytesProcessed(state.iterations() * data.size() * sizeof(T));
+}
+
+template <typename T>
+static void BM_ByteSwap(benchmark::State& state) {
+    // Parameters: width, SIMD level limit (0 = scalar, 1 = SSE2, 2 = AVX2)
+    // One 256-row single channel tile, swapped in place
+    std::size_t width = static_cast<std::size_t>(state.range(0));
+    auto limit = static_cast<cpu::SimdLevel>(state.range(1));
+    if (limit > cpu::detected_simd_level()) {
+        state.SkipWithError("SIMD level not supported by this CPU");
+        return;
+    }
+    
+    ImageConfig config{static_cast<uint32_t>(width), 256, 1, 1, 256, 256};
+    ImageGenerator<T> image_gen;
+    auto data = image_gen.generate_random(config);
+    
+    cpu::set_simd_level_limit(limit);
+    for (auto _ : state) {
+        byteswap_array(std::span<T>(data));
+        benchmark::DoNotOptimize(data.data());
+        benchmark::ClobberMemory();
+    }
+    cpu::set_simd_level_limit(cpu::SimdLevel::AVX2);
+    
+    state.SetBytesProcessed(state.iterations() * data.size() * sizeof(T));
+}
+
 // ============================================================================
 // Benchmark Registration
 // ============================================================================
 
 // Metadata Parsing - Single Page. does not depend much on image size
-// Params: width, format, endianness
+// Params: width, format, endianness, speculative
 BENCHMARK(BM_Metadata_ParseIFD_SinglePage)
-    ->Args({512, 0, 0})      // 512x512, Classic, Little
-    ->Args({512, 1, 0})   // 512x512, BigTIFF, Little
-    ->Args({512, 1, 1})   // 512x512, BigTIFF, Big
+    ->Args({512, 0, 0, 0})   // 512x512, Classic, Little
+    ->Args({512, 0, 0, 1})   // 512x512, Classic, Little, single read
+    ->Args({512, 1, 0, 0})   // 512x512, BigTIFF, Little
+    ->Args({512, 1, 0, 1})   // 512x512, BigTIFF, Little, single read
+    ->Args({512, 1, 1, 0})   // 512x512, BigTIFF, Big
+    ->Args({512, 1, 1, 1})   // 512x512, BigTIFF, Big, single read
     ->Name("TiffConcept/Metadata/ParseIFD/SinglePage")
     ->Unit(benchmark::kMicrosecond);
 
@@ -1275,6 +2400,54 @@ BENCHMARK(BM_LibTIFF_Metadata_ExtractAllPages)
 
 #endif // HAVE_LIBTIFF
 
+// Metadata - IFD chain walk (simulated remote storage)
+// Params: latency_us, speculative
+BENCHMARK(BM_Metadata_WalkIFDChain)
+    ->Args({0, 0})
+    ->Args({0, 1})
+    ->Args({200, 0})      // Local network storage
+    ->Args({200, 1})
+    ->Args({2000, 0})     // Object store
+    ->Args({2000, 1})
+    ->Name("TiffConcept/Metadata/WalkIFDChain")
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+// Metadata - random page access (simulated remote storage)
+// Params: latency_us, indexed
+BENCHMARK(BM_Metadata_RandomPage)
+    ->Args({0, 0})
+    ->Args({0, 1})
+    ->Args({200, 0})      // Local network storage
+    ->Args({200, 1})
+    ->Name("TiffConcept/Metadata/RandomPage")
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+// Metadata - tag extraction (simulated remote storage)
+// Params: latency_us
+BENCHMARK(BM_Metadata_ExtractTags_Remote)
+    ->Arg(0)
+    ->Arg(200)            // Local network storage
+    ->Arg(2000)           // Object store
+    ->Name("TiffConcept/Metadata/ExtractTags/Remote")
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+// Metadata - tile array extraction (vectors vs lazy views)
+// Params: width
+BENCHMARK_TEMPLATE(BM_Metadata_ExtractTags_TileArrays, MinTiledSpec)
+    ->Arg(1024)           // 4096 tiles
+    ->Arg(4096)           // 65536 tiles
+    ->Name("TiffConcept/Metadata/ExtractTags/TileArrays/Vector")
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_TEMPLATE(BM_Metadata_ExtractTags_TileArrays, MinTiledViewSpec)
+    ->Arg(1024)
+    ->Arg(4096)
+    ->Name("TiffConcept/Metadata/ExtractTags/TileArrays/View")
+    ->Unit(benchmark::kMicrosecond);
+
 // Read - Size Variations
 // Params: width, channels, compression, endianness
 
@@ -1353,6 +2526,30 @@ BENCHMARK(BM_Read_SizeVariation<uint16_t, FastReaderType<uint16_t, DecompressorS
 #endif // HAVE_LIBURING || _WIN32
 
 
+// Read - Worker Scaling
+// Params: width, worker threads
+BENCHMARK(BM_Read_WorkerScaling<uint8_t, CPULimitedReaderType<uint8_t, DecompressorSpec<NoneDecompressorDesc, ZstdDecompressorDesc>>>)
+    ->ArgsProduct({{8192}, {1, 2, 4, 8, 16}})
+    ->Name("TiffConcept/Read/CPULimitedReader/WorkerScaling/uint8")
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+#if defined(HAVE_LIBURING) || defined(_WIN32)
+BENCHMARK(BM_Read_WorkerScaling<uint8_t, FastReaderType<uint8_t, DecompressorSpec<NoneDecompressorDesc, ZstdDecompressorDesc>>>)
+    ->ArgsProduct({{8192}, {1, 2, 4, 8, 16}})
+    ->Name("TiffConcept/Read/FastReader/WorkerScaling/uint8")
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+// Read - Concurrent callers sharing one file reader
+// Params: width, concurrent callers
+BENCHMARK(BM_Read_ConcurrentCallers<uint8_t, FastReaderType<uint8_t, DecompressorSpec<NoneDecompressorDesc>>>)
+    ->ArgsProduct({{4096}, {1, 2, 4, 8}})
+    ->Name("TiffConcept/Read/FastReader/ConcurrentCallers/uint8")
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+#endif // HAVE_LIBURING || _WIN32
+
 #ifdef HAVE_LIBTIFF
 // Read - Size Variations
 BENCHMARK(BM_LibTIFF_Read_SizeVariation<uint8_t>)
@@ -1373,6 +2570,56 @@ BENCHMARK(BM_LibTIFF_Read_SizeVariation<uint16_t>)
     ->Unit(benchmark::kMillisecond);
 #endif // HAVE_LIBTIFF
 
+#if defined(HAVE_LIBTIFF) && defined(HAVE_ZLIB)
+// Read - Deflate
+BENCHMARK(BM_Read_Codec<uint8_t, SimpleReaderType<uint8_t, DecompressorSpec<NoneDecompressorDesc, DeflateDecompressorDesc>>, CompressionType::Deflate>)
+    ->Args({2048, 0})          // 2048x2048, no predictor
+    ->Args({2048, 1})          // 2048x2048, horizontal predictor
+    ->Args({8192, 1})          // 8192x8192, horizontal predictor
+    ->Name("TiffConcept/Read/SimpleReader/Deflate/uint8")
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_Read_Codec<uint8_t, CPULimitedReaderType<uint8_t, DecompressorSpec<NoneDecompressorDesc, DeflateDecompressorDesc>>, CompressionType::Deflate>)
+    ->Args({2048, 0})
+    ->Args({2048, 1})
+    ->Args({8192, 1})
+    ->Name("TiffConcept/Read/CPULimitedReader/Deflate/uint8")
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_LibTIFF_Read_Codec<uint8_t, CompressionType::Deflate>)
+    ->Args({2048, 0})
+    ->Args({2048, 1})
+    ->Args({8192, 1})
+    ->Name("LibTIFF/Read/Deflate/uint8")
+    ->Unit(benchmark::kMillisecond);
+#endif // HAVE_LIBTIFF && HAVE_ZLIB
+
+#ifdef HAVE_LIBTIFF
+// Read - LZW
+BENCHMARK(BM_Read_Codec<uint8_t, SimpleReaderType<uint8_t, DecompressorSpec<NoneDecompressorDesc, LZWDecompressorDesc>>, CompressionType::LZW>)
+    ->Args({2048, 0})          // 2048x2048, no predictor
+    ->Args({2048, 1})          // 2048x2048, horizontal predictor
+    ->Args({8192, 1})          // 8192x8192, horizontal predictor
+    ->Name("TiffConcept/Read/SimpleReader/LZW/uint8")
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_Read_Codec<uint8_t, CPULimitedReaderType<uint8_t, DecompressorSpec<NoneDecompressorDesc, LZWDecompressorDesc>>, CompressionType::LZW>)
+    ->Args({2048, 0})
+    ->Args({2048, 1})
+    ->Args({8192, 1})
+    ->Name("TiffConcept/Read/CPULimitedReader/LZW/uint8")
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_LibTIFF_Read_Codec<uint8_t, CompressionType::LZW>)
+    ->Args({2048, 0})
+    ->Args({2048, 1})
+    ->Args({8192, 1})
+    ->Name("LibTIFF/Read/LZW/uint8")
+    ->Unit(benchmark::kMillisecond);
+#endif // HAVE_LIBTIFF
+
 
 // Read - Partial Regions
 // Params: image_width, region_width
@@ -1411,6 +2658,34 @@ BENCHMARK(BM_Read_PartialRegion<uint8_t, FastReaderType<uint8_t, DecompressorSpe
     ->Unit(benchmark::kMillisecond);
 #endif // HAVE_LIBURING || _WIN32
 
+BENCHMARK(BM_Read_ViewportPan<uint8_t, CPULimitedReaderType<uint8_t, DecompressorSpec<NoneDecompressorDesc, ZstdDecompressorDesc>>>)
+    ->Arg(0)     // No tile cache
+    ->Arg(256)   // 256 MiB decoded-tile cache
+    ->Name("TiffConcept/Read/CPULimitedReader/ViewportPan/uint8")
+    ->Unit(benchmark::kMillisecond);
+
+#if defined(HAVE_LIBURING) || defined(_WIN32)
+BENCHMARK(BM_Read_ViewportPan<uint8_t, FastReaderType<uint8_t, DecompressorSpec<NoneDecompressorDesc, ZstdDecompressorDesc>>>)
+    ->Arg(0)     // No tile cache
+    ->Arg(256)   // 256 MiB decoded-tile cache
+    ->Name("TiffConcept/Read/FastReader/ViewportPan/uint8")
+    ->Unit(benchmark::kMillisecond);
+#endif // HAVE_LIBURING || _WIN32
+
+BENCHMARK(BM_Read_RandomPatches<uint8_t, CPULimitedReaderType<uint8_t, DecompressorSpec<NoneDecompressorDesc, ZstdDecompressorDesc>>>)
+    ->Arg(0)     // read_region per patch
+    ->Arg(1)     // read_regions (shared tiles decoded once)
+    ->Name("TiffConcept/Read/CPULimitedReader/RandomPatches/uint8")
+    ->Unit(benchmark::kMillisecond);
+
+#if defined(HAVE_LIBURING) || defined(_WIN32)
+BENCHMARK(BM_Read_RandomPatches<uint8_t, FastReaderType<uint8_t, DecompressorSpec<NoneDecompressorDesc, ZstdDecompressorDesc>>>)
+    ->Arg(0)     // read_region per patch
+    ->Arg(1)     // read_regions (shared tiles decoded once, batched together)
+    ->Name("TiffConcept/Read/FastReader/RandomPatches/uint8")
+    ->Unit(benchmark::kMillisecond);
+#endif // HAVE_LIBURING || _WIN32
+
 
 #ifdef HAVE_LIBTIFF
 // Read - Partial Regions
@@ -1423,6 +2698,54 @@ BENCHMARK(BM_LibTIFF_Read_PartialRegion<uint8_t>)
 #endif // HAVE_LIBTIFF
 
 
+// Read - Simulated remote storage: batching sweep
+// Params: latency_us, max_batch_kb, max_gap_kb
+
+static void RemoteBatchingArgs(benchmark::internal::Benchmark* b) {
+    for (int64_t latency_us : {1000, 20000}) {          // NAS, object store
+        for (int64_t batch_kb : {64, 1024, 4096, 16384}) {
+            for (int64_t gap_kb : {0, 64, 512, -1}) {       // -1 = adaptive
+                b->Args({latency_us, batch_kb, gap_kb});
+            }
+        }
+    }
+}
+
+BENCHMARK(BM_Read_RemoteBatching<uint8_t, IOLimitedReaderType<uint8_t, DecompressorSpec<NoneDecompressorDesc>>>)
+    ->Apply(RemoteBatchingArgs)
+    ->Name("TiffConcept/Read/IOLimitedReader/RemoteBatching/uint8")
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+BENCHMARK(BM_Read_RemoteBatching<uint8_t, FastReaderType<uint8_t, DecompressorSpec<NoneDecompressorDesc>>>)
+    ->Apply(RemoteBatchingArgs)
+    ->Name("TiffConcept/Read/FastReader/RemoteBatching/uint8")
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+// Read - Page Stacks (simulated remote storage)
+// Params: latency_us, stacked
+static void PageStackArgs(benchmark::internal::Benchmark* b) {
+    for (int64_t latency_us : {1000, 20000}) {
+        for (int64_t stacked : {0, 1}) {
+            b->Args({latency_us, stacked});
+        }
+    }
+}
+
+BENCHMARK(BM_Read_PageStack<uint8_t, IOLimitedReaderType<uint8_t, DecompressorSpec<NoneDecompressorDesc>>>)
+    ->Apply(PageStackArgs)
+    ->Name("TiffConcept/Read/IOLimitedReader/PageStack/uint8")
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+BENCHMARK(BM_Read_PageStack<uint8_t, FastReaderType<uint8_t, DecompressorSpec<NoneDecompressorDesc>>>)
+    ->Apply(PageStackArgs)
+    ->Name("TiffConcept/Read/FastReader/PageStack/uint8")
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+
 // Read - 3D Volumes
 // Params: xy_size, depth
 
@@ -1535,6 +2858,147 @@ BENCHMARK(BM_LibTIFF_Read_MultiPage<uint8_t>)
     ->Name("LibTIFF/Read/MultiPage/uint8")
     ->Unit(benchmark::kMillisecond);
 #endif // HAVE_LIBTIFF
+// Write - Encoder Scaling
+// Params: width, encoder threads
+BENCHMARK(BM_Write_EncoderScaling<uint8_t>)
+    ->ArgsProduct({{8192}, {1, 2, 4, 8, 16}})
+    ->Name("TiffConcept/Write/EncoderScaling/uint8")
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+// Write - Codecs
+// Params: width, predictor
+BENCHMARK(BM_Write_Codec<uint8_t, CompressorSpec<NoneCompressorDesc, LZWCompressorDesc>, CompressionScheme::LZW>)
+    ->ArgsProduct({{2048}, {0, 1}})
+    ->Name("TiffConcept/Write/LZW/uint8")
+    ->Unit(benchmark::kMillisecond);
+
+#ifdef HAVE_ZLIB
+BENCHMARK(BM_Write_Codec<uint8_t, CompressorSpec<NoneCompressorDesc, DeflateCompressorDescWithLevel<1>>, CompressionScheme::Deflate_Adobe>)
+    ->ArgsProduct({{2048}, {0, 1}})
+    ->Name("TiffConcept/Write/Deflate1/uint8")
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_Write_Codec<uint8_t, CompressorSpec<NoneCompressorDesc, DeflateCompressorDesc>, CompressionScheme::Deflate_Adobe>)
+    ->ArgsProduct({{2048}, {0, 1}})
+    ->Name("TiffConcept/Write/Deflate6/uint8")
+    ->Unit(benchmark::kMillisecond);
+#endif // HAVE_ZLIB
+
+#ifdef HAVE_LIBTIFF
+// Params: width, predictor, compression (libtiff defaults: Deflate level 6)
+BENCHMARK(BM_LibTIFF_Write_Codec<uint8_t>)
+    ->ArgsProduct({{2048}, {0, 1}, {COMPRESSION_LZW}})
+    ->Name("LibTIFF/Write/LZW/uint8")
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_LibTIFF_Write_Codec<uint8_t>)
+    ->ArgsProduct({{2048}, {0, 1}, {COMPRESSION_ADOBE_DEFLATE}})
+    ->Name("LibTIFF/Write/Deflate6/uint8")
+    ->Unit(benchmark::kMillisecond);
+#endif // HAVE_LIBTIFF
+
+// Predictor - Horizontal decode, one 256-row tile
+// Params: width, SIMD level limit (0 = scalar, 1 = SSE2, 2 = AVX2)
+BENCHMARK(BM_Predictor_DecodeHorizontal<uint8_t, 1>)
+    ->ArgsProduct({{256}, {0, 1, 2}})
+    ->Name("TiffConcept/Predictor/DecodeHorizontal/uint8/1ch")
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(BM_Predictor_DecodeHorizontal<uint8_t, 2>)
+    ->ArgsProduct({{256}, {0, 1, 2}})
+    ->Name("TiffConcept/Predictor/DecodeHorizontal/uint8/2ch")
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(BM_Predictor_DecodeHorizontal<uint8_t, 3>)
+    ->ArgsProduct({{256}, {0, 1, 2}})
+    ->Name("TiffConcept/Predictor/DecodeHorizontal/uint8/3ch")
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(BM_Predictor_DecodeHorizontal<uint8_t, 4>)
+    ->ArgsProduct({{256}, {0, 1, 2}})
+    ->Name("TiffConcept/Predictor/DecodeHorizontal/uint8/4ch")
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(BM_Predictor_DecodeHorizontal<uint16_t, 1>)
+    ->ArgsProduct({{256}, {0, 1, 2}})
+    ->Name("TiffConcept/Predictor/DecodeHorizontal/uint16/1ch")
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(BM_Predictor_DecodeHorizontal<uint16_t, 2>)
+    ->ArgsProduct({{256}, {0, 1, 2}})
+    ->Name("TiffConcept/Predictor/DecodeHorizontal/uint16/2ch")
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(BM_Predictor_DecodeHorizontal<uint16_t, 3>)
+    ->ArgsProduct({{256}, {0, 1, 2}})
+    ->Name("TiffConcept/Predictor/DecodeHorizontal/uint16/3ch")
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(BM_Predictor_DecodeHorizontal<uint16_t, 4>)
+    ->ArgsProduct({{256}, {0, 1, 2}})
+    ->Name("TiffConcept/Predictor/DecodeHorizontal/uint16/4ch")
+    ->Unit(benchmark::kMicrosecond);
+
+// Predictor - Floating point decode/encode, one 256-row tile
+// Params: width, SIMD level limit (0 = scalar, 1 = SSE2, 2 = AVX2)
+BENCHMARK(BM_Predictor_FloatingPoint<float, 1, false>)
+    ->ArgsProduct({{256}, {0, 1, 2}})
+    ->Name("TiffConcept/Predictor/DecodeFloatingPoint/float32/1ch")
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(BM_Predictor_FloatingPoint<float, 3, false>)
+    ->ArgsProduct({{256}, {0, 1, 2}})
+    ->Name("TiffConcept/Predictor/DecodeFloatingPoint/float32/3ch")
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(BM_Predictor_FloatingPoint<double, 1, false>)
+    ->ArgsProduct({{256}, {0, 1, 2}})
+    ->Name("TiffConcept/Predictor/DecodeFloatingPoint/float64/1ch")
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(BM_Predictor_FloatingPoint<double, 3, false>)
+    ->ArgsProduct({{256}, {0, 1, 2}})
+    ->Name("TiffConcept/Predictor/DecodeFloatingPoint/float64/3ch")
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(BM_Predictor_FloatingPoint<float, 1, true>)
+    ->ArgsProduct({{256}, {0, 1, 2}})
+    ->Name("TiffConcept/Predictor/EncodeFloatingPoint/float32/1ch")
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(BM_Predictor_FloatingPoint<float, 3, true>)
+    ->ArgsProduct({{256}, {0, 1, 2}})
+    ->Name("TiffConcept/Predictor/EncodeFloatingPoint/float32/3ch")
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(BM_Predictor_FloatingPoint<double, 1, true>)
+    ->ArgsProduct({{256}, {0, 1, 2}})
+    ->Name("TiffConcept/Predictor/EncodeFloatingPoint/float64/1ch")
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(BM_Predictor_FloatingPoint<double, 3, true>)
+    ->ArgsProduct({{256}, {0, 1, 2}})
+    ->Name("TiffConcept/Predictor/EncodeFloatingPoint/float64/3ch")
+    ->Unit(benchmark::kMicrosecond);
+
+// Byte order conversion of one 256-row tile
+// Params: width, SIMD level limit (0 = scalar, 1 = SSE2, 2 = AVX2)
+BENCHMARK(BM_ByteSwap<uint16_t>)
+    ->ArgsProduct({{256}, {0, 1, 2}})
+    ->Name("TiffConcept/ByteSwap/uint16")
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(BM_ByteSwap<uint32_t>)
+    ->ArgsProduct({{256}, {0, 1, 2}})
+    ->Name("TiffConcept/ByteSwap/uint32")
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(BM_ByteSwap<double>)
+    ->ArgsProduct({{256}, {0, 1, 2}})
+    ->Name("TiffConcept/ByteSwap/float64")
+    ->Unit(benchmark::kMicrosecond);
+
 #if 0
 // Write - Size and Channel Variations
 // Params: width, channels, compression, predictor
@@ -9,8 +9,12 @@
 #endif
 
 // TiffConcept includes for multi-page generation
+#include "../tiffconcept/include/tiffconcept/compressors/compressor_lzw.hpp"
 #include "../tiffconcept/include/tiffconcept/compressors/compressor_standard.hpp"
 #include "../tiffconcept/include/tiffconcept/compressors/compressor_zstd.hpp"
+#ifdef HAVE_ZLIB
+#include "../tiffconcept/include/tiffconcept/compressors/compressor_deflate.hpp"
+#endif
 #include "../tiffconcept/include/tiffconcept/readers/reader_stream.hpp"
 #include "../tiffconcept/include/tiffconcept/tiff_writer.hpp"
 #include "../tiffconcept/include/tiffconcept/strategy/write_strategy.hpp"
@@ -19,6 +23,13 @@ namespace tiff_bench {
 
 using namespace tiffconcept;
 
+/// Compressors available to TiffGenerator
+#ifdef HAVE_ZLIB
+using GeneratorCompSpec = CompressorSpec<ZstdCompressorDesc, LZWCompressorDesc, DeflateCompressorDesc>;
+#else
+using GeneratorCompSpec = CompressorSpec<ZstdCompressorDesc, LZWCompressorDesc>;
+#endif
+
 // ============================================================================
 // ImageConfig
 // ============================================================================
@@ -51,6 +62,8 @@ std::string BenchmarkParams::name() const {
     switch (storage_config.compression) {
         case CompressionType::None: oss << "_NoComp"; break;
         case CompressionType::ZSTD: oss << "_ZSTD"; break;
+        case CompressionType::Deflate: oss << "_Deflate"; break;
+        case CompressionType::LZW: oss << "_LZW"; break;
     }
     
     // Add predictor if not None
@@ -230,6 +243,14 @@ std::filesystem::path TiffGenerator<T>::create_file(
     switch (compression) {
         case CompressionType::None: comp_scheme = CompressionScheme::None; break;
         case CompressionType::ZSTD: comp_scheme = CompressionScheme::ZSTD; break;
+        case CompressionType::LZW: comp_scheme = CompressionScheme::LZW; break;
+        case CompressionType::Deflate:
+#ifdef HAVE_ZLIB
+            comp_scheme = CompressionScheme::Deflate_Adobe;
+            break;
+#else
+            throw std::runtime_error("TiffGenerator needs zlib to write Deflate files");
+#endif
     }
     
     switch (storage_config.predictor) {
@@ -265,8 +286,8 @@ std::filesystem::path TiffGenerator<T>::create_file(
     
     // Create a lambda to write the file with the appropriate template parameters
     auto write_file = [&]<std::endian TargetEndian, TiffFormatType Format, typename IFDStrategy, typename TileStrategy>() {
-        if (compression == CompressionType::ZSTD) {
-            using CompSpec = CompressorSpec<ZstdCompressorDesc>;
+        if (compression != CompressionType::None) {
+            using CompSpec = GeneratorCompSpec;
             using WConfig = WriteConfig<IFDStrategy, TileStrategy, DirectWrite<StreamFileWriter>, TwoPassOffsets>;
             using WriterType = TiffWriter<T, CompSpec, WConfig, Format, TargetEndian>;
             
@@ -442,6 +463,8 @@ int LibTiffGenerator<T>::to_libtiff_compression(CompressionType comp) {
     switch (comp) {
         case CompressionType::None: return COMPRESSION_NONE;
         case CompressionType::ZSTD: return COMPRESSION_ZSTD;
+        case CompressionType::Deflate: return COMPRESSION_ADOBE_DEFLATE;
+        case CompressionType::LZW: return COMPRESSION_LZW;
         default: return COMPRESSION_NONE;
     }
 }
@@ -20,7 +20,7 @@ enum class Endianness { Little, Big };
 enum class TiffFormat { Classic, BigTIFF };
 
 /// Compression type enumeration
-enum class CompressionType { None, ZSTD };
+enum class CompressionType { None, ZSTD, Deflate, LZW };
 
 /// Predictor type enumeration  
 enum class PredictorType { None, Horizontal };
@@ -4,14 +4,21 @@
 #include <vector>
 #include <random>
 #include <algorithm>
+#include <map>
 #include <span>
 
 #include "../tiffconcept/include/tiffconcept/compressors/compressor_base.hpp"
+#include "../tiffconcept/include/tiffconcept/compressors/compressor_lzw.hpp"
 #include "../tiffconcept/include/tiffconcept/compressors/compressor_standard.hpp"
 #include "../tiffconcept/include/tiffconcept/compressors/compressor_zstd.hpp"
 #include "../tiffconcept/include/tiffconcept/decompressors/decompressor_base.hpp"
+#include "../tiffconcept/include/tiffconcept/decompressors/decompressor_lzw.hpp"
 #include "../tiffconcept/include/tiffconcept/decompressors/decompressor_standard.hpp"
 #include "../tiffconcept/include/tiffconcept/decompressors/decompressor_zstd.hpp"
+#ifdef HAVE_ZLIB
+#include "../tiffconcept/include/tiffconcept/compressors/compressor_deflate.hpp"
+#include "../tiffconcept/include/tiffconcept/decompressors/decompressor_deflate.hpp"
+#endif
 #include "../tiffconcept/include/tiffconcept/types/result.hpp"
 #include "../tiffconcept/include/tiffconcept/types/tiff_spec.hpp"
 
@@ -640,6 +647,608 @@ TEST(ZstdDecompressor, InvalidFrame) {
     EXPECT_EQ(result.error().code, Error::Code::InvalidFormat);
 }
 
+// ============================================================================
+// Deflate Compressor/Decompressor Tests
+// ============================================================================
+
+#ifdef HAVE_ZLIB
+
+/// Compress with zlib directly (reference encoder)
+std::vector<std::byte> zlib_compress(const std::vector<std::byte>& input, int level = Z_DEFAULT_COMPRESSION) {
+    uLongf bound = compressBound(static_cast<uLong>(input.size()));
+    std::vector<std::byte> compressed(bound);
+    int ret = compress2(reinterpret_cast<Bytef*>(compressed.data()), &bound,
+                        reinterpret_cast<const Bytef*>(input.data()), static_cast<uLong>(input.size()), level);
+    EXPECT_EQ(ret, Z_OK);
+    compressed.resize(bound);
+    return compressed;
+}
+
+TEST(DeflateDecompressor, MultipleSizes) {
+    DeflateDecompressor decompressor;
+    
+    const std::array sizes = {0, 1, 10, 100, 1000, 10000, 50000};
+    
+    for (auto size : sizes) {
+        auto input = generate_compressible_data(size);
+        auto compressed = zlib_compress(input);
+        
+        std::vector<std::byte> decompressed(size);
+        auto result = decompressor.decompress(decompressed, compressed);
+        ASSERT_TRUE(result.is_ok()) << "Size: " << size;
+        EXPECT_EQ(result.value(), static_cast<std::size_t>(size));
+        EXPECT_TRUE(vectors_equal(decompressed, input)) << "Size: " << size;
+    }
+}
+
+TEST(DeflateDecompressor, ReusesStreamAcrossChunks) {
+    DeflateDecompressor decompressor;
+    
+    // Alternate levels and data so that no state can leak between chunks
+    for (int i = 0; i < 8; ++i) {
+        auto input = (i % 2 == 0) ? generate_random_bytes(4096, i) : generate_data_with_runs(4096, i);
+        auto compressed = zlib_compress(input, i + 1);
+        
+        std::vector<std::byte> decompressed(input.size());
+        auto result = decompressor.decompress(decompressed, compressed);
+        ASSERT_TRUE(result.is_ok()) << "Chunk: " << i;
+        EXPECT_TRUE(vectors_equal(decompressed, input)) << "Chunk: " << i;
+    }
+}
+
+TEST(DeflateDecompressor, InvalidData) {
+    DeflateDecompressor decompressor;
+    
+    std::vector<std::byte> invalid_data = {
+        std::byte{0x00}, std::byte{0x01}, std::byte{0x02}, std::byte{0x03}
+    };
+    
+    std::vector<std::byte> output(100);
+    auto result = decompressor.decompress(output, invalid_data);
+    ASSERT_TRUE(result.is_error());
+    EXPECT_EQ(result.error().code, Error::Code::InvalidFormat);
+    
+    // The stream is still usable after an error
+    auto input = generate_random_bytes(100);
+    auto compressed = zlib_compress(input);
+    result = decompressor.decompress(output, compressed);
+    ASSERT_TRUE(result.is_ok());
+    EXPECT_TRUE(vectors_equal(output, input));
+}
+
+TEST(DeflateDecompressor, TruncatedStream) {
+    DeflateDecompressor decompressor;
+    
+    auto input = generate_random_bytes(5000);
+    auto compressed = zlib_compress(input);
+    compressed.resize(compressed.size() / 2);
+    
+    std::vector<std::byte> output(input.size());
+    auto result = decompressor.decompress(output, compressed);
+    ASSERT_TRUE(result.is_error());
+    EXPECT_EQ(result.error().code, Error::Code::InvalidFormat);
+}
+
+TEST(DeflateDecompressor, StopsWhenOutputFull) {
+    DeflateDecompressor decompressor;
+    
+    auto input = generate_compressible_data(2000);
+    auto compressed = zlib_compress(input);
+    
+    // Only the first 1000 bytes are needed (e.g. a padded chunk)
+    std::vector<std::byte> output(1000);
+    auto result = decompressor.decompress(output, compressed);
+    ASSERT_TRUE(result.is_ok());
+    EXPECT_EQ(result.value(), 1000u);
+    EXPECT_EQ(std::memcmp(output.data(), input.data(), output.size()), 0);
+}
+
+TEST(DeflateCompressorDecompressor, MultipleSizes) {
+    DeflateCompressor<> compressor;
+    DeflateDecompressor decompressor;
+    
+    const std::array sizes = {0, 1, 10, 100, 1000, 10000, 100000};
+    
+    for (auto size : sizes) {
+        for (auto input : {generate_compressible_data(size), generate_random_bytes(size)}) {
+            std::vector<std::byte> compressed;
+            auto compress_result = compressor.compress(compressed, 0, input);
+            ASSERT_TRUE(compress_result.is_ok()) << "Size: " << size;
+            
+            std::vector<std::byte> decompressed(size);
+            auto decompress_result = decompressor.decompress(
+                decompressed,
+                std::span<const std::byte>(compressed.data(), compress_result.value())
+            );
+            ASSERT_TRUE(decompress_result.is_ok()) << "Size: " << size;
+            EXPECT_TRUE(vectors_equal(decompressed, input)) << "Size: " << size;
+        }
+    }
+}
+
+TEST(DeflateCompressor, ZlibCompatible) {
+    DeflateCompressor<> compressor;
+    
+    auto input = generate_data_with_runs(20000);
+    std::vector<std::byte> compressed;
+    auto compress_result = compressor.compress(compressed, 0, input);
+    ASSERT_TRUE(compress_result.is_ok());
+    EXPECT_LT(compress_result.value(), input.size());
+    
+    std::vector<std::byte> decompressed(input.size());
+    uLongf decompressed_size = static_cast<uLongf>(decompressed.size());
+    int ret = uncompress(reinterpret_cast<Bytef*>(decompressed.data()), &decompressed_size,
+                         reinterpret_cast<const Bytef*>(compressed.data()),
+                         static_cast<uLong>(compress_result.value()));
+    ASSERT_EQ(ret, Z_OK);
+    EXPECT_EQ(decompressed_size, input.size());
+    EXPECT_TRUE(vectors_equal(decompressed, input));
+}
+
+TEST(DeflateCompressor, DifferentCompressionLevels) {
+    auto input = generate_compressible_data(50000);
+    
+    DeflateCompressor<1> fast;
+    DeflateCompressor<9> best;
+    EXPECT_EQ(fast.get_level(), 1);
+    EXPECT_EQ(best.get_level(), 9);
+    
+    std::vector<std::byte> fast_output;
+    std::vector<std::byte> best_output;
+    auto fast_result = fast.compress(fast_output, 0, input);
+    auto best_result = best.compress(best_output, 0, input);
+    ASSERT_TRUE(fast_result.is_ok());
+    ASSERT_TRUE(best_result.is_ok());
+    EXPECT_LE(best_result.value(), fast_result.value());
+    
+    // Changing the level recreates the stream: the output matches a fresh compressor
+    fast.set_level(9);
+    EXPECT_EQ(fast.clone().get_level(), 9);
+    std::vector<std::byte> relevel_output;
+    auto relevel_result = fast.compress(relevel_output, 0, input);
+    ASSERT_TRUE(relevel_result.is_ok());
+    ASSERT_EQ(relevel_result.value(), best_result.value());
+    EXPECT_EQ(std::memcmp(relevel_output.data(), best_output.data(), best_result.value()), 0);
+}
+
+TEST(DeflateCompressor, ReusesStreamAcrossChunks) {
+    DeflateCompressor<> compressor;
+    DeflateCompressor<> reference;
+    
+    // A reused stream produces the same bytes as a fresh one for every chunk
+    for (int i = 0; i < 8; ++i) {
+        auto input = (i % 2 == 0) ? generate_random_bytes(4096, i) : generate_data_with_runs(4096, i);
+        
+        std::vector<std::byte> compressed;
+        auto result = compressor.compress(compressed, 0, input);
+        ASSERT_TRUE(result.is_ok()) << "Chunk: " << i;
+        
+        std::vector<std::byte> expected;
+        auto expected_result = reference.clone().compress(expected, 0, input);
+        ASSERT_TRUE(expected_result.is_ok()) << "Chunk: " << i;
+        ASSERT_EQ(result.value(), expected_result.value()) << "Chunk: " << i;
+        EXPECT_EQ(std::memcmp(compressed.data(), expected.data(), result.value()), 0) << "Chunk: " << i;
+    }
+}
+
+TEST(DeflateCompressor, WithOffset) {
+    DeflateCompressor<> compressor;
+    
+    std::vector<std::byte> input = generate_random_bytes(100);
+    std::vector<std::byte> compressed;
+    compressed.resize(50, std::byte{0xFF});  // Pre-fill with data
+    
+    auto compress_result = compressor.compress(compressed, 50, input);
+    ASSERT_TRUE(compress_result.is_ok());
+    
+    // First 50 bytes should be untouched
+    for (std::size_t i = 0; i < 50; ++i) {
+        EXPECT_EQ(compressed[i], std::byte{0xFF});
+    }
+    
+    DeflateDecompressor decompressor;
+    std::vector<std::byte> decompressed(input.size());
+    auto decompress_result = decompressor.decompress(
+        decompressed,
+        std::span<const std::byte>(compressed.data() + 50, compress_result.value())
+    );
+    ASSERT_TRUE(decompress_result.is_ok());
+    EXPECT_TRUE(vectors_equal(decompressed, input));
+}
+
+TEST(CompressorDecompressorStorage, DeflateSchemes) {
+    CompressorStorage<CompressorSpec<NoneCompressorDesc, DeflateCompressorDesc>> compressor_storage;
+    DecompressorStorage<DecompressorSpec<NoneDecompressorDesc, DeflateDecompressorDesc>> decompressor_storage;
+    
+    EXPECT_TRUE(compressor_storage.supports(CompressionScheme::Deflate));
+    EXPECT_TRUE(compressor_storage.supports(CompressionScheme::Deflate_Adobe));
+    EXPECT_EQ(DeflateCompressor<>::get_default_scheme(), CompressionScheme::Deflate_Adobe);
+    
+    auto input = generate_compressible_data(5000);
+    
+    for (auto scheme : {CompressionScheme::Deflate, CompressionScheme::Deflate_Adobe}) {
+        std::vector<std::byte> compressed;
+        auto compress_result = compressor_storage.compress(compressed, 0, input, scheme);
+        ASSERT_TRUE(compress_result.is_ok()) << "Scheme: " << static_cast<int>(scheme);
+        
+        std::vector<std::byte> decompressed(input.size());
+        auto decompress_result = decompressor_storage.decompress(
+            decompressed,
+            std::span<const std::byte>(compressed.data(), compress_result.value()),
+            scheme
+        );
+        ASSERT_TRUE(decompress_result.is_ok()) << "Scheme: " << static_cast<int>(scheme);
+        EXPECT_TRUE(vectors_equal(decompressed, input)) << "Scheme: " << static_cast<int>(scheme);
+    }
+}
+
+TEST(DecompressorStorage, DeflateSchemes) {
+    using DeflateSpec = DecompressorSpec<NoneDecompressorDesc, DeflateDecompressorDesc>;
+    DecompressorStorage<DeflateSpec> storage;
+    
+    EXPECT_TRUE(storage.supports(CompressionScheme::Deflate));
+    EXPECT_TRUE(storage.supports(CompressionScheme::Deflate_Adobe));
+    EXPECT_FALSE(storage.supports(CompressionScheme::ZSTD));
+    
+    auto input = generate_data_with_runs(3000);
+    auto compressed = zlib_compress(input);
+    
+    for (auto scheme : {CompressionScheme::Deflate, CompressionScheme::Deflate_Adobe}) {
+        std::vector<std::byte> decompressed(input.size());
+        auto result = storage.decompress(decompressed, compressed, scheme);
+        ASSERT_TRUE(result.is_ok()) << "Scheme: " << static_cast<int>(scheme);
+        EXPECT_TRUE(vectors_equal(decompressed, input)) << "Scheme: " << static_cast<int>(scheme);
+    }
+}
+
+#endif // HAVE_ZLIB
+
+// ============================================================================
+// LZW Compressor/Decompressor Tests
+// ============================================================================
+
+/// Straightforward LZW encoder (reference for the decoder tests)
+/// new_style selects MSB-first codes with early change (TIFF 6.0) instead of
+/// the LSB-first layout written by pre-6.0 libtiff
+std::vector<std::byte> lzw_compress_reference(const std::vector<std::byte>& input, bool new_style = true) {
+    std::vector<std::byte> output;
+    uint64_t bit_buffer = 0;
+    uint32_t bit_count = 0;
+    uint32_t width = 9;
+    
+    auto put_code = [&](uint32_t code) {
+        if (new_style) {
+            bit_buffer = (bit_buffer << width) | code;
+            bit_count += width;
+            while (bit_count >= 8) {
+                bit_count -= 8;
+                output.push_back(static_cast<std::byte>(bit_buffer >> bit_count));
+            }
+        } else {
+            bit_buffer |= static_cast<uint64_t>(code) << bit_count;
+            bit_count += width;
+            while (bit_count >= 8) {
+                output.push_back(static_cast<std::byte>(bit_buffer));
+                bit_buffer >>= 8;
+                bit_count -= 8;
+            }
+        }
+    };
+    
+    std::map<std::pair<uint32_t, uint8_t>, uint32_t> table;
+    uint32_t next_code = 258;
+    put_code(256);
+    
+    int64_t current = -1;
+    for (auto b : input) {
+        uint8_t byte = std::to_integer<uint8_t>(b);
+        if (current < 0) {
+            current = byte;
+            continue;
+        }
+        auto it = table.find({static_cast<uint32_t>(current), byte});
+        if (it != table.end()) {
+            current = it->second;
+            continue;
+        }
+        put_code(static_cast<uint32_t>(current));
+        table[{static_cast<uint32_t>(current), byte}] = next_code++;
+        // The decoder lags one entry behind: old-style switches one code later
+        if (next_code >= (1u << width) + (new_style ? 0u : 1u) && width < 12) {
+            ++width;
+        }
+        if (next_code >= 4094) {
+            put_code(256);
+            table.clear();
+            next_code = 258;
+            width = 9;
+        }
+        current = byte;
+    }
+    if (current >= 0) {
+        put_code(static_cast<uint32_t>(current));
+        ++next_code;
+        if (next_code >= 4094) {
+            put_code(256);
+            width = 9;
+        } else if (next_code >= (1u << width) + (new_style ? 0u : 1u) && width < 12) {
+            ++width;
+        }
+    }
+    put_code(257);
+    if (bit_count > 0) {
+        if (new_style) {
+            output.push_back(static_cast<std::byte>(bit_buffer << (8 - bit_count)));
+        } else {
+            output.push_back(static_cast<std::byte>(bit_buffer));
+        }
+    }
+    return output;
+}
+
+/// 32x4 8-bit strip compressed by libtiff, and the matching raw data
+std::pair<std::vector<std::byte>, std::vector<std::byte>> lzw_libtiff_reference() {
+    const std::array<uint8_t, 124> compressed_bytes = {
+        0x80, 0x0A, 0x80, 0x40, 0x40, 0x38, 0x24, 0x16, 0x0E, 0x08, 0x0A, 0x82, 0xA1, 0x70, 0xC8, 0x70,
+        0x3C, 0x20, 0x11, 0x8A, 0x84, 0xE2, 0xA1, 0x60, 0xB8, 0x62, 0x33, 0x1A, 0x8A, 0x87, 0x43, 0xC1,
+        0xF9, 0x04, 0x86, 0x46, 0x24, 0x0A, 0xA0, 0xA0, 0xC8, 0x40, 0x4C, 0x2A, 0x2A, 0x0D, 0x43, 0x84,
+        0x22, 0x31, 0x28, 0xA2, 0x28, 0x2F, 0x8B, 0x8D, 0x87, 0x03, 0xA1, 0x54, 0x74, 0x89, 0x20, 0x25,
+        0x93, 0x45, 0x52, 0x40, 0x8C, 0x98, 0x30, 0x1A, 0x15, 0x07, 0xE5, 0x62, 0x69, 0x70, 0xB4, 0x54,
+        0x31, 0x1A, 0x4C, 0x87, 0x63, 0xD1, 0xF8, 0xAA, 0x6E, 0x49, 0x9C, 0x94, 0x0A, 0x42, 0xA9, 0xE8,
+        0x5A, 0x7E, 0x1D, 0x0F, 0x8A, 0x84, 0x94, 0x41, 0x58, 0xB4, 0x5E, 0x32, 0x15, 0x0D, 0x87, 0x34,
+        0xB2, 0x01, 0x08, 0x88, 0x2A, 0xA8, 0x13, 0xAA, 0x45, 0x52, 0xBC, 0x04
+    };
+    std::vector<std::byte> compressed(compressed_bytes.size());
+    std::memcpy(compressed.data(), compressed_bytes.data(), compressed_bytes.size());
+    
+    std::vector<std::byte> raw(32 * 4);
+    for (std::size_t y = 0; y < 4; ++y) {
+        for (std::size_t x = 0; x < 32; ++x) {
+            raw[y * 32 + x] = static_cast<std::byte>(x % 8 ? ((x * 7) / 3 + y * 5) & 0xFF : 42);
+        }
+    }
+    return {compressed, raw};
+}
+
+TEST(LZWDecompressor, LibTiffReference) {
+    auto [compressed, expected] = lzw_libtiff_reference();
+    
+    LZWDecompressor decompressor;
+    std::vector<std::byte> output(expected.size());
+    auto result = decompressor.decompress(output, compressed);
+    ASSERT_TRUE(result.is_ok()) << result.error().message;
+    EXPECT_EQ(result.value(), expected.size());
+    EXPECT_TRUE(vectors_equal(output, expected));
+}
+
+TEST(LZWDecompressor, NewStyleMultipleSizes) {
+    LZWDecompressor decompressor;
+    
+    // Large compressible inputs go through every code width and several Clear codes
+    const std::array sizes = {0, 1, 2, 10, 100, 1000, 10000, 100000};
+    
+    for (auto size : sizes) {
+        for (auto input : {generate_compressible_data(size), generate_random_bytes(size),
+                           generate_data_with_runs(size)}) {
+            auto compressed = lzw_compress_reference(input, true);
+            
+            std::vector<std::byte> decompressed(size);
+            auto result = decompressor.decompress(decompressed, compressed);
+            ASSERT_TRUE(result.is_ok()) << "Size: " << size << " " << result.error().message;
+            EXPECT_EQ(result.value(), static_cast<std::size_t>(size));
+            EXPECT_TRUE(vectors_equal(decompressed, input)) << "Size: " << size;
+        }
+    }
+}
+
+TEST(LZWDecompressor, OldStyleMultipleSizes) {
+    LZWDecompressor decompressor;
+    
+    const std::array sizes = {2, 10, 100, 1000, 10000, 100000};
+    
+    for (auto size : sizes) {
+        for (auto input : {generate_compressible_data(size), generate_random_bytes(size),
+                           generate_data_with_runs(size)}) {
+            auto compressed = lzw_compress_reference(input, false);
+            ASSERT_EQ(compressed[0], std::byte{0x00});
+            
+            std::vector<std::byte> decompressed(size);
+            auto result = decompressor.decompress(decompressed, compressed);
+            ASSERT_TRUE(result.is_ok()) << "Size: " << size << " " << result.error().message;
+            EXPECT_EQ(result.value(), static_cast<std::size_t>(size));
+            EXPECT_TRUE(vectors_equal(decompressed, input)) << "Size: " << size;
+        }
+    }
+}
+
+TEST(LZWDecompressor, RepeatedByte) {
+    // A single repeated byte only produces KwKwK codes
+    LZWDecompressor decompressor;
+    std::vector<std::byte> input(50000, std::byte{0x5A});
+    auto compressed = lzw_compress_reference(input);
+    
+    std::vector<std::byte> decompressed(input.size());
+    auto result = decompressor.decompress(decompressed, compressed);
+    ASSERT_TRUE(result.is_ok()) << result.error().message;
+    EXPECT_TRUE(vectors_equal(decompressed, input));
+}
+
+TEST(LZWDecompressor, ReusesTableAcrossChunks) {
+    LZWDecompressor decompressor;
+    
+    // Alternate layouts and data so that no state can leak between chunks
+    for (int i = 0; i < 8; ++i) {
+        auto input = (i % 2 == 0) ? generate_random_bytes(4096, i) : generate_data_with_runs(4096, i);
+        auto compressed = lzw_compress_reference(input, i % 3 != 0);
+        
+        std::vector<std::byte> decompressed(input.size());
+        auto result = decompressor.decompress(decompressed, compressed);
+        ASSERT_TRUE(result.is_ok()) << "Chunk: " << i;
+        EXPECT_TRUE(vectors_equal(decompressed, input)) << "Chunk: " << i;
+    }
+}
+
+TEST(LZWDecompressor, InvalidCode) {
+    LZWDecompressor decompressor;
+    
+    // Clear code followed by code 300, which is not in the table
+    // 100000000 100101100 -> 0x80 0x4B 0x00
+    std::vector<std::byte> invalid_data = {std::byte{0x80}, std::byte{0x4B}, std::byte{0x00}};
+    
+    std::vector<std::byte> output(100);
+    auto result = decompressor.decompress(output, invalid_data);
+    ASSERT_TRUE(result.is_error());
+    EXPECT_EQ(result.error().code, Error::Code::InvalidFormat);
+}
+
+TEST(LZWDecompressor, TruncatedStream) {
+    LZWDecompressor decompressor;
+    
+    auto input = generate_random_bytes(5000);
+    auto compressed = lzw_compress_reference(input);
+    compressed.resize(compressed.size() / 2);
+    
+    std::vector<std::byte> output(input.size());
+    auto result = decompressor.decompress(output, compressed);
+    ASSERT_TRUE(result.is_error());
+    EXPECT_EQ(result.error().code, Error::Code::InvalidFormat);
+}
+
+TEST(LZWDecompressor, StopsWhenOutputFull) {
+    LZWDecompressor decompressor;
+    
+    for (auto input : {generate_compressible_data(2000), generate_data_with_runs(2000)}) {
+        auto compressed = lzw_compress_reference(input);
+        
+        // Only the first bytes are needed (e.g. a padded chunk), the last
+        // code may be cut in the middle of its string
+        for (std::size_t size : {1, 999, 1000, 1001}) {
+            std::vector<std::byte> output(size);
+            auto result = decompressor.decompress(output, compressed);
+            ASSERT_TRUE(result.is_ok());
+            EXPECT_EQ(result.value(), size);
+            EXPECT_EQ(std::memcmp(output.data(), input.data(), output.size()), 0);
+        }
+    }
+}
+
+TEST(LZWCompressor, MatchesLibTiff) {
+    auto [expected, input] = lzw_libtiff_reference();
+    
+    LZWCompressor compressor;
+    std::vector<std::byte> compressed;
+    auto result = compressor.compress(compressed, 0, input);
+    ASSERT_TRUE(result.is_ok());
+    ASSERT_EQ(result.value(), expected.size());
+    EXPECT_EQ(std::memcmp(compressed.data(), expected.data(), expected.size()), 0);
+}
+
+TEST(LZWCompressor, MatchesReferenceEncoder) {
+    // Without ratio-based resets the output is fully determined by the spec,
+    // including the Clear codes emitted when the table is full
+    LZWCompressor compressor;
+    
+    for (auto input : {generate_compressible_data(100000), generate_random_bytes(20000),
+                       generate_data_with_runs(50000), std::vector<std::byte>(30000, std::byte{7})}) {
+        auto expected = lzw_compress_reference(input);
+        
+        std::vector<std::byte> compressed;
+        auto result = compressor.compress(compressed, 0, input);
+        ASSERT_TRUE(result.is_ok());
+        ASSERT_EQ(result.value(), expected.size());
+        EXPECT_EQ(std::memcmp(compressed.data(), expected.data(), expected.size()), 0);
+    }
+}
+
+TEST(LZWCompressorDecompressor, MultipleSizes) {
+    LZWCompressor compressor;
+    LZWDecompressor decompressor;
+    
+    const std::array sizes = {0, 1, 2, 10, 100, 1000, 10000, 100000};
+    
+    for (auto size : sizes) {
+        for (auto input : {generate_compressible_data(size), generate_random_bytes(size),
+                           generate_data_with_runs(size)}) {
+            std::vector<std::byte> compressed;
+            auto compress_result = compressor.compress(compressed, 0, input);
+            ASSERT_TRUE(compress_result.is_ok()) << "Size: " << size;
+            EXPECT_LE(compress_result.value(), LZWCompressor::get_compress_bound(input.size()));
+            
+            std::vector<std::byte> decompressed(size);
+            auto decompress_result = decompressor.decompress(
+                decompressed,
+                std::span<const std::byte>(compressed.data(), compress_result.value())
+            );
+            ASSERT_TRUE(decompress_result.is_ok()) << "Size: " << size;
+            EXPECT_EQ(decompress_result.value(), static_cast<std::size_t>(size));
+            EXPECT_TRUE(vectors_equal(decompressed, input)) << "Size: " << size;
+        }
+    }
+}
+
+TEST(LZWCompressor, ReusesTableAcrossChunks) {
+    // Enough chunks to wrap the table generation counter
+    LZWCompressor compressor;
+    LZWDecompressor decompressor;
+    
+    for (int i = 0; i < 5000; ++i) {
+        auto input = generate_data_with_runs(64, i);
+        
+        std::vector<std::byte> compressed;
+        auto compress_result = compressor.compress(compressed, 0, input);
+        ASSERT_TRUE(compress_result.is_ok()) << "Chunk: " << i;
+        
+        std::vector<std::byte> decompressed(input.size());
+        auto decompress_result = decompressor.decompress(
+            decompressed,
+            std::span<const std::byte>(compressed.data(), compress_result.value())
+        );
+        ASSERT_TRUE(decompress_result.is_ok()) << "Chunk: " << i;
+        ASSERT_TRUE(vectors_equal(decompressed, input)) << "Chunk: " << i;
+    }
+}
+
+TEST(LZWCompressor, WithOffset) {
+    LZWCompressor compressor;
+    
+    std::vector<std::byte> input = generate_random_bytes(100);
+    std::vector<std::byte> compressed;
+    compressed.resize(50, std::byte{0xFF});  // Pre-fill with data
+    
+    auto compress_result = compressor.compress(compressed, 50, input);
+    ASSERT_TRUE(compress_result.is_ok());
+    
+    // First 50 bytes should be untouched
+    for (std::size_t i = 0; i < 50; ++i) {
+        EXPECT_EQ(compressed[i], std::byte{0xFF});
+    }
+    
+    LZWDecompressor decompressor;
+    std::vector<std::byte> decompressed(input.size());
+    auto decompress_result = decompressor.decompress(
+        decompressed,
+        std::span<const std::byte>(compressed.data() + 50, compress_result.value())
+    );
+    ASSERT_TRUE(decompress_result.is_ok());
+    EXPECT_TRUE(vectors_equal(decompressed, input));
+}
+
+TEST(DecompressorStorage, LZWScheme) {
+    using LZWSpec = DecompressorSpec<NoneDecompressorDesc, LZWDecompressorDesc>;
+    DecompressorStorage<LZWSpec> storage;
+    
+    EXPECT_TRUE(storage.supports(CompressionScheme::LZW));
+    EXPECT_FALSE(storage.supports(CompressionScheme::ZSTD));
+    
+    auto input = generate_data_with_runs(3000);
+    auto compressed = lzw_compress_reference(input);
+    
+    std::vector<std::byte> decompressed(input.size());
+    auto result = storage.decompress(decompressed, compressed, CompressionScheme::LZW);
+    ASSERT_TRUE(result.is_ok());
+    EXPECT_TRUE(vectors_equal(decompressed, input));
+}
+
 // ============================================================================
 // Compressor/Decompressor Storage Tests
 // ============================================================================
@@ -657,13 +1266,15 @@ using StandardDecompressorSpec = DecompressorSpec<
 using FullCompressorSpec = CompressorSpec<
     NoneCompressorDesc,
     PackBitsCompressorDesc,
-    ZstdCompressorDesc
+    ZstdCompressorDesc,
+    LZWCompressorDesc
 >;
 
 using FullDecompressorSpec = DecompressorSpec<
     NoneDecompressorDesc,
     PackBitsDecompressorDesc,
-    ZstdDecompressorDesc
+    ZstdDecompressorDesc,
+    LZWDecompressorDesc
 >;
 
 TEST(CompressorStorage, StandardSpec) {
@@ -814,7 +1425,8 @@ TEST(RoundTrip, AllSchemesWithRandomData) {
         CompressionScheme::None,
         CompressionScheme::PackBits,
         CompressionScheme::ZSTD,
-        CompressionScheme::ZSTD_Alt
+        CompressionScheme::ZSTD_Alt,
+        CompressionScheme::LZW
     };
     
     for (auto scheme : schemes) {
@@ -844,7 +1456,8 @@ TEST(RoundTrip, AllSchemesWithCompressibleData) {
     const std::array schemes = {
         CompressionScheme::None,
         CompressionScheme::PackBits,
-        CompressionScheme::ZSTD
+        CompressionScheme::ZSTD,
+        CompressionScheme::LZW
     };
     
     for (auto scheme : schemes) {
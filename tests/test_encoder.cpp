@@ -12,6 +12,8 @@
 #include "../tiffconcept/include/tiffconcept/decompressors/decompressor_base.hpp"
 #include "../tiffconcept/include/tiffconcept/decompressors/decompressor_standard.hpp"
 #include "../tiffconcept/include/tiffconcept/decompressors/decompressor_zstd.hpp"
+#include "../tiffconcept/include/tiffconcept/lowlevel/byteswap.hpp"
+#include "../tiffconcept/include/tiffconcept/lowlevel/cpu_features.hpp"
 #include "../tiffconcept/include/tiffconcept/lowlevel/decoder.hpp"
 #include "../tiffconcept/include/tiffconcept/lowlevel/encoder.hpp"
 #include "../tiffconcept/include/tiffconcept/types/result.hpp"
@@ -431,6 +433,137 @@ TEST(EncoderDecoder, RoundTripPackBits) {
     EXPECT_EQ(std::memcmp(decoded.data(), original.data(), original.size()), 0);
 }
 
+// ============================================================================
+// Byte Order Tests
+// ============================================================================
+
+constexpr std::endian non_native_endian =
+    std::endian::native == std::endian::little ? std::endian::big : std::endian::little;
+
+/// Swap arrays of every length up to a few registers at every SIMD level,
+/// and compare with the element by element byteswap()
+template <typename T>
+void check_byteswap_array() {
+    using U = std::conditional_t<sizeof(T) == 2, uint16_t, std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>>;
+    std::vector<cpu::SimdLevel> levels{cpu::SimdLevel::Scalar};
+    for (auto level : {cpu::SimdLevel::SSE2, cpu::SimdLevel::AVX2}) {
+        if (level <= cpu::detected_simd_level()) {
+            levels.push_back(level);
+        }
+    }
+    
+    for (std::size_t count = 0; count <= 80; ++count) {
+        auto bits = generate_test_image<U>(static_cast<uint32_t>(count) + 1, 1, 1, count);
+        std::vector<T> original(count + 1);
+        std::memcpy(original.data(), bits.data(), original.size() * sizeof(T));
+        
+        for (auto level : levels) {
+            cpu::set_simd_level_limit(level);
+            std::vector<T> swapped = original;
+            byteswap_array(std::span<T>(swapped).first(count));
+            cpu::set_simd_level_limit(cpu::SimdLevel::AVX2);
+            
+            for (std::size_t i = 0; i <= count; ++i) {
+                U expected = bits[i];
+                if (i < count) {
+                    expected = byteswap(expected);
+                }
+                U actual;
+                std::memcpy(&actual, &swapped[i], sizeof(U));
+                ASSERT_EQ(actual, expected) << "SIMD level " << static_cast<int>(level)
+                                            << ", count " << count << ", index " << i;
+            }
+        }
+    }
+}
+
+TEST(ByteSwap, MatchesScalarAtEveryLevel) {
+    check_byteswap_array<uint16_t>();
+    check_byteswap_array<int16_t>();
+    check_byteswap_array<uint32_t>();
+    check_byteswap_array<float>();
+    check_byteswap_array<uint64_t>();
+    check_byteswap_array<double>();
+}
+
+TEST(ByteSwap, ThreeByteElements) {
+    std::vector<Float24> values(5);
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        values[i].bytes[0] = static_cast<uint8_t>(i);
+        values[i].bytes[1] = 0x80;
+        values[i].bytes[2] = static_cast<uint8_t>(0xF0 + i);
+    }
+    byteswap_array(std::span<Float24>(values));
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        EXPECT_EQ(values[i].bytes[0], 0xF0 + i);
+        EXPECT_EQ(values[i].bytes[1], 0x80);
+        EXPECT_EQ(values[i].bytes[2], i);
+    }
+}
+
+TEST(EncoderDecoder, RoundTripNonNativeByteOrder) {
+    using CompSpec = CompressorSpec<NoneCompressorDesc, ZstdCompressorDesc>;
+    using DecompSpec = DecompressorSpec<NoneDecompressorDesc, ZstdDecompressorDesc>;
+    
+    ChunkEncoder<uint16_t, CompSpec> encoder;
+    TileDecoder<uint16_t, DecompSpec> decoder;
+    
+    auto original = generate_test_image<uint16_t>(48, 40, 3, 77);
+    
+    for (auto predictor : {Predictor::None, Predictor::Horizontal}) {
+        // Stored samples: predictor applied to the native values, then swapped
+        auto native = encoder.encode_2d(original, 0, 0, 0, 48, 40, 0,
+                                        CompressionScheme::None, predictor, 3);
+        ASSERT_TRUE(native.is_ok());
+        std::vector<uint16_t> expected(original.size());
+        std::memcpy(expected.data(), native.value().data.data(), expected.size() * sizeof(uint16_t));
+        for (auto& value : expected) {
+            value = byteswap(value);
+        }
+        
+        auto swapped = encoder.encode_2d(original, 0, 0, 0, 48, 40, 0,
+                                         CompressionScheme::None, predictor, 3, non_native_endian);
+        ASSERT_TRUE(swapped.is_ok());
+        ASSERT_EQ(swapped.value().data.size(), expected.size() * sizeof(uint16_t));
+        EXPECT_EQ(std::memcmp(swapped.value().data.data(), expected.data(), swapped.value().data.size()), 0);
+        
+        for (auto compression : {CompressionScheme::None, CompressionScheme::ZSTD}) {
+            auto encoded = encoder.encode_2d(original, 0, 0, 0, 48, 40, 0,
+                                             compression, predictor, 3, non_native_endian);
+            ASSERT_TRUE(encoded.is_ok());
+            
+            auto decoded = decoder.decode_copy(encoded.value().data, 48, 40,
+                                               compression, predictor, 3, non_native_endian);
+            ASSERT_TRUE(decoded.is_ok());
+            EXPECT_EQ(decoded.value(), original);
+        }
+    }
+}
+
+TEST(EncoderDecoder, FloatingPointPredictorIgnoresByteOrder) {
+    using CompSpec = CompressorSpec<NoneCompressorDesc>;
+    using DecompSpec = DecompressorSpec<NoneDecompressorDesc>;
+    
+    ChunkEncoder<float, CompSpec> encoder;
+    TileDecoder<float, DecompSpec> decoder;
+    
+    auto original = generate_test_image<float>(32, 16, 2, 5);
+    
+    // The byte planes are always most significant byte first
+    auto native = encoder.encode_2d(original, 0, 0, 0, 32, 16, 0,
+                                    CompressionScheme::None, Predictor::FloatingPoint, 2);
+    auto swapped = encoder.encode_2d(original, 0, 0, 0, 32, 16, 0,
+                                     CompressionScheme::None, Predictor::FloatingPoint, 2, non_native_endian);
+    ASSERT_TRUE(native.is_ok());
+    ASSERT_TRUE(swapped.is_ok());
+    EXPECT_EQ(native.value().data, swapped.value().data);
+    
+    auto decoded = decoder.decode_copy(swapped.value().data, 32, 16,
+                                       CompressionScheme::None, Predictor::FloatingPoint, 2, non_native_endian);
+    ASSERT_TRUE(decoded.is_ok());
+    EXPECT_EQ(decoded.value(), original);
+}
+
 // ============================================================================
 // Edge Cases
 // ============================================================================
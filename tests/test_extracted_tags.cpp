@@ -9,6 +9,7 @@
 #include "../tiffconcept/include/tiffconcept/types/tag_spec_examples.hpp"
 #include "../tiffconcept/include/tiffconcept/parsing.hpp"
 #include "../tiffconcept/include/tiffconcept/readers/reader_buffer.hpp"
+#include "../tiffconcept/include/tiffconcept/readers/reader_simulated_remote.hpp"
 #include "../tiffconcept/include/tiffconcept/types/tiff_spec.hpp"
 
 using namespace tiffconcept;
@@ -1269,6 +1270,76 @@ TEST(ExtractedTags, AllOptionalTagsWithMixedPresence) {
     EXPECT_FALSE(tags.get<TagCode::Artist>().has_value());
 }
 
+TEST(ExtractedTags, ExternalDataIsReadInCoalescedRequests) {
+    ExtractedTags<ImageWidthTag, StripOffsetsTag, StripByteCountsTag, XResolutionTag, SoftwareTag> tags;
+
+    std::vector<uint32_t> offsets = {1000, 2000, 3000, 4000};
+    std::vector<uint32_t> counts = {500, 600, 700, 800};
+    const char* software = "Coalesced";
+    struct RationalData { uint32_t num; uint32_t den; } x_res{72, 1};
+
+    // Strip arrays and resolution close together, the software string far away
+    std::vector<std::byte> buffer(64 * 1024, std::byte{0});
+    std::memcpy(buffer.data() + 100, offsets.data(), offsets.size() * sizeof(uint32_t));
+    std::memcpy(buffer.data() + 200, counts.data(), counts.size() * sizeof(uint32_t));
+    std::memcpy(buffer.data() + 300, &x_res, sizeof(RationalData));
+    std::memcpy(buffer.data() + 60000, software, std::strlen(software) + 1);
+
+    SimulatedRemoteReader<BufferReader> reader(BufferReader(buffer), {.latency = std::chrono::microseconds(0)});
+
+    std::vector<TiffTag<std::endian::native>> tag_buffer;
+    uint32_t width = 640;
+    tag_buffer.push_back(make_inline_tag(static_cast<uint16_t>(TagCode::ImageWidth),
+                                         TiffDataType::Long, 1, &width, sizeof(width)));
+    tag_buffer.push_back(make_offset_tag(static_cast<uint16_t>(TagCode::StripOffsets),
+                                         TiffDataType::Long, 4, 100));
+    tag_buffer.push_back(make_offset_tag(static_cast<uint16_t>(TagCode::StripByteCounts),
+                                         TiffDataType::Long, 4, 200));
+    tag_buffer.push_back(make_offset_tag(static_cast<uint16_t>(TagCode::XResolution),
+                                         TiffDataType::Rational, 1, 300));
+    tag_buffer.push_back(make_offset_tag(static_cast<uint16_t>(TagCode::Software),
+                                         TiffDataType::Ascii, std::strlen(software) + 1, 60000));
+
+    auto result = tags.extract<SimulatedRemoteReader<BufferReader>, TiffFormatType::Classic, std::endian::native>(
+        reader, std::span(tag_buffer));
+
+    ASSERT_TRUE(result);
+    EXPECT_EQ(tags.get<TagCode::ImageWidth>(), 640);
+    EXPECT_EQ(tags.get<TagCode::StripOffsets>()[3], 4000);
+    EXPECT_EQ(tags.get<TagCode::StripByteCounts>()[3], 800);
+    EXPECT_EQ(tags.get<TagCode::XResolution>().numerator, 72);
+    EXPECT_EQ(tags.get<TagCode::Software>(), "Coalesced");
+    // One request for the three nearby arrays, one for the distant string
+    EXPECT_EQ(reader.stats().requests, 2u);
+}
+
+TEST(ExtractedTags, ExternalDataOutOfFileFailsOnlyItsTag) {
+    ExtractedTags<StripOffsetsTag, StripByteCountsTag, OptSoftwareTag> tags;
+
+    std::vector<uint32_t> offsets = {1000, 2000};
+    std::vector<uint32_t> counts = {500, 600};
+    std::vector<std::byte> buffer(1024, std::byte{0});
+    std::memcpy(buffer.data() + 100, offsets.data(), offsets.size() * sizeof(uint32_t));
+    std::memcpy(buffer.data() + 200, counts.data(), counts.size() * sizeof(uint32_t));
+    BufferViewReader reader{std::span<const std::byte>(buffer)};
+
+    std::vector<TiffTag<std::endian::native>> tag_buffer;
+    tag_buffer.push_back(make_offset_tag(static_cast<uint16_t>(TagCode::StripOffsets),
+                                         TiffDataType::Long, 2, 100));
+    tag_buffer.push_back(make_offset_tag(static_cast<uint16_t>(TagCode::StripByteCounts),
+                                         TiffDataType::Long, 2, 200));
+    tag_buffer.push_back(make_offset_tag(static_cast<uint16_t>(TagCode::Software),
+                                         TiffDataType::Ascii, 64, 5000));
+
+    auto result = tags.extract<BufferViewReader, TiffFormatType::Classic, std::endian::native>(
+        reader, std::span(tag_buffer));
+
+    ASSERT_TRUE(result);
+    EXPECT_EQ(tags.get<TagCode::StripOffsets>()[1], 2000);
+    EXPECT_EQ(tags.get<TagCode::StripByteCounts>()[1], 600);
+    EXPECT_FALSE(tags.get<TagCode::Software>().has_value());
+}
+
 int main(int argc, char **argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
@@ -3,6 +3,9 @@
 #include <random>
 #include <cstring>
 #include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <thread>
 
 #include "../tiffconcept/include/tiffconcept/image_reader.hpp"
 #include "../tiffconcept/include/tiffconcept/tiff_writer.hpp"
@@ -12,12 +15,21 @@
 #include "../tiffconcept/include/tiffconcept/decompressors/decompressor_zstd.hpp"
 #include "../tiffconcept/include/tiffconcept/strategy/write_strategy.hpp"
 #include "../tiffconcept/include/tiffconcept/readers/reader_buffer.hpp"
+#include "../tiffconcept/include/tiffconcept/readers/reader_simulated_remote.hpp"
 #include "../tiffconcept/include/tiffconcept/lowlevel/tiling.hpp"
 #include "../tiffconcept/include/tiffconcept/ifd.hpp"
 #include "../tiffconcept/include/tiffconcept/tag_extraction.hpp"
 #include "../tiffconcept/include/tiffconcept/types/tag_spec.hpp"
 #include "../tiffconcept/include/tiffconcept/types/tag_spec_examples.hpp"
 
+#ifdef __unix__
+#include "../tiffconcept/include/tiffconcept/readers/reader_unix_pread.hpp"
+#endif
+
+#ifdef HAVE_LIBURING
+#include "../tiffconcept/include/tiffconcept/readers/reader_unix_io_uring.hpp"
+#endif
+
 using namespace tiffconcept;
 
 // ============================================================================
@@ -585,4 +597,1208 @@ TEST(ImageReaderTest, ReadPartialRegion_Tiled) {
 
         check_whole_tile(std::span<const PixelType>(output_data));
     }
-}
\ No newline at end of file
+}
+// ============================================================================
+// Direct Decode Tests (tiles decoded straight into the output buffer)
+// ============================================================================
+
+TEST(ImageReaderTest, DirectDecodeTarget_Geometry) {
+    std::vector<uint16_t> output(64 * 40 * 3);
+    std::span<uint16_t> out(output);
+    
+    // Strip of rows 16..31 of a 64 pixels wide RGB image
+    Tile strip{};
+    strip.id.coords = TileCoordinates{0, 16, 0, 0};
+    strip.id.size = TileSize{64, 16, 1, 3};
+    
+    // Region rows 8..47: the strip lies inside, 8 rows down
+    ImageRegion region(0, 0, 8, 0, 3, 1, 40, 64);
+    auto target = direct_decode_target(strip, region, out);
+    EXPECT_EQ(target.data(), output.data() + 8 * 64 * 3);
+    EXPECT_EQ(target.size(), 16u * 64 * 3);
+    
+    // Strip crossing the region border
+    ImageRegion late(0, 0, 20, 0, 3, 1, 40, 64);
+    EXPECT_TRUE(direct_decode_target(strip, late, out).empty());
+    
+    // Narrower region: the rows are not contiguous in the output
+    std::vector<uint16_t> narrow_output(32 * 40 * 3);
+    ImageRegion narrow(0, 0, 8, 0, 3, 1, 40, 32);
+    EXPECT_TRUE(direct_decode_target(strip, narrow, std::span<uint16_t>(narrow_output)).empty());
+    
+    // Channel subset: tiles carry more samples than the output pixels
+    std::vector<uint16_t> gray_output(64 * 40);
+    ImageRegion gray(0, 0, 8, 0, 1, 1, 40, 64);
+    EXPECT_TRUE(direct_decode_target(strip, gray, std::span<uint16_t>(gray_output)).empty());
+}
+
+TEST(ImageReaderTest, ReadStrippedImage_DirectDecode_ZSTD_RGB) {
+    using PixelType = uint16_t;
+    using CompSpec = CompressorSpec<NoneCompressorDesc, PackBitsCompressorDesc, ZstdCompressorDesc>;
+    using DecompSpec = DecompressorSpec<NoneDecompressorDesc, PackBitsDecompressorDesc, ZstdDecompressorDesc>;
+    using WriteConfig = WriteConfig<IFDAtEnd, SequentialTiles, DirectWrite<BufferWriter>, LazyOffsets>;
+    
+    const uint32_t width = 96, height = 96;
+    const uint32_t rows_per_strip = 16;
+    const uint16_t samples_per_pixel = 3;
+    
+    auto original_data = generate_test_image<PixelType>(width, height, 1, samples_per_pixel);
+    
+    BufferWriter buffer_writer;
+    TiffWriter<PixelType, CompSpec, WriteConfig> writer;
+    auto write_result = writer.write_stripped_image<ImageLayoutSpec::DHWC>(
+        buffer_writer, original_data,
+        width, height, rows_per_strip, samples_per_pixel,
+        PlanarConfiguration::Chunky, CompressionScheme::ZSTD, Predictor::Horizontal
+    );
+    ASSERT_TRUE(write_result.is_ok());
+    
+    auto file_data = buffer_writer.buffer();
+    BufferReader reader(file_data);
+    
+    auto ifd_offset_result = ifd::get_first_ifd_offset<BufferReader, TiffFormatType::Classic, std::endian::little>(reader);
+    ASSERT_TRUE(ifd_offset_result.is_ok());
+    auto ifd_header_result = ifd::read_ifd_header<BufferReader, TiffFormatType::Classic, std::endian::little>(reader, ifd_offset_result.value());
+    ASSERT_TRUE(ifd_header_result.is_ok());
+    std::vector<parsing::TagType<TiffFormatType::Classic, std::endian::little>> tags;
+    auto next_ifd_result = ifd::read_ifd_tags<BufferReader, TiffFormatType::Classic, std::endian::little>(
+        reader, ifd_header_result.value(), tags);
+    ASSERT_TRUE(next_ifd_result.is_ok());
+    ExtractedTags<MinStrippedSpec> metadata;
+    auto extract_result = metadata.extract<BufferReader, TiffFormatType::Classic, std::endian::little>(reader, tags);
+    ASSERT_TRUE(extract_result.is_ok());
+    
+    // Expected DHWC or DCHW crop of the original image
+    auto crop = [&](const ImageRegion& region, bool channels_first) {
+        std::vector<PixelType> expected(region.num_samples());
+        for (uint32_t y = 0; y < region.height; ++y) {
+            for (uint32_t x = 0; x < region.width; ++x) {
+                for (uint16_t c = 0; c < region.num_channels; ++c) {
+                    std::size_t src = ((region.start_y + y) * width + region.start_x + x) * samples_per_pixel +
+                                      region.start_channel + c;
+                    std::size_t dst = channels_first
+                        ? (static_cast<std::size_t>(c) * region.height + y) * region.width + x
+                        : (static_cast<std::size_t>(y) * region.width + x) * region.num_channels + c;
+                    expected[dst] = original_data[src];
+                }
+            }
+        }
+        return expected;
+    };
+    
+    auto check_readers = [&]<ImageLayoutSpec OutSpec>(const ImageRegion& region, bool expect_direct) {
+        auto expected = crop(region, OutSpec != ImageLayoutSpec::DHWC);
+        std::vector<PixelType> output_data(region.num_samples());
+        EXPECT_EQ(expect_direct, (can_decode_into_output<OutSpec, PixelType>(
+            region, metadata, std::span<const PixelType>(output_data))));
+        
+        SimpleReader<PixelType, DecompSpec> simple_reader;
+        ASSERT_TRUE((simple_reader.read_region<OutSpec>(
+            reader, metadata, region, std::span<PixelType>(output_data)).is_ok()));
+        EXPECT_EQ(expected, output_data) << "SimpleReader, rows " << region.start_y << "+" << region.height;
+        
+        IOLimitedReader<PixelType, DecompSpec> io_reader;
+        std::fill(output_data.begin(), output_data.end(), PixelType{0});
+        ASSERT_TRUE((io_reader.read_region<OutSpec>(
+            reader, metadata, region, std::span<PixelType>(output_data)).is_ok()));
+        EXPECT_EQ(expected, output_data) << "IOLimitedReader, rows " << region.start_y << "+" << region.height;
+        
+        CPULimitedReader<PixelType, DecompSpec> cpu_reader;
+        std::fill(output_data.begin(), output_data.end(), PixelType{0});
+        ASSERT_TRUE((cpu_reader.read_region<OutSpec>(
+            reader, metadata, region, std::span<PixelType>(output_data)).is_ok()));
+        EXPECT_EQ(expected, output_data) << "CPULimitedReader, rows " << region.start_y << "+" << region.height;
+    };
+    
+    // Whole image, then strip-aligned rows: every strip decoded in place
+    check_readers.template operator()<ImageLayoutSpec::DHWC>(ImageRegion(0, 0, 0, 0, 3, 1, height, width), true);
+    check_readers.template operator()<ImageLayoutSpec::DHWC>(ImageRegion(0, 0, 16, 0, 3, 1, 64, width), true);
+    // Unaligned rows: inner strips in place, border strips copied
+    check_readers.template operator()<ImageLayoutSpec::DHWC>(ImageRegion(0, 0, 10, 0, 3, 1, 75, width), true);
+    // Layouts where every strip goes through extract_tile_to_buffer
+    check_readers.template operator()<ImageLayoutSpec::DHWC>(ImageRegion(0, 0, 16, 8, 3, 1, 32, 64), true);
+    check_readers.template operator()<ImageLayoutSpec::DHWC>(ImageRegion(1, 0, 0, 0, 2, 1, height, width), false);
+    check_readers.template operator()<ImageLayoutSpec::DCHW>(ImageRegion(0, 0, 0, 0, 3, 1, height, width), false);
+}
+
+// ============================================================================
+// Read Plan Tests (region prepared once, read many times)
+// ============================================================================
+
+TEST(ImageReaderTest, ReadPlan_PreparedOnceReusedByReaders) {
+    using PixelType = uint16_t;
+    using CompSpec = CompressorSpec<NoneCompressorDesc, PackBitsCompressorDesc, ZstdCompressorDesc>;
+    using DecompSpec = DecompressorSpec<NoneDecompressorDesc, PackBitsDecompressorDesc, ZstdDecompressorDesc>;
+    using WriteConfig = WriteConfig<IFDAtEnd, SequentialTiles, DirectWrite<BufferWriter>, LazyOffsets>;
+    
+    const uint32_t width = 128, height = 96;
+    const uint32_t tile_width = 32, tile_height = 32;
+    const uint16_t samples_per_pixel = 2;
+    
+    auto original_data = generate_test_image<PixelType>(width, height, 1, samples_per_pixel);
+    
+    BufferWriter buffer_writer;
+    TiffWriter<PixelType, CompSpec, WriteConfig> writer;
+    auto write_result = writer.write_single_image<ImageLayoutSpec::DHWC>(
+        buffer_writer, original_data,
+        width, height, tile_width, tile_height, samples_per_pixel,
+        PlanarConfiguration::Chunky, CompressionScheme::ZSTD, Predictor::Horizontal
+    );
+    ASSERT_TRUE(write_result.is_ok());
+    
+    auto file_data = buffer_writer.buffer();
+    BufferReader reader(file_data);
+    
+    auto ifd_offset_result = ifd::get_first_ifd_offset<BufferReader, TiffFormatType::Classic, std::endian::little>(reader);
+    ASSERT_TRUE(ifd_offset_result.is_ok());
+    auto ifd_header_result = ifd::read_ifd_header<BufferReader, TiffFormatType::Classic, std::endian::little>(reader, ifd_offset_result.value());
+    ASSERT_TRUE(ifd_header_result.is_ok());
+    std::vector<parsing::TagType<TiffFormatType::Classic, std::endian::little>> tags;
+    auto next_ifd_result = ifd::read_ifd_tags<BufferReader, TiffFormatType::Classic, std::endian::little>(
+        reader, ifd_header_result.value(), tags);
+    ASSERT_TRUE(next_ifd_result.is_ok());
+    ExtractedTags<MinTiledSpec> metadata;
+    auto extract_result = metadata.extract<BufferReader, TiffFormatType::Classic, std::endian::little>(reader, tags);
+    ASSERT_TRUE(extract_result.is_ok());
+    
+    // Rows 20..69, columns 40..99: 3x3 partially covered tiles
+    ImageRegion region(0, 0, 20, 40, samples_per_pixel, 1, 50, 60);
+    ReadPlan<PixelType, ImageLayoutSpec::DHWC> plan;
+    ASSERT_TRUE(plan.prepare(metadata, region).is_ok());
+    EXPECT_EQ(plan.compression(), CompressionScheme::ZSTD);
+    EXPECT_EQ(plan.predictor(), Predictor::Horizontal);
+    EXPECT_EQ(plan.shape().image_width(), width);
+    ASSERT_EQ(plan.tiles().size(), 9u);
+    EXPECT_FALSE(plan.has_direct_tiles());
+    
+    for (std::size_t i = 0; i < plan.tiles().size(); ++i) {
+        const Tile& tile = plan.tiles()[i];
+        const TileCopy& copy = plan.tile_copy(i);
+        EXPECT_EQ(copy.src_pos.x + tile.id.coords.x, copy.dst_pos.x + region.start_x);
+        EXPECT_EQ(copy.src_pos.y + tile.id.coords.y, copy.dst_pos.y + region.start_y);
+        EXPECT_EQ(copy.direct_offset, TileCopy::not_direct);
+    }
+    
+    std::vector<PixelType> expected(region.num_samples());
+    for (uint32_t y = 0; y < region.height; ++y) {
+        for (uint32_t x = 0; x < region.width; ++x) {
+            for (uint16_t c = 0; c < samples_per_pixel; ++c) {
+                expected[(y * region.width + x) * samples_per_pixel + c] =
+                    original_data[((region.start_y + y) * width + region.start_x + x) * samples_per_pixel + c];
+            }
+        }
+    }
+    
+    // The same plan serves every reader, and repeated reads
+    std::vector<PixelType> output_data(region.num_samples());
+    SimpleReader<PixelType, DecompSpec> simple_reader;
+    IOLimitedReader<PixelType, DecompSpec> io_reader;
+    CPULimitedReader<PixelType, DecompSpec> cpu_reader;
+    for (int pass = 0; pass < 2; ++pass) {
+        std::fill(output_data.begin(), output_data.end(), PixelType{0});
+        ASSERT_TRUE(simple_reader.read_region(reader, plan, std::span<PixelType>(output_data)).is_ok());
+        EXPECT_EQ(expected, output_data) << "SimpleReader, pass " << pass;
+        
+        std::fill(output_data.begin(), output_data.end(), PixelType{0});
+        ASSERT_TRUE(io_reader.read_region(reader, plan, std::span<PixelType>(output_data)).is_ok());
+        EXPECT_EQ(expected, output_data) << "IOLimitedReader, pass " << pass;
+        
+        std::fill(output_data.begin(), output_data.end(), PixelType{0});
+        ASSERT_TRUE(cpu_reader.read_region(reader, plan, std::span<PixelType>(output_data)).is_ok());
+        EXPECT_EQ(expected, output_data) << "CPULimitedReader, pass " << pass;
+    }
+    
+    // Output buffers are still checked against the planned region
+    std::vector<PixelType> short_output(region.num_samples() - 1);
+    auto short_result = cpu_reader.read_region(reader, plan, std::span<PixelType>(short_output));
+    ASSERT_FALSE(short_result.is_ok());
+    EXPECT_EQ(short_result.error().code, Error::Code::OutOfBounds);
+    
+    // Pixel type and region are validated once, by prepare()
+    ReadPlan<uint8_t, ImageLayoutSpec::DHWC> wrong_type_plan;
+    EXPECT_FALSE(wrong_type_plan.prepare(metadata, region).is_ok());
+    ImageRegion outside(0, 0, 80, 0, samples_per_pixel, 1, 32, width);
+    EXPECT_FALSE(plan.prepare(metadata, outside).is_ok());
+    EXPECT_TRUE(plan.tiles().empty());
+}
+
+// ============================================================================
+// Batch Buffer Arena Tests
+// ============================================================================
+
+TEST(ImageReaderTest, BatchBufferArena_SizeClassesAndCap) {
+    // Four classes per power of two above 4 KiB
+    EXPECT_EQ(BatchBufferArena::rounded_size(1), 4096u);
+    EXPECT_EQ(BatchBufferArena::rounded_size(4096), 4096u);
+    EXPECT_EQ(BatchBufferArena::rounded_size(4097), 5120u);
+    EXPECT_EQ(BatchBufferArena::rounded_size(8192), 8192u);
+    EXPECT_EQ(BatchBufferArena::rounded_size(8193), 10240u);
+    for (size_t size = 1; size < (size_t{1} << 24); size = size * 3 / 2 + 7) {
+        const size_t rounded = BatchBufferArena::rounded_size(size);
+        EXPECT_GE(rounded, size);
+        EXPECT_LE(rounded, std::max<size_t>(4096, size + size / 4 + 1));
+    }
+
+    BatchBufferArena arena(64 * 1024);
+    {
+        auto a = arena.acquire(10000);
+        ASSERT_TRUE(static_cast<bool>(a));
+        EXPECT_GE(a.capacity(), 10000u);
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(a.data()) % BatchBufferArena::alignment, 0u);
+        std::memset(a.data(), 0xAB, 10000);
+    }
+    auto stats = arena.stats();
+    EXPECT_EQ(stats.misses, 1u);
+    EXPECT_EQ(stats.cached_bytes, BatchBufferArena::rounded_size(10000));
+
+    // Same size class: recycled
+    auto b = arena.acquire(9000);
+    EXPECT_EQ(arena.stats().hits, 1u);
+    EXPECT_EQ(arena.stats().cached_bytes, 0u);
+
+    // Free buffers are capped at 64 KiB: the second 40 KiB buffer is dropped
+    {
+        auto c = arena.acquire(40 * 1024);
+        auto d = arena.acquire(40 * 1024);
+        auto moved = std::move(d);
+        EXPECT_FALSE(static_cast<bool>(d));
+    }
+    stats = arena.stats();
+    EXPECT_EQ(stats.misses, 3u);
+    EXPECT_EQ(stats.dropped, 1u);
+    EXPECT_EQ(stats.cached_bytes, 40u * 1024);
+    b.reset();
+    EXPECT_LE(arena.stats().cached_bytes, arena.max_cached_bytes());
+
+    arena.release_cached();
+    EXPECT_EQ(arena.stats().cached_bytes, 0u);
+
+    // No cap: nothing is kept
+    BatchBufferArena uncached(0);
+    (void)uncached.acquire(100);
+    (void)uncached.acquire(100);
+    EXPECT_EQ(uncached.stats().hits, 0u);
+    EXPECT_EQ(uncached.stats().dropped, 2u);
+}
+
+// ============================================================================
+// Decoded Tile Cache Tests
+// ============================================================================
+
+TEST(ImageReaderTest, DecodedTileCache_LruAndCounters) {
+    // One shard: LRU order is global
+    DecodedTileCache<uint8_t> cache({.max_bytes = 4 * 1024, .shards = 1});
+    EXPECT_EQ(cache.max_bytes(), 4u * 1024);
+    auto key = [](uint32_t index) { return TileCacheKey{7, 8, index}; };
+    std::vector<uint8_t> tile(1024);
+    for (uint32_t i = 0; i < 4; ++i) {
+        std::fill(tile.begin(), tile.end(), static_cast<uint8_t>(i));
+        cache.insert(key(i), tile);
+    }
+    EXPECT_EQ(cache.stats().entries, 4u);
+    EXPECT_EQ(cache.stats().bytes, 4u * 1024);
+
+    // Tile 0 becomes the most recently used: inserting tile 4 evicts tile 1
+    auto hit = cache.find(key(0));
+    ASSERT_TRUE(hit);
+    EXPECT_EQ(hit->size(), 1024u);
+    EXPECT_EQ((*hit)[0], 0);
+    std::fill(tile.begin(), tile.end(), uint8_t{4});
+    cache.insert(key(4), tile);
+    EXPECT_FALSE(cache.find(key(1)));
+    EXPECT_TRUE(cache.find(key(0)));
+    EXPECT_EQ((*hit)[1023], 0);  // Still alive, whatever happens to the entry
+
+    // Same key of another image
+    EXPECT_FALSE(cache.find(TileCacheKey{7, 9, 0}));
+
+    // Already cached, or larger than the budget: ignored
+    cache.insert(key(0), tile);
+    cache.insert(key(9), std::vector<uint8_t>(5000));
+
+    auto stats = cache.stats();
+    EXPECT_EQ(stats.hits, 2u);
+    EXPECT_EQ(stats.misses, 2u);
+    EXPECT_EQ(stats.insertions, 5u);
+    EXPECT_EQ(stats.evictions, 1u);
+    EXPECT_EQ(stats.entries, 4u);
+    EXPECT_EQ(stats.bytes, 4u * 1024);
+
+    cache.clear();
+    EXPECT_EQ(cache.stats().entries, 0u);
+    EXPECT_EQ(cache.stats().bytes, 0u);
+    EXPECT_FALSE(cache.find(key(0)));
+
+    // Shards are a power of two, each with its share of the budget
+    DecodedTileCache<uint16_t> sharded({.max_bytes = 1024 * 1024, .shards = 5});
+    EXPECT_EQ(sharded.shard_count(), 8u);
+    std::vector<uint16_t> small_tile(64, 1);
+    for (uint32_t i = 0; i < 1000; ++i) {
+        sharded.insert(TileCacheKey{1, 2, i}, small_tile);
+    }
+    EXPECT_EQ(sharded.stats().entries, 1000u);
+    EXPECT_EQ(sharded.stats().evictions, 0u);
+}
+
+// ============================================================================
+// File-backed Reader Tests (direct I/O)
+// ============================================================================
+
+namespace {
+
+// Write a ZSTD + horizontal predictor tiled image to a temporary file and
+// extract its metadata. Returns the file path.
+template <typename PixelType>
+std::filesystem::path write_async_test_file(
+    const std::string& filename,
+    const std::vector<PixelType>& data,
+    uint32_t width, uint32_t height, uint32_t tile_width, uint32_t tile_height,
+    ExtractedTags<MinTiledSpec>& metadata) {
+    using CompSpec = CompressorSpec<NoneCompressorDesc, PackBitsCompressorDesc, ZstdCompressorDesc>;
+    using WriteConfig = WriteConfig<IFDAtEnd, SequentialTiles, DirectWrite<BufferWriter>, LazyOffsets>;
+
+    BufferWriter buffer_writer;
+    TiffWriter<PixelType, CompSpec, WriteConfig> writer;
+    auto write_result = writer.template write_single_image<ImageLayoutSpec::DHWC>(
+        buffer_writer, data,
+        width, height, tile_width, tile_height, 1,
+        PlanarConfiguration::Chunky, CompressionScheme::ZSTD, Predictor::Horizontal
+    );
+    EXPECT_TRUE(write_result.is_ok());
+
+    auto file_data = buffer_writer.buffer();
+    BufferReader reader(file_data);
+    auto ifd_offset_result = ifd::get_first_ifd_offset<BufferReader, TiffFormatType::Classic, std::endian::little>(reader);
+    EXPECT_TRUE(ifd_offset_result.is_ok());
+    auto ifd_header_result = ifd::read_ifd_header<BufferReader, TiffFormatType::Classic, std::endian::little>(reader, ifd_offset_result.value());
+    EXPECT_TRUE(ifd_header_result.is_ok());
+    std::vector<parsing::TagType<TiffFormatType::Classic, std::endian::little>> tags;
+    auto next_ifd_result = ifd::read_ifd_tags<BufferReader, TiffFormatType::Classic, std::endian::little>(
+        reader, ifd_header_result.value(), tags);
+    EXPECT_TRUE(next_ifd_result.is_ok());
+    auto extract_result = metadata.extract<BufferReader, TiffFormatType::Classic, std::endian::little>(reader, tags);
+    EXPECT_TRUE(extract_result.is_ok());
+
+    auto path = std::filesystem::temp_directory_path() / filename;
+    std::ofstream file(path, std::ios::binary);
+    file.write(reinterpret_cast<const char*>(file_data.data()), static_cast<std::streamsize>(file_data.size()));
+    return path;
+}
+
+} // namespace
+
+TEST(ImageReaderTest, CPULimitedReader_TileCache) {
+    using PixelType = uint16_t;
+    using DecompSpec = DecompressorSpec<NoneDecompressorDesc, PackBitsDecompressorDesc, ZstdDecompressorDesc>;
+
+    const uint32_t width = 256, height = 256;
+    auto original_data = generate_test_image<PixelType>(width, height, 1, 1);
+
+    ExtractedTags<MinTiledSpec> metadata;
+    auto path = write_async_test_file<PixelType>("test_cpu_reader_cache.tif", original_data, width, height, 32, 32, metadata);
+    std::vector<std::byte> file_data(std::filesystem::file_size(path));
+    {
+        std::ifstream file(path, std::ios::binary);
+        file.read(reinterpret_cast<char*>(file_data.data()), static_cast<std::streamsize>(file_data.size()));
+    }
+    std::filesystem::remove(path);
+    BufferReader reader(file_data);
+
+    auto expected_for = [&](const ImageRegion& region) {
+        std::vector<PixelType> expected(region.num_samples());
+        for (uint32_t y = 0; y < region.height; ++y) {
+            for (uint32_t x = 0; x < region.width; ++x) {
+                expected[y * region.width + x] = original_data[(region.start_y + y) * width + region.start_x + x];
+            }
+        }
+        return expected;
+    };
+
+    auto cache = std::make_shared<DecodedTileCache<PixelType>>();
+    CPULimitedReader<PixelType, DecompSpec> cpu_reader({.worker_threads = 2, .tile_cache = cache});
+    const TileCacheScope scope{1, 8};
+
+    // 4x4 tiles: all decoded, then all cached
+    const ImageRegion region_a(0, 0, 0, 0, 1, 1, 100, 100);
+    for (int pass = 0; pass < 2; ++pass) {
+        std::vector<PixelType> output(region_a.num_samples(), 0);
+        ASSERT_TRUE(cpu_reader.read_region<ImageLayoutSpec::DHWC>(
+            reader, metadata, region_a, std::span<PixelType>(output), scope).is_ok());
+        EXPECT_EQ(expected_for(region_a), output) << "pass " << pass;
+    }
+    auto stats = cache->stats();
+    EXPECT_EQ(stats.misses, 16u);
+    EXPECT_EQ(stats.insertions, 16u);
+    EXPECT_EQ(stats.hits, 16u);
+
+    // Overlapping region: 4 of its 16 tiles are cached
+    const ImageRegion region_b(0, 0, 64, 64, 1, 1, 100, 100);
+    std::vector<PixelType> output_b(region_b.num_samples(), 0);
+    ASSERT_TRUE(cpu_reader.read_region<ImageLayoutSpec::DHWC>(
+        reader, metadata, region_b, std::span<PixelType>(output_b), scope).is_ok());
+    EXPECT_EQ(expected_for(region_b), output_b);
+    EXPECT_EQ(cache->stats().hits, 20u);
+    EXPECT_EQ(cache->stats().misses, 28u);
+
+    // Cached tiles are not read: the file content does not matter anymore
+    std::vector<std::byte> zeros(file_data.size());
+    BufferReader zero_reader(zeros);
+    std::vector<PixelType> output_a(region_a.num_samples(), 0);
+    ASSERT_TRUE(cpu_reader.read_region<ImageLayoutSpec::DHWC>(
+        zero_reader, metadata, region_a, std::span<PixelType>(output_a), scope).is_ok());
+    EXPECT_EQ(expected_for(region_a), output_a);
+
+    // Without scope, or for another image, the cache is not used
+    EXPECT_FALSE(cpu_reader.read_region<ImageLayoutSpec::DHWC>(
+        zero_reader, metadata, region_a, std::span<PixelType>(output_a)).is_ok());
+    EXPECT_FALSE(cpu_reader.read_region<ImageLayoutSpec::DHWC>(
+        zero_reader, metadata, region_a, std::span<PixelType>(output_a), TileCacheScope{2, 8}).is_ok());
+}
+
+TEST(ImageReaderTest, ReadRegions_DeduplicatesSharedTiles) {
+    using PixelType = uint16_t;
+    using DecompSpec = DecompressorSpec<NoneDecompressorDesc, PackBitsDecompressorDesc, ZstdDecompressorDesc>;
+
+    const uint32_t width = 256, height = 256;
+    auto original_data = generate_test_image<PixelType>(width, height, 1, 1);
+
+    ExtractedTags<MinTiledSpec> metadata;
+    auto path = write_async_test_file<PixelType>("test_read_regions.tif", original_data, width, height, 32, 32, metadata);
+    std::vector<std::byte> file_data(std::filesystem::file_size(path));
+    {
+        std::ifstream file(path, std::ios::binary);
+        file.read(reinterpret_cast<char*>(file_data.data()), static_cast<std::streamsize>(file_data.size()));
+    }
+    std::filesystem::remove(path);
+
+    auto expected_for = [&](const ImageRegion& region) {
+        std::vector<PixelType> expected(region.num_samples());
+        for (uint32_t y = 0; y < region.height; ++y) {
+            for (uint32_t x = 0; x < region.width; ++x) {
+                expected[y * region.width + x] = original_data[(region.start_y + y) * width + region.start_x + x];
+            }
+        }
+        return expected;
+    };
+
+    // Two overlapping patches on the same 2x2 tiles, one tile of them read
+    // alone (decoded in place), and a 3x3 patch elsewhere: 13 distinct tiles
+    const std::vector<ImageRegion> regions = {
+        ImageRegion(0, 0, 0, 0, 1, 1, 48, 48),
+        ImageRegion(0, 0, 16, 16, 1, 1, 48, 48),
+        ImageRegion(0, 0, 32, 32, 1, 1, 32, 32),
+        ImageRegion(0, 0, 100, 100, 1, 1, 64, 64),
+    };
+    MultiRegionPlan<PixelType, ImageLayoutSpec::DHWC> plan;
+    ASSERT_TRUE(plan.prepare(metadata, regions).is_ok());
+    ASSERT_EQ(plan.num_regions(), regions.size());
+    ASSERT_EQ(plan.tiles().size(), 13u);
+    size_t uses = 0;
+    uint64_t distinct_bytes = 0;
+    for (size_t i = 0; i < plan.tiles().size(); ++i) {
+        uses += plan.tile_uses(i);
+        distinct_bytes += plan.tiles()[i].location.length;
+        if (i > 0) {
+            EXPECT_LT(plan.tiles()[i - 1].location.offset, plan.tiles()[i].location.offset);
+        }
+    }
+    EXPECT_EQ(uses, 18u);
+
+    std::vector<std::vector<PixelType>> buffers;
+    std::vector<std::span<PixelType>> outputs;
+    auto reset_outputs = [&] {
+        buffers.clear();
+        outputs.clear();
+        for (const auto& region : regions) {
+            buffers.emplace_back(region.num_samples(), 0);
+        }
+        for (auto& buffer : buffers) {
+            outputs.emplace_back(buffer);
+        }
+    };
+    auto check_outputs = [&](const char* reader_name) {
+        for (size_t i = 0; i < regions.size(); ++i) {
+            EXPECT_EQ(expected_for(regions[i]), buffers[i]) << reader_name << ", region " << i;
+        }
+    };
+
+    // Every reader reads each distinct tile once (one request per tile when not batched)
+    using RemoteReader = SimulatedRemoteReader<BufferReader>;
+    const RemoteReader::Config remote_config{.latency = std::chrono::microseconds(0)};
+    {
+        RemoteReader remote(BufferReader(file_data), remote_config);
+        SimpleReader<PixelType, DecompSpec> simple_reader;
+        reset_outputs();
+        ASSERT_TRUE(simple_reader.read_regions<ImageLayoutSpec::DHWC>(remote, metadata, regions, outputs).is_ok());
+        check_outputs("SimpleReader");
+        EXPECT_EQ(remote.stats().requests, 13u);
+        EXPECT_EQ(remote.stats().bytes, distinct_bytes);
+    }
+    {
+        RemoteReader remote(BufferReader(file_data), remote_config);
+        IOLimitedReader<PixelType, DecompSpec> io_reader({.io_threads = 2, .max_batch_size = 1});
+        reset_outputs();
+        ASSERT_TRUE(io_reader.read_regions<ImageLayoutSpec::DHWC>(remote, metadata, regions, outputs).is_ok());
+        check_outputs("IOLimitedReader");
+        EXPECT_EQ(remote.stats().requests, 13u);
+        EXPECT_EQ(io_reader.io_stats().bytes_needed, distinct_bytes);
+        EXPECT_EQ(io_reader.plan_batches(remote, plan).batches.size(), 13u);
+    }
+    {
+        RemoteReader remote(BufferReader(file_data), remote_config);
+        auto cache = std::make_shared<DecodedTileCache<PixelType>>();
+        CPULimitedReader<PixelType, DecompSpec> cpu_reader({.worker_threads = 2, .tile_cache = cache});
+        const TileCacheScope scope{1, 8};
+        for (int pass = 0; pass < 2; ++pass) {
+            reset_outputs();
+            ASSERT_TRUE(cpu_reader.read_regions(remote, plan, outputs, scope).is_ok());
+            check_outputs("CPULimitedReader");
+        }
+        // Second pass: every distinct tile is copied from the cache
+        EXPECT_EQ(remote.stats().requests, 13u);
+        EXPECT_EQ(cache->stats().insertions, 13u);
+        EXPECT_EQ(cache->stats().hits, 13u);
+    }
+    {
+        RemoteReader remote(BufferReader(file_data), remote_config);
+        FastReader<PixelType, DecompSpec> fast_reader({.worker_threads = 2, .max_batch_size = 1});
+        reset_outputs();
+        ASSERT_TRUE(fast_reader.read_regions<ImageLayoutSpec::DHWC>(remote, metadata, regions, outputs).is_ok());
+        check_outputs("FastReader");
+        EXPECT_EQ(remote.stats().requests, 13u);
+        EXPECT_EQ(fast_reader.io_stats().bytes_needed, distinct_bytes);
+    }
+
+    // One output buffer per region, each matching its region
+    BufferReader reader(file_data);
+    CPULimitedReader<PixelType, DecompSpec> cpu_reader({.worker_threads = 1});
+    reset_outputs();
+    auto result = cpu_reader.read_regions(reader, plan, std::span<const std::span<PixelType>>(outputs).first(3));
+    ASSERT_FALSE(result.is_ok());
+    EXPECT_EQ(result.error().code, Error::Code::OutOfBounds);
+    outputs[1] = outputs[1].first(10);
+    EXPECT_FALSE(cpu_reader.read_regions(reader, plan, outputs).is_ok());
+}
+
+TEST(ImageReaderTest, ReadPages_StackBatchedAcrossPages) {
+    using PixelType = uint16_t;
+    using DecompSpec = DecompressorSpec<NoneDecompressorDesc, PackBitsDecompressorDesc, ZstdDecompressorDesc>;
+
+    // Three 128x128 pages stored one after the other (as in a multipage file)
+    const uint32_t width = 128, height = 128;
+    const size_t num_pages = 3;
+    std::vector<std::vector<PixelType>> page_data;
+    std::vector<ExtractedTags<MinTiledSpec>> pages(num_pages);
+    std::vector<std::byte> file_data;
+    for (size_t page = 0; page < num_pages; ++page) {
+        page_data.push_back(generate_test_image<PixelType>(width, height, 1, 1, 42 + page));
+        auto path = write_async_test_file<PixelType>("test_read_pages.tif", page_data.back(), width, height, 32, 32, pages[page]);
+        const size_t page_offset = file_data.size();
+        file_data.resize(page_offset + std::filesystem::file_size(path));
+        std::ifstream file(path, std::ios::binary);
+        file.read(reinterpret_cast<char*>(file_data.data() + page_offset), static_cast<std::streamsize>(file_data.size() - page_offset));
+        file.close();
+        std::filesystem::remove(path);
+        for (auto& offset : pages[page].get<TagCode::TileOffsets>()) {
+            offset += static_cast<uint32_t>(page_offset);
+        }
+    }
+
+    // Bottom tile row of every page: the last tiles of a page and the first
+    // of the next one are separated by the IFD and the other tiles of the page
+    const ImageRegion region(0, 0, 96, 0, 1, 1, 32, width);
+    std::vector<PixelType> expected;
+    for (const auto& data : page_data) {
+        expected.insert(expected.end(), data.begin() + 96 * width, data.end());
+    }
+    const std::span<const ExtractedTags<MinTiledSpec>> page_span(pages);
+
+    PageStackPlan<PixelType, ImageLayoutSpec::DHWC> plan;
+    ASSERT_TRUE(plan.prepare(page_span, region).is_ok());
+    ASSERT_EQ(plan.num_pages(), num_pages);
+    EXPECT_EQ(plan.page_samples(), region.num_samples());
+    ASSERT_EQ(plan.tiles().size(), 4 * num_pages);
+    for (size_t i = 0; i < plan.tiles().size(); ++i) {
+        EXPECT_EQ(plan.tile_page(i), i / 4);
+        if (i > 0) {
+            EXPECT_LT(plan.tiles()[i - 1].location.offset, plan.tiles()[i].location.offset);
+        }
+    }
+
+    using RemoteReader = SimulatedRemoteReader<BufferReader>;
+    const RemoteReader::Config remote_config{.latency = std::chrono::microseconds(0)};
+    std::vector<PixelType> output(expected.size());
+    {
+        RemoteReader remote(BufferReader(file_data), remote_config);
+        SimpleReader<PixelType, DecompSpec> simple_reader;
+        std::fill(output.begin(), output.end(), 0);
+        ASSERT_TRUE(simple_reader.read_pages<ImageLayoutSpec::DHWC>(remote, page_span, region, std::span<PixelType>(output)).is_ok());
+        EXPECT_EQ(output, expected);
+    }
+    {
+        // Gaps bridged: the pages are read with a single request, as one batch
+        RemoteReader remote(BufferReader(file_data), remote_config);
+        IOLimitedReader<PixelType, DecompSpec> io_reader({.io_threads = 2, .max_gap_size = 1 << 20});
+        std::fill(output.begin(), output.end(), 0);
+        ASSERT_TRUE(io_reader.read_pages<ImageLayoutSpec::DHWC>(remote, page_span, region, std::span<PixelType>(output)).is_ok());
+        EXPECT_EQ(output, expected);
+        EXPECT_EQ(remote.stats().requests, 1u);
+
+        // Gaps not bridged: one batch per page (its 4 tiles are contiguous)
+        IOLimitedReader<PixelType, DecompSpec> exact_reader({.io_threads = 2, .max_gap_size = 0});
+        EXPECT_EQ(exact_reader.plan_batches(remote, plan).batches.size(), num_pages);
+    }
+    {
+        RemoteReader remote(BufferReader(file_data), remote_config);
+        CPULimitedReader<PixelType, DecompSpec> cpu_reader({.worker_threads = 2});
+        std::fill(output.begin(), output.end(), 0);
+        ASSERT_TRUE(cpu_reader.read_pages(remote, plan, std::span<PixelType>(output)).is_ok());
+        EXPECT_EQ(output, expected);
+        EXPECT_EQ(remote.stats().requests, 4 * num_pages);
+    }
+    {
+        RemoteReader remote(BufferReader(file_data), remote_config);
+        FastReader<PixelType, DecompSpec> fast_reader({.worker_threads = 2, .max_gap_size = 1 << 20});
+        std::fill(output.begin(), output.end(), 0);
+        ASSERT_TRUE(fast_reader.read_pages<ImageLayoutSpec::DHWC>(remote, page_span, region, std::span<PixelType>(output)).is_ok());
+        EXPECT_EQ(output, expected);
+        EXPECT_EQ(remote.stats().requests, 1u);
+    }
+
+    // The output holds the region of every page
+    BufferReader reader(file_data);
+    CPULimitedReader<PixelType, DecompSpec> cpu_reader({.worker_threads = 1});
+    auto result = cpu_reader.read_pages(reader, plan, std::span<PixelType>(output).first(plan.page_samples()));
+    ASSERT_FALSE(result.is_ok());
+    EXPECT_EQ(result.error().code, Error::Code::OutOfBounds);
+    EXPECT_FALSE(plan.prepare(page_span, ImageRegion(0, 0, 100, 0, 1, 1, 32, width)).is_ok());
+}
+
+TEST(ImageReaderTest, BatchingReaders_SimulatedRemote) {
+    using PixelType = uint16_t;
+    using DecompSpec = DecompressorSpec<NoneDecompressorDesc, PackBitsDecompressorDesc, ZstdDecompressorDesc>;
+
+    const uint32_t width = 256, height = 256;
+    auto original_data = generate_test_image<PixelType>(width, height, 1, 1);
+
+    ExtractedTags<MinTiledSpec> metadata;
+    auto path = write_async_test_file<PixelType>("test_remote_reader.tif", original_data, width, height, 32, 32, metadata);
+    std::vector<std::byte> file_data(std::filesystem::file_size(path));
+    {
+        std::ifstream file(path, std::ios::binary);
+        file.read(reinterpret_cast<char*>(file_data.data()), static_cast<std::streamsize>(file_data.size()));
+    }
+    std::filesystem::remove(path);
+    const ImageRegion region(0, 0, 0, 0, 1, 1, height, width);
+
+    using RemoteReader = SimulatedRemoteReader<BufferReader>;
+    const RemoteReader::Config remote_config{.latency = std::chrono::microseconds(500), .max_concurrent_requests = 4};
+
+    // Requests per read of the 64 tiles (stored contiguously)
+    auto io_limited_requests = [&](size_t max_batch_size) -> uint64_t {
+        RemoteReader remote(BufferReader(file_data), remote_config);
+        IOLimitedReader<PixelType, DecompSpec> io_reader({.io_threads = 2, .max_batch_size = max_batch_size});
+        std::vector<PixelType> output(region.num_samples(), 0);
+        auto result = io_reader.read_region<ImageLayoutSpec::DHWC>(remote, metadata, region, std::span<PixelType>(output));
+        EXPECT_TRUE(result.is_ok()) << result.error().message;
+        EXPECT_TRUE(compare_images<PixelType>(original_data, output));
+        return remote.stats().requests;
+    };
+    auto fast_requests = [&](size_t max_batch_size) -> uint64_t {
+        RemoteReader remote(BufferReader(file_data), remote_config);
+        FastReader<PixelType, DecompSpec> fast_reader({.worker_threads = 2, .max_batch_size = max_batch_size});
+        std::vector<PixelType> output(region.num_samples(), 0);
+        auto result = fast_reader.read_region<ImageLayoutSpec::DHWC>(remote, metadata, region, std::span<PixelType>(output));
+        EXPECT_TRUE(result.is_ok()) << result.error().message;
+        EXPECT_TRUE(compare_images<PixelType>(original_data, output));
+        EXPECT_EQ(remote.pending_operations(), 0u);
+        return remote.stats().requests;
+    };
+
+    EXPECT_EQ(io_limited_requests(1), 64u);
+    EXPECT_LT(io_limited_requests(8 * 1024), 64u);
+    EXPECT_EQ(io_limited_requests(4 * 1024 * 1024), 1u);
+    EXPECT_EQ(fast_requests(1), 64u);
+    EXPECT_LT(fast_requests(8 * 1024), 64u);
+    EXPECT_EQ(fast_requests(4 * 1024 * 1024), 1u);
+}
+
+TEST(ImageReaderTest, AdaptiveBatchPlanner_CostModel) {
+    // Synthetic storage: 2 ms per request, 100 MB/s
+    auto read_time = [](size_t bytes) {
+        return std::chrono::nanoseconds(2'000'000 + static_cast<int64_t>(bytes) * 10);
+    };
+    AdaptiveBatchPlanner planner({.smoothing = 0.2, .initial_latency = std::chrono::nanoseconds(0)});
+    EXPECT_EQ(planner.break_even_gap(), 0u);
+    for (int i = 0; i < 200; ++i) {
+        const size_t bytes = 4096 + static_cast<size_t>(i % 7) * 65536;
+        planner.record(bytes, read_time(bytes));
+    }
+    const IoCostEstimate estimate = planner.estimate();
+    EXPECT_EQ(estimate.samples, 200u);
+    EXPECT_NEAR(estimate.latency_seconds, 0.002, 1e-4);
+    EXPECT_NEAR(estimate.bandwidth_bytes_per_second, 1e8, 1e6);
+    EXPECT_NEAR(static_cast<double>(planner.break_even_gap()), 200'000.0, 2'000.0);
+
+    // Tiles of 10 KB, 105 KB apart then 300 KB apart: only the first gap is worth reading
+    std::vector<Tile> tiles(3);
+    tiles[0].location = {0, 10'000};
+    tiles[1].location = {115'000, 10'000};
+    tiles[2].location = {425'000, 10'000};
+    BatchPlan plan = planner.plan(tiles, 1, 4 * 1024 * 1024);
+    ASSERT_EQ(plan.batches.size(), 2u);
+    EXPECT_EQ(plan.batches[0].tile_count, 2u);
+    EXPECT_EQ(plan.batches[0].total_size, 125'000u);
+    EXPECT_EQ(plan.batches[1].first_tile_index, 2u);
+    EXPECT_EQ(plan.bytes_needed, 30'000u);
+    EXPECT_EQ(plan.bytes_read, 135'000u);
+    EXPECT_NEAR(plan.amplification(), 135.0 / 30.0, 1e-9);
+    EXPECT_NEAR(plan.expected_seconds, 2 * 0.002 + 135'000 / 1e8, 1e-4);
+
+    // Twice the concurrency halves the value of a saved request
+    AdaptiveBatchPlanner parallel({.initial_latency = std::chrono::milliseconds(2),
+                                   .initial_bandwidth = 1e8, .concurrency = 2});
+    EXPECT_EQ(parallel.plan(tiles, 1, 4 * 1024 * 1024).batches.size(), 3u);
+
+    // Static batching of the same tiles, and the memory bound
+    EXPECT_EQ(make_batch_plan(tiles, 1, 4 * 1024 * 1024, 64 * 1024).batches.size(), 3u);
+    EXPECT_EQ(make_batch_plan(tiles, 1, 4 * 1024 * 1024, 1024 * 1024).batches.size(), 1u);
+    EXPECT_EQ(make_batch_plan(tiles, 1, 100'000, 1024 * 1024).batches.size(), 3u);
+}
+
+TEST(ImageReaderTest, BatchingReaders_AdaptiveBatching) {
+    using PixelType = uint16_t;
+    using DecompSpec = DecompressorSpec<NoneDecompressorDesc, PackBitsDecompressorDesc, ZstdDecompressorDesc>;
+
+    const uint32_t width = 256, height = 256;
+    auto original_data = generate_test_image<PixelType>(width, height, 1, 1);
+
+    ExtractedTags<MinTiledSpec> metadata;
+    auto path = write_async_test_file<PixelType>("test_adaptive_batching.tif", original_data, width, height, 32, 32, metadata);
+    std::vector<std::byte> file_data(std::filesystem::file_size(path));
+    {
+        std::ifstream file(path, std::ios::binary);
+        file.read(reinterpret_cast<char*>(file_data.data()), static_cast<std::streamsize>(file_data.size()));
+    }
+    std::filesystem::remove(path);
+    SimulatedRemoteReader<BufferReader> remote(BufferReader(file_data),
+                                               {.latency = std::chrono::milliseconds(2),
+                                                .bandwidth_bytes_per_second = 100 * 1000 * 1000});
+
+    // 2x2 tiles on the left of the image: the two tile rows are 6 tiles apart
+    const ImageRegion region(0, 0, 0, 0, 1, 1, 64, 64);
+    ReadPlan<PixelType, ImageLayoutSpec::DHWC> plan;
+    ASSERT_TRUE(plan.prepare(metadata, region).is_ok());
+
+    // Without measurements (no latency assumed), no gap is worth reading
+    auto planner = std::make_shared<AdaptiveBatchPlanner>(
+        AdaptiveBatchPlanner::Config{.initial_latency = std::chrono::nanoseconds(0)});
+    IOLimitedReader<PixelType, DecompSpec> io_reader({.io_threads = 1, .batch_planner = planner});
+    BatchPlan batch_plan = io_reader.plan_batches(remote, plan);
+    ASSERT_EQ(batch_plan.batches.size(), 2u);
+    EXPECT_DOUBLE_EQ(batch_plan.amplification(), 1.0);
+
+    std::vector<PixelType> output(region.num_samples(), 0);
+    auto expected = [&] {
+        std::vector<PixelType> pixels(region.num_samples());
+        for (uint32_t y = 0; y < region.height; ++y) {
+            std::copy_n(original_data.begin() + y * width, region.width, pixels.begin() + y * region.width);
+        }
+        return pixels;
+    }();
+    ASSERT_TRUE(io_reader.read_region(remote, plan, std::span<PixelType>(output)).is_ok());
+    EXPECT_EQ(output, expected);
+    EXPECT_EQ(io_reader.io_stats().requests, 2u);
+
+    // Measured 2 ms requests make the gap (a few KB of compressed tiles) worth reading
+    EXPECT_GT(planner->estimate().latency_seconds, 0.001);
+    batch_plan = io_reader.plan_batches(remote, plan);
+    ASSERT_EQ(batch_plan.batches.size(), 1u);
+    EXPECT_GT(batch_plan.amplification(), 1.0);
+    EXPECT_GT(batch_plan.expected_seconds, 0.001);
+
+    std::fill(output.begin(), output.end(), 0);
+    ASSERT_TRUE(io_reader.read_region(remote, plan, std::span<PixelType>(output)).is_ok());
+    EXPECT_EQ(output, expected);
+    const BatchIoStats stats = io_reader.io_stats();
+    EXPECT_EQ(stats.requests, 3u);
+    EXPECT_EQ(stats.bytes_read, 2 * batch_plan.bytes_needed + batch_plan.bytes_read - batch_plan.bytes_needed);
+    EXPECT_GT(stats.amplification(), 1.0);
+    EXPECT_EQ(remote.stats().requests, 3u);
+
+    // FastReader feeds the same planner from its completions
+    FastReader<PixelType, DecompSpec> fast_reader({.worker_threads = 1, .batch_planner = planner});
+    const uint64_t samples = planner->estimate().samples;
+    std::fill(output.begin(), output.end(), 0);
+    ASSERT_TRUE(fast_reader.read_region(remote, plan, std::span<PixelType>(output)).is_ok());
+    EXPECT_EQ(output, expected);
+    EXPECT_EQ(fast_reader.io_stats().requests, 1u);
+    EXPECT_EQ(planner->estimate().samples, samples + 1);
+}
+
+#ifdef __unix__
+TEST(ImageReaderTest, IOLimitedReader_DirectIO) {
+    using PixelType = uint16_t;
+    using DecompSpec = DecompressorSpec<NoneDecompressorDesc, PackBitsDecompressorDesc, ZstdDecompressorDesc>;
+
+    const uint32_t width = 256, height = 192;
+    auto original_data = generate_test_image<PixelType>(width, height, 1, 1);
+
+    // Small tiles: several tiles per block, batches never aligned by chance
+    ExtractedTags<MinTiledSpec> metadata;
+    auto path = write_async_test_file<PixelType>("test_io_reader_direct.tif", original_data, width, height, 16, 16, metadata);
+    PreadDirectFileReader reader(path.string());
+    ASSERT_TRUE(reader.is_valid());
+    if (!reader.direct_io()) {
+        std::filesystem::remove(path);
+        GTEST_SKIP() << "File system without O_DIRECT support";
+    }
+
+    // Default batching, and batches split on every gap / a few blocks
+    IOLimitedReader<PixelType, DecompSpec> default_reader;
+    IOLimitedReader<PixelType, DecompSpec> split_reader({.io_threads = 2, .max_batch_size = 3000, .max_gap_size = 0});
+    const ImageRegion regions[] = {
+        ImageRegion(0, 0, 0, 0, 1, 1, height, width),
+        ImageRegion(0, 0, 37, 21, 1, 1, 101, 150),
+    };
+    for (const auto& region : regions) {
+        std::vector<PixelType> expected(region.num_samples());
+        for (uint32_t y = 0; y < region.height; ++y) {
+            for (uint32_t x = 0; x < region.width; ++x) {
+                expected[y * region.width + x] = original_data[(region.start_y + y) * width + region.start_x + x];
+            }
+        }
+        for (auto* io_reader : {&default_reader, &split_reader}) {
+            std::vector<PixelType> output(region.num_samples(), 0);
+            auto result = io_reader->read_region<ImageLayoutSpec::DHWC>(reader, metadata, region, std::span<PixelType>(output));
+            ASSERT_TRUE(result.is_ok()) << result.error().message;
+            EXPECT_EQ(expected, output);
+        }
+    }
+
+    std::filesystem::remove(path);
+}
+TEST(ImageReaderTest, IOLimitedReader_RecyclesBatchBuffers) {
+    using PixelType = uint16_t;
+    using DecompSpec = DecompressorSpec<NoneDecompressorDesc, PackBitsDecompressorDesc, ZstdDecompressorDesc>;
+
+    const uint32_t width = 256, height = 256;
+    auto original_data = generate_test_image<PixelType>(width, height, 1, 1);
+
+    ExtractedTags<MinTiledSpec> metadata;
+    auto path = write_async_test_file<PixelType>("test_io_reader_buffers.tif", original_data, width, height, 32, 32, metadata);
+    PreadFileReader reader(path.string());
+    ASSERT_TRUE(reader.is_valid());
+    const ImageRegion region(0, 0, 0, 0, 1, 1, height, width);
+
+    auto read_twice = [&](IOLimitedReader<PixelType, DecompSpec>& io_reader) {
+        for (int pass = 0; pass < 2; ++pass) {
+            std::vector<PixelType> output(region.num_samples(), 0);
+            auto result = io_reader.read_region<ImageLayoutSpec::DHWC>(reader, metadata, region, std::span<PixelType>(output));
+            ASSERT_TRUE(result.is_ok()) << result.error().message;
+            EXPECT_TRUE(compare_images<PixelType>(original_data, output)) << "pass " << pass;
+        }
+    };
+
+    // At most one allocation per batch over both passes: the second pass
+    // reuses the buffers of the first
+    IOLimitedReader<PixelType, DecompSpec> io_reader({.io_threads = 2, .max_batch_size = 8 * 1024});
+    read_twice(io_reader);
+    auto stats = io_reader.buffer_stats();
+    EXPECT_GT(stats.misses, 1u);
+    EXPECT_GE(stats.hits, stats.misses);
+    EXPECT_EQ(stats.dropped, 0u);
+    EXPECT_GT(stats.cached_bytes, 0u);
+
+    // Without cache every batch allocates
+    IOLimitedReader<PixelType, DecompSpec> uncached_reader({.io_threads = 2, .max_batch_size = 8 * 1024,
+                                                            .max_cached_buffer_bytes = 0});
+    read_twice(uncached_reader);
+    stats = uncached_reader.buffer_stats();
+    EXPECT_EQ(stats.hits, 0u);
+    EXPECT_EQ(stats.dropped, stats.misses);
+    EXPECT_EQ(stats.cached_bytes, 0u);
+
+    std::filesystem::remove(path);
+}
+#endif
+
+// ============================================================================
+// FastReader Tests (async I/O)
+// ============================================================================
+
+#ifdef HAVE_LIBURING
+
+TEST(ImageReaderTest, FastReader_ReadTiledImage_ZSTD_WorkerCounts) {
+    using PixelType = uint16_t;
+    using DecompSpec = DecompressorSpec<NoneDecompressorDesc, PackBitsDecompressorDesc, ZstdDecompressorDesc>;
+
+    const uint32_t width = 512, height = 512;
+    auto original_data = generate_test_image<PixelType>(width, height, 1, 1);
+
+    ExtractedTags<MinTiledSpec> metadata;
+    auto path = write_async_test_file<PixelType>("test_fast_reader_workers.tif", original_data, width, height, 64, 64, metadata);
+    IoUringFileReader reader(path.string());
+    ASSERT_TRUE(reader.is_valid());
+
+    TiledImageInfo<PixelType> image_info;
+    ASSERT_TRUE(image_info.update_from_metadata(metadata).is_ok());
+    auto region = image_info.shape().full_region();
+
+    for (size_t workers : {1, 2, 4}) {
+        // Small batches so that many completions are in flight at once
+        FastReader<PixelType, DecompSpec> fast_reader({.worker_threads = workers, .max_batch_size = 16 * 1024});
+        std::vector<PixelType> output_data(original_data.size(), 0);
+        auto read_result = fast_reader.read_region<ImageLayoutSpec::DHWC>(
+            reader, metadata, region, std::span<PixelType>(output_data));
+        ASSERT_TRUE(read_result.is_ok()) << "workers=" << workers;
+        EXPECT_TRUE(compare_images<PixelType>(original_data, output_data)) << "workers=" << workers;
+        EXPECT_EQ(reader.pending_operations(), 0u);
+    }
+
+    std::filesystem::remove(path);
+}
+
+TEST(ImageReaderTest, FastReader_ConcurrentCallsShareReader) {
+    using PixelType = uint8_t;
+    using DecompSpec = DecompressorSpec<NoneDecompressorDesc, PackBitsDecompressorDesc, ZstdDecompressorDesc>;
+
+    const uint32_t width = 512, height = 512;
+    auto original_data = generate_test_image<PixelType>(width, height, 1, 1);
+
+    ExtractedTags<MinTiledSpec> metadata;
+    auto path = write_async_test_file<PixelType>("test_fast_reader_concurrent.tif", original_data, width, height, 32, 32, metadata);
+    IoUringFileReader reader(path.string());
+    ASSERT_TRUE(reader.is_valid());
+
+    // Completions of one call may be reaped by another: each must still land
+    // in the output of the call that submitted the read.
+    FastReader<PixelType, DecompSpec> fast_reader({.worker_threads = 2, .max_batch_size = 8 * 1024});
+    const size_t num_callers = 4;
+    std::vector<std::vector<PixelType>> outputs(num_callers);
+    std::vector<char> ok(num_callers, 0);
+    std::vector<std::thread> callers;
+    for (size_t t = 0; t < num_callers; ++t) {
+        callers.emplace_back([&, t] {
+            // Each caller reads a different horizontal band
+            uint32_t band_height = height / num_callers;
+            ImageRegion region(0, 0, static_cast<uint32_t>(t * band_height), 0, 1, 1, band_height, width);
+            outputs[t].assign(region.num_samples(), 0);
+            ok[t] = fast_reader.read_region<ImageLayoutSpec::DHWC>(
+                reader, metadata, region, std::span<PixelType>(outputs[t])).is_ok();
+        });
+    }
+    for (auto& caller : callers) {
+        caller.join();
+    }
+
+    for (size_t t = 0; t < num_callers; ++t) {
+        ASSERT_TRUE(ok[t]) << "caller " << t;
+        size_t band_samples = static_cast<size_t>(width) * (height / num_callers);
+        std::span<const PixelType> expected(original_data.data() + t * band_samples, band_samples);
+        EXPECT_TRUE(compare_images<PixelType>(expected, outputs[t])) << "caller " << t;
+    }
+
+    std::filesystem::remove(path);
+}
+
+TEST(ImageReaderTest, FastReader_RegisteredBuffers) {
+    using PixelType = uint16_t;
+    using DecompSpec = DecompressorSpec<NoneDecompressorDesc, PackBitsDecompressorDesc, ZstdDecompressorDesc>;
+
+    const uint32_t width = 512, height = 512;
+    auto original_data = generate_test_image<PixelType>(width, height, 1, 1);
+
+    ExtractedTags<MinTiledSpec> metadata;
+    auto path = write_async_test_file<PixelType>("test_fast_reader_registered.tif", original_data, width, height, 64, 64, metadata);
+
+    // Fewer registered buffers than batches: the others use heap buffers
+    IoUringFileReader::Config config;
+    config.use_registered_io = true;
+    config.registered_buffer_count = 4;
+    config.registered_buffer_size = 16 * 1024;
+    IoUringFileReader reader(path.string(), config);
+    ASSERT_TRUE(reader.is_valid());
+    if (!reader.registered_io()) {
+        GTEST_SKIP() << "Buffer registration not permitted (RLIMIT_MEMLOCK)";
+    }
+    EXPECT_EQ(reader.registered_buffer_size(), 16u * 1024);
+
+    TiledImageInfo<PixelType> image_info;
+    ASSERT_TRUE(image_info.update_from_metadata(metadata).is_ok());
+    auto region = image_info.shape().full_region();
+
+    FastReader<PixelType, DecompSpec> fast_reader({.worker_threads = 2});
+    for (int pass = 0; pass < 2; ++pass) {
+        std::vector<PixelType> output_data(original_data.size(), 0);
+        auto read_result = fast_reader.read_region<ImageLayoutSpec::DHWC>(
+            reader, metadata, region, std::span<PixelType>(output_data));
+        ASSERT_TRUE(read_result.is_ok()) << "pass " << pass;
+        EXPECT_TRUE(compare_images<PixelType>(original_data, output_data)) << "pass " << pass;
+        EXPECT_EQ(reader.pending_operations(), 0u);
+    }
+
+    // Every buffer went back to the pool
+    std::vector<io_uring_impl::RegisteredBuffer> leases;
+    for (int i = 0; i < 4; ++i) {
+        leases.push_back(reader.acquire_buffer(1024));
+        EXPECT_TRUE(static_cast<bool>(leases.back()));
+    }
+    EXPECT_FALSE(static_cast<bool>(reader.acquire_buffer(1024)));
+    leases.pop_back();
+    EXPECT_FALSE(static_cast<bool>(reader.acquire_buffer(32 * 1024)));
+
+    // Direct READ_FIXED into a lent buffer
+    auto lease = reader.acquire_buffer(4096);
+    ASSERT_TRUE(static_cast<bool>(lease));
+    auto handle = reader.async_read_into(lease.data().subspan(0, 4096), 0, 4096);
+    ASSERT_TRUE(handle.is_ok());
+    ASSERT_TRUE(reader.submit_pending().is_ok());
+    auto completions = reader.wait_completions();
+    ASSERT_EQ(completions.size(), 1u);
+    ASSERT_TRUE(completions[0].second.is_ok());
+    std::vector<std::byte> expected(4096);
+    ASSERT_TRUE(reader.read_into(expected.data(), 0, 4096).is_ok());
+    EXPECT_EQ(std::memcmp(lease.data().data(), expected.data(), 4096), 0);
+
+    std::filesystem::remove(path);
+}
+
+TEST(ImageReaderTest, FastReader_DirectIO) {
+    using PixelType = uint16_t;
+    using DecompSpec = DecompressorSpec<NoneDecompressorDesc, PackBitsDecompressorDesc, ZstdDecompressorDesc>;
+
+    const uint32_t width = 256, height = 192;
+    auto original_data = generate_test_image<PixelType>(width, height, 1, 1);
+
+    ExtractedTags<MinTiledSpec> metadata;
+    auto path = write_async_test_file<PixelType>("test_fast_reader_direct.tif", original_data, width, height, 16, 16, metadata);
+    const ImageRegion region(0, 0, 37, 21, 1, 1, 101, 150);
+    std::vector<PixelType> expected(region.num_samples());
+    for (uint32_t y = 0; y < region.height; ++y) {
+        for (uint32_t x = 0; x < region.width; ++x) {
+            expected[y * region.width + x] = original_data[(region.start_y + y) * width + region.start_x + x];
+        }
+    }
+
+    // Aligned batches land in arena buffers, or in registered buffers
+    for (bool registered : {false, true}) {
+        IoUringFileReader::Config config;
+        config.use_direct_io = true;
+        config.use_registered_io = registered;
+        config.registered_buffer_size = 8 * 1024;
+        IoUringFileReader reader(path.string(), config);
+        ASSERT_TRUE(reader.is_valid());
+        if (!reader.direct_io()) {
+            std::filesystem::remove(path);
+            GTEST_SKIP() << "File system without O_DIRECT support";
+        }
+
+        FastReader<PixelType, DecompSpec> fast_reader({.worker_threads = 2, .max_batch_size = 3000, .max_gap_size = 0});
+        std::vector<PixelType> output(region.num_samples(), 0);
+        auto result = fast_reader.read_region<ImageLayoutSpec::DHWC>(reader, metadata, region, std::span<PixelType>(output));
+        ASSERT_TRUE(result.is_ok()) << result.error().message;
+        EXPECT_EQ(expected, output) << "registered " << registered;
+        EXPECT_EQ(reader.pending_operations(), 0u);
+    }
+
+    std::filesystem::remove(path);
+}
+
+TEST(ImageReaderTest, FastReader_RecyclesBatchBuffers) {
+    using PixelType = uint16_t;
+    using DecompSpec = DecompressorSpec<NoneDecompressorDesc, PackBitsDecompressorDesc, ZstdDecompressorDesc>;
+
+    const uint32_t width = 256, height = 256;
+    auto original_data = generate_test_image<PixelType>(width, height, 1, 1);
+
+    ExtractedTags<MinTiledSpec> metadata;
+    auto path = write_async_test_file<PixelType>("test_fast_reader_buffers.tif", original_data, width, height, 32, 32, metadata);
+    IoUringFileReader reader(path.string());
+    ASSERT_TRUE(reader.is_valid());
+    const ImageRegion region(0, 0, 0, 0, 1, 1, height, width);
+
+    // Buffers are acquired before any read is submitted: the first pass
+    // allocates one per batch, the second gets them all back
+    FastReader<PixelType, DecompSpec> fast_reader({.worker_threads = 2, .max_batch_size = 8 * 1024});
+    BufferArenaStats first_pass;
+    for (int pass = 0; pass < 2; ++pass) {
+        std::vector<PixelType> output(region.num_samples(), 0);
+        auto result = fast_reader.read_region<ImageLayoutSpec::DHWC>(reader, metadata, region, std::span<PixelType>(output));
+        ASSERT_TRUE(result.is_ok()) << result.error().message;
+        EXPECT_TRUE(compare_images<PixelType>(original_data, output)) << "pass " << pass;
+        if (pass == 0) {
+            first_pass = fast_reader.buffer_stats();
+        }
+    }
+    auto stats = fast_reader.buffer_stats();
+    EXPECT_EQ(first_pass.hits, 0u);
+    EXPECT_GT(first_pass.misses, 1u);
+    EXPECT_EQ(stats.misses, first_pass.misses);
+    EXPECT_EQ(stats.hits, first_pass.misses);
+    EXPECT_EQ(stats.cached_bytes, first_pass.cached_bytes);
+
+    std::filesystem::remove(path);
+}
+
+TEST(ImageReaderTest, FastReader_TileCache) {
+    using PixelType = uint16_t;
+    using DecompSpec = DecompressorSpec<NoneDecompressorDesc, PackBitsDecompressorDesc, ZstdDecompressorDesc>;
+
+    const uint32_t width = 256, height = 256;
+    auto original_data = generate_test_image<PixelType>(width, height, 1, 1);
+
+    ExtractedTags<MinTiledSpec> metadata;
+    auto path = write_async_test_file<PixelType>("test_fast_reader_cache.tif", original_data, width, height, 32, 32, metadata);
+    IoUringFileReader reader(path.string());
+    ASSERT_TRUE(reader.is_valid());
+    const ImageRegion region(0, 0, 0, 0, 1, 1, height, width);
+
+    // The second pass submits no read at all
+    auto cache = std::make_shared<DecodedTileCache<PixelType>>();
+    FastReader<PixelType, DecompSpec> fast_reader({.worker_threads = 2, .max_batch_size = 8 * 1024, .tile_cache = cache});
+    for (int pass = 0; pass < 2; ++pass) {
+        std::vector<PixelType> output(region.num_samples(), 0);
+        auto result = fast_reader.read_region<ImageLayoutSpec::DHWC>(
+            reader, metadata, region, std::span<PixelType>(output), TileCacheScope{1, 8});
+        ASSERT_TRUE(result.is_ok()) << result.error().message;
+        EXPECT_TRUE(compare_images<PixelType>(original_data, output)) << "pass " << pass;
+    }
+    auto stats = cache->stats();
+    EXPECT_EQ(stats.misses, 64u);
+    EXPECT_EQ(stats.insertions, 64u);
+    EXPECT_EQ(stats.hits, 64u);
+    EXPECT_EQ(fast_reader.buffer_stats().hits, 0u);
+
+    std::filesystem::remove(path);
+}
+
+TEST(ImageReaderTest, FastReader_TruncatedFile_ReturnsError) {
+    using PixelType = uint8_t;
+    using DecompSpec = DecompressorSpec<NoneDecompressorDesc, PackBitsDecompressorDesc, ZstdDecompressorDesc>;
+
+    const uint32_t width = 256, height = 256;
+    auto original_data = generate_test_image<PixelType>(width, height, 1, 1);
+
+    ExtractedTags<MinTiledSpec> metadata;
+    auto path = write_async_test_file<PixelType>("test_fast_reader_truncated.tif", original_data, width, height, 32, 32, metadata);
+
+    // Keep only the first half of the file: later reads fail or come back short
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) / 2);
+    IoUringFileReader reader(path.string());
+    ASSERT_TRUE(reader.is_valid());
+
+    TiledImageInfo<PixelType> image_info;
+    ASSERT_TRUE(image_info.update_from_metadata(metadata).is_ok());
+
+    FastReader<PixelType, DecompSpec> fast_reader({.worker_threads = 2, .max_batch_size = 4 * 1024});
+    std::vector<PixelType> output_data(original_data.size(), 0);
+    auto read_result = fast_reader.read_region<ImageLayoutSpec::DHWC>(
+        reader, metadata, image_info.shape().full_region(), std::span<PixelType>(output_data));
+    EXPECT_FALSE(read_result.is_ok());
+    EXPECT_EQ(reader.pending_operations(), 0u);
+
+    std::filesystem::remove(path);
+}
+
+#endif // HAVE_LIBURING
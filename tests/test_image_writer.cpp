@@ -1,4 +1,5 @@
 #include <gtest/gtest.h>
+#include <algorithm>
 #include <vector>
 #include <random>
 
@@ -539,6 +540,82 @@ TEST(ImageWriter, NonZeroDataOffset) {
     EXPECT_EQ(info.tile_offsets[0], 1000);
 }
 
+// ============================================================================
+// Parallel Encoding Tests
+// ============================================================================
+
+TEST(ImageWriter, ParallelEncodingMatchesSequential) {
+    using CompSpec = CompressorSpec<
+        NoneCompressorDesc,
+        ZstdCompressorDesc
+    >;
+    using Config = WriteConfig<IFDAtEnd, ImageOrderTiles, DirectWrite<BufferWriter>, LazyOffsets>;
+    using WriterType = ImageWriter<uint16_t, CompSpec, Config>;
+    
+    auto image = generate_test_image<uint16_t>(500, 300, 3);
+    
+    for (auto planar : {PlanarConfiguration::Chunky, PlanarConfiguration::Planar}) {
+        WriterType sequential_writer;
+        BufferWriter sequential_file;
+        auto sequential_result = sequential_writer.write_image<ImageLayoutSpec::DHWC>(
+            sequential_file, std::span<const uint16_t>(image),
+            500, 300, 1, 64, 64, 1, 3,
+            planar, CompressionScheme::ZSTD, Predictor::Horizontal, 16
+        );
+        ASSERT_TRUE(sequential_result.is_ok());
+        
+        // Small in-flight window forces workers to wait for the writer
+        WriterType parallel_writer(WriterType::Config{.encoder_threads = 4, .max_chunks_in_flight = 3});
+        BufferWriter parallel_file;
+        auto parallel_result = parallel_writer.write_image<ImageLayoutSpec::DHWC>(
+            parallel_file, std::span<const uint16_t>(image),
+            500, 300, 1, 64, 64, 1, 3,
+            planar, CompressionScheme::ZSTD, Predictor::Horizontal, 16
+        );
+        ASSERT_TRUE(parallel_result.is_ok());
+        
+        // Same offsets, same byte counts, same bytes on disk
+        EXPECT_EQ(parallel_result.value().tile_offsets, sequential_result.value().tile_offsets);
+        EXPECT_EQ(parallel_result.value().tile_byte_counts, sequential_result.value().tile_byte_counts);
+        EXPECT_EQ(parallel_result.value().total_data_size, sequential_result.value().total_data_size);
+        auto sequential_bytes = sequential_file.buffer();
+        auto parallel_bytes = parallel_file.buffer();
+        ASSERT_EQ(parallel_bytes.size(), sequential_bytes.size());
+        EXPECT_TRUE(std::equal(parallel_bytes.begin(), parallel_bytes.end(), sequential_bytes.begin()));
+    }
+}
+
+TEST(ImageWriter, ParallelEncodingReusesWorkers) {
+    using CompSpec = CompressorSpec<
+        ZstdCompressorDesc
+    >;
+    using Config = WriteConfig<IFDAtEnd, OnDemandTiles, DirectWrite<BufferWriter>, LazyOffsets>;
+    using WriterType = ImageWriter<uint8_t, CompSpec, Config>;
+    
+    WriterType writer(WriterType::Config{.encoder_threads = 3});
+    
+    // More threads than chunks, then more chunks than threads, then after clear()
+    for (uint32_t size : {64u, 256u, 256u}) {
+        auto image = generate_gradient<uint8_t>(size, size, 1);
+        BufferWriter file_writer;
+        auto result = writer.write_image<ImageLayoutSpec::DHWC>(
+            file_writer, std::span<const uint8_t>(image),
+            size, size, 1, 32, 32, 1, 1,
+            PlanarConfiguration::Chunky, CompressionScheme::ZSTD, Predictor::None, 0
+        );
+        ASSERT_TRUE(result.is_ok());
+        
+        // Chunks are contiguous and cover the whole written range
+        const auto& info = result.value();
+        std::size_t total = 0;
+        for (auto count : info.tile_byte_counts) {
+            total += count;
+        }
+        EXPECT_EQ(total, info.total_data_size);
+        writer.clear();
+    }
+}
+
 int main(int argc, char** argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
@@ -3,13 +3,18 @@
 #include <random>
 #include <cstring>
 #include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <thread>
 
 #include "../tiffconcept/include/tiffconcept/parsing.hpp"
 #include "../tiffconcept/include/tiffconcept/ifd.hpp"
+#include "../tiffconcept/include/tiffconcept/page_index.hpp"
 #include "../tiffconcept/include/tiffconcept/lowlevel/ifd_builder.hpp"
 #include "../tiffconcept/include/tiffconcept/tag_extraction.hpp"
 #include "../tiffconcept/include/tiffconcept/lowlevel/tag_writing.hpp"
 #include "../tiffconcept/include/tiffconcept/readers/reader_buffer.hpp"
+#include "../tiffconcept/include/tiffconcept/readers/reader_simulated_remote.hpp"
 #include "../tiffconcept/include/tiffconcept/types/tiff_spec.hpp"
 #include "../tiffconcept/include/tiffconcept/types/tag_codes.hpp"
 #include "../tiffconcept/include/tiffconcept/types/tag_spec.hpp"
@@ -43,6 +48,62 @@ std::vector<T> generate_test_data(std::size_t count, uint64_t seed = 42) {
     return data;
 }
 
+// Builds a file made of a header and a chain of IFDs, page i having
+// ImageWidth 100 * (i + 1) and PageNumber (i, num_pages)
+template <TiffFormatType TiffFormat>
+std::vector<std::byte> build_ifd_chain(int num_pages, std::vector<std::size_t>& ifd_offsets) {
+    using TagSpec = TagSpec<
+        ImageWidthTag,
+        PageNumberTag
+    >;
+    
+    std::vector<IFDBuilder<TiffFormat, std::endian::little, IFDAtEnd>> builders(num_pages);
+    for (int i = 0; i < num_pages; ++i) {
+        ExtractedTags<TagSpec> tags;
+        tags.template get<TagCode::ImageWidth>() = 100 * (i + 1);
+        tags.template get<TagCode::PageNumber>() = std::array<uint16_t, 2>{
+            static_cast<uint16_t>(i), 
+            static_cast<uint16_t>(num_pages)
+        };
+        EXPECT_TRUE(builders[i].add_tags(tags).is_ok());
+    }
+    
+    std::size_t current_offset = TiffFormat == TiffFormatType::Classic
+        ? sizeof(TiffHeader<std::endian::little>)
+        : sizeof(TiffBigHeader<std::endian::little>);
+    ifd_offsets.resize(num_pages);
+    for (int i = 0; i < num_pages; ++i) {
+        ifd_offsets[i] = current_offset;
+        current_offset += builders[i].calculate_ifd_size();
+    }
+    
+    BufferWriter writer;
+    EXPECT_TRUE(writer.resize(current_offset));
+    if constexpr (TiffFormat == TiffFormatType::Classic) {
+        TiffHeader<std::endian::little> header;
+        header.byte_order = {0x49, 0x49};
+        header.version = 42;
+        header.first_ifd_offset = static_cast<uint32_t>(ifd_offsets[0]);
+        std::memcpy(writer.buffer().data(), &header, sizeof(header));
+    } else {
+        TiffBigHeader<std::endian::little> header;
+        header.byte_order = {0x49, 0x49};
+        header.version = 43;
+        header.offset_size = 8;
+        header.reserved = 0;
+        header.first_ifd_offset = ifd_offsets[0];
+        std::memcpy(writer.buffer().data(), &header, sizeof(header));
+    }
+    
+    for (int i = 0; i < num_pages; ++i) {
+        builders[i].set_next_ifd_offset(ifd::IFDOffset(i < num_pages - 1 ? ifd_offsets[i + 1] : 0));
+        EXPECT_TRUE(builders[i].write_to_file(writer, ifd_offsets[i]).is_ok());
+    }
+    
+    auto buffer = writer.buffer();
+    return std::vector<std::byte>(buffer.begin(), buffer.end());
+}
+
 // ============================================================================
 // IFD Chain Reading Tests
 // ============================================================================
@@ -334,6 +395,109 @@ TEST(MultiPageTIFF, BigTIFF_IFDChain) {
     EXPECT_EQ(ifd2.next_ifd_offset.value, 0u);
 }
 
+TEST(MultiPageTIFF, ReadIFDChain_SpeculativeRead) {
+    using TagSpec = TagSpec<
+        ImageWidthTag,
+        PageNumberTag
+    >;
+    using RemoteReader = SimulatedRemoteReader<BufferReader>;
+    
+    constexpr int num_pages = 5;
+    std::vector<IFDBuilder<TiffFormatType::Classic, std::endian::little, IFDAtEnd>> builders(num_pages);
+    for (int i = 0; i < num_pages; ++i) {
+        ExtractedTags<TagSpec> tags;
+        tags.get<TagCode::ImageWidth>() = 100 + i * 10;
+        tags.get<TagCode::PageNumber>() = std::array<uint16_t, 2>{
+            static_cast<uint16_t>(i), 
+            static_cast<uint16_t>(num_pages)
+        };
+        ASSERT_TRUE(builders[i].add_tags(tags).is_ok());
+    }
+    
+    BufferWriter writer;
+    ASSERT_TRUE(writer.resize(4096));  // Preallocate buffer
+    std::vector<std::size_t> ifd_offsets(num_pages);
+    std::size_t current_offset = sizeof(TiffHeader<std::endian::little>);
+    for (int i = 0; i < num_pages; ++i) {
+        ifd_offsets[i] = current_offset;
+        current_offset += builders[i].calculate_ifd_size();
+    }
+    
+    TiffHeader<std::endian::little> header;
+    header.byte_order = {0x49, 0x49};
+    header.version = 42;
+    header.first_ifd_offset = static_cast<uint32_t>(ifd_offsets[0]);
+    
+    auto header_view = writer.write(0, sizeof(header));
+    ASSERT_TRUE(header_view.is_ok());
+    std::memcpy(header_view.value().data().data(), &header, sizeof(header));
+    ASSERT_TRUE(header_view.value().flush().is_ok());
+    
+    for (int i = 0; i < num_pages; ++i) {
+        builders[i].set_next_ifd_offset(ifd::IFDOffset(i < num_pages - 1 ? ifd_offsets[i + 1] : 0));
+        ASSERT_TRUE(builders[i].write_to_file(writer, ifd_offsets[i]).is_ok());
+    }
+    
+    // The file ends with the last IFD: windows near the end are cut short
+    const auto file_data = std::span<const std::byte>(writer.buffer()).first(current_offset);
+    
+    // Walks the chain, returning every IFD read
+    auto walk_chain = [&](const RemoteReader& reader, std::size_t speculative_read_size) {
+        std::vector<ifd::IFD<TiffFormatType::Classic, std::endian::little>> ifds;
+        ifd::IFD<TiffFormatType::Classic, std::endian::little> current_ifd;
+        ifd::IFDOffset current(ifd_offsets[0]);
+        while (current) {
+            auto result = ifd::read_ifd_into<RemoteReader, TiffFormatType::Classic, std::endian::little>(
+                reader, current, current_ifd, speculative_read_size);
+            EXPECT_TRUE(result.is_ok());
+            if (!result.is_ok() || ifds.size() >= num_pages) {
+                break;
+            }
+            ifds.push_back(current_ifd);
+            current = current_ifd.next_ifd_offset;
+        }
+        return ifds;
+    };
+    
+    const RemoteReader::Config remote_config{.latency = std::chrono::microseconds(0)};
+    RemoteReader exact_reader(BufferReader(file_data), remote_config);
+    const auto expected = walk_chain(exact_reader, 0);
+    ASSERT_EQ(expected.size(), static_cast<std::size_t>(num_pages));
+    EXPECT_EQ(exact_reader.stats().requests, 2u * num_pages);
+    
+    auto expect_same_ifds = [&](const auto& ifds) {
+        ASSERT_EQ(ifds.size(), expected.size());
+        for (std::size_t i = 0; i < ifds.size(); ++i) {
+            EXPECT_EQ(ifds[i].description.offset, expected[i].description.offset);
+            EXPECT_EQ(ifds[i].description.num_entries, expected[i].description.num_entries);
+            EXPECT_EQ(ifds[i].next_ifd_offset, expected[i].next_ifd_offset);
+            ASSERT_EQ(ifds[i].tags.size(), expected[i].tags.size());
+            EXPECT_EQ(std::memcmp(ifds[i].tags.data(), expected[i].tags.data(),
+                                  ifds[i].tags.size() * sizeof(ifds[i].tags[0])), 0);
+        }
+    };
+    
+    // One read per IFD when it fits in the window, including the last one
+    // (shorter window at the end of the file)
+    RemoteReader speculative_reader(BufferReader(file_data), remote_config);
+    expect_same_ifds(walk_chain(speculative_reader, ifd::default_speculative_read_size));
+    EXPECT_EQ(speculative_reader.stats().requests, static_cast<uint64_t>(num_pages));
+    
+    // A window smaller than the IFDs falls back to a second read
+    ASSERT_GT(expected[0].size_in_bytes(), 16u);
+    RemoteReader small_window_reader(BufferReader(file_data), remote_config);
+    expect_same_ifds(walk_chain(small_window_reader, 16));
+    EXPECT_EQ(small_window_reader.stats().requests, 2u * num_pages);
+    
+    // An IFD cut short by the end of the file is still an error
+    RemoteReader truncated_reader(BufferReader(file_data.first(current_offset - 2)), remote_config);
+    ifd::IFD<TiffFormatType::Classic, std::endian::little> last_ifd;
+    auto truncated_result = ifd::read_ifd_into<RemoteReader, TiffFormatType::Classic, std::endian::little>(
+        truncated_reader, ifd::IFDOffset(ifd_offsets[num_pages - 1]), last_ifd, ifd::default_speculative_read_size);
+    ASSERT_FALSE(truncated_result.is_ok());
+    EXPECT_EQ(truncated_result.error().code, Error::Code::UnexpectedEndOfFile);
+}
+
 // ============================================================================
 // Error Detection Tests
 // ============================================================================
@@ -776,3 +940,221 @@ TEST(MultiPageTIFF, PageNavigation_RandomAccess) {
         EXPECT_EQ(page_info[0], page_num);
     }
 }
+
+TEST(MultiPageTIFF, PageIndex_RandomAccess) {
+    using TagSpec = TagSpec<
+        ImageWidthTag,
+        PageNumberTag
+    >;
+    
+    constexpr int num_pages = 10;
+    std::vector<std::size_t> ifd_offsets;
+    const auto file_data = build_ifd_chain<TiffFormatType::Classic>(num_pages, ifd_offsets);
+    BufferViewReader reader{std::span<const std::byte>(file_data)};
+    
+    const FileStamp stamp{file_data.size(), 1234};
+    auto index_result = PageIndex::build<BufferViewReader, TiffFormatType::Classic, std::endian::little>(reader, stamp);
+    ASSERT_TRUE(index_result.is_ok());
+    const auto& index = index_result.value();
+    
+    ASSERT_EQ(index.size(), static_cast<std::size_t>(num_pages));
+    EXPECT_EQ(index.format(), TiffFormatType::Classic);
+    EXPECT_EQ(index.byte_order(), std::endian::little);
+    EXPECT_EQ(index.stamp(), stamp);
+    for (int i = 0; i < num_pages; ++i) {
+        auto page = index.page(i);
+        ASSERT_TRUE(page.is_ok());
+        EXPECT_EQ(page.value().offset.value, ifd_offsets[i]);
+        EXPECT_EQ(page.value().num_entries, 2u);
+        EXPECT_EQ(page.value().next_ifd_offset.value, i < num_pages - 1 ? ifd_offsets[i + 1] : 0u);
+        EXPECT_EQ(index.offsets()[i].value, ifd_offsets[i]);
+    }
+    auto out_of_range = index.page(num_pages);
+    ASSERT_FALSE(out_of_range.is_ok());
+    EXPECT_EQ(out_of_range.error().code, Error::Code::InvalidPageIndex);
+    
+    // Pages are read directly, in any order
+    for (int page_num : {5, 2, 8, 0, 9}) {
+        auto ifd_result = ifd::read_ifd<BufferViewReader, TiffFormatType::Classic, std::endian::little>(
+            reader, index.page(page_num).value().offset);
+        ASSERT_TRUE(ifd_result.is_ok());
+        
+        ExtractedTags<TagSpec> tags;
+        ASSERT_TRUE((tags.extract<BufferViewReader, TiffFormatType::Classic, std::endian::little>(
+            reader, std::span(ifd_result.value().tags)).is_ok()));
+        EXPECT_EQ(tags.get<TagCode::ImageWidth>(), 100u * (page_num + 1));
+        EXPECT_EQ(tags.get<TagCode::PageNumber>()[0], page_num);
+    }
+}
+
+TEST(MultiPageTIFF, PageIndex_BigTIFF_SerializeRoundTrip) {
+    constexpr int num_pages = 6;
+    std::vector<std::size_t> ifd_offsets;
+    const auto file_data = build_ifd_chain<TiffFormatType::BigTIFF>(num_pages, ifd_offsets);
+    BufferViewReader reader{std::span<const std::byte>(file_data)};
+    
+    const FileStamp stamp{file_data.size(), 987654321};
+    auto index_result = PageIndex::build<BufferViewReader, TiffFormatType::BigTIFF, std::endian::little>(reader, stamp);
+    ASSERT_TRUE(index_result.is_ok());
+    const auto& index = index_result.value();
+    ASSERT_EQ(index.size(), static_cast<std::size_t>(num_pages));
+    
+    const auto blob = index.serialize();
+    EXPECT_EQ(blob.size(), 40u + 16u * num_pages);
+    
+    auto reloaded = PageIndex::deserialize(blob, stamp);
+    ASSERT_TRUE(reloaded.is_ok());
+    EXPECT_EQ(reloaded.value().format(), TiffFormatType::BigTIFF);
+    EXPECT_EQ(reloaded.value().byte_order(), std::endian::little);
+    EXPECT_EQ(reloaded.value().stamp(), stamp);
+    ASSERT_EQ(reloaded.value().size(), index.size());
+    for (int i = 0; i < num_pages; ++i) {
+        EXPECT_EQ(reloaded.value().page(i).value().offset, index.page(i).value().offset);
+        EXPECT_EQ(reloaded.value().page(i).value().num_entries, index.page(i).value().num_entries);
+        EXPECT_EQ(reloaded.value().page(i).value().next_ifd_offset, index.page(i).value().next_ifd_offset);
+    }
+    
+    // Stale: the file changed size or was rewritten
+    auto other_size = PageIndex::deserialize(blob, FileStamp{stamp.size + 1, stamp.mtime_ns});
+    ASSERT_FALSE(other_size.is_ok());
+    EXPECT_EQ(other_size.error().code, Error::Code::InvalidOperation);
+    auto other_mtime = PageIndex::deserialize(blob, FileStamp{stamp.size, stamp.mtime_ns + 1});
+    ASSERT_FALSE(other_mtime.is_ok());
+    EXPECT_EQ(other_mtime.error().code, Error::Code::InvalidOperation);
+    
+    // Corrupted or truncated
+    auto corrupted = blob;
+    corrupted[40] ^= std::byte{0x01};
+    EXPECT_EQ(PageIndex::deserialize(corrupted, stamp).error().code, Error::Code::InvalidFormat);
+    EXPECT_EQ(PageIndex::deserialize(std::span(blob).first(blob.size() - 16), stamp).error().code,
+              Error::Code::InvalidFormat);
+    EXPECT_EQ(PageIndex::deserialize(std::span(file_data).first(64), stamp).error().code,
+              Error::Code::InvalidHeader);
+}
+
+TEST(MultiPageTIFF, PageIndex_ChainLoopIsAnError) {
+    std::vector<std::size_t> ifd_offsets;
+    auto file_data = build_ifd_chain<TiffFormatType::Classic>(3, ifd_offsets);
+    
+    // Last IFD points back to the first one
+    const uint32_t loop_offset = static_cast<uint32_t>(ifd_offsets[0]);
+    std::memcpy(file_data.data() + file_data.size() - sizeof(uint32_t), &loop_offset, sizeof(loop_offset));
+    BufferViewReader reader{std::span<const std::byte>(file_data)};
+    
+    auto index = PageIndex::build<BufferViewReader, TiffFormatType::Classic, std::endian::little>(
+        reader, FileStamp{file_data.size(), 0});
+    ASSERT_FALSE(index.is_ok());
+    EXPECT_EQ(index.error().code, Error::Code::InvalidFormat);
+}
+
+TEST(MultiPageTIFF, PageIndex_ConcurrentSavesUseTheirOwnTemporaryFile) {
+    constexpr int num_pages = 5;
+    std::vector<std::size_t> ifd_offsets;
+    const auto file_data = build_ifd_chain<TiffFormatType::Classic>(num_pages, ifd_offsets);
+    BufferViewReader reader{std::span<const std::byte>(file_data)};
+    const FileStamp stamp{file_data.size(), 123456789};
+    auto index = PageIndex::build<BufferViewReader, TiffFormatType::Classic, std::endian::little>(reader, stamp);
+    ASSERT_TRUE(index.is_ok());
+    
+    const auto dir = std::filesystem::temp_directory_path() / "tiffconcept_page_index_concurrent";
+    std::filesystem::remove_all(dir);
+    std::filesystem::create_directories(dir);
+    const auto sidecar = PageIndex::sidecar_path(dir / "image.tif");
+    
+    // Writers sharing a sidecar must not install each other's partial files
+    constexpr int num_writers = 8;
+    std::vector<int> saved(num_writers, 0);
+    std::vector<std::thread> writers;
+    for (int w = 0; w < num_writers; ++w) {
+        writers.emplace_back([&, w] {
+            for (int i = 0; i < 20; ++i) {
+                saved[w] += index.value().save(sidecar).is_ok() ? 1 : 0;
+            }
+        });
+    }
+    for (auto& writer : writers) {
+        writer.join();
+    }
+    for (int w = 0; w < num_writers; ++w) {
+        EXPECT_EQ(saved[w], 20) << "writer " << w;
+    }
+    auto loaded = PageIndex::load(sidecar, stamp);
+    ASSERT_TRUE(loaded.is_ok());
+    EXPECT_EQ(loaded.value().size(), static_cast<std::size_t>(num_pages));
+    
+    // No temporary file is left behind
+    std::size_t files = 0;
+    for ([[maybe_unused]] const auto& entry : std::filesystem::directory_iterator(dir)) {
+        ++files;
+    }
+    EXPECT_EQ(files, 1u);
+    
+    // A failed save reports an error and leaves nothing behind either
+    auto failed = index.value().save(PageIndex::sidecar_path(dir / "missing" / "image.tif"));
+    ASSERT_FALSE(failed.is_ok());
+    EXPECT_EQ(failed.error().code, Error::Code::WriteError);
+    EXPECT_FALSE(std::filesystem::exists(dir / "missing"));
+    
+    std::filesystem::remove_all(dir);
+}
+
+TEST(MultiPageTIFF, PageIndex_SidecarSkipsTheWalk) {
+    using RemoteReader = SimulatedRemoteReader<BufferReader>;
+    
+    constexpr int num_pages = 8;
+    std::vector<std::size_t> ifd_offsets;
+    const auto file_data = build_ifd_chain<TiffFormatType::Classic>(num_pages, ifd_offsets);
+    
+    const auto path = std::filesystem::temp_directory_path() / "tiffconcept_page_index_test.tif";
+    const auto sidecar = PageIndex::sidecar_path(path);
+    std::filesystem::remove(sidecar);
+    auto write_file = [&](std::span<const std::byte> data) {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+    };
+    write_file(file_data);
+    
+    // The reader stands for the file: its requests are the IFD walk
+    const RemoteReader::Config remote_config{.latency = std::chrono::microseconds(0)};
+    auto open_index = [&](const RemoteReader& reader) {
+        return PageIndex::open<RemoteReader, TiffFormatType::Classic, std::endian::little>(reader, path);
+    };
+    
+    // First open: walk (one read per IFD) and write the sidecar
+    {
+        RemoteReader reader(BufferReader(std::span<const std::byte>(file_data)), remote_config);
+        auto index = open_index(reader);
+        ASSERT_TRUE(index.is_ok());
+        EXPECT_EQ(index.value().size(), static_cast<std::size_t>(num_pages));
+        EXPECT_EQ(reader.stats().requests, 1u + num_pages);  // Header + IFDs
+        EXPECT_TRUE(std::filesystem::exists(sidecar));
+    }
+    
+    // Later opens: no read at all
+    {
+        RemoteReader reader(BufferReader(std::span<const std::byte>(file_data)), remote_config);
+        auto index = open_index(reader);
+        ASSERT_TRUE(index.is_ok());
+        EXPECT_EQ(reader.stats().requests, 0u);
+        ASSERT_EQ(index.value().size(), static_cast<std::size_t>(num_pages));
+        EXPECT_EQ(index.value().page(num_pages - 1).value().offset.value, ifd_offsets[num_pages - 1]);
+    }
+    
+    // The file changed: the stale sidecar is ignored and rewritten
+    std::vector<std::byte> grown_data = file_data;
+    grown_data.resize(file_data.size() + 100);
+    write_file(grown_data);
+    {
+        RemoteReader reader(BufferReader(std::span<const std::byte>(grown_data)), remote_config);
+        auto index = open_index(reader);
+        ASSERT_TRUE(index.is_ok());
+        EXPECT_EQ(reader.stats().requests, 1u + num_pages);
+        auto stamp = FileStamp::of(path);
+        ASSERT_TRUE(stamp.is_ok());
+        EXPECT_EQ(index.value().stamp(), stamp.value());
+        EXPECT_TRUE(PageIndex::load(sidecar, stamp.value()).is_ok());
+    }
+    
+    std::filesystem::remove(path);
+    std::filesystem::remove(sidecar);
+}
@@ -420,6 +420,22 @@ TEST(PredictorTest, FloatingPointFloat32FiveChannels) {
     EXPECT_EQ(original, decoded);
 }
 
+TEST(PredictorTest, FloatingPointFloat32ByteLayout) {
+    // TIFF Technical Note 3: byte planes from the most significant byte,
+    // then byte-wise differencing across the whole row
+    std::array<float, 2> values = {1.0f, 2.0f}; // 0x3F800000, 0x40000000
+    delta_encode_floating_point(std::span<float>(values), 2, 1, 2, 1);
+    
+    std::array<uint8_t, 8> bytes;
+    std::memcpy(bytes.data(), values.data(), bytes.size());
+    const std::array<uint8_t, 8> expected = {0x3F, 0x01, 0x40, 0x80, 0x00, 0x00, 0x00, 0x00};
+    EXPECT_EQ(expected, bytes);
+    
+    delta_decode_floating_point(std::span<float>(values), 2, 1, 2, 1);
+    EXPECT_EQ(1.0f, values[0]);
+    EXPECT_EQ(2.0f, values[1]);
+}
+
 // ============================================================================
 // Non-Native Float Tests (Float16, Float24)
 // ============================================================================
@@ -798,6 +814,248 @@ TEST(PredictorTest, DecodePreEncodedFloat) {
     EXPECT_EQ(original, decoded);
 }
 
+// ============================================================================
+// SIMD Kernel Tests (bit-exact against the scalar implementation)
+// ============================================================================
+
+/// SIMD levels available on this machine, besides Scalar
+std::vector<cpu::SimdLevel> available_simd_levels() {
+    std::vector<cpu::SimdLevel> levels;
+    for (auto level : {cpu::SimdLevel::SSE2, cpu::SimdLevel::AVX2}) {
+        if (level <= cpu::detected_simd_level()) {
+            levels.push_back(level);
+        }
+    }
+    return levels;
+}
+
+/// Decode random data with every SIMD kernel and compare with the scalar
+/// implementation, over widths covering empty rows, partial registers and
+/// several registers, with stride padding that must be left untouched
+template <typename T, std::size_t SamplesPerPixel>
+void check_simd_matches_scalar() {
+    const auto levels = available_simd_levels();
+    if (levels.empty()) {
+        GTEST_SKIP() << "No SIMD kernels on this platform";
+    }
+    
+    const std::size_t height = 3;
+    for (std::size_t width = 0; width <= 80; ++width) {
+        for (std::size_t padding : {std::size_t{0}, std::size_t{7}}) {
+            const std::size_t stride = width * SamplesPerPixel + padding;
+            std::vector<T> encoded = generate_random_data<T>(height * stride + 1, 1000 + width);
+            
+            std::vector<T> expected = encoded;
+            detail::delta_decode_horizontal_impl<T, SamplesPerPixel>(
+                std::span(expected), width, height, stride);
+            
+            for (auto level : levels) {
+                if (!detail::simd::has_horizontal_kernel<T>(SamplesPerPixel, level)) {
+                    continue;
+                }
+                std::vector<T> decoded = encoded;
+                detail::simd::delta_decode_horizontal_simd(
+                    std::span(decoded), width, height, stride, SamplesPerPixel, level);
+                ASSERT_EQ(expected, decoded)
+                    << "SIMD level " << static_cast<int>(level)
+                    << ", width " << width << ", padding " << padding;
+            }
+        }
+    }
+}
+
+TEST(PredictorSimdTest, UInt8MatchesScalar) {
+    check_simd_matches_scalar<uint8_t, 1>();
+    check_simd_matches_scalar<uint8_t, 2>();
+    check_simd_matches_scalar<uint8_t, 3>();
+    check_simd_matches_scalar<uint8_t, 4>();
+}
+
+TEST(PredictorSimdTest, UInt16MatchesScalar) {
+    check_simd_matches_scalar<uint16_t, 1>();
+    check_simd_matches_scalar<uint16_t, 2>();
+    check_simd_matches_scalar<uint16_t, 3>();
+    check_simd_matches_scalar<uint16_t, 4>();
+}
+
+TEST(PredictorSimdTest, SignedMatchesScalar) {
+    check_simd_matches_scalar<int8_t, 1>();
+    check_simd_matches_scalar<int8_t, 3>();
+    check_simd_matches_scalar<int16_t, 2>();
+    check_simd_matches_scalar<int16_t, 4>();
+}
+
+TEST(PredictorSimdTest, KernelAvailability) {
+    EXPECT_FALSE(detail::simd::has_horizontal_kernel<uint32_t>(1, cpu::SimdLevel::AVX2));
+    EXPECT_FALSE(detail::simd::has_horizontal_kernel<uint64_t>(1, cpu::SimdLevel::AVX2));
+    EXPECT_FALSE(detail::simd::has_horizontal_kernel<uint8_t>(5, cpu::SimdLevel::AVX2));
+    EXPECT_FALSE(detail::simd::has_horizontal_kernel<uint16_t>(0, cpu::SimdLevel::SSE2));
+    EXPECT_FALSE(detail::simd::has_horizontal_kernel<uint8_t>(1, cpu::SimdLevel::Scalar));
+    EXPECT_FALSE(detail::simd::has_horizontal_kernel<uint16_t>(3, cpu::SimdLevel::SSE2));
+    EXPECT_TRUE(detail::simd::has_horizontal_kernel<uint16_t>(3, cpu::SimdLevel::AVX2));
+    EXPECT_TRUE(detail::simd::has_horizontal_kernel<int8_t>(3, cpu::SimdLevel::SSE2));
+}
+
+TEST(PredictorSimdTest, LevelLimitSelectsFallback) {
+    const std::size_t width = 300;
+    const std::size_t height = 4;
+    const std::size_t samples_per_pixel = 3;
+    const std::size_t stride = width * samples_per_pixel;
+    
+    std::vector<uint16_t> original = generate_random_data<uint16_t>(height * stride, 7);
+    std::vector<uint16_t> encoded = original;
+    delta_encode_horizontal(std::span(encoded), width, height, stride, samples_per_pixel);
+    
+    for (auto limit : {cpu::SimdLevel::Scalar, cpu::SimdLevel::SSE2, cpu::SimdLevel::AVX2}) {
+        cpu::set_simd_level_limit(limit);
+        EXPECT_LE(cpu::simd_level(), limit);
+        std::vector<uint16_t> decoded = encoded;
+        delta_decode_horizontal(std::span(decoded), width, height, stride, samples_per_pixel);
+        EXPECT_EQ(original, decoded) << "SIMD limit " << static_cast<int>(limit);
+    }
+    cpu::set_simd_level_limit(cpu::SimdLevel::AVX2);
+    EXPECT_EQ(cpu::simd_level(), cpu::detected_simd_level());
+}
+
+/// Floating point predictor: decode and encode random bytes with every SIMD
+/// kernel and compare with the scalar implementation, row by row
+template <typename FloatType, std::size_t SamplesPerPixel>
+void check_fp_simd_matches_scalar() {
+    const auto levels = available_simd_levels();
+    if (levels.empty()) {
+        GTEST_SKIP() << "No SIMD kernels on this platform";
+    }
+    
+    constexpr std::size_t bytes = sizeof(FloatType);
+    for (std::size_t width = 0; width <= 80; ++width) {
+        const std::size_t count = width * SamplesPerPixel;
+        const std::size_t row_bytes = count * bytes;
+        // The kernels may read a register past the row (as fp_row_buffer allows)
+        std::vector<uint8_t> input = generate_random_data<uint8_t>(row_bytes + 32, 2000 + width);
+        
+        std::vector<uint8_t> planes = input;
+        std::vector<uint8_t> expected_decoded(row_bytes);
+        detail::fp_decode_row_scalar<FloatType>(planes.data(), expected_decoded.data(), count, SamplesPerPixel);
+        std::vector<uint8_t> expected_encoded(row_bytes);
+        detail::fp_encode_row_scalar<FloatType>(input.data(), expected_encoded.data(), count, SamplesPerPixel);
+        
+        for (auto level : levels) {
+            if (!detail::simd::has_fp_kernel<FloatType>(count, level)) {
+                continue;
+            }
+            planes = input;
+            std::vector<uint8_t> decoded(row_bytes);
+            detail::simd::fp_decode_row_simd<FloatType>(planes.data(), decoded.data(), count, SamplesPerPixel, level);
+            ASSERT_EQ(expected_decoded, decoded)
+                << "decode, SIMD level " << static_cast<int>(level) << ", width " << width;
+            
+            std::vector<uint8_t> encoded(row_bytes);
+            detail::simd::fp_encode_row_simd<FloatType>(input.data(), encoded.data(), count, SamplesPerPixel, level);
+            ASSERT_EQ(expected_encoded, encoded)
+                << "encode, SIMD level " << static_cast<int>(level) << ", width " << width;
+        }
+    }
+}
+
+template <typename FloatType>
+void check_fp_simd_matches_scalar_all_channels() {
+    check_fp_simd_matches_scalar<FloatType, 1>();
+    check_fp_simd_matches_scalar<FloatType, 2>();
+    check_fp_simd_matches_scalar<FloatType, 3>();
+    check_fp_simd_matches_scalar<FloatType, 4>();
+    check_fp_simd_matches_scalar<FloatType, 5>();
+}
+
+TEST(PredictorSimdTest, Float32MatchesScalar) {
+    check_fp_simd_matches_scalar_all_channels<float>();
+}
+
+TEST(PredictorSimdTest, Float64MatchesScalar) {
+    check_fp_simd_matches_scalar_all_channels<double>();
+}
+
+/// Regression: the SSE2 kernels kept 8-byte samples in 4 plane registers.
+/// Force SSE2 (the path taken by CPUs without AVX2) and check the guard
+/// bytes around the output; build with TIFFCONCEPT_TESTS_SANITIZE to also
+/// catch overruns of the kernels' own registers
+TEST(PredictorSimdTest, Float64Sse2KernelsStayInBounds) {
+    if (cpu::detected_simd_level() < cpu::SimdLevel::SSE2) {
+        GTEST_SKIP() << "No SSE2 kernels on this platform";
+    }
+    constexpr std::size_t guard = 64;
+    constexpr uint8_t canary = 0xA5;
+
+    for (std::size_t samples_per_pixel : {1, 2, 3, 4}) {
+        const std::size_t count = 100 * samples_per_pixel;
+        const std::size_t row_bytes = count * sizeof(double);
+        std::vector<uint8_t> input = generate_random_data<uint8_t>(row_bytes + 32, 3000 + samples_per_pixel);
+        ASSERT_TRUE(detail::simd::has_fp_kernel<double>(count, cpu::SimdLevel::SSE2));
+
+        std::vector<uint8_t> planes = input;
+        std::vector<uint8_t> expected(row_bytes);
+        detail::fp_decode_row_scalar<double>(planes.data(), expected.data(), count, samples_per_pixel);
+        planes = input;
+        std::vector<uint8_t> decoded(guard + row_bytes + guard, canary);
+        detail::simd::fp_decode_row_simd<double>(planes.data(), decoded.data() + guard, count, samples_per_pixel,
+                                                 cpu::SimdLevel::SSE2);
+        EXPECT_TRUE(std::equal(expected.begin(), expected.end(), decoded.begin() + guard))
+            << "decode, " << samples_per_pixel << " samples per pixel";
+
+        detail::fp_encode_row_scalar<double>(input.data(), expected.data(), count, samples_per_pixel);
+        std::vector<uint8_t> encoded(guard + row_bytes + guard, canary);
+        detail::simd::fp_encode_row_simd<double>(input.data(), encoded.data() + guard, count, samples_per_pixel,
+                                                 cpu::SimdLevel::SSE2);
+        EXPECT_TRUE(std::equal(expected.begin(), expected.end(), encoded.begin() + guard))
+            << "encode, " << samples_per_pixel << " samples per pixel";
+
+        for (const auto* buffer : {&decoded, &encoded}) {
+            const bool intact = std::all_of(buffer->begin(), buffer->begin() + guard,
+                                            [](uint8_t v) { return v == canary; }) &&
+                                std::all_of(buffer->end() - guard, buffer->end(),
+                                            [](uint8_t v) { return v == canary; });
+            EXPECT_TRUE(intact) << samples_per_pixel << " samples per pixel";
+        }
+    }
+
+    // Same through the public entry point with the level limited to SSE2
+    const std::size_t width = 129;
+    const std::size_t height = 2;
+    std::vector<double> original = generate_random_data<double>(height * width, 13);
+    cpu::set_simd_level_limit(cpu::SimdLevel::SSE2);
+    std::vector<double> roundtrip = original;
+    delta_encode_floating_point(std::span(roundtrip), width, height, width, 1);
+    delta_decode_floating_point(std::span(roundtrip), width, height, width, 1);
+    cpu::set_simd_level_limit(cpu::SimdLevel::AVX2);
+    EXPECT_EQ(0, std::memcmp(original.data(), roundtrip.data(), original.size() * sizeof(double)));
+}
+
+TEST(PredictorSimdTest, Float16MatchesScalar) {
+    check_fp_simd_matches_scalar_all_channels<Float16>();
+}
+
+TEST(PredictorSimdTest, Float24MatchesScalar) {
+    check_fp_simd_matches_scalar_all_channels<Float24>();
+}
+
+TEST(PredictorSimdTest, FloatingPointLevelLimitRoundTrip) {
+    const std::size_t width = 257;
+    const std::size_t height = 3;
+    const std::size_t samples_per_pixel = 2;
+    const std::size_t stride = width * samples_per_pixel + 5;
+    
+    std::vector<float> original = generate_random_data<float>(height * stride, 11);
+    for (auto limit : {cpu::SimdLevel::Scalar, cpu::SimdLevel::SSE2, cpu::SimdLevel::AVX2}) {
+        cpu::set_simd_level_limit(limit);
+        std::vector<float> encoded = original;
+        delta_encode_floating_point(std::span(encoded), width, height, stride, samples_per_pixel);
+        std::vector<float> decoded = encoded;
+        delta_decode_floating_point(std::span(decoded), width, height, stride, samples_per_pixel);
+        EXPECT_EQ(0, std::memcmp(original.data(), decoded.data(), original.size() * sizeof(float)))
+            << "SIMD limit " << static_cast<int>(limit);
+    }
+    cpu::set_simd_level_limit(cpu::SimdLevel::AVX2);
+}
+
 int main(int argc, char **argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
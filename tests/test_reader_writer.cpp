@@ -4,14 +4,20 @@
 #include <vector>
 #include <thread>
 #include <array>
+#include <atomic>
+#include <set>
+#include <cstdlib>
 #include <cstring>
+#include <memory>
 
 #include "../tiffconcept/include/tiffconcept/readers/reader_buffer.hpp"
 #include "../tiffconcept/include/tiffconcept/readers/reader_stream.hpp"
+#include "../tiffconcept/include/tiffconcept/readers/reader_simulated_remote.hpp"
 
 #ifdef __unix__
 #include "../tiffconcept/include/tiffconcept/readers/reader_unix_pread.hpp"
 #include "../tiffconcept/include/tiffconcept/readers/reader_unix_mmap.hpp"
+#include "../tiffconcept/include/tiffconcept/readers/reader_caching.hpp"
 #ifdef HAVE_LIBURING
 #include "../tiffconcept/include/tiffconcept/readers/reader_unix_io_uring.hpp"
 #endif
@@ -107,6 +113,12 @@ MmapFileReader RawReaderTest<MmapFileReader>::create_reader() {
     return MmapFileReader(test_file_path.string());
 }
 
+// Specialization for PreadDirectFileReader
+template <>
+PreadDirectFileReader RawReaderTest<PreadDirectFileReader>::create_reader() {
+    return PreadDirectFileReader(test_file_path.string());
+}
+
 #ifdef HAVE_LIBURING
 // Specialization for IoUringFileReader
 template <>
@@ -151,6 +163,7 @@ using ReaderTypes = ::testing::Types<
 #ifdef __unix__
     , PreadFileReader
     , MmapFileReader
+    , PreadDirectFileReader  // O_DIRECT pread reader
 #ifdef HAVE_LIBURING
     , IoUringFileReader  // Async io_uring reader
 #endif
@@ -839,6 +852,71 @@ TEST(ViewTests, EmptyView) {
     EXPECT_TRUE(view.empty());
 }
 
+// ============================================================================
+// Direct I/O Tests (O_DIRECT)
+// ============================================================================
+
+#ifdef __unix__
+// Reads at every alignment: in place, through the bounce buffer, across the end of file
+template <typename ReaderT>
+void check_direct_reads(const ReaderT& reader, const std::vector<std::byte>& test_data) {
+    const size_t alignment = reader.io_alignment();
+    ASSERT_GE(alignment, 512u);
+    ASSERT_EQ(alignment & (alignment - 1), 0u);
+    
+    const size_t cases[][2] = {
+        {0, alignment},                          // Aligned
+        {alignment, 3 * alignment},              // Aligned, several blocks
+        {1, 10},                                 // Inside the first block
+        {alignment - 3, 7},                      // Across a block boundary
+        {alignment + 5, 2 * alignment},          // Unaligned start, several blocks
+        {test_data.size() - 100, 100},           // Unaligned end of file
+        {test_data.size() - 100, 1000},          // Truncated at the end of file
+    };
+    for (const auto& [offset, size] : cases) {
+        const size_t expected_size = std::min(size, test_data.size() - offset);
+        
+        auto view_res = reader.read(offset, size);
+        ASSERT_TRUE(view_res.is_ok()) << offset << "+" << size;
+        ASSERT_EQ(view_res.value().size(), expected_size);
+        EXPECT_EQ(std::memcmp(view_res.value().data().data(), test_data.data() + offset, expected_size), 0)
+            << offset << "+" << size;
+        
+        // Aligned destination, room for whole blocks
+        std::unique_ptr<std::byte[], decltype(&std::free)> aligned(
+            static_cast<std::byte*>(std::aligned_alloc(alignment, 8 * alignment)), &std::free);
+        ASSERT_TRUE(reader.read_into(aligned.get(), offset, size).is_ok()) << offset << "+" << size;
+        EXPECT_EQ(std::memcmp(aligned.get(), test_data.data() + offset, expected_size), 0)
+            << offset << "+" << size;
+        
+        // Unaligned destination, exactly sized: nothing written past it
+        std::vector<std::byte> unaligned(expected_size + 2, std::byte{0xAB});
+        ASSERT_TRUE(reader.read_into(unaligned.data() + 1, offset, expected_size).is_ok()) << offset << "+" << size;
+        EXPECT_EQ(std::memcmp(unaligned.data() + 1, test_data.data() + offset, expected_size), 0)
+            << offset << "+" << size;
+        EXPECT_EQ(unaligned.front(), std::byte{0xAB});
+        EXPECT_EQ(unaligned.back(), std::byte{0xAB});
+    }
+}
+
+TEST(DirectIOTests, PreadDirectAlignedAndUnalignedReads) {
+    std::vector<std::byte> test_data(64 * 1024 + 123);
+    for (size_t i = 0; i < test_data.size(); ++i) {
+        test_data[i] = static_cast<std::byte>((i * 13) % 253);
+    }
+    fs::path test_file = create_test_file("direct_io_pread.bin", test_data);
+    
+    PreadDirectFileReader reader(test_file.string());
+    ASSERT_TRUE(reader.is_valid());
+    if (!reader.direct_io()) {
+        GTEST_SKIP() << "File system without O_DIRECT support";
+    }
+    check_direct_reads(reader, test_data);
+    
+    fs::remove(test_file);
+}
+#endif
+
 // ============================================================================
 // AsyncRawReader Tests
 // ============================================================================
@@ -993,6 +1071,119 @@ TEST(AsyncReaderTests, IoUringWaitWithTimeout) {
     fs::remove(test_file);
 }
 
+TEST(AsyncReaderTests, IoUringConcurrentSubmitters) {
+    std::vector<std::byte> test_data(64 * 1024);
+    for (size_t i = 0; i < test_data.size(); ++i) {
+        test_data[i] = static_cast<std::byte>((i * 7) % 251);
+    }
+
+    fs::path test_file = create_test_file("async_test_iouring_concurrent.bin", test_data);
+
+    IoUringFileReader::Config config;
+    config.queue_depth = 32;
+    IoUringFileReader reader(test_file.string(), config);
+    ASSERT_TRUE(reader.is_valid());
+
+    // More operations in flight than the queue depth and the initial slot table
+    constexpr size_t num_threads = 4;
+    constexpr size_t reads_per_thread = 160;
+    constexpr size_t read_size = 256;
+    std::vector<std::vector<std::byte>> buffers(num_threads * reads_per_thread, std::vector<std::byte>(read_size));
+    std::vector<uint64_t> ids(buffers.size(), 0);
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&, t] {
+            for (size_t i = 0; i < reads_per_thread; ++i) {
+                size_t op = t * reads_per_thread + i;
+                auto handle_res = reader.async_read_into(buffers[op], (op * 97) % (test_data.size() - read_size), read_size);
+                if (handle_res.is_ok()) {
+                    ids[op] = handle_res.value().id;
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(std::set<uint64_t>(ids.begin(), ids.end()).size(), buffers.size());
+    EXPECT_EQ(reader.pending_operations(), buffers.size());
+
+    // Reap from several threads; the submission backlog drains as CQEs are consumed
+    std::atomic<size_t> completed{0};
+    std::atomic<size_t> failed{0};
+    threads.clear();
+    for (size_t t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&] {
+            while (completed.load() + failed.load() < buffers.size()) {
+                auto completions = reader.wait_completions_for(std::chrono::milliseconds(100), 16);
+                for (auto& [handle, result] : completions) {
+                    (result.is_ok() && result.value().size() == read_size ? completed : failed).fetch_add(1);
+                }
+                if (completions.empty() && reader.pending_operations() == 0) {
+                    break;
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(completed.load(), buffers.size());
+    EXPECT_EQ(failed.load(), 0u);
+    EXPECT_EQ(reader.pending_operations(), 0u);
+
+    for (size_t op = 0; op < buffers.size(); ++op) {
+        size_t offset = (op * 97) % (test_data.size() - read_size);
+        ASSERT_EQ(std::memcmp(buffers[op].data(), test_data.data() + offset, read_size), 0) << "op " << op;
+    }
+
+    fs::remove(test_file);
+}
+
+TEST(AsyncReaderTests, IoUringDirectIO) {
+    std::vector<std::byte> test_data(64 * 1024 + 123);
+    for (size_t i = 0; i < test_data.size(); ++i) {
+        test_data[i] = static_cast<std::byte>((i * 13) % 253);
+    }
+    fs::path test_file = create_test_file("async_test_iouring_direct.bin", test_data);
+    
+    IoUringFileReader::Config config;
+    config.queue_depth = 32;
+    config.use_direct_io = true;
+    IoUringFileReader reader(test_file.string(), config);
+    ASSERT_TRUE(reader.is_valid());
+    if (!reader.direct_io()) {
+        GTEST_SKIP() << "File system without O_DIRECT support";
+    }
+    check_direct_reads(reader, test_data);
+    
+    // Async reads: aligned ones in place, others through a bounce buffer
+    const size_t alignment = reader.io_alignment();
+    std::unique_ptr<std::byte[], decltype(&std::free)> aligned(
+        static_cast<std::byte*>(std::aligned_alloc(alignment, 4 * alignment)), &std::free);
+    std::vector<std::byte> unaligned(1001);
+    const size_t tail_offset = test_data.size() - 50;
+    std::vector<std::byte> tail(50);
+    ASSERT_TRUE(reader.async_read_into(std::span(aligned.get(), 4 * alignment), alignment, 4 * alignment).is_ok());
+    ASSERT_TRUE(reader.async_read_into(unaligned, 777, unaligned.size()).is_ok());
+    ASSERT_TRUE(reader.async_read_into(tail, tail_offset, tail.size()).is_ok());
+    ASSERT_TRUE(reader.submit_pending().is_ok());
+    
+    size_t completed = 0;
+    for (int i = 0; i < 100 && completed < 3; ++i) {
+        for (auto& [handle, result] : reader.wait_completions_for(std::chrono::milliseconds(100))) {
+            ASSERT_TRUE(result.is_ok()) << result.error().message;
+            completed++;
+        }
+    }
+    ASSERT_EQ(completed, 3u);
+    EXPECT_EQ(std::memcmp(aligned.get(), test_data.data() + alignment, 4 * alignment), 0);
+    EXPECT_EQ(std::memcmp(unaligned.data(), test_data.data() + 777, unaligned.size()), 0);
+    EXPECT_EQ(std::memcmp(tail.data(), test_data.data() + tail_offset, tail.size()), 0);
+    
+    fs::remove(test_file);
+}
+
 TEST(AsyncReaderTests, IoUringSyncFallback) {
     // Test that sync read still works
     std::vector<std::byte> test_data(2048);
@@ -1188,6 +1379,327 @@ TEST(AsyncReaderTests, IOCPSyncFallback) {
 }
 #endif  // _WIN32
 
+// ============================================================================
+// Caching Reader Tests
+// ============================================================================
+
+#ifdef __unix__
+static_assert(RawReader<CachingReader<PreadFileReader>>);
+static_assert(!AsyncRawReader<CachingReader<PreadFileReader>>);
+
+TEST(CachingReaderTests, ReadsMatchFileAndHitCache) {
+    std::vector<std::byte> test_data(10 * 4096 + 123);
+    for (size_t i = 0; i < test_data.size(); ++i) {
+        test_data[i] = static_cast<std::byte>((i * 7) % 251);
+    }
+    fs::path test_file = create_test_file("caching_reader.bin", test_data);
+    
+    CachingReader<PreadFileReader> reader(PreadFileReader(test_file.string()), {.block_size = 4096});
+    ASSERT_TRUE(reader.is_valid());
+    ASSERT_EQ(reader.size().value(), test_data.size());
+    
+    const size_t cases[][2] = {
+        {0, 4096},                          // One block
+        {10, 20},                           // Inside a block
+        {4090, 20},                         // Across a block boundary
+        {3 * 4096 + 1, 5 * 4096},           // Several blocks
+        {test_data.size() - 50, 50},        // Last (short) block
+        {test_data.size() - 50, 1000},      // Truncated at the end of file
+    };
+    for (int pass = 0; pass < 2; ++pass) {
+        const uint64_t inner_reads = reader.cache_stats().inner_reads;
+        for (const auto& [offset, size] : cases) {
+            const size_t expected_size = std::min(size, test_data.size() - offset);
+            
+            auto view_res = reader.read(offset, size);
+            ASSERT_TRUE(view_res.is_ok()) << offset << "+" << size;
+            ASSERT_EQ(view_res.value().size(), expected_size);
+            EXPECT_EQ(std::memcmp(view_res.value().data().data(), test_data.data() + offset, expected_size), 0)
+                << offset << "+" << size;
+            
+            std::vector<std::byte> buffer(expected_size);
+            ASSERT_TRUE(reader.read_into(buffer.data(), offset, size).is_ok()) << offset << "+" << size;
+            EXPECT_EQ(std::memcmp(buffer.data(), test_data.data() + offset, expected_size), 0)
+                << offset << "+" << size;
+        }
+        if (pass == 1) {
+            // Everything was cached by the first pass
+            EXPECT_EQ(reader.cache_stats().inner_reads, inner_reads);
+        }
+    }
+    
+    const BlockCacheStats stats = reader.cache_stats();
+    EXPECT_GT(stats.hits, stats.misses);
+    EXPECT_EQ(stats.misses, 9u);  // Blocks 0-1, 3-8 and 10, each fetched once
+    EXPECT_EQ(stats.blocks, 9u);
+    EXPECT_EQ(stats.evictions, 0u);
+    
+    // Reads within a block are views of the cached block
+    auto a = reader.read(100, 10);
+    auto b = reader.read(200, 10);
+    ASSERT_TRUE(a.is_ok() && b.is_ok());
+    EXPECT_EQ(a.value().data().data() + 100, b.value().data().data());
+    
+    EXPECT_FALSE(reader.read(test_data.size(), 1).is_ok());
+    
+    fs::remove(test_file);
+}
+
+TEST(CachingReaderTests, EvictsWithinBudgetAndBypassesLargeReads) {
+    std::vector<std::byte> test_data(64 * 1024);
+    for (size_t i = 0; i < test_data.size(); ++i) {
+        test_data[i] = static_cast<std::byte>(i % 239);
+    }
+    fs::path test_file = create_test_file("caching_reader_evict.bin", test_data);
+    
+    CachingReader<PreadFileReader> reader(PreadFileReader(test_file.string()),
+                                          {.block_size = 1024, .max_bytes = 4 * 1024, .shards = 1,
+                                           .max_cached_read = 8 * 1024});
+    ASSERT_TRUE(reader.is_valid());
+    
+    for (size_t offset = 0; offset < test_data.size(); offset += 1024) {
+        auto view_res = reader.read(offset, 1024);
+        ASSERT_TRUE(view_res.is_ok());
+        EXPECT_EQ(std::memcmp(view_res.value().data().data(), test_data.data() + offset, 1024), 0);
+    }
+    BlockCacheStats stats = reader.cache_stats();
+    EXPECT_EQ(stats.blocks, 4u);
+    EXPECT_EQ(stats.evictions, 60u);
+    
+    // Most recently used blocks are still cached
+    const uint64_t inner_reads = stats.inner_reads;
+    ASSERT_TRUE(reader.read(60 * 1024, 4 * 1024).is_ok());
+    EXPECT_EQ(reader.cache_stats().inner_reads, inner_reads);
+    
+    // Large reads go straight to the inner reader
+    std::vector<std::byte> buffer(test_data.size());
+    ASSERT_TRUE(reader.read_into(buffer.data(), 0, buffer.size()).is_ok());
+    EXPECT_EQ(buffer, test_data);
+    stats = reader.cache_stats();
+    EXPECT_EQ(stats.inner_reads, inner_reads + 1);
+    EXPECT_EQ(stats.blocks, 4u);
+    
+    reader.clear_cache();
+    EXPECT_EQ(reader.cache_stats().blocks, 0u);
+    
+    fs::remove(test_file);
+}
+
+TEST(CachingReaderTests, SmallBudgetStillCaches) {
+    std::vector<std::byte> test_data(16 * 1024);
+    for (size_t i = 0; i < test_data.size(); ++i) {
+        test_data[i] = static_cast<std::byte>(i % 233);
+    }
+    fs::path test_file = create_test_file("caching_reader_small.bin", test_data);
+    
+    // Fewer blocks than the 16 default shards
+    CachingReader<PreadFileReader> reader(PreadFileReader(test_file.string()),
+                                          {.block_size = 1024, .max_bytes = 3 * 1024});
+    ASSERT_TRUE(reader.is_valid());
+    
+    for (int pass = 0; pass < 2; ++pass) {
+        auto view_res = reader.read(10, 100);
+        ASSERT_TRUE(view_res.is_ok());
+        EXPECT_EQ(std::memcmp(view_res.value().data().data(), test_data.data() + 10, 100), 0);
+    }
+    BlockCacheStats stats = reader.cache_stats();
+    EXPECT_EQ(stats.inner_reads, 1u);
+    EXPECT_EQ(stats.hits, 1u);
+    EXPECT_EQ(stats.blocks, 1u);
+    
+    // The budget still bounds the cache
+    for (size_t offset = 0; offset < test_data.size(); offset += 1024) {
+        ASSERT_TRUE(reader.read(offset, 1024).is_ok());
+    }
+    stats = reader.cache_stats();
+    EXPECT_GE(stats.blocks, 1u);
+    EXPECT_LE(stats.blocks, 3u);
+    
+    fs::remove(test_file);
+}
+
+static_assert(AsyncRawReader<CachingReader<SimulatedRemoteReader<BufferReader>>>);
+
+TEST(CachingReaderTests, AsyncReadRejectsSmallBuffer) {
+    std::vector<std::byte> test_data(8 * 1024);
+    for (size_t i = 0; i < test_data.size(); ++i) {
+        test_data[i] = static_cast<std::byte>(i % 229);
+    }
+    CachingReader<SimulatedRemoteReader<BufferReader>> reader(
+        SimulatedRemoteReader<BufferReader>(BufferReader(test_data), {.latency = std::chrono::milliseconds(0)}),
+        {.block_size = 1024});
+    ASSERT_TRUE(reader.is_valid());
+    
+    // Cache the blocks, so that the async read would be served from memory
+    ASSERT_TRUE(reader.read(0, 2048).is_ok());
+    
+    std::vector<std::byte> buffer(2048 + 16, std::byte{0xAB});
+    auto handle_res = reader.async_read_into(std::span<std::byte>(buffer.data(), 1024), 0, 2048);
+    ASSERT_FALSE(handle_res.is_ok());
+    EXPECT_EQ(handle_res.error().code, Error::Code::InvalidOperation);
+    for (const std::byte b : buffer) {
+        ASSERT_EQ(b, std::byte{0xAB});
+    }
+    EXPECT_EQ(reader.pending_operations(), 0u);
+    
+    // Same read into a large enough buffer
+    handle_res = reader.async_read_into(std::span<std::byte>(buffer.data(), 2048), 0, 2048);
+    ASSERT_TRUE(handle_res.is_ok());
+    auto completions = reader.wait_completions();
+    ASSERT_EQ(completions.size(), 1u);
+    ASSERT_TRUE(completions[0].second.is_ok());
+    EXPECT_EQ(std::memcmp(buffer.data(), test_data.data(), 2048), 0);
+}
+
+#ifdef HAVE_LIBURING
+static_assert(AsyncRawReader<CachingReader<IoUringFileReader>>);
+
+TEST(CachingReaderTests, IoUringAsyncReadsFillAndHitCache) {
+    std::vector<std::byte> test_data(16 * 4096);
+    for (size_t i = 0; i < test_data.size(); ++i) {
+        test_data[i] = static_cast<std::byte>((i * 5) % 247);
+    }
+    fs::path test_file = create_test_file("caching_reader_async.bin", test_data);
+    
+    CachingReader<IoUringFileReader> reader(IoUringFileReader(test_file.string()), {.block_size = 4096});
+    ASSERT_TRUE(reader.is_valid());
+    
+    for (int pass = 0; pass < 2; ++pass) {
+        std::vector<std::vector<std::byte>> buffers(8, std::vector<std::byte>(2 * 4096));
+        std::set<uint64_t> ids;
+        for (size_t i = 0; i < buffers.size(); ++i) {
+            auto handle_res = reader.async_read_into(buffers[i], i * 2 * 4096, 2 * 4096);
+            ASSERT_TRUE(handle_res.is_ok());
+            ids.insert(handle_res.value().id);
+        }
+        EXPECT_EQ(ids.size(), buffers.size());
+        ASSERT_TRUE(reader.submit_pending().is_ok());
+        
+        size_t completed = 0;
+        while (completed < buffers.size()) {
+            auto completions = reader.wait_completions_for(std::chrono::milliseconds(1000), 3);
+            ASSERT_FALSE(completions.empty());
+            EXPECT_LE(completions.size(), 3u);
+            for (auto& [handle, result] : completions) {
+                ASSERT_TRUE(result.is_ok());
+                ASSERT_EQ(ids.erase(handle.id), 1u);
+                EXPECT_EQ(result.value().size(), 2 * 4096u);
+            }
+            completed += completions.size();
+        }
+        EXPECT_EQ(reader.pending_operations(), 0u);
+        for (size_t i = 0; i < buffers.size(); ++i) {
+            EXPECT_EQ(std::memcmp(buffers[i].data(), test_data.data() + i * 2 * 4096, 2 * 4096), 0);
+        }
+    }
+    
+    // The second pass was served from the blocks cached by the first
+    const BlockCacheStats stats = reader.cache_stats();
+    EXPECT_EQ(stats.inner_reads, 8u);
+    EXPECT_EQ(stats.blocks, 16u);
+    
+    // Sync reads share the cache
+    auto view_res = reader.read(4096 + 10, 100);
+    ASSERT_TRUE(view_res.is_ok());
+    EXPECT_EQ(std::memcmp(view_res.value().data().data(), test_data.data() + 4096 + 10, 100), 0);
+    EXPECT_EQ(reader.cache_stats().inner_reads, 8u);
+    
+    fs::remove(test_file);
+}
+#endif  // HAVE_LIBURING
+#endif  // __unix__
+
+// ============================================================================
+// Simulated Remote Reader Tests
+// ============================================================================
+
+static_assert(RawReader<SimulatedRemoteReader<BufferReader>>);
+static_assert(AsyncRawReader<SimulatedRemoteReader<BufferReader>>);
+
+TEST(SimulatedRemoteReaderTests, SyncReadsWaitForLatency) {
+    std::vector<std::byte> test_data(4096);
+    for (size_t i = 0; i < test_data.size(); ++i) {
+        test_data[i] = static_cast<std::byte>(i % 256);
+    }
+    SimulatedRemoteReader<BufferReader> reader(BufferReader(test_data), {.latency = std::chrono::milliseconds(5)});
+    ASSERT_TRUE(reader.is_valid());
+    ASSERT_EQ(reader.size().value(), test_data.size());
+    
+    const auto start = std::chrono::steady_clock::now();
+    auto view_res = reader.read(100, 200);
+    ASSERT_TRUE(view_res.is_ok());
+    ASSERT_EQ(view_res.value().size(), 200u);
+    EXPECT_EQ(std::memcmp(view_res.value().data().data(), test_data.data() + 100, 200), 0);
+    
+    std::vector<std::byte> buffer(4000);
+    ASSERT_TRUE(reader.read_into(buffer.data(), 96, 5000).is_ok());  // Clipped to the end of file
+    EXPECT_EQ(std::memcmp(buffer.data(), test_data.data() + 96, 4000), 0);
+    EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(10));
+    
+    const RemoteReaderStats stats = reader.stats();
+    EXPECT_EQ(stats.requests, 2u);
+    EXPECT_EQ(stats.bytes, 4200u);
+}
+
+TEST(SimulatedRemoteReaderTests, AsyncReadsHonourConcurrencyAndBandwidth) {
+    std::vector<std::byte> test_data(64 * 1024);
+    for (size_t i = 0; i < test_data.size(); ++i) {
+        test_data[i] = static_cast<std::byte>((i * 3) % 251);
+    }
+    
+    // One connection: 4 requests of 2 ms complete one after the other
+    SimulatedRemoteReader<BufferReader> serial(BufferReader(test_data),
+                                               {.latency = std::chrono::milliseconds(2), .max_concurrent_requests = 1});
+    std::vector<std::vector<std::byte>> buffers(4, std::vector<std::byte>(1024));
+    auto start = std::chrono::steady_clock::now();
+    std::vector<uint64_t> ids;
+    for (size_t i = 0; i < buffers.size(); ++i) {
+        auto handle_res = serial.async_read_into(buffers[i], i * 1024, 1024);
+        ASSERT_TRUE(handle_res.is_ok());
+        ids.push_back(handle_res.value().id);
+    }
+    ASSERT_TRUE(serial.submit_pending().is_ok());
+    EXPECT_EQ(serial.pending_operations(), 4u);
+    EXPECT_TRUE(serial.poll_completions().empty());
+    
+    std::vector<uint64_t> completed;
+    while (completed.size() < buffers.size()) {
+        auto completions = serial.wait_completions(1);
+        ASSERT_EQ(completions.size(), 1u);
+        auto& [handle, result] = completions[0];
+        ASSERT_TRUE(result.is_ok());
+        EXPECT_EQ(result.value().size(), 1024u);
+        completed.push_back(handle.id);
+    }
+    EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(8));
+    EXPECT_EQ(completed, ids);  // In submission order
+    EXPECT_EQ(serial.pending_operations(), 0u);
+    EXPECT_TRUE(serial.wait_completions().empty());
+    for (size_t i = 0; i < buffers.size(); ++i) {
+        EXPECT_EQ(std::memcmp(buffers[i].data(), test_data.data() + i * 1024, 1024), 0);
+    }
+    
+    // 64 KiB over a 6.4 MB/s link take at least 10 ms, however many connections
+    SimulatedRemoteReader<BufferReader> narrow(BufferReader(test_data),
+                                               {.latency = std::chrono::microseconds(0),
+                                                .bandwidth_bytes_per_second = 6400 * 1024});
+    std::vector<std::byte> all(test_data.size());
+    start = std::chrono::steady_clock::now();
+    ASSERT_TRUE(narrow.async_read_into(std::span(all).first(32 * 1024), 0, 32 * 1024).is_ok());
+    ASSERT_TRUE(narrow.async_read_into(std::span(all).last(32 * 1024), 32 * 1024, 32 * 1024).is_ok());
+    EXPECT_TRUE(narrow.wait_completions_for(std::chrono::milliseconds(0)).empty());
+    size_t count = 0;
+    while (count < 2) {
+        count += narrow.wait_completions_for(std::chrono::milliseconds(100)).size();
+    }
+    EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(10));
+    EXPECT_EQ(all, test_data);
+    
+    // Errors are reported on submission
+    EXPECT_FALSE(narrow.async_read_into(all, test_data.size(), 1).is_ok());
+    EXPECT_FALSE(narrow.async_read_into(std::span(all).first(10), 0, 11).is_ok());
+}
+
 // ============================================================================
 // Stress Tests
 // ============================================================================
@@ -301,6 +301,79 @@ TEST(TagParsing, ParseRationalArray) {
     EXPECT_EQ(result.value()[1].denominator, 10000u);
 }
 
+// ============================================================================
+// Lazy Array Tests
+// ============================================================================
+
+TEST(TagParsing, ParseArrayViewLongExternal) {
+    std::vector<uint32_t> offsets = {100, 200, 300, 400, 500};
+    std::size_t offset = 2000;
+    auto buffer = create_buffer_with_data(3000, offset, offsets.data(), offsets.size() * sizeof(uint32_t));
+    BufferViewReader reader{std::span<const std::byte>(buffer)};
+    
+    auto tag = make_offset_tag(static_cast<uint16_t>(TagCode::TileOffsets), TiffDataType::Long, offsets.size(), offset);
+    
+    auto result = parsing::parse_tag<BufferViewReader, TileOffsetsTag_View>(reader, tag);
+    
+    ASSERT_TRUE(result);
+    const auto& view = result.value();
+    ASSERT_EQ(view.size(), offsets.size());
+    EXPECT_EQ(view.element_size(), sizeof(uint32_t));
+    EXPECT_FALSE(view.is_byteswapped());
+    for (std::size_t i = 0; i < offsets.size(); ++i) {
+        EXPECT_EQ(view[i], offsets[i]);
+    }
+    
+    // Copies share the data, assign() detaches into a native copy
+    TagArrayView<uint64_t> copy = view;
+    copy.assign(std::vector<uint32_t>{7, 8});
+    EXPECT_EQ(view.size(), offsets.size());
+    ASSERT_EQ(copy.size(), 2u);
+    EXPECT_EQ(copy.element_size(), sizeof(uint64_t));
+    EXPECT_EQ(copy[1], 8u);
+}
+
+// Converting a view may widen its element type but never narrow it
+static_assert(std::is_constructible_v<TagArrayView<uint64_t>, const TagArrayView<uint32_t>&>);
+static_assert(!std::is_constructible_v<TagArrayView<uint32_t>, const TagArrayView<uint64_t>&>);
+static_assert(!std::is_constructible_v<TagArrayView<uint16_t>, const TagArrayView<uint32_t>&>);
+
+TEST(TagParsing, ParseArrayViewShortInlineSwapped) {
+    constexpr std::endian Source = std::endian::native == std::endian::little ? std::endian::big : std::endian::little;
+    std::array<uint16_t, 2> values = {byteswap(uint16_t{0x1234}), byteswap(uint16_t{42})};
+    auto tag = make_inline_tag<Source>(static_cast<uint16_t>(TagCode::TileByteCounts), TiffDataType::Short, 2, values.data(), sizeof(values));
+    
+    BufferViewReader reader(std::span<const std::byte>{});
+    
+    auto result = parsing::parse_tag<BufferViewReader, TileByteCountsTag_View, TiffFormatType::Classic, std::endian::native, Source>(reader, tag);
+    
+    ASSERT_TRUE(result);
+    const auto& view = result.value();
+    ASSERT_EQ(view.size(), 2u);
+    EXPECT_EQ(view.element_size(), sizeof(uint16_t));
+    EXPECT_TRUE(view.is_byteswapped());
+    EXPECT_EQ(view[0], 0x1234u);
+    EXPECT_EQ(view[1], 42u);
+    EXPECT_EQ(std::vector<uint64_t>(view.begin(), view.end()), (std::vector<uint64_t>{0x1234, 42}));
+}
+
+TEST(TagParsing, ParseArrayViewErrors) {
+    std::array<uint8_t, 4> bytes = {1, 2, 3, 4};
+    auto byte_tag = make_inline_tag(static_cast<uint16_t>(TagCode::TileOffsets), TiffDataType::Byte, 4, bytes.data(), sizeof(bytes));
+    
+    std::vector<std::byte> buffer(5, std::byte{0});
+    BufferViewReader reader{std::span<const std::byte>(buffer)};
+    
+    auto wrong_type = parsing::parse_tag<BufferViewReader, TileOffsetsTag_View>(reader, byte_tag);
+    ASSERT_FALSE(wrong_type);
+    EXPECT_EQ(wrong_type.error().code, Error::Code::InvalidTagType);
+    
+    auto out_of_bounds_tag = make_offset_tag(static_cast<uint16_t>(TagCode::TileOffsets), TiffDataType::Long, 2, 100);
+    auto out_of_bounds = parsing::parse_tag<BufferViewReader, TileOffsetsTag_View>(reader, out_of_bounds_tag);
+    ASSERT_FALSE(out_of_bounds);
+    EXPECT_EQ(out_of_bounds.error().code, Error::Code::OutOfBounds);
+}
+
 // ============================================================================
 // Endianness Conversion Tests
 // ============================================================================
@@ -326,6 +399,31 @@ TEST(TagParsing, ParseWithEndianSwap) {
     EXPECT_EQ(result.value(), 0x12345678);
 }
 
+TEST(TagParsing, ParseArrayExternalWithEndianSwap) {
+    constexpr std::endian Source = std::endian::native == std::endian::little ? std::endian::big : std::endian::little;
+    
+    // Long enough for the vectorized conversion, with a scalar tail
+    std::vector<uint32_t> offsets(37);
+    std::vector<uint32_t> stored(offsets.size());
+    for (std::size_t i = 0; i < offsets.size(); ++i) {
+        offsets[i] = static_cast<uint32_t>(0x01020304u * (i + 1));
+        stored[i] = byteswap(offsets[i]);
+    }
+    std::size_t offset = 64;
+    auto buffer = create_buffer_with_data(512, offset, stored.data(), stored.size() * sizeof(uint32_t));
+    BufferViewReader reader{std::span<const std::byte>(buffer)};
+    
+    auto tag = make_offset_tag<Source>(static_cast<uint16_t>(TagCode::StripOffsets), TiffDataType::Long, offsets.size(), offset);
+    
+    auto result = parsing::parse_tag<BufferViewReader, StripOffsetsTag, TiffFormatType::Classic, std::endian::native, Source>(reader, tag);
+    
+    ASSERT_TRUE(result);
+    ASSERT_EQ(result.value().size(), offsets.size());
+    for (std::size_t i = 0; i < offsets.size(); ++i) {
+        EXPECT_EQ(result.value()[i], offsets[i]);
+    }
+}
+
 // ============================================================================
 // Type Promotion Tests
 // ============================================================================
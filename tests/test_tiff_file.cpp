@@ -6,10 +6,16 @@
 #include <cstring>
 #include <cmath>
 
+#include "../tiffconcept/include/tiffconcept/compressors/compressor_lzw.hpp"
 #include "../tiffconcept/include/tiffconcept/compressors/compressor_standard.hpp"
 #include "../tiffconcept/include/tiffconcept/compressors/compressor_zstd.hpp"
+#include "../tiffconcept/include/tiffconcept/decompressors/decompressor_lzw.hpp"
 #include "../tiffconcept/include/tiffconcept/decompressors/decompressor_standard.hpp"
 #include "../tiffconcept/include/tiffconcept/decompressors/decompressor_zstd.hpp"
+#ifdef HAVE_ZLIB
+#include "../tiffconcept/include/tiffconcept/compressors/compressor_deflate.hpp"
+#include "../tiffconcept/include/tiffconcept/decompressors/decompressor_deflate.hpp"
+#endif
 #include "../tiffconcept/include/tiffconcept/image_reader.hpp"
 #include "../tiffconcept/include/tiffconcept/lowlevel/tag_writing.hpp"
 #include "../tiffconcept/include/tiffconcept/lowlevel/tiling.hpp"
@@ -287,6 +293,147 @@ TEST(TiffFileRoundtrip, ClassicTIFF_Uint16_ZSTD_BigEndian) {
     cleanup_file(filepath);
 }
 
+TEST(TiffFileRoundtrip, ClassicTIFF_Uint16_BigEndian_LazyTileArrays) {
+    using PixelType = uint16_t;
+    using CompSpec = CompressorSpec<NoneCompressorDesc, PackBitsCompressorDesc, ZstdCompressorDesc>;
+    using DecompSpec = DecompressorSpec<NoneDecompressorDesc, PackBitsDecompressorDesc, ZstdDecompressorDesc>;
+    using WriteConfig = WriteConfig<IFDAtEnd, SequentialTiles, DirectWrite<StreamFileWriter>, TwoPassOffsets>;
+    using WriterType = TiffWriter<PixelType, CompSpec, WriteConfig, TiffFormatType::Classic, std::endian::big>;
+    
+    const uint32_t width = 120;
+    const uint32_t height = 90;
+    const uint32_t tile_width = 32;
+    const uint32_t tile_height = 32;
+    const uint16_t samples_per_pixel = 1;
+    
+    auto original_data = generate_test_image<PixelType>(width, height, 1, samples_per_pixel, 2468);
+    
+    auto filepath = get_temp_filepath("test_classic_uint16_lazy_tile_arrays.tif");
+    cleanup_file(filepath);
+    
+    {
+        WriterType tiff_writer;
+        StreamFileWriter file_writer(filepath.string());
+        auto write_result = tiff_writer.template write_single_image<ImageLayoutSpec::DHWC>(
+            file_writer,
+            original_data,
+            width, height,
+            tile_width, tile_height,
+            samples_per_pixel,
+            PlanarConfiguration::Chunky,
+            CompressionScheme::ZSTD,
+            Predictor::Horizontal
+        );
+        ASSERT_TRUE(write_result.is_ok());
+    }
+    
+    StreamFileReader file_reader(filepath.string());
+    auto ifd_offset = ifd::get_first_ifd_offset<StreamFileReader, TiffFormatType::Classic, std::endian::big>(file_reader);
+    ASSERT_TRUE(ifd_offset.is_ok());
+    auto ifd_result = ifd::read_ifd<StreamFileReader, TiffFormatType::Classic, std::endian::big>(
+        file_reader, ifd_offset.value());
+    ASSERT_TRUE(ifd_result.is_ok());
+    
+    ExtractedTags<MinTiledSpec> eager_tags;
+    ASSERT_TRUE((eager_tags.extract<StreamFileReader, TiffFormatType::Classic, std::endian::big>(
+        file_reader, std::span(ifd_result.value().tags))));
+    
+    ExtractedTags<MinTiledViewSpec> lazy_tags;
+    ASSERT_TRUE((lazy_tags.extract<StreamFileReader, TiffFormatType::Classic, std::endian::big>(
+        file_reader, std::span(ifd_result.value().tags))));
+    
+    // The arrays are kept as stored in the file (big-endian LONG) and decoded on access
+    const auto& offsets = lazy_tags.template get<TagCode::TileOffsets>();
+    const auto& byte_counts = lazy_tags.template get<TagCode::TileByteCounts>();
+    const auto& eager_offsets = eager_tags.template get<TagCode::TileOffsets>();
+    const auto& eager_byte_counts = eager_tags.template get<TagCode::TileByteCounts>();
+    ASSERT_EQ(offsets.size(), 12u);
+    EXPECT_EQ(offsets.element_size(), sizeof(uint32_t));
+    EXPECT_EQ(offsets.is_byteswapped(), std::endian::native != std::endian::big);
+    ASSERT_EQ(offsets.size(), eager_offsets.size());
+    ASSERT_EQ(byte_counts.size(), eager_byte_counts.size());
+    for (std::size_t i = 0; i < offsets.size(); ++i) {
+        EXPECT_EQ(offsets[i], eager_offsets[i]);
+        EXPECT_EQ(byte_counts[i], eager_byte_counts[i]);
+    }
+    
+    TiledImageInfo<PixelType> image_info;
+    ASSERT_TRUE(image_info.update_from_metadata(lazy_tags).is_ok());
+    EXPECT_EQ(image_info.num_tiles(), offsets.size());
+    
+    SimpleReader<PixelType, DecompSpec> image_reader;
+    auto region = image_info.shape().full_region();
+    std::vector<PixelType> read_data(region.num_samples());
+    auto read_result = image_reader.read_region<ImageLayoutSpec::DHWC>(
+        file_reader, lazy_tags, region, read_data
+    );
+    ASSERT_TRUE(read_result.is_ok());
+    EXPECT_TRUE(compare_images<PixelType>(original_data, read_data));
+    
+    cleanup_file(filepath);
+}
+
+TEST(TiffFileRoundtrip, ClassicTIFF_Uint16_BigEndian_PixelByteOrder) {
+    using PixelType = uint16_t;
+    using CompSpec = CompressorSpec<NoneCompressorDesc>;
+    using DecompSpec = DecompressorSpec<NoneDecompressorDesc>;
+    using WriteConfig = WriteConfig<IFDAtEnd, SequentialTiles, DirectWrite<StreamFileWriter>, TwoPassOffsets>;
+    using WriterType = TiffWriter<PixelType, CompSpec, WriteConfig, TiffFormatType::Classic, std::endian::big>;
+    
+    const uint32_t width = 64;
+    const uint32_t height = 48;
+    const uint32_t tile_width = 32;
+    const uint32_t tile_height = 16;
+    
+    auto original_data = generate_test_image<PixelType>(width, height, 1, 1, 1357);
+    
+    auto filepath = get_temp_filepath("test_classic_uint16_be_pixel_order.tif");
+    cleanup_file(filepath);
+    
+    {
+        WriterType tiff_writer;
+        StreamFileWriter file_writer(filepath.string());
+        auto write_result = tiff_writer.template write_single_image<ImageLayoutSpec::DHWC>(
+            file_writer, original_data, width, height, tile_width, tile_height, 1,
+            PlanarConfiguration::Chunky, CompressionScheme::None, Predictor::None);
+        ASSERT_TRUE(write_result.is_ok());
+    }
+    
+    StreamFileReader file_reader(filepath.string());
+    auto ifd_offset = ifd::get_first_ifd_offset<StreamFileReader, TiffFormatType::Classic, std::endian::big>(file_reader);
+    ASSERT_TRUE(ifd_offset.is_ok());
+    auto ifd_result = ifd::read_ifd<StreamFileReader, TiffFormatType::Classic, std::endian::big>(
+        file_reader, ifd_offset.value());
+    ASSERT_TRUE(ifd_result.is_ok());
+    
+    ExtractedTags<MinTiledSpec> read_tags;
+    ASSERT_TRUE((read_tags.extract<StreamFileReader, TiffFormatType::Classic, std::endian::big>(
+        file_reader, std::span(ifd_result.value().tags))));
+    EXPECT_EQ(read_tags.byte_order, std::endian::big);
+    
+    // The samples of the first tile row are stored most significant byte first
+    auto tile_view = file_reader.read(read_tags.template get<TagCode::TileOffsets>()[0], tile_width * sizeof(PixelType));
+    ASSERT_TRUE(tile_view.is_ok());
+    auto stored = tile_view.value().data();
+    ASSERT_EQ(stored.size(), tile_width * sizeof(PixelType));
+    for (uint32_t x = 0; x < tile_width; ++x) {
+        const auto value = static_cast<PixelType>((std::to_integer<unsigned>(stored[2 * x]) << 8) |
+                                                  std::to_integer<unsigned>(stored[2 * x + 1]));
+        EXPECT_EQ(value, original_data[x]) << "sample " << x;
+    }
+    
+    TiledImageInfo<PixelType> image_info;
+    ASSERT_TRUE(image_info.update_from_metadata(read_tags).is_ok());
+    SimpleReader<PixelType, DecompSpec> image_reader;
+    auto region = image_info.shape().full_region();
+    std::vector<PixelType> read_data(region.num_samples());
+    ASSERT_TRUE((image_reader.read_region<ImageLayoutSpec::DHWC>(
+        file_reader, read_tags, region, read_data).is_ok()));
+    EXPECT_TRUE(compare_images<PixelType>(original_data, read_data));
+    
+    cleanup_file(filepath);
+}
+
 TEST(TiffFileRoundtrip, ClassicTIFF_Float_Predictor) {
     using PixelType = float;
     using CompSpec = CompressorSpec<NoneCompressorDesc, PackBitsCompressorDesc, ZstdCompressorDesc>;
@@ -942,3 +1089,386 @@ TEST(TiffFileRoundtrip, ErrorTruncatedFile) {
     
     cleanup_file(filepath);
 }
+
+// ============================================================================
+// Incremental (Tile-by-Tile) Write Tests
+// ============================================================================
+
+/// Copy channels [first_channel, first_channel + num_channels) of a 2D region out of a HWC image
+template <typename T>
+std::vector<T> crop_region(std::span<const T> image, uint32_t width, uint16_t channels,
+                           uint32_t x0, uint32_t y0, uint32_t w, uint32_t h,
+                           uint16_t first_channel, uint16_t num_channels) {
+    std::vector<T> out;
+    out.reserve(static_cast<std::size_t>(w) * h * num_channels);
+    for (uint32_t y = y0; y < y0 + h; ++y) {
+        for (uint32_t x = x0; x < x0 + w; ++x) {
+            for (uint16_t c = first_channel; c < first_channel + num_channels; ++c) {
+                out.push_back(image[(static_cast<std::size_t>(y) * width + x) * channels + c]);
+            }
+        }
+    }
+    return out;
+}
+
+/// Read the first image of a file back as DHWC
+template <typename PixelType, typename DecompSpec, typename TagSpec, typename ImageInfo,
+          TiffFormatType Format, std::endian Endian>
+std::vector<PixelType> read_back_image(const fs::path& filepath) {
+    StreamFileReader file_reader(filepath.string());
+    auto first_ifd_result = ifd::get_first_ifd_offset<StreamFileReader, Format, Endian>(file_reader);
+    EXPECT_TRUE(first_ifd_result.is_ok());
+    if (!first_ifd_result.is_ok()) return {};
+
+    auto ifd_result = ifd::read_ifd<StreamFileReader, Format, Endian>(file_reader, first_ifd_result.value());
+    EXPECT_TRUE(ifd_result.is_ok());
+    if (!ifd_result.is_ok()) return {};
+
+    ExtractedTags<TagSpec> read_tags;
+    auto extract_result = read_tags.template extract<StreamFileReader, Format, Endian>(
+        file_reader, std::span(ifd_result.value().tags));
+    EXPECT_TRUE(extract_result.is_ok()) << extract_result.error().message;
+    if (!extract_result.is_ok()) return {};
+
+    ImageInfo image_info;
+    auto update_result = image_info.update_from_metadata(read_tags);
+    EXPECT_TRUE(update_result.is_ok());
+    if (!update_result.is_ok()) return {};
+
+    SimpleReader<PixelType, DecompSpec> image_reader;
+    auto region = image_info.shape().full_region();
+    std::vector<PixelType> read_data(region.num_samples());
+    auto read_result = image_reader.template read_region<ImageLayoutSpec::DHWC>(
+        file_reader, read_tags, region, read_data);
+    EXPECT_TRUE(read_result.is_ok());
+    return read_data;
+}
+
+TEST(TiffFileRoundtrip, Incremental_Tiled_OutOfOrder_IFDAtEnd) {
+    using PixelType = uint16_t;
+    using CompSpec = CompressorSpec<NoneCompressorDesc, ZstdCompressorDesc>;
+    using DecompSpec = DecompressorSpec<NoneDecompressorDesc, ZstdDecompressorDesc>;
+    using WriteConfig = WriteConfig<IFDAtEnd, OnDemandTiles, DirectWrite<StreamFileWriter>, LazyOffsets>;
+    using WriterType = TiffWriter<PixelType, CompSpec, WriteConfig, TiffFormatType::Classic, std::endian::little>;
+    using TagSpec = TagSpec<
+        ImageWidthTag,
+        ImageLengthTag,
+        BitsPerSampleTag,
+        CompressionTag,
+        PhotometricInterpretationTag,
+        SamplesPerPixelTag,
+        PlanarConfigurationTag,
+        PredictorTag,
+        TileWidthTag,
+        TileLengthTag,
+        OptTag_t<TileOffsetsTag>,
+        OptTag_t<TileByteCountsTag>
+    >;
+
+    // Edge tiles on both axes
+    const uint32_t width = 100;
+    const uint32_t height = 70;
+    const uint32_t tile_width = 32;
+    const uint32_t tile_height = 32;
+    const uint16_t samples_per_pixel = 3;
+
+    auto original_data = generate_test_image<PixelType>(width, height, 1, samples_per_pixel, 77777);
+    std::span<const PixelType> original(original_data);
+
+    auto filepath = get_temp_filepath("test_incremental_tiled.tif");
+    cleanup_file(filepath);
+
+    WriterType tiff_writer;
+    StreamFileWriter file_writer(filepath.string());
+
+    ASSERT_TRUE(tiff_writer.begin_tiled_image(
+        width, height, 1, tile_width, tile_height, 1, samples_per_pixel,
+        PlanarConfiguration::Chunky, CompressionScheme::ZSTD, Predictor::Horizontal).is_ok());
+    EXPECT_TRUE(tiff_writer.image_in_progress());
+
+    // Push tiles in reverse order, edge tiles cropped to the image
+    const uint32_t tiles_across = (width + tile_width - 1) / tile_width;
+    const uint32_t tiles_down = (height + tile_height - 1) / tile_height;
+    for (uint32_t ty = tiles_down; ty-- > 0;) {
+        for (uint32_t tx = tiles_across; tx-- > 0;) {
+            uint32_t x0 = tx * tile_width;
+            uint32_t y0 = ty * tile_height;
+            auto tile = crop_region(original, width, samples_per_pixel, x0, y0,
+                                    std::min(tile_width, width - x0), std::min(tile_height, height - y0),
+                                    0, samples_per_pixel);
+            auto result = tiff_writer.write_tile(file_writer, tx, ty, 0, 0, std::span<const PixelType>(tile));
+            ASSERT_TRUE(result.is_ok()) << result.error().message;
+        }
+    }
+
+    auto finish_result = tiff_writer.finish_image(file_writer);
+    ASSERT_TRUE(finish_result.is_ok()) << finish_result.error().message;
+    EXPECT_FALSE(tiff_writer.image_in_progress());
+
+    auto read_data = read_back_image<PixelType, DecompSpec, TagSpec, TiledImageInfo<PixelType>,
+                                     TiffFormatType::Classic, std::endian::little>(filepath);
+    EXPECT_TRUE(compare_images<PixelType>(original_data, read_data));
+
+    cleanup_file(filepath);
+}
+
+TEST(TiffFileRoundtrip, Incremental_Planar_BigTIFF_IFDAtBeginning) {
+    using PixelType = uint8_t;
+    using CompSpec = CompressorSpec<NoneCompressorDesc, ZstdCompressorDesc>;
+    using DecompSpec = DecompressorSpec<NoneDecompressorDesc, ZstdDecompressorDesc>;
+    using WriteConfig = WriteConfig<IFDAtBeginning, OnDemandTiles, DirectWrite<StreamFileWriter>, LazyOffsets>;
+    using WriterType = TiffWriter<PixelType, CompSpec, WriteConfig, TiffFormatType::BigTIFF, std::endian::big>;
+    using TagSpec = TagSpec<
+        ImageWidthTag,
+        ImageLengthTag,
+        BitsPerSampleTag,
+        CompressionTag,
+        PhotometricInterpretationTag,
+        SamplesPerPixelTag,
+        PlanarConfigurationTag,
+        TileWidthTag,
+        TileLengthTag,
+        OptTag_t<TileOffsetsTag_BigTIFF>,
+        OptTag_t<TileByteCountsTag_BigTIFF>
+    >;
+
+    const uint32_t width = 64;
+    const uint32_t height = 48;
+    const uint32_t tile_width = 16;
+    const uint32_t tile_height = 16;
+    const uint16_t samples_per_pixel = 3;
+
+    auto original_data = generate_test_image<PixelType>(width, height, 1, samples_per_pixel, 88888);
+    std::span<const PixelType> original(original_data);
+
+    auto filepath = get_temp_filepath("test_incremental_planar_bigtiff.tif");
+    cleanup_file(filepath);
+
+    WriterType tiff_writer;
+    StreamFileWriter file_writer(filepath.string());
+
+    ASSERT_TRUE(tiff_writer.begin_tiled_image(
+        width, height, 1, tile_width, tile_height, 1, samples_per_pixel,
+        PlanarConfiguration::Planar, CompressionScheme::ZSTD, Predictor::None).is_ok());
+
+    // Interleave planes, as a per-channel pipeline would
+    for (uint32_t ty = 0; ty < height / tile_height; ++ty) {
+        for (uint32_t tx = 0; tx < width / tile_width; ++tx) {
+            for (uint16_t plane = 0; plane < samples_per_pixel; ++plane) {
+                auto tile = crop_region(original, width, samples_per_pixel,
+                                        tx * tile_width, ty * tile_height, tile_width, tile_height,
+                                        plane, 1);
+                ASSERT_TRUE(tiff_writer.write_tile(
+                    file_writer, tx, ty, 0, plane, std::span<const PixelType>(tile)).is_ok());
+            }
+        }
+    }
+    ASSERT_TRUE(tiff_writer.finish_image(file_writer).is_ok());
+
+    // IFD was reserved right after the BigTIFF header
+    StreamFileReader file_reader(filepath.string());
+    auto first_ifd_result = ifd::get_first_ifd_offset<StreamFileReader, TiffFormatType::BigTIFF, std::endian::big>(file_reader);
+    ASSERT_TRUE(first_ifd_result.is_ok());
+    EXPECT_EQ(first_ifd_result.value().value, 16u);
+
+    auto read_data = read_back_image<PixelType, DecompSpec, TagSpec, TiledImageInfo<PixelType>,
+                                     TiffFormatType::BigTIFF, std::endian::big>(filepath);
+    EXPECT_TRUE(compare_images<PixelType>(original_data, read_data));
+
+    cleanup_file(filepath);
+}
+
+TEST(TiffFileRoundtrip, Incremental_Stripped) {
+    using PixelType = uint8_t;
+    using CompSpec = CompressorSpec<NoneCompressorDesc, PackBitsCompressorDesc>;
+    using DecompSpec = DecompressorSpec<NoneDecompressorDesc, PackBitsDecompressorDesc>;
+    using WriteConfig = WriteConfig<IFDAtEnd, OnDemandTiles, BufferedWrite<StreamFileWriter>, LazyOffsets>;
+    using WriterType = TiffWriter<PixelType, CompSpec, WriteConfig, TiffFormatType::Classic, std::endian::little>;
+    using TagSpec = TagSpec<
+        ImageWidthTag,
+        ImageLengthTag,
+        BitsPerSampleTag,
+        CompressionTag,
+        PhotometricInterpretationTag,
+        OptTag_t<StripOffsetsTag>,
+        SamplesPerPixelTag,
+        RowsPerStripTag,
+        OptTag_t<StripByteCountsTag>,
+        PlanarConfigurationTag
+    >;
+
+    const uint32_t width = 120;
+    const uint32_t height = 120;
+    const uint32_t rows_per_strip = 30;
+
+    auto original_data = generate_test_image<PixelType>(width, height, 1, 1, 99999);
+    std::span<const PixelType> original(original_data);
+
+    auto filepath = get_temp_filepath("test_incremental_stripped.tif");
+    cleanup_file(filepath);
+
+    WriterType tiff_writer;
+    StreamFileWriter file_writer(filepath.string());
+
+    ASSERT_TRUE(tiff_writer.begin_stripped_image(
+        width, height, rows_per_strip, 1,
+        PlanarConfiguration::Chunky, CompressionScheme::PackBits, Predictor::None).is_ok());
+
+    for (uint32_t strip : {2u, 0u, 3u, 1u}) {
+        auto data = original.subspan(static_cast<std::size_t>(strip) * rows_per_strip * width,
+                                     static_cast<std::size_t>(rows_per_strip) * width);
+        ASSERT_TRUE(tiff_writer.write_strip(file_writer, strip, 0, data).is_ok());
+    }
+    ASSERT_TRUE(tiff_writer.finish_image(file_writer).is_ok());
+
+    auto read_data = read_back_image<PixelType, DecompSpec, TagSpec, StrippedImageInfo<PixelType>,
+                                     TiffFormatType::Classic, std::endian::little>(filepath);
+    EXPECT_TRUE(compare_images<PixelType>(original_data, read_data));
+
+    cleanup_file(filepath);
+}
+
+TEST(TiffFileRoundtrip, Incremental_SessionErrors) {
+    using PixelType = uint8_t;
+    using CompSpec = CompressorSpec<NoneCompressorDesc>;
+    using WriteConfig = WriteConfig<IFDAtEnd, OnDemandTiles, DirectWrite<StreamFileWriter>, LazyOffsets>;
+    using WriterType = TiffWriter<PixelType, CompSpec, WriteConfig, TiffFormatType::Classic, std::endian::little>;
+
+    auto filepath = get_temp_filepath("test_incremental_errors.tif");
+    cleanup_file(filepath);
+
+    WriterType tiff_writer;
+    StreamFileWriter file_writer(filepath.string());
+    std::vector<PixelType> tile(32 * 32, 7);
+    std::span<const PixelType> tile_span(tile);
+
+    // No session yet
+    auto result = tiff_writer.write_tile(file_writer, 0, 0, 0, 0, tile_span);
+    ASSERT_FALSE(result.is_ok());
+    EXPECT_EQ(result.error().code, Error::Code::InvalidOperation);
+    result = tiff_writer.finish_image(file_writer);
+    ASSERT_FALSE(result.is_ok());
+    EXPECT_EQ(result.error().code, Error::Code::InvalidOperation);
+
+    ASSERT_TRUE(tiff_writer.begin_tiled_image(
+        64, 64, 1, 32, 32, 1, 1,
+        PlanarConfiguration::Chunky, CompressionScheme::None, Predictor::None).is_ok());
+
+    // A second session cannot be opened while one is in progress
+    result = tiff_writer.begin_tiled_image(
+        64, 64, 1, 32, 32, 1, 1,
+        PlanarConfiguration::Chunky, CompressionScheme::None, Predictor::None);
+    ASSERT_FALSE(result.is_ok());
+    EXPECT_EQ(result.error().code, Error::Code::InvalidOperation);
+
+    // Out of range tile and wrong data size
+    result = tiff_writer.write_tile(file_writer, 2, 0, 0, 0, tile_span);
+    ASSERT_FALSE(result.is_ok());
+    EXPECT_EQ(result.error().code, Error::Code::OutOfBounds);
+    result = tiff_writer.write_tile(file_writer, 0, 0, 0, 0, tile_span.subspan(0, 100));
+    ASSERT_FALSE(result.is_ok());
+    EXPECT_EQ(result.error().code, Error::Code::OutOfBounds);
+
+    for (uint32_t i = 0; i < 3; ++i) {
+        ASSERT_TRUE(tiff_writer.write_tile(file_writer, i % 2, i / 2, 0, 0, tile_span).is_ok());
+    }
+
+    // Duplicate tile
+    result = tiff_writer.write_tile(file_writer, 0, 0, 0, 0, tile_span);
+    ASSERT_FALSE(result.is_ok());
+    EXPECT_EQ(result.error().code, Error::Code::InvalidOperation);
+
+    // Missing tile: finish fails but the session stays open
+    result = tiff_writer.finish_image(file_writer);
+    ASSERT_FALSE(result.is_ok());
+    EXPECT_EQ(result.error().code, Error::Code::InvalidOperation);
+    EXPECT_TRUE(tiff_writer.image_in_progress());
+
+    ASSERT_TRUE(tiff_writer.write_tile(file_writer, 1, 1, 0, 0, tile_span).is_ok());
+    ASSERT_TRUE(tiff_writer.finish_image(file_writer).is_ok());
+    EXPECT_FALSE(tiff_writer.image_in_progress());
+
+    cleanup_file(filepath);
+}
+
+// ============================================================================
+// LZW / Deflate Write Tests
+// ============================================================================
+
+/// Write a tiled uint16 image with the given scheme and read it back
+template <typename CompSpec, typename DecompSpec>
+void roundtrip_with_scheme(CompressionScheme compression, Predictor predictor, const char* filename) {
+    using PixelType = uint16_t;
+    using WriteConfig = WriteConfig<IFDAtBeginning, ImageOrderTiles, DirectWrite<StreamFileWriter>, TwoPassOffsets>;
+    using WriterType = TiffWriter<PixelType, CompSpec, WriteConfig, TiffFormatType::Classic, std::endian::little>;
+    using TagSpec = TagSpec<
+        ImageWidthTag,
+        ImageLengthTag,
+        BitsPerSampleTag,
+        CompressionTag,
+        PhotometricInterpretationTag,
+        SamplesPerPixelTag,
+        PlanarConfigurationTag,
+        OptTag_t<PredictorTag>,  // Not written without predictor
+        TileWidthTag,
+        TileLengthTag,
+        OptTag_t<TileOffsetsTag>,
+        OptTag_t<TileByteCountsTag>
+    >;
+
+    const uint32_t width = 150;
+    const uint32_t height = 90;
+    const uint16_t samples_per_pixel = 2;
+
+    // Smooth gradient so that the predictor and the codec actually compress
+    std::vector<PixelType> original_data(static_cast<std::size_t>(width) * height * samples_per_pixel);
+    for (uint32_t y = 0; y < height; ++y) {
+        for (uint32_t x = 0; x < width; ++x) {
+            for (uint16_t c = 0; c < samples_per_pixel; ++c) {
+                original_data[(static_cast<std::size_t>(y) * width + x) * samples_per_pixel + c] =
+                    static_cast<PixelType>(x * 13 + y * 7 + c * 1000);
+            }
+        }
+    }
+
+    auto filepath = get_temp_filepath(filename);
+    cleanup_file(filepath);
+
+    ExtractedTags<PhotometricInterpretationTag> tags;
+    tags.template get<TagCode::PhotometricInterpretation>() = PhotometricInterpretation::MinIsBlack;
+
+    {
+        WriterType tiff_writer;
+        StreamFileWriter file_writer(filepath.string());
+        auto write_result = tiff_writer.template write_single_image<ImageLayoutSpec::DHWC>(
+            file_writer, std::span<const PixelType>(original_data),
+            width, height, 64, 64, samples_per_pixel,
+            PlanarConfiguration::Chunky, compression, predictor, tags);
+        ASSERT_TRUE(write_result.is_ok()) << write_result.error().message;
+    }
+
+    // Smaller than the 3x2 uncompressed (padded) tiles
+    EXPECT_LT(fs::file_size(filepath), 3u * 2u * 64u * 64u * samples_per_pixel * sizeof(PixelType));
+
+    auto read_data = read_back_image<PixelType, DecompSpec, TagSpec, TiledImageInfo<PixelType>,
+                                     TiffFormatType::Classic, std::endian::little>(filepath);
+    EXPECT_TRUE(compare_images<PixelType>(original_data, read_data));
+
+    cleanup_file(filepath);
+}
+
+TEST(TiffFileRoundtrip, ClassicTIFF_Uint16_LZW) {
+    using CompSpec = CompressorSpec<NoneCompressorDesc, LZWCompressorDesc>;
+    using DecompSpec = DecompressorSpec<NoneDecompressorDesc, LZWDecompressorDesc>;
+    roundtrip_with_scheme<CompSpec, DecompSpec>(CompressionScheme::LZW, Predictor::None, "test_lzw.tif");
+    roundtrip_with_scheme<CompSpec, DecompSpec>(CompressionScheme::LZW, Predictor::Horizontal, "test_lzw_pred.tif");
+}
+
+#ifdef HAVE_ZLIB
+TEST(TiffFileRoundtrip, ClassicTIFF_Uint16_Deflate) {
+    using CompSpec = CompressorSpec<NoneCompressorDesc, DeflateCompressorDescWithLevel<1>>;
+    using DecompSpec = DecompressorSpec<NoneDecompressorDesc, DeflateDecompressorDesc>;
+    roundtrip_with_scheme<CompSpec, DecompSpec>(CompressionScheme::Deflate_Adobe, Predictor::Horizontal, "test_deflate.tif");
+    roundtrip_with_scheme<CompSpec, DecompSpec>(CompressionScheme::Deflate, Predictor::None, "test_deflate_old.tif");
+}
+#endif // HAVE_ZLIB
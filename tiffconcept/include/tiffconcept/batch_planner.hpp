@@ -0,0 +1,139 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <span>
+#include <vector>
+#include "types/tile_info.hpp"
+
+namespace tiffconcept {
+
+/// @brief Adjacent tiles fetched with a single read
+struct IoBatch {
+    size_t first_tile_index;  ///< Index of the first tile of the batch (in the sorted tile list)
+    size_t tile_count;        ///< Number of tiles in the batch
+    size_t file_offset;       ///< Starting file offset
+    size_t total_size;        ///< Total bytes to read (including gaps)
+};
+
+/// @brief Batches of a read, as built by IOLimitedReader and FastReader
+///        (see their plan_batches() method)
+struct BatchPlan {
+    std::vector<IoBatch> batches;
+    size_t bytes_needed = 0;        ///< Bytes of the tiles themselves
+    size_t bytes_read = 0;          ///< Bytes of the batches (tiles, gaps and alignment)
+    double expected_seconds = 0.0;  ///< Estimated completion time (0 without a cost model)
+
+    /// @brief Read amplification (bytes read / bytes needed, 1 = no wasted byte)
+    [[nodiscard]] double amplification() const noexcept {
+        return bytes_needed > 0 ? static_cast<double>(bytes_read) / static_cast<double>(bytes_needed) : 1.0;
+    }
+};
+
+/// @brief I/O counters of a batching reader (snapshot, see io_stats())
+struct BatchIoStats {
+    uint64_t requests = 0;      ///< Batch reads issued
+    uint64_t bytes_read = 0;    ///< Bytes of the batches
+    uint64_t bytes_needed = 0;  ///< Bytes of the tiles they contained
+
+    /// @brief Read amplification (bytes read / bytes needed, 1 = no wasted byte)
+    [[nodiscard]] double amplification() const noexcept {
+        return bytes_needed > 0 ? static_cast<double>(bytes_read) / static_cast<double>(bytes_needed) : 1.0;
+    }
+};
+
+/// @brief Group tiles into batches, bridging gaps of at most max_gap_size bytes
+///
+/// Tile extents are widened to whole blocks of alignment bytes first, so that
+/// tiles sharing a block merge and every batch is one aligned read. A batch
+/// never grows beyond max_batch_size bytes, unless a single tile does.
+///
+/// @param tiles Tiles sorted by file offset (collect_tiles_for_region)
+/// @param alignment Block size of the reads (power of two, 1 = none)
+/// @return Batches covering all tiles exactly once, in order
+[[nodiscard]] BatchPlan make_batch_plan(
+    std::span<const Tile> tiles,
+    size_t alignment,
+    size_t max_batch_size,
+    size_t max_gap_size);
+
+/// @brief Latency and bandwidth of a storage, as estimated by an AdaptiveBatchPlanner
+struct IoCostEstimate {
+    double latency_seconds;             ///< Time of a request, regardless of its size
+    double bandwidth_bytes_per_second;  ///< Transfer rate once a request is served
+    uint64_t samples;                   ///< Reads measured so far
+};
+
+/// @brief Batch planner choosing gaps to bridge from measured I/O costs
+///
+/// A read of n bytes is modelled as taking latency + n / bandwidth seconds.
+/// Both parameters are fitted online to the reads of the readers using the
+/// planner: each measured read updates exponentially weighted means of its
+/// size and duration, and the line through them is refitted (the intercept
+/// is the latency, the slope the inverse bandwidth). Until reads of
+/// different sizes have been seen, the configured bandwidth is kept.
+///
+/// With this model, bridging a gap of g bytes costs g / bandwidth seconds
+/// and saves one request, i.e. latency / concurrency seconds when requests
+/// are served concurrency at a time. Each gap is bridged iff this pays off,
+/// which minimizes the expected completion time of the read (costs add up),
+/// within the memory bound of max_batch_size.
+///
+/// Plugged into IOLimitedReader and FastReader (Config::batch_planner), where
+/// it replaces Config::max_gap_size. One planner should be shared by the
+/// readers of one storage.
+///
+/// @note Thread-safe
+class AdaptiveBatchPlanner {
+public:
+    struct Config {
+        double smoothing = 0.1;   ///< EWMA weight of the latest read (0 < smoothing <= 1)
+        std::chrono::nanoseconds initial_latency{std::chrono::microseconds(100)};  ///< Prior latency
+        double initial_bandwidth = 1e9;  ///< Prior bandwidth (bytes per second)
+        size_t concurrency = 1;   ///< Requests the storage serves in parallel
+    };
+
+    AdaptiveBatchPlanner();
+    explicit AdaptiveBatchPlanner(Config config);
+
+    AdaptiveBatchPlanner(const AdaptiveBatchPlanner&) = delete;
+    AdaptiveBatchPlanner& operator=(const AdaptiveBatchPlanner&) = delete;
+
+    /// @brief Account for a read of bytes bytes that took elapsed
+    void record(size_t bytes, std::chrono::nanoseconds elapsed) noexcept;
+
+    [[nodiscard]] IoCostEstimate estimate() const noexcept;
+
+    /// @brief Largest gap worth reading rather than issuing another request
+    [[nodiscard]] size_t break_even_gap() const noexcept;
+
+    /// @brief Batches minimizing the expected completion time of a read
+    /// @param tiles Tiles sorted by file offset
+    /// @param alignment Block size of the reads (power of two, 1 = none)
+    /// @param max_batch_size Upper bound of a batch (memory)
+    [[nodiscard]] BatchPlan plan(std::span<const Tile> tiles, size_t alignment, size_t max_batch_size) const;
+
+    [[nodiscard]] const Config& config() const noexcept { return config_; }
+
+private:
+    [[nodiscard]] static size_t break_even_gap(const IoCostEstimate& estimate, size_t concurrency) noexcept;
+
+    Config config_;
+
+    mutable std::mutex mutex_;
+    // Exponentially weighted means of the read sizes (x, bytes) and durations (y, seconds)
+    double mean_x_ = 0.0;
+    double mean_y_ = 0.0;
+    double mean_xx_ = 0.0;
+    double mean_xy_ = 0.0;
+    double latency_;          // Seconds
+    double seconds_per_byte_;
+    uint64_t samples_ = 0;
+};
+
+} // namespace tiffconcept
+
+#define TIFFCONCEPT_BATCH_PLANNER_HEADER
+#include "impl/batch_planner_impl.hpp"
@@ -0,0 +1,176 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <new>
+#include <span>
+#include <string>
+#include <vector>
+#include <zlib.h>
+#include "compressor_base.hpp"
+#include "../types/result.hpp"
+
+namespace tiffconcept {
+
+/// RAII wrapper for a zlib deflate stream
+/// The stream is allocated lazily on first use and reset (not reallocated)
+/// between chunks, so the window and hash chains are reused for every tile
+/// encoded by the owning ChunkEncoder.
+/// @tparam DefaultLevel Compression level used by default-constructed instances
+///         (e.g. inside a CompressorSpec). 1 is fastest, 9 compresses best.
+template <int DefaultLevel = 6>
+class DeflateCompressor {
+private:
+    struct DeflateStreamDeleter {
+        void operator()(z_stream* stream) const noexcept {
+            if (stream) {
+                deflateEnd(stream);
+                delete stream;
+            }
+        }
+    };
+
+    mutable std::unique_ptr<z_stream, DeflateStreamDeleter> stream_;
+    mutable int stream_level_ = 0;
+    int compression_level_;
+
+    /// Ensure the deflate stream is initialized for the current level (lazy initialization)
+    [[nodiscard]] Result<z_stream*> ensure_stream() const noexcept {
+        if (stream_ && stream_level_ != compression_level_) {
+            // Level changed since the stream was created
+            stream_.reset();
+        }
+        if (!stream_) {
+            auto* stream = new (std::nothrow) z_stream{};
+            if (!stream) {
+                return Err(Error::Code::MemoryError,
+                          "Failed to allocate deflate stream");
+            }
+            // Both TIFF Deflate variants store a zlib (RFC 1950) stream
+            if (deflateInit(stream, compression_level_) != Z_OK) {
+                delete stream;
+                return Err(Error::Code::MemoryError,
+                          "Failed to initialize deflate stream");
+            }
+            stream_.reset(stream);
+            stream_level_ = compression_level_;
+        } else if (deflateReset(stream_.get()) != Z_OK) [[unlikely]] {
+            return Err(Error::Code::CompressionError,
+                      "Failed to reset deflate stream");
+        }
+        return Ok(stream_.get());
+    }
+
+public:
+    /// Create a Deflate compressor with the specified compression level
+    /// @param level Compression level (1-9, 0 stores uncompressed, default DefaultLevel)
+    explicit constexpr DeflateCompressor(int level = DefaultLevel) noexcept
+        : compression_level_(level) {}
+
+    ~DeflateCompressor() = default;
+
+    // Non-copyable
+    DeflateCompressor(const DeflateCompressor&) = delete;
+    DeflateCompressor& operator=(const DeflateCompressor&) = delete;
+
+    // Movable
+    DeflateCompressor(DeflateCompressor&&) noexcept = default;
+    DeflateCompressor& operator=(DeflateCompressor&&) noexcept = default;
+
+    /// Clone this compressor for multi-threading
+    /// Creates a new compressor with the same compression level but a fresh stream
+    [[nodiscard]] DeflateCompressor clone() const noexcept {
+        return DeflateCompressor{compression_level_};
+    }
+
+    /// Get the default compression scheme for this compressor
+    /// Adobe-style Deflate (8) is the code recommended by the TIFF specification
+    [[nodiscard]] static constexpr CompressionScheme get_default_scheme() noexcept {
+        return CompressionScheme::Deflate_Adobe;
+    }
+
+    /// Compress data using the stream (thread-safe if each thread has its own instance)
+    /// Stream is created lazily on first use
+    /// @param output Output vector - will be resized if needed
+    /// @param offset Starting position in output vector
+    /// @param input Input data to compress
+    /// @return Number of bytes written
+    [[nodiscard]] Result<std::size_t> compress(
+        std::vector<std::byte>& output,
+        std::size_t offset,
+        std::span<const std::byte> input) const noexcept {
+
+        if (input.size() > std::numeric_limits<uInt>::max()) [[unlikely]] {
+            return Err(Error::Code::UnsupportedFeature,
+                       "Deflate chunk larger than 4 GiB");
+        }
+
+        auto stream_result = ensure_stream();
+        if (!stream_result) [[unlikely]] {
+            return Err(stream_result.error().code, stream_result.error().message);
+        }
+        z_stream* stream = stream_result.value();
+
+        // Calculate worst-case compressed size
+        std::size_t bound = deflateBound(stream, static_cast<uLong>(input.size()));
+        std::size_t required_size = offset + bound;
+
+        // Resize if necessary
+        if (output.size() < required_size) {
+            try {
+                output.resize(required_size);
+            } catch (...) {
+                return Err(Error::Code::MemoryError,
+                           "Failed to resize output buffer");
+            }
+        }
+
+        // zlib does not modify the input, the cast only works around its C API
+        stream->next_in = reinterpret_cast<Bytef*>(const_cast<std::byte*>(input.data()));
+        stream->avail_in = static_cast<uInt>(input.size());
+        stream->next_out = reinterpret_cast<Bytef*>(output.data() + offset);
+        stream->avail_out = static_cast<uInt>(bound);
+
+        int ret = deflate(stream, Z_FINISH);
+        if (ret != Z_STREAM_END) [[unlikely]] {
+            return Err(Error::Code::CompressionError,
+                       std::string("Deflate compression failed: ") +
+                       (stream->msg ? stream->msg : "output buffer too small"));
+        }
+
+        return Ok(bound - stream->avail_out);
+    }
+
+    /// Get the compression level
+    [[nodiscard]] constexpr int get_level() const noexcept {
+        return compression_level_;
+    }
+
+    /// Set the compression level
+    /// The stream is recreated on the next compress() call
+    constexpr void set_level(int level) noexcept {
+        compression_level_ = level;
+    }
+
+    /// Get the worst-case compressed size for given input size
+    [[nodiscard]] static std::size_t get_compress_bound(std::size_t input_size) noexcept {
+        return compressBound(static_cast<uLong>(input_size));
+    }
+};
+
+/// Deflate compressor descriptor
+/// Handles both Adobe-style (8) and the older PKZIP-style (32946) Deflate tags
+/// @tparam Level Compression level used by the writer (1-9, default 6)
+template <int Level = 6>
+using DeflateCompressorDescWithLevel = CompressorDescriptor<
+    DeflateCompressor<Level>,
+    CompressionScheme::Deflate_Adobe,
+    CompressionScheme::Deflate
+>;
+
+/// Deflate compressor descriptor with zlib's default level (6)
+using DeflateCompressorDesc = DeflateCompressorDescWithLevel<>;
+
+} // namespace tiffconcept
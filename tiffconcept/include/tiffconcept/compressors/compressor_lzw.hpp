@@ -0,0 +1,238 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <span>
+#include <vector>
+#include "compressor_base.hpp"
+#include "../types/result.hpp"
+
+namespace tiffconcept {
+
+/// LZW compression as per TIFF spec Section 13
+///
+/// Writes new-style streams (MSB-first codes, code width growing one code
+/// early), the layout produced by libtiff and readable by every TIFF reader.
+/// The string table is an open-addressing hash of (prefix code, byte) keys.
+/// Slots are tagged with a generation number, so a Clear code (and every new
+/// chunk) invalidates the whole table by bumping the generation instead of
+/// clearing 64 KiB. The table is allocated lazily and reused for every chunk
+/// encoded by the owning ChunkEncoder.
+class LZWCompressor {
+private:
+    static constexpr uint32_t clear_code = 256;
+    static constexpr uint32_t eoi_code = 257;
+    static constexpr uint32_t first_free_code = 258;
+    static constexpr uint32_t min_code_bits = 9;
+    static constexpr uint32_t max_code_bits = 12;
+    /// Codes are not allowed past this point: a Clear code is emitted instead
+    static constexpr uint32_t max_free_code = (1u << max_code_bits) - 2;
+
+    static constexpr uint32_t hash_bits = 13;
+    static constexpr uint32_t hash_size = 1u << hash_bits;
+    /// Keys use the low 20 bits of a slot tag, the generation the high 12 bits
+    static constexpr uint32_t key_bits = 20;
+    static constexpr uint32_t max_generation = (1u << (32 - key_bits)) - 1;
+
+    /// Hash table slot: generation << key_bits | (prefix << 8 | byte)
+    struct Slot {
+        uint32_t tag;
+        uint32_t code;
+    };
+
+    struct Table {
+        Slot slots[hash_size];
+        uint32_t generation;
+    };
+
+    mutable std::unique_ptr<Table> table_;
+
+    /// Ensure the string table is allocated (lazy initialization)
+    [[nodiscard]] Result<Table*> ensure_table() const noexcept {
+        if (!table_) {
+            // Generation 0 is never used, so value-initialized slots are empty
+            table_.reset(new (std::nothrow) Table{});
+            if (!table_) [[unlikely]] {
+                return Err(Error::Code::MemoryError,
+                          "Failed to allocate LZW string table");
+            }
+        }
+        return Ok(table_.get());
+    }
+
+    /// Invalidate every entry of the table
+    static void reset_table(Table& table) noexcept {
+        if (table.generation == max_generation) {
+            std::fill(std::begin(table.slots), std::end(table.slots), Slot{0, 0});
+            table.generation = 0;
+        }
+        ++table.generation;
+    }
+
+    /// MSB-first bit writer into a pre-sized output buffer
+    class BitWriter {
+    private:
+        std::byte* out_;
+        uint64_t buffer_ = 0;
+        uint32_t bits_ = 0;
+
+    public:
+        explicit BitWriter(std::byte* out) noexcept : out_(out) {}
+
+        void write(uint32_t code, uint32_t width) noexcept {
+            buffer_ = (buffer_ << width) | code;
+            bits_ += width;
+            while (bits_ >= 8) {
+                bits_ -= 8;
+                *out_++ = static_cast<std::byte>(buffer_ >> bits_);
+            }
+        }
+
+        /// Flush the last partial byte (zero padded)
+        [[nodiscard]] std::byte* finish() noexcept {
+            if (bits_ > 0) {
+                *out_++ = static_cast<std::byte>(buffer_ << (8 - bits_));
+                bits_ = 0;
+            }
+            return out_;
+        }
+    };
+
+public:
+    constexpr LZWCompressor() noexcept = default;
+
+    ~LZWCompressor() = default;
+
+    // Non-copyable
+    LZWCompressor(const LZWCompressor&) = delete;
+    LZWCompressor& operator=(const LZWCompressor&) = delete;
+
+    // Movable
+    LZWCompressor(LZWCompressor&&) noexcept = default;
+    LZWCompressor& operator=(LZWCompressor&&) noexcept = default;
+
+    /// Clone this compressor for multi-threading
+    /// Creates a new compressor with a fresh table
+    [[nodiscard]] LZWCompressor clone() const noexcept {
+        return LZWCompressor{};
+    }
+
+    /// Get the default compression scheme for this compressor
+    [[nodiscard]] static constexpr CompressionScheme get_default_scheme() noexcept {
+        return CompressionScheme::LZW;
+    }
+
+    /// Compress data (thread-safe if each thread has its own instance)
+    /// Table is created lazily on first use
+    /// @param output Output vector - will be resized if needed
+    /// @param offset Starting position in output vector
+    /// @param input Input data to compress
+    /// @return Number of bytes written
+    [[nodiscard]] Result<std::size_t> compress(
+        std::vector<std::byte>& output,
+        std::size_t offset,
+        std::span<const std::byte> input) const noexcept {
+
+        auto table_result = ensure_table();
+        if (!table_result) [[unlikely]] {
+            return Err(table_result.error().code, table_result.error().message);
+        }
+        Table& table = *table_result.value();
+
+        std::size_t required_size = offset + get_compress_bound(input.size());
+        if (output.size() < required_size) {
+            try {
+                output.resize(required_size);
+            } catch (...) {
+                return Err(Error::Code::MemoryError,
+                           "Failed to resize output buffer");
+            }
+        }
+
+        BitWriter writer(output.data() + offset);
+        uint32_t width = min_code_bits;
+        uint32_t next_code = first_free_code;
+
+        reset_table(table);
+        writer.write(clear_code, width);
+
+        if (!input.empty()) {
+            const auto* data = reinterpret_cast<const uint8_t*>(input.data());
+            const std::size_t size = input.size();
+            uint32_t current = data[0];
+
+            for (std::size_t i = 1; i < size; ++i) {
+                const uint32_t byte = data[i];
+                const uint32_t key = (current << 8) | byte;
+                const uint32_t tag = (table.generation << key_bits) | key;
+
+                // Fibonacci hashing, linear probing (load factor stays below 1/2)
+                uint32_t slot = (key * 2654435761u) >> (32 - hash_bits);
+                while (true) {
+                    const Slot& s = table.slots[slot];
+                    if (s.tag == tag) {
+                        break;
+                    }
+                    if ((s.tag >> key_bits) != table.generation) {
+                        break;
+                    }
+                    slot = (slot + 1) & (hash_size - 1);
+                }
+
+                if (table.slots[slot].tag == tag) {
+                    // String + byte is in the table: extend the current string
+                    current = table.slots[slot].code;
+                    continue;
+                }
+
+                writer.write(current, width);
+                table.slots[slot] = Slot{tag, next_code};
+                ++next_code;
+
+                if (next_code == max_free_code) {
+                    // Table full: start over
+                    writer.write(clear_code, width);
+                    reset_table(table);
+                    next_code = first_free_code;
+                    width = min_code_bits;
+                } else if (next_code == (1u << width)) {
+                    ++width;
+                }
+                current = byte;
+            }
+
+            writer.write(current, width);
+            // The decoder adds an entry when it reads this code: keep the
+            // code width in sync for the EOI code
+            ++next_code;
+            if (next_code == max_free_code) {
+                writer.write(clear_code, width);
+                width = min_code_bits;
+            } else if (next_code == (1u << width)) {
+                ++width;
+            }
+        }
+
+        writer.write(eoi_code, width);
+        std::byte* end = writer.finish();
+        return Ok(static_cast<std::size_t>(end - (output.data() + offset)));
+    }
+
+    /// Get the worst-case compressed size for given input size
+    /// Every byte may need a 12-bit code, plus Clear codes and the EOI code
+    [[nodiscard]] static constexpr std::size_t get_compress_bound(std::size_t input_size) noexcept {
+        std::size_t max_codes = input_size + input_size / (max_free_code - first_free_code) + 3;
+        return (max_codes * max_code_bits + 7) / 8;
+    }
+};
+
+/// LZW compressor descriptor
+using LZWCompressorDesc = CompressorDescriptor<
+    LZWCompressor,
+    CompressionScheme::LZW
+>;
+
+} // namespace tiffconcept
@@ -0,0 +1,135 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <new>
+#include <span>
+#include <string>
+#include <zlib.h>
+#include "decompressor_base.hpp"
+#include "../types/result.hpp"
+
+namespace tiffconcept {
+
+/// RAII wrapper for a zlib inflate stream
+/// The stream is allocated lazily on first use and reset (not reallocated)
+/// between chunks, so the 32 KiB window and the decoding tables are reused
+/// for every tile decoded by the owning TileDecoder.
+class DeflateDecompressor {
+private:
+    struct InflateStreamDeleter {
+        void operator()(z_stream* stream) const noexcept {
+            if (stream) {
+                inflateEnd(stream);
+                delete stream;
+            }
+        }
+    };
+
+    mutable std::unique_ptr<z_stream, InflateStreamDeleter> stream_;
+
+    /// Ensure the inflate stream is initialized (lazy initialization)
+    [[nodiscard]] Result<z_stream*> ensure_stream() const noexcept {
+        if (!stream_) {
+            auto* stream = new (std::nothrow) z_stream{};
+            if (!stream) {
+                return Err(Error::Code::MemoryError,
+                          "Failed to allocate inflate stream");
+            }
+            // Both TIFF Deflate variants store a zlib (RFC 1950) stream
+            if (inflateInit(stream) != Z_OK) {
+                delete stream;
+                return Err(Error::Code::MemoryError,
+                          "Failed to initialize inflate stream");
+            }
+            stream_.reset(stream);
+        } else if (inflateReset(stream_.get()) != Z_OK) [[unlikely]] {
+            return Err(Error::Code::InvalidOperation,
+                      "Failed to reset inflate stream");
+        }
+        return Ok(stream_.get());
+    }
+
+public:
+    constexpr DeflateDecompressor() noexcept = default;
+
+    ~DeflateDecompressor() = default;
+
+    // Non-copyable
+    DeflateDecompressor(const DeflateDecompressor&) = delete;
+    DeflateDecompressor& operator=(const DeflateDecompressor&) = delete;
+
+    // Movable
+    DeflateDecompressor(DeflateDecompressor&&) noexcept = default;
+    DeflateDecompressor& operator=(DeflateDecompressor&&) noexcept = default;
+
+    /// Decompress a zlib stream (thread-safe if each thread has its own instance)
+    /// Stream is created lazily on first use
+    /// @note Like libtiff, decoding stops once the output buffer is full: trailing
+    ///       data after a complete chunk is ignored rather than reported as an error
+    [[nodiscard]] Result<std::size_t> decompress(
+        std::span<std::byte> output,
+        std::span<const std::byte> input) const noexcept {
+
+        if (input.size() > std::numeric_limits<uInt>::max() ||
+            output.size() > std::numeric_limits<uInt>::max()) [[unlikely]] {
+            return Err(Error::Code::UnsupportedFeature,
+                       "Deflate chunk larger than 4 GiB");
+        }
+
+        if (output.empty()) {
+            return Ok(std::size_t{0});
+        }
+
+        auto stream_result = ensure_stream();
+        if (!stream_result) {
+            return Err(stream_result.error().code, stream_result.error().message);
+        }
+        z_stream* stream = stream_result.value();
+
+        // zlib does not modify the input, the cast only works around its C API
+        stream->next_in = reinterpret_cast<Bytef*>(const_cast<std::byte*>(input.data()));
+        stream->avail_in = static_cast<uInt>(input.size());
+        stream->next_out = reinterpret_cast<Bytef*>(output.data());
+        stream->avail_out = static_cast<uInt>(output.size());
+
+        int ret = inflate(stream, Z_FINISH);
+        std::size_t produced = output.size() - stream->avail_out;
+
+        if (ret == Z_STREAM_END) {
+            return Ok(produced);
+        }
+
+        // Output full before the end-of-stream marker: the chunk is complete
+        if (stream->avail_out == 0 && (ret == Z_OK || ret == Z_BUF_ERROR)) {
+            return Ok(produced);
+        }
+
+        if (ret == Z_BUF_ERROR || ret == Z_OK) {
+            return Err(Error::Code::InvalidFormat,
+                       "Deflate decompression failed: truncated stream");
+        }
+
+        if (ret == Z_MEM_ERROR) [[unlikely]] {
+            return Err(Error::Code::MemoryError,
+                       "Deflate decompression failed: out of memory");
+        }
+
+        return Err(Error::Code::InvalidFormat,
+                   std::string("Deflate decompression failed: ") +
+                   (stream->msg ? stream->msg : "corrupt data"));
+    }
+};
+
+/// Deflate decompressor descriptor
+/// Handles both Adobe-style (8) and the older PKZIP-style (32946) Deflate tags,
+/// which use the same zlib stream format
+using DeflateDecompressorDesc = DecompressorDescriptor<
+    DeflateDecompressor,
+    CompressionScheme::Deflate_Adobe,
+    CompressionScheme::Deflate
+>;
+
+} // namespace tiffconcept
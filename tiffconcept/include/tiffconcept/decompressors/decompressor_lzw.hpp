@@ -0,0 +1,279 @@
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <new>
+#include <span>
+#include "decompressor_base.hpp"
+#include "../types/result.hpp"
+#include "../types/tiff_spec.hpp"
+
+namespace tiffconcept {
+
+/// LZW decompression as per TIFF spec Section 13
+///
+/// Every string of the LZW table is the concatenation of a previously decoded
+/// string and the first byte of the string decoded right after it, so it is
+/// already present verbatim in the output buffer. The string table therefore
+/// only stores (offset, length) pairs into the output: emitting a code is a
+/// single memcpy and adding an entry is two stores, with no per-code
+/// allocation or prefix-chain walk. The table (24 KiB) is allocated lazily
+/// and reused for every chunk decoded by the owning TileDecoder.
+///
+/// Both bit layouts found in the wild are supported:
+/// - New-style (TIFF 6.0): MSB-first codes, code width grows one code early
+/// - Old-style (pre-6.0 libtiff): LSB-first codes, code width grows on time
+/// The layout is detected per chunk from the leading Clear code, like libtiff.
+class LZWDecompressor {
+private:
+    static constexpr uint32_t clear_code = 256;
+    static constexpr uint32_t eoi_code = 257;
+    static constexpr uint32_t first_free_code = 258;
+    static constexpr uint32_t min_code_bits = 9;
+    static constexpr uint32_t max_code_bits = 12;
+    static constexpr uint32_t table_size = 1u << max_code_bits;
+
+    /// String table entry: location of the string in the output buffer
+    struct Entry {
+        uint32_t offset;
+        uint32_t length;
+    };
+
+    mutable std::unique_ptr<Entry[]> table_;
+
+    /// Ensure the string table is allocated (lazy initialization)
+    [[nodiscard]] Result<Entry*> ensure_table() const noexcept {
+        if (!table_) {
+            table_.reset(new (std::nothrow) Entry[table_size]);
+            if (!table_) [[unlikely]] {
+                return Err(Error::Code::MemoryError,
+                          "Failed to allocate LZW string table");
+            }
+        }
+        return Ok(table_.get());
+    }
+
+    /// Bit reader over the compressed chunk, MSB-first or LSB-first
+    template <bool MSBFirst>
+    class BitReader {
+    private:
+        const uint8_t* data_;
+        const uint8_t* end_;
+        uint64_t buffer_ = 0;
+        uint32_t bits_ = 0;
+
+    public:
+        BitReader(std::span<const std::byte> input) noexcept
+            : data_(reinterpret_cast<const uint8_t*>(input.data()))
+            , end_(reinterpret_cast<const uint8_t*>(input.data()) + input.size()) {}
+
+        /// Read one code of the given width
+        /// @return false if the input is exhausted
+        [[nodiscard]] bool read(uint32_t width, uint32_t& code) noexcept {
+            if (bits_ < width) {
+                if (end_ - data_ >= 8) [[likely]] {
+                    // Refill whole bytes from a single unaligned 8-byte load
+                    uint64_t word;
+                    std::memcpy(&word, data_, sizeof(word));
+                    uint32_t count = (63 - bits_) >> 3;
+                    if constexpr (MSBFirst) {
+                        if constexpr (std::endian::native == std::endian::little) {
+                            word = byteswap(word);
+                        }
+                        buffer_ |= word >> bits_;
+                        // Drop the bits of the partially consumed last byte
+                        bits_ += count * 8;
+                        buffer_ &= ~uint64_t{0} << (64 - bits_);
+                    } else {
+                        if constexpr (std::endian::native == std::endian::big) {
+                            word = byteswap(word);
+                        }
+                        buffer_ |= word << bits_;
+                        bits_ += count * 8;
+                        buffer_ &= (uint64_t{1} << bits_) - 1;
+                    }
+                    data_ += count;
+                    return read_buffered(width, code);
+                }
+                // Tail of the input: refill up to 56 bits one byte at a time
+                while (bits_ <= 56 && data_ != end_) {
+                    if constexpr (MSBFirst) {
+                        buffer_ |= static_cast<uint64_t>(*data_++) << (56 - bits_);
+                    } else {
+                        buffer_ |= static_cast<uint64_t>(*data_++) << bits_;
+                    }
+                    bits_ += 8;
+                }
+                if (bits_ < width) [[unlikely]] {
+                    return false;
+                }
+            }
+            return read_buffered(width, code);
+        }
+
+    private:
+        bool read_buffered(uint32_t width, uint32_t& code) noexcept {
+            if constexpr (MSBFirst) {
+                code = static_cast<uint32_t>(buffer_ >> (64 - width));
+                buffer_ <<= width;
+            } else {
+                code = static_cast<uint32_t>(buffer_ & ((uint64_t{1} << width) - 1));
+                buffer_ >>= width;
+            }
+            bits_ -= width;
+            return true;
+        }
+    };
+
+    /// Decode loop, specialized for each bit layout
+    /// EarlyChange is the offset between the table size and the code
+    /// width switch: 1 for new-style streams, 0 for old-style streams
+    template <bool MSBFirst, uint32_t EarlyChange>
+    [[nodiscard]] Result<std::size_t> decode(
+        std::span<std::byte> output,
+        std::span<const std::byte> input,
+        Entry* table) const noexcept {
+
+        BitReader<MSBFirst> reader(input);
+        std::byte* out = output.data();
+        const std::size_t out_size = output.size();
+
+        std::size_t pos = 0;
+        uint32_t width = min_code_bits;
+        uint32_t next_code = first_free_code;
+        // Previously emitted string (prev_length == 0 right after a Clear code)
+        std::size_t prev_offset = 0;
+        uint32_t prev_length = 0;
+
+        uint32_t code;
+        while (reader.read(width, code)) {
+            if (code == clear_code) {
+                width = min_code_bits;
+                next_code = first_free_code;
+                prev_length = 0;
+                continue;
+            }
+            if (code == eoi_code) {
+                return Ok(pos);
+            }
+
+            std::size_t offset = pos;
+            uint32_t length;
+
+            if (code < clear_code) {
+                // Literal
+                out[pos] = static_cast<std::byte>(code);
+                length = 1;
+            } else if (code < next_code) {
+                // Known string: copy it from its previous occurrence
+                const Entry entry = table[code];
+                length = entry.length;
+                if (length <= 8 && pos + 8 <= out_size) [[likely]] {
+                    // Short string: one 8-byte load/store, the bytes past the
+                    // string are overwritten by the following codes
+                    uint64_t word;
+                    std::memcpy(&word, out + entry.offset, sizeof(word));
+                    std::memcpy(out + pos, &word, sizeof(word));
+                } else if (pos + length > out_size) [[unlikely]] {
+                    std::memcpy(out + pos, out + entry.offset, out_size - pos);
+                    return Ok(out_size);
+                } else {
+                    std::memcpy(out + pos, out + entry.offset, length);
+                }
+            } else if (code == next_code && prev_length != 0) {
+                // KwKwK case: previous string followed by its own first byte
+                length = prev_length + 1;
+                if (pos + length > out_size) [[unlikely]] {
+                    std::size_t available = out_size - pos;
+                    std::memcpy(out + pos, out + prev_offset,
+                                available < prev_length ? available : prev_length);
+                    return Ok(out_size);
+                }
+                std::memcpy(out + pos, out + prev_offset, prev_length);
+                out[pos + prev_length] = out[prev_offset];
+            } else [[unlikely]] {
+                return Err(Error::Code::InvalidFormat,
+                           "LZW: invalid code in compressed stream");
+            }
+
+            // New entry: previous string extended by the first byte of this
+            // one, which is exactly the bytes starting at prev_offset
+            if (prev_length != 0 && next_code < table_size) {
+                table[next_code] = Entry{static_cast<uint32_t>(prev_offset), prev_length + 1};
+                ++next_code;
+                if (next_code + EarlyChange >= (1u << width) && width < max_code_bits) {
+                    ++width;
+                }
+            }
+
+            prev_offset = offset;
+            prev_length = length;
+            pos += length;
+
+            if (pos == out_size) {
+                // Output full: the chunk is complete, trailing codes are ignored
+                return Ok(pos);
+            }
+        }
+
+        return Err(Error::Code::InvalidFormat,
+                   "LZW: unexpected end of input before EOI code");
+    }
+
+public:
+    constexpr LZWDecompressor() noexcept = default;
+
+    ~LZWDecompressor() = default;
+
+    // Non-copyable
+    LZWDecompressor(const LZWDecompressor&) = delete;
+    LZWDecompressor& operator=(const LZWDecompressor&) = delete;
+
+    // Movable
+    LZWDecompressor(LZWDecompressor&&) noexcept = default;
+    LZWDecompressor& operator=(LZWDecompressor&&) noexcept = default;
+
+    /// Decompress LZW encoded data (thread-safe if each thread has its own instance)
+    /// @note Like libtiff, decoding stops once the output buffer is full.
+    ///       If the stream ends early, bytes past the returned size are unspecified.
+    [[nodiscard]] Result<std::size_t> decompress(
+        std::span<std::byte> output,
+        std::span<const std::byte> input) const noexcept {
+
+        if (output.size() > std::numeric_limits<uint32_t>::max()) [[unlikely]] {
+            return Err(Error::Code::UnsupportedFeature,
+                       "LZW chunk larger than 4 GiB");
+        }
+
+        if (output.empty()) {
+            return Ok(std::size_t{0});
+        }
+
+        auto table_result = ensure_table();
+        if (!table_result) {
+            return Err(table_result.error().code, table_result.error().message);
+        }
+        Entry* table = table_result.value();
+
+        // A new-style stream starts with the Clear code written MSB-first
+        // (0x80 ...), an old-style one with the Clear code written LSB-first
+        // (0x00, then bit 0 set)
+        if (input.size() >= 2 && input[0] == std::byte{0} &&
+            (std::to_integer<uint8_t>(input[1]) & 0x1) != 0) {
+            return decode<false, 0>(output, input, table);
+        }
+        return decode<true, 1>(output, input, table);
+    }
+};
+
+/// LZW decompressor descriptor
+using LZWDecompressorDesc = DecompressorDescriptor<
+    LZWDecompressor,
+    CompressionScheme::LZW
+>;
+
+} // namespace tiffconcept
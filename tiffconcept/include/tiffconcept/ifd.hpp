@@ -56,6 +56,19 @@
  * }
  * @endcode
  * 
+ * ## Speculative Reads
+ * 
+ * By default, read_ifd() and read_ifd_into() issue two reads: the entry count, then
+ * the tags and the next offset. On high-latency storage, walking a long IFD chain
+ * this way costs two round trips per page. Passing a speculative_read_size reads
+ * that many bytes at the IFD offset instead, and parses the whole IFD from this
+ * single view; a second read is only issued when the IFD does not fit in it:
+ * 
+ * @code{.cpp}
+ * auto ifd_result = read_ifd<MmapFileReader, TiffFormatType::Classic, std::endian::little>(
+ *     reader, offset, default_speculative_read_size);
+ * @endcode
+ * 
  * @note All functions are noexcept and use Result<T> for error handling
  * @note IFD operations support both Classic TIFF and BigTIFF formats via template parameters
  */
@@ -156,6 +169,14 @@ struct IFD {
     [[nodiscard]] std::vector<std::byte> write() const noexcept;
 };
 
+/**
+ * @brief Default window of speculative IFD reads (see read_ifd_into())
+ * 
+ * Holds the header, up to 340 tags (Classic TIFF) or 204 tags (BigTIFF)
+ * and the next IFD offset.
+ */
+inline constexpr std::size_t default_speculative_read_size = 4096;
+
 /**
  * @brief Get the first IFD offset from a TIFF file header
  * 
@@ -275,6 +296,8 @@ template <RawReader Reader, TiffFormatType TiffFormat = TiffFormatType::Classic,
  * @param reader The file reader to use
  * @param offset File offset where the IFD is located
  * @param[out] ifd IFD structure to populate (will be modified)
+ * @param speculative_read_size Bytes read at once at the IFD offset (0 = read the
+ *        entry count first, then the tags and next offset: two reads)
  * @return Ok() on success, or Error on failure
  * 
  * @throws None (noexcept)
@@ -283,11 +306,18 @@ template <RawReader Reader, TiffFormatType TiffFormat = TiffFormatType::Classic,
  * @retval Error::Code::OutOfBounds IFD offset is beyond the file size
  * 
  * @note This function performs optimized bulk reading of tags and next offset
+ * @note In speculative mode, a single read suffices when the IFD fits in
+ *       speculative_read_size bytes (and in the file); otherwise the tags
+ *       and next offset are read again, in a second read
  * @note The ifd parameter's tag vector will be resized as needed
  * @note All previous contents of ifd will be replaced
  */
 template <RawReader Reader, TiffFormatType TiffFormat = TiffFormatType::Classic, std::endian SourceEndian = std::endian::native>
-[[nodiscard]] Result<void> read_ifd_into(const Reader& reader, IFDOffset offset, IFD<TiffFormat, SourceEndian>& ifd) noexcept;
+[[nodiscard]] Result<void> read_ifd_into(
+    const Reader& reader,
+    IFDOffset offset,
+    IFD<TiffFormat, SourceEndian>& ifd,
+    std::size_t speculative_read_size = 0) noexcept;
 
 /**
  * @brief Read a complete IFD and return a new IFD struct
@@ -304,6 +334,8 @@ template <RawReader Reader, TiffFormatType TiffFormat = TiffFormatType::Classic,
  * 
  * @param reader The file reader to use
  * @param offset File offset where the IFD is located
+ * @param speculative_read_size Bytes read at once at the IFD offset (0 = two reads,
+ *        see read_ifd_into())
  * @return Result containing the complete IFD, or an error
  * 
  * @throws None (noexcept)
@@ -324,7 +356,10 @@ template <RawReader Reader, TiffFormatType TiffFormat = TiffFormatType::Classic,
  * @endcode
  */
 template <RawReader Reader, TiffFormatType TiffFormat = TiffFormatType::Classic, std::endian SourceEndian = std::endian::native>
-[[nodiscard]] Result<IFD<TiffFormat, SourceEndian>> read_ifd(const Reader& reader, IFDOffset offset) noexcept; 
+[[nodiscard]] Result<IFD<TiffFormat, SourceEndian>> read_ifd(
+    const Reader& reader,
+    IFDOffset offset,
+    std::size_t speculative_read_size = 0) noexcept;
 
 } // namespace ifd
 
@@ -1,19 +1,33 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
 #include <concepts>
 #include <condition_variable>
+#include <cstddef>
+#include <cstdint>
 #include <deque>
 #include <functional>
+#include <memory>
 #include <mutex>
+#include <new>
+#include <optional>
 #include <span>
 #include <thread>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
 #include <vector>
+#include "batch_planner.hpp"
 #include "decompressors/decompressor_base.hpp"
 #include "lowlevel/decoder.hpp"
 #include "lowlevel/tiling.hpp"
 #include "image_shape.hpp"
 #include "reader_base.hpp"
+#include "tile_cache.hpp"
 #include "types/result.hpp"
 
 namespace tiffconcept {
@@ -97,6 +111,409 @@ requires (std::is_same_v<PixelType, uint8_t> ||
     std::span<const PixelType> decoded_tile,
     std::span<PixelType> output_buffer) noexcept;
 
+/// @brief Check whether tiles can be decoded straight into the output buffer
+/// @tparam OutSpec Output buffer layout specification (DHWC, DCHW, or CDHW)
+/// @tparam PixelType The pixel data type
+/// @tparam TagSpec Tag specification type (must contain minimum required tags for image extraction)
+/// @param region The image region being read
+/// @param metadata Extracted TIFF tags containing image metadata
+/// @param output_buffer Output buffer for the entire region
+/// @return true if the tile layout matches the output layout, so that the
+///         tiles returned by direct_decode_target() can skip extract_tile_to_buffer
+/// 
+/// @note Requires a valid pixel type and an output buffer matching the region
+/// @note Chunky tiles must carry all the region channels, and the output be
+///       DHWC unless there is a single channel (planar tiles: single channel regions)
+/// @note Meant to be called once per read_region, direct_decode_target once per tile
+template <ImageLayoutSpec OutSpec, typename PixelType, typename TagSpec>
+requires (TiledImageTagSpec<TagSpec> || StrippedImageTagSpec<TagSpec>)
+[[nodiscard]] inline bool can_decode_into_output(
+    const ImageRegion& region,
+    const ExtractedTags<TagSpec>& metadata,
+    std::span<const PixelType> output_buffer) noexcept;
+
+/// @brief Part of the output buffer a tile can be decoded into directly
+/// @tparam PixelType The pixel data type
+/// @param tile The tile being read (from collect_tiles_for_region)
+/// @param region The image region being read
+/// @param output_buffer Output buffer for the entire region
+/// @return The destination of the decoded tile, or an empty span if the tile
+///         must be decoded to a scratch buffer and copied with extract_tile_to_buffer
+/// 
+/// @note Only valid if can_decode_into_output() returned true for this read
+/// @note The tile must lie fully inside the region, with rows as wide as the
+///       region rows (e.g. strips of a full-width region), and slices as tall
+///       as the region for 3D tiles, so that the destination is contiguous
+template <typename PixelType>
+[[nodiscard]] inline std::span<PixelType> direct_decode_target(
+    const Tile& tile,
+    const ImageRegion& region,
+    std::span<PixelType> output_buffer) noexcept;
+
+/// @brief Placement of a decoded tile in the output buffer of a region
+/// @note Computed once per tile by ReadPlan::prepare (see extract_tile_to_buffer)
+struct TileCopy {
+    static constexpr std::size_t not_direct = static_cast<std::size_t>(-1);
+    
+    TileSize src_dims;          ///< Decoded tile dimensions
+    TileSize copy_dims;         ///< Dimensions of the tile/region overlap
+    TileCoordinates src_pos;    ///< Overlap position in the tile
+    TileCoordinates dst_pos;    ///< Overlap position in the region
+    std::size_t direct_offset = not_direct; ///< Output offset if the tile is decoded in place
+};
+
+/// @brief Prepared read of a region: validated shape, decoding parameters,
+///        tiles and their placement in the output buffer
+/// 
+/// Built once per (metadata, region), so that readers do not re-parse and
+/// re-validate the image metadata for every tile. All the readers build one
+/// internally, and also accept a prepared plan to read the same region again.
+/// 
+/// @tparam PixelType The pixel data type (validated against the image)
+/// @tparam OutSpec Output buffer layout specification (DHWC, DCHW, or CDHW)
+/// 
+/// @note The plan does not reference the metadata after prepare()
+/// @note Thread-safe once prepared: all the read accessors are const
+/// 
+/// Example usage:
+/// @code
+/// ReadPlan<uint16_t, ImageLayoutSpec::DHWC> plan;
+/// auto prepare_result = plan.prepare(metadata, region);
+/// if (prepare_result) {
+///     auto read_result = cpu_reader.read_region(file_reader, plan, output_buffer);
+/// }
+/// @endcode
+template <typename PixelType, ImageLayoutSpec OutSpec>
+class ReadPlan {
+public:
+    using pixel_type = PixelType;
+    using output_type = std::span<PixelType>;  ///< Output buffer of the region
+    
+    ReadPlan() = default;
+    
+    /// @brief Validate the metadata and collect the tiles of a region
+    /// @param metadata Extracted TIFF tags containing image and tile/strip information
+    /// @param region The region to read
+    /// @return Result<void> indicating success or error
+    /// @retval InvalidTag Required tags missing
+    /// @retval InvalidFormat Pixel type mismatch
+    /// @retval OutOfBounds Region exceeds image bounds
+    /// @note Reuses the storage of a previous plan
+    template <typename TagSpec>
+    requires (TiledImageTagSpec<TagSpec> || StrippedImageTagSpec<TagSpec>)
+    [[nodiscard]] Result<void> prepare(
+        const ExtractedTags<TagSpec>& metadata,
+        const ImageRegion& region) noexcept;
+    
+    /// @brief Plan the read of some of the tiles of another plan
+    /// @param plan Prepared plan (same region, and so same output buffer)
+    /// @param tile_indices Indices in plan.tiles(), in increasing order
+    /// @return Result<void> indicating success or error
+    /// @retval MemoryError Allocation failed
+    /// @note Reuses the storage of a previous plan
+    [[nodiscard]] Result<void> select_tiles(
+        const ReadPlan& plan,
+        std::span<const std::size_t> tile_indices) noexcept;
+    
+    [[nodiscard]] const ImageShape& shape() const noexcept { return shape_; }
+    [[nodiscard]] const ImageRegion& region() const noexcept { return region_; }
+    [[nodiscard]] CompressionScheme compression() const noexcept { return compression_; }
+    [[nodiscard]] Predictor predictor() const noexcept { return predictor_; }
+    /// @brief Byte order of the image data (that of the metadata, see ExtractedTags::byte_order)
+    [[nodiscard]] std::endian byte_order() const noexcept { return byte_order_; }
+    
+    /// @brief Tiles overlapping the region, in file offset order
+    [[nodiscard]] const std::vector<Tile>& tiles() const noexcept { return tiles_; }
+    
+    /// @brief Placement of tiles()[tile_index] in the output buffer
+    [[nodiscard]] const TileCopy& tile_copy(std::size_t tile_index) const noexcept { return copies_[tile_index]; }
+    
+    /// @brief Whether at least one tile is decoded in place
+    [[nodiscard]] bool has_direct_tiles() const noexcept { return direct_output_; }
+    
+    /// @brief Check that an output buffer matches the region
+    /// @retval OutOfBounds Output buffer size doesn't match region size
+    [[nodiscard]] Result<void> validate_output(std::span<const PixelType> output_buffer) const noexcept;
+    
+    /// @brief Destination of a tile decoded in place (see direct_decode_target)
+    /// @return Empty span if the tile goes through place_tile()
+    [[nodiscard]] std::span<PixelType> direct_target(
+        std::size_t tile_index,
+        std::span<PixelType> output_buffer) const noexcept;
+    
+    /// @brief Copy a decoded tile to the output buffer (with layout conversion)
+    /// @retval OutOfBounds Decoded tile size doesn't match tile dimensions
+    [[nodiscard]] Result<void> place_tile(
+        std::size_t tile_index,
+        std::span<const PixelType> decoded_tile,
+        std::span<PixelType> output_buffer) const noexcept;
+    
+    /// @brief Decode a tile into the output buffer: in place when possible,
+    ///        otherwise through the decoder scratch buffer and place_tile()
+    /// @param decoder Decoder of the calling thread
+    /// @param tile_index Index in tiles()
+    /// @param compressed Compressed tile data
+    /// @param output_buffer Output buffer (checked with validate_output())
+    template <typename DecompSpec>
+    [[nodiscard]] Result<void> decode_tile(
+        TileDecoder<PixelType, DecompSpec>& decoder,
+        std::size_t tile_index,
+        std::span<const std::byte> compressed,
+        std::span<PixelType> output_buffer) const noexcept;
+    
+    /// @brief decode_tile(), also returning the decoded tile (e.g. to cache it)
+    /// @param decoded Receives the whole decoded tile: its destination in the
+    ///        output buffer, or the decoder scratch buffer (valid until the
+    ///        next decode with this decoder)
+    template <typename DecompSpec>
+    [[nodiscard]] Result<void> decode_tile(
+        TileDecoder<PixelType, DecompSpec>& decoder,
+        std::size_t tile_index,
+        std::span<const std::byte> compressed,
+        std::span<PixelType> output_buffer,
+        std::span<const PixelType>& decoded) const noexcept;
+
+private:
+    ImageShape shape_;
+    ImageRegion region_{0, 0, 0, 0, 0, 0, 0, 0};
+    CompressionScheme compression_ = CompressionScheme::None;
+    Predictor predictor_ = Predictor::None;
+    std::endian byte_order_ = std::endian::native;
+    std::vector<Tile> tiles_;
+    std::vector<TileCopy> copies_;
+    bool direct_output_ = false;
+};
+
+/// @brief Prepared read of several regions of the same image, each tile
+///        being read and decoded once whatever the number of regions it overlaps
+/// 
+/// Holds a ReadPlan per region, and the union of their tiles: tiles() lists
+/// every distinct tile once (in file offset order), and decode_tile() decodes
+/// it once and copies it to every region output buffer it overlaps. Readers
+/// accept it in place of a ReadPlan (see read_regions).
+/// 
+/// @tparam PixelType The pixel data type (validated against the image)
+/// @tparam OutSpec Output buffer layout specification (DHWC, DCHW, or CDHW)
+/// 
+/// @note Output buffers are one per region, in the order of the regions, and must not overlap
+/// @note Thread-safe once prepared: all the read accessors are const
+/// 
+/// Example usage:
+/// @code
+/// std::vector<ImageRegion> patches = ...;
+/// std::vector<std::vector<uint8_t>> buffers = ...;       // patches[i].num_samples() each
+/// std::vector<std::span<uint8_t>> outputs(buffers.begin(), buffers.end());
+/// auto result = cpu_reader.read_regions<ImageLayoutSpec::DHWC>(file_reader, metadata, patches, outputs);
+/// @endcode
+template <typename PixelType, ImageLayoutSpec OutSpec>
+class MultiRegionPlan {
+public:
+    using pixel_type = PixelType;
+    using output_type = std::span<const std::span<PixelType>>;  ///< One output buffer per region
+    
+    MultiRegionPlan() = default;
+    
+    /// @brief Validate the metadata and collect the distinct tiles of the regions
+    /// @param metadata Extracted TIFF tags containing image and tile/strip information
+    /// @param regions The regions to read
+    /// @return Result<void> indicating success or error
+    /// @retval InvalidTag Required tags missing
+    /// @retval InvalidFormat Pixel type mismatch
+    /// @retval OutOfBounds A region exceeds image bounds
+    /// @retval MemoryError Allocation failed
+    template <typename TagSpec>
+    requires (TiledImageTagSpec<TagSpec> || StrippedImageTagSpec<TagSpec>)
+    [[nodiscard]] Result<void> prepare(
+        const ExtractedTags<TagSpec>& metadata,
+        std::span<const ImageRegion> regions) noexcept;
+    
+    /// @brief Plan the read of some of the tiles of another plan
+    /// @param plan Prepared plan (same regions, and so same output buffers)
+    /// @param tile_indices Indices in plan.tiles(), in increasing order
+    /// @retval MemoryError Allocation failed
+    /// @note The region plans are shared with plan, not copied
+    [[nodiscard]] Result<void> select_tiles(
+        const MultiRegionPlan& plan,
+        std::span<const std::size_t> tile_indices) noexcept;
+    
+    [[nodiscard]] std::size_t num_regions() const noexcept { return plans_ ? plans_->size() : 0; }
+    
+    /// @brief Plan of one of the regions
+    [[nodiscard]] const ReadPlan<PixelType, OutSpec>& region_plan(std::size_t region_index) const noexcept {
+        return (*plans_)[region_index];
+    }
+    
+    /// @brief Distinct tiles overlapping the regions, in file offset order
+    [[nodiscard]] const std::vector<Tile>& tiles() const noexcept { return tiles_; }
+    
+    /// @brief Number of regions tiles()[tile_index] is copied to
+    [[nodiscard]] std::size_t tile_uses(std::size_t tile_index) const noexcept {
+        return target_begin_[tile_index + 1] - target_begin_[tile_index];
+    }
+    
+    /// @brief Check that there is one output buffer per region, matching it
+    /// @retval OutOfBounds Wrong number of buffers, or buffer size doesn't match its region
+    [[nodiscard]] Result<void> validate_output(output_type output_buffers) const noexcept;
+    
+    /// @brief Copy a decoded tile to every region it overlaps
+    /// @retval OutOfBounds Decoded tile size doesn't match tile dimensions
+    [[nodiscard]] Result<void> place_tile(
+        std::size_t tile_index,
+        std::span<const PixelType> decoded_tile,
+        output_type output_buffers) const noexcept;
+    
+    /// @brief Decode a tile once, into the first region where it can be
+    ///        decoded in place if any, and copy it to the other regions
+    /// @param decoder Decoder of the calling thread
+    /// @param tile_index Index in tiles()
+    /// @param compressed Compressed tile data
+    /// @param output_buffers Output buffers (checked with validate_output())
+    template <typename DecompSpec>
+    [[nodiscard]] Result<void> decode_tile(
+        TileDecoder<PixelType, DecompSpec>& decoder,
+        std::size_t tile_index,
+        std::span<const std::byte> compressed,
+        output_type output_buffers) const noexcept;
+    
+    /// @brief decode_tile(), also returning the decoded tile (e.g. to cache it)
+    template <typename DecompSpec>
+    [[nodiscard]] Result<void> decode_tile(
+        TileDecoder<PixelType, DecompSpec>& decoder,
+        std::size_t tile_index,
+        std::span<const std::byte> compressed,
+        output_type output_buffers,
+        std::span<const PixelType>& decoded) const noexcept;
+
+private:
+    /// @brief A use of a distinct tile: region, and index in the region plan
+    struct Target {
+        std::size_t region_index;
+        std::size_t tile_index;
+    };
+    
+    std::shared_ptr<const std::vector<ReadPlan<PixelType, OutSpec>>> plans_;
+    std::vector<Tile> tiles_;
+    std::vector<std::size_t> target_begin_;  ///< Targets of tiles_[i]: [target_begin_[i], target_begin_[i + 1])
+    std::vector<Target> targets_;            ///< Grouped by tile, decoded-in-place target first
+};
+
+/// @brief Prepared read of the same region of several pages (z-stacks,
+///        time-lapses stored as one page per plane) into a single buffer
+/// 
+/// Holds a ReadPlan per page, and the tiles of all the pages merged in file
+/// offset order, so that readers batch tiles of consecutive pages together
+/// when they are stored next to each other. Page p is decoded into the
+/// output slice [p * page_samples(), (p + 1) * page_samples()), laid out
+/// as OutSpec: the output is [page, D, H, W, C] for DHWC. Readers accept it
+/// in place of a ReadPlan (see read_pages).
+/// 
+/// @tparam PixelType The pixel data type (validated against every page)
+/// @tparam OutSpec Layout of each page in the output buffer (DHWC, DCHW, or CDHW)
+/// 
+/// @note Pages may differ in size, tiling and compression; the region must fit in all of them
+/// @note Thread-safe once prepared: all the read accessors are const
+/// 
+/// Example usage:
+/// @code
+/// std::vector<ExtractedTags<MyTagSpec>> pages = ...;  // One per plane
+/// std::vector<uint16_t> stack(pages.size() * region.num_samples());
+/// auto result = fast_reader.read_pages<ImageLayoutSpec::DHWC>(
+///     file_reader, std::span<const ExtractedTags<MyTagSpec>>(pages), region, std::span<uint16_t>(stack));
+/// @endcode
+template <typename PixelType, ImageLayoutSpec OutSpec>
+class PageStackPlan {
+public:
+    using pixel_type = PixelType;
+    using output_type = std::span<PixelType>;  ///< Output buffer of all the pages
+    
+    PageStackPlan() = default;
+    
+    /// @brief Validate the metadata of every page and collect their tiles
+    /// @param pages Extracted TIFF tags of the pages, in output order
+    /// @param region The region to read in every page
+    /// @return Result<void> indicating success or error
+    /// @retval InvalidTag Required tags missing
+    /// @retval InvalidFormat Pixel type mismatch
+    /// @retval OutOfBounds Region exceeds the bounds of a page
+    /// @retval MemoryError Allocation failed
+    template <typename TagSpec>
+    requires (TiledImageTagSpec<TagSpec> || StrippedImageTagSpec<TagSpec>)
+    [[nodiscard]] Result<void> prepare(
+        std::span<const ExtractedTags<TagSpec>> pages,
+        const ImageRegion& region) noexcept;
+    
+    /// @brief Plan the read of some of the tiles of another plan
+    /// @param plan Prepared plan (same pages and region)
+    /// @param tile_indices Indices in plan.tiles(), in increasing order
+    /// @retval MemoryError Allocation failed
+    /// @note The page plans are shared with plan, not copied
+    [[nodiscard]] Result<void> select_tiles(
+        const PageStackPlan& plan,
+        std::span<const std::size_t> tile_indices) noexcept;
+    
+    [[nodiscard]] std::size_t num_pages() const noexcept { return plans_ ? plans_->size() : 0; }
+    
+    /// @brief Plan of one of the pages
+    [[nodiscard]] const ReadPlan<PixelType, OutSpec>& page_plan(std::size_t page_index) const noexcept {
+        return (*plans_)[page_index];
+    }
+    
+    /// @brief Samples of the region of one page (stride of the pages in the output)
+    [[nodiscard]] std::size_t page_samples() const noexcept { return page_samples_; }
+    
+    /// @brief Tiles of all the pages, in file offset order
+    [[nodiscard]] const std::vector<Tile>& tiles() const noexcept { return tiles_; }
+    
+    /// @brief Page of tiles()[tile_index]
+    [[nodiscard]] std::size_t tile_page(std::size_t tile_index) const noexcept { return targets_[tile_index].page_index; }
+    
+    /// @brief Check that an output buffer holds the region of every page
+    /// @retval OutOfBounds Output buffer size doesn't match num_pages() * page_samples()
+    [[nodiscard]] Result<void> validate_output(std::span<const PixelType> output_buffer) const noexcept;
+    
+    /// @brief Copy a decoded tile to the slice of its page
+    /// @retval OutOfBounds Decoded tile size doesn't match tile dimensions
+    [[nodiscard]] Result<void> place_tile(
+        std::size_t tile_index,
+        std::span<const PixelType> decoded_tile,
+        std::span<PixelType> output_buffer) const noexcept;
+    
+    /// @brief Decode a tile into the slice of its page (see ReadPlan::decode_tile)
+    template <typename DecompSpec>
+    [[nodiscard]] Result<void> decode_tile(
+        TileDecoder<PixelType, DecompSpec>& decoder,
+        std::size_t tile_index,
+        std::span<const std::byte> compressed,
+        std::span<PixelType> output_buffer) const noexcept;
+    
+    /// @brief decode_tile(), also returning the decoded tile
+    template <typename DecompSpec>
+    [[nodiscard]] Result<void> decode_tile(
+        TileDecoder<PixelType, DecompSpec>& decoder,
+        std::size_t tile_index,
+        std::span<const std::byte> compressed,
+        std::span<PixelType> output_buffer,
+        std::span<const PixelType>& decoded) const noexcept;
+
+private:
+    /// @brief Source of a tile: page, and index in the page plan
+    struct Target {
+        std::size_t page_index;
+        std::size_t tile_index;
+    };
+    
+    [[nodiscard]] std::span<PixelType> page_output(
+        std::size_t page_index,
+        std::span<PixelType> output_buffer) const noexcept {
+        return output_buffer.subspan(page_index * page_samples_, page_samples_);
+    }
+    
+    std::shared_ptr<const std::vector<ReadPlan<PixelType, OutSpec>>> plans_;
+    std::size_t page_samples_ = 0;
+    std::vector<Tile> tiles_;
+    std::vector<Target> targets_;  ///< One per tile
+};
+
 // ============================================================================
 // Sample Readers
 // ============================================================================
@@ -110,7 +527,7 @@ requires (std::is_same_v<PixelType, uint8_t> ||
 ///
 /// @tparam PixelType The pixel data type
 /// @tparam DecompSpec Decompressor specification type
-/// @note Not Thread-safe: internal state (tiles_, decoder_) is reused
+/// @note Not Thread-safe: internal state (plans_, decoder_) is reused
 template <typename PixelType, typename DecompSpec>
 class SimpleReader {
 public:
@@ -125,63 +542,266 @@ public:
         const ImageRegion& region,
         std::span<PixelType> output_buffer) noexcept {
 
-        // 1. Identify which tiles are needed
-        tiles_.clear();
-        auto collect_res = collect_tiles_for_region(region, metadata, tiles_);
-        if (!collect_res) return collect_res;
+        // 1. Identify which tiles are needed, and how to decode them
+        auto& plan = std::get<ReadPlan<PixelType, OutSpec>>(plans_);
+        auto prepare_res = plan.prepare(metadata, region);
+        if (!prepare_res) return prepare_res;
 
-        // 2. Get compression and predictor from tags
-        CompressionScheme compression = optional::extract_tag_or<TagCode::Compression, TagSpec>(
-            metadata, CompressionScheme::None
-        );
-        
-        Predictor predictor = Predictor::None;
-        if constexpr (TagSpec::template has_tag<TagCode::Predictor>()) {
-            predictor = optional::extract_tag_or<TagCode::Predictor, TagSpec>(
-                metadata, Predictor::None
-            );
-        }
+        return read_region(reader, plan, output_buffer);
+    }
+
+    /// @brief Read a prepared region into the output buffer
+    template <typename Reader, ImageLayoutSpec OutSpec>
+    requires RawReader<Reader>
+    [[nodiscard]] Result<void> read_region(
+        const Reader& reader,
+        const ReadPlan<PixelType, OutSpec>& plan,
+        std::span<PixelType> output_buffer) noexcept {
+
+        return read_tiles(reader, plan, output_buffer);
+    }
 
-        // 3. Process each tile sequentially
-        for (const auto& tile : tiles_) {
+    /// @brief Read several regions, each tile once (see MultiRegionPlan)
+    template <ImageLayoutSpec OutSpec, typename Reader, typename TagSpec>
+    requires RawReader<Reader> && (TiledImageTagSpec<TagSpec> || StrippedImageTagSpec<TagSpec>)
+    [[nodiscard]] Result<void> read_regions(
+        const Reader& reader,
+        const ExtractedTags<TagSpec>& metadata,
+        std::span<const ImageRegion> regions,
+        std::span<const std::span<PixelType>> output_buffers) noexcept {
+
+        MultiRegionPlan<PixelType, OutSpec> plan;
+        auto prepare_res = plan.prepare(metadata, regions);
+        if (!prepare_res) return prepare_res;
+
+        return read_tiles(reader, plan, output_buffers);
+    }
+
+    /// @brief Read prepared regions into their output buffers
+    template <typename Reader, ImageLayoutSpec OutSpec>
+    requires RawReader<Reader>
+    [[nodiscard]] Result<void> read_regions(
+        const Reader& reader,
+        const MultiRegionPlan<PixelType, OutSpec>& plan,
+        std::span<const std::span<PixelType>> output_buffers) noexcept {
+        return read_tiles(reader, plan, output_buffers);
+    }
+
+    /// @brief Read the same region of several pages (see PageStackPlan)
+    template <ImageLayoutSpec OutSpec, typename Reader, typename TagSpec>
+    requires RawReader<Reader> && (TiledImageTagSpec<TagSpec> || StrippedImageTagSpec<TagSpec>)
+    [[nodiscard]] Result<void> read_pages(
+        const Reader& reader,
+        std::span<const ExtractedTags<TagSpec>> pages,
+        const ImageRegion& region,
+        std::span<PixelType> output_buffer) noexcept {
+
+        PageStackPlan<PixelType, OutSpec> plan;
+        auto prepare_res = plan.prepare(pages, region);
+        if (!prepare_res) return prepare_res;
+
+        return read_tiles(reader, plan, output_buffer);
+    }
+
+    /// @brief Read a prepared page stack into the output buffer
+    template <typename Reader, ImageLayoutSpec OutSpec>
+    requires RawReader<Reader>
+    [[nodiscard]] Result<void> read_pages(
+        const Reader& reader,
+        const PageStackPlan<PixelType, OutSpec>& plan,
+        std::span<PixelType> output_buffer) noexcept {
+        return read_tiles(reader, plan, output_buffer);
+    }
+
+private:
+    TileDecoder<PixelType, DecompSpec> decoder_; // Reused decoder (holds scratch buffer)
+    std::tuple<ReadPlan<PixelType, ImageLayoutSpec::DHWC>,
+               ReadPlan<PixelType, ImageLayoutSpec::DCHW>,
+               ReadPlan<PixelType, ImageLayoutSpec::CDHW>> plans_; // Reused plans of read_region, per output layout
+
+    template <typename Reader, typename Plan>
+    [[nodiscard]] Result<void> read_tiles(
+        const Reader& reader,
+        const Plan& plan,
+        typename Plan::output_type output_buffer) noexcept {
+
+        auto output_res = plan.validate_output(output_buffer);
+        if (!output_res) return output_res;
+
+        // 2. Process each tile sequentially
+        const auto& tiles = plan.tiles();
+        for (std::size_t i = 0; i < tiles.size(); ++i) {
             // Read compressed data
-            auto read_res = reader.read(tile.location.offset, tile.location.length);
+            auto read_res = reader.read(tiles[i].location.offset, tiles[i].location.length);
             if (!read_res) return read_res.error();
             auto compressed_view = std::move(read_res.value());
 
-            // Decode
+            // Decode and extract to output buffer
             // Note: TileDecoder handles decompression and predictor steps
-            auto decode_res = decoder_.decode(
-                compressed_view.data(),
-                tile.id.size.width,
-                tile.id.size.height * tile.id.size.depth, // Treat depth as height extension for decoding
-                compression,
-                predictor,
-                tile.id.size.nsamples
-            );
+            auto decode_res = plan.decode_tile(decoder_, i, compressed_view.data(), output_buffer);
             if (!decode_res) return decode_res.error();
-
-            // Extract to output buffer
-            auto extract_res = extract_tile_to_buffer<OutSpec, PixelType>(
-                tile, region, metadata, decode_res.value(), output_buffer
-            );
-            if (!extract_res) return extract_res.error();
         }
 
         return Ok();
     }
+};
+
+namespace detail {
+    /// @brief Prepared read the readers can execute (ReadPlan or MultiRegionPlan)
+    template <typename Plan, typename PixelType>
+    concept TileReadPlan = std::same_as<typename Plan::pixel_type, PixelType> &&
+        requires(const Plan& plan, typename Plan::output_type output) {
+            { plan.tiles() } -> std::same_as<const std::vector<Tile>&>;
+            { plan.validate_output(output) } -> std::same_as<Result<void>>;
+        };
+    
+    /// @brief Alignment of in-place reads of a reader (1 unless AlignedIoReader)
+    template <typename Reader>
+    [[nodiscard]] std::size_t io_alignment(const Reader& reader) noexcept {
+        if constexpr (AlignedIoReader<Reader>) {
+            return std::max<std::size_t>(reader.io_alignment(), 1);
+        } else {
+            return 1;
+        }
+    }
+    
+    /// @brief Tile cache of a read_region call (disabled if cache is null)
+    template <typename PixelType>
+    struct TileCacheRef {
+        DecodedTileCache<PixelType>* cache = nullptr;
+        TileCacheScope scope{};
+        
+        explicit operator bool() const noexcept { return cache != nullptr; }
+        
+        /// @brief Cache a tile decoded by ReadPlan::decode_tile (no-op if disabled)
+        void insert(const Tile& tile, std::span<const PixelType> decoded) const noexcept {
+            if (cache) {
+                cache->insert(TileCacheKey::of(scope, tile), decoded);
+            }
+        }
+    };
+    
+    /// @brief Copy the cached tiles of a plan to the output buffer
+    /// @param pending Receives the plan of the tiles that are not cached
+    /// @return Result<void> indicating success or error
+    template <typename PixelType, TileReadPlan<PixelType> Plan>
+    [[nodiscard]] Result<void> place_cached_tiles(
+        const TileCacheRef<PixelType>& cache,
+        const Plan& plan,
+        typename Plan::output_type output_buffer,
+        Plan& pending) noexcept;
+} // namespace detail
+
+/// @brief Counters of a BatchBufferArena (snapshot, see BatchBufferArena::stats)
+struct BufferArenaStats {
+    uint64_t hits = 0;         ///< Buffers served from the free lists
+    uint64_t misses = 0;       ///< Buffers allocated because their size class had none free
+    uint64_t dropped = 0;      ///< Released buffers freed because the cap was reached
+    size_t cached_bytes = 0;   ///< Bytes held by free buffers
+};
+
+/// @brief Size-classed pool of batch read buffers, owned by a reader
+///
+/// Requested sizes are rounded up to one of four classes per power of two
+/// (at most 25% slack), each with its own free list and lock, so concurrent
+/// read_region calls rarely contend. Released buffers go back to their free
+/// list as long as the free buffers total at most max_cached_bytes, and are
+/// freed otherwise.
+///
+/// Buffers are aligned on 4096 bytes: direct I/O readers with a coarser
+/// alignment read batches through their bounce buffers.
+///
+/// @note Thread-safe. The arena must outlive the buffers it hands out.
+class BatchBufferArena {
+public:
+    static constexpr std::size_t alignment = 4096;
+
+    /// @brief Buffer lent by the arena, returned to it on destruction
+    class Buffer {
+    public:
+        Buffer() noexcept = default;
+        Buffer(Buffer&& other) noexcept;
+        Buffer& operator=(Buffer&& other) noexcept;
+        Buffer(const Buffer&) = delete;
+        Buffer& operator=(const Buffer&) = delete;
+        ~Buffer() { reset(); }
+
+        [[nodiscard]] std::byte* data() const noexcept { return data_; }
+        [[nodiscard]] std::size_t capacity() const noexcept { return data_ ? class_size(size_class_) : 0; }
+        explicit operator bool() const noexcept { return data_ != nullptr; }
+
+        /// @brief Return the buffer to the arena (no-op if empty)
+        void reset() noexcept;
+
+    private:
+        friend class BatchBufferArena;
+        Buffer(BatchBufferArena* arena, std::byte* data, unsigned size_class) noexcept
+            : arena_(arena), data_(data), size_class_(size_class) {}
+
+        BatchBufferArena* arena_ = nullptr;
+        std::byte* data_ = nullptr;
+        unsigned size_class_ = 0;
+    };
+
+    /// @param max_cached_bytes Cap on the bytes of free buffers kept for reuse (0 = no reuse)
+    explicit BatchBufferArena(std::size_t max_cached_bytes) noexcept
+        : max_cached_bytes_(max_cached_bytes) {}
+    ~BatchBufferArena();
+
+    BatchBufferArena(const BatchBufferArena&) = delete;
+    BatchBufferArena& operator=(const BatchBufferArena&) = delete;
+
+    /// @brief Buffer of at least size bytes
+    /// @return Empty buffer if out of memory
+    [[nodiscard]] Buffer acquire(std::size_t size) noexcept;
+
+    /// @brief Free every cached buffer (buffers in use are not affected)
+    void release_cached() noexcept;
+
+    [[nodiscard]] BufferArenaStats stats() const noexcept;
+    [[nodiscard]] std::size_t max_cached_bytes() const noexcept { return max_cached_bytes_; }
+
+    /// @brief Capacity of the buffers handed out for size bytes
+    [[nodiscard]] static std::size_t rounded_size(std::size_t size) noexcept { return class_size(class_of(size)); }
 
 private:
-    std::vector<Tile> tiles_; // Reused vector for tile list
-    TileDecoder<PixelType, DecompSpec> decoder_; // Reused decoder (holds scratch buffer)
+    static constexpr unsigned min_class_log2 = 12;  // Class 0: up to 4 KiB
+    static constexpr unsigned max_class_log2 = 48;  // Larger requests fail
+    static constexpr unsigned num_classes = 1 + (max_class_log2 - min_class_log2) * 4;
+
+    struct SizeClass {
+        std::mutex mutex;
+        std::vector<std::byte*> free;
+    };
+
+    [[nodiscard]] static unsigned class_of(std::size_t size) noexcept;
+    [[nodiscard]] static std::size_t class_size(unsigned size_class) noexcept;
+    void recycle(std::byte* data, unsigned size_class) noexcept;
+
+    std::size_t max_cached_bytes_;
+    std::array<SizeClass, num_classes> classes_;
+    std::atomic<std::size_t> cached_bytes_{0};
+    std::atomic<uint64_t> hits_{0};
+    std::atomic<uint64_t> misses_{0};
+    std::atomic<uint64_t> dropped_{0};
 };
 
 /// @brief Reader optimized for high-latency I/O (e.g., network shares, cloud storage).
 ///
 /// Strategies:
 /// - Batching: Groups small adjacent reads into larger requests to reduce round-trips.
+///   With direct I/O readers (AlignedIoReader), batches cover whole aligned blocks
+///   and are read in place into aligned buffers. With an AdaptiveBatchPlanner
+///   (Config::batch_planner), gaps are bridged according to the measured latency
+///   and bandwidth of the reads instead of max_gap_size.
 /// - Parallel I/O: Uses a pool of I/O threads to fetch data in parallel.
+/// - Buffer Reuse: Batch buffers come from a BatchBufferArena owned by the reader,
+///   so repeated reads do not allocate (see Config::max_cached_buffer_bytes).
 /// - Serial Processing: Decoding and extraction happen on the calling thread.
+/// - Multiple Regions: read_regions batches the distinct tiles of all the regions
+///   together, and decodes each of them once (see MultiRegionPlan).
+/// - Page Stacks: read_pages batches the tiles of the same region of several pages
+///   together (see PageStackPlan).
 ///
 /// Thread-safety:
 /// - read_region is thread-safe and can be called concurrently.
@@ -195,11 +815,26 @@ public:
         size_t io_threads = 0; // Number of parallel read threads, 0 = auto-detect
         size_t max_batch_size = 4 * 1024 * 1024; // Max bytes per read request
         size_t max_gap_size = 64 * 1024; // Max gap to bridge between chunks
+        size_t max_cached_buffer_bytes = 64 * 1024 * 1024; // Free batch buffers kept for reuse (0 = none)
+        std::shared_ptr<AdaptiveBatchPlanner> batch_planner{}; // Cost-model batching, replaces max_gap_size (optional, may be shared)
     };
 
     explicit IOLimitedReader(Config config = {});
     ~IOLimitedReader();
 
+    /// @brief Counters of the batch buffer arena shared by all read_region calls
+    [[nodiscard]] BufferArenaStats buffer_stats() const noexcept { return buffers_.stats(); }
+
+    /// @brief Requests and read amplification of all read_region calls
+    [[nodiscard]] BatchIoStats io_stats() const noexcept;
+
+    /// @brief Batches read_region would read for a prepared region (for inspection)
+    template <typename Reader, detail::TileReadPlan<PixelType> Plan>
+    requires RawReader<Reader>
+    [[nodiscard]] BatchPlan plan_batches(
+        const Reader& reader,
+        const Plan& plan) const;
+
     template <ImageLayoutSpec OutSpec, typename Reader, typename TagSpec>
     requires RawReader<Reader> && (TiledImageTagSpec<TagSpec> || StrippedImageTagSpec<TagSpec>)
     [[nodiscard]] Result<void> read_region(
@@ -208,18 +843,62 @@ public:
         const ImageRegion& region,
         std::span<PixelType> output_buffer) noexcept;
 
+    /// @brief Read a prepared region (see ReadPlan)
+    template <typename Reader, ImageLayoutSpec OutSpec>
+    requires RawReader<Reader>
+    [[nodiscard]] Result<void> read_region(
+        const Reader& reader,
+        const ReadPlan<PixelType, OutSpec>& plan,
+        std::span<PixelType> output_buffer) noexcept;
+
+    /// @brief Read several regions, batching and decoding their distinct tiles once
+    /// @param output_buffers One buffer per region (regions[i].num_samples() each)
+    template <ImageLayoutSpec OutSpec, typename Reader, typename TagSpec>
+    requires RawReader<Reader> && (TiledImageTagSpec<TagSpec> || StrippedImageTagSpec<TagSpec>)
+    [[nodiscard]] Result<void> read_regions(
+        const Reader& reader,
+        const ExtractedTags<TagSpec>& metadata,
+        std::span<const ImageRegion> regions,
+        std::span<const std::span<PixelType>> output_buffers) noexcept;
+
+    /// @brief Read prepared regions (see MultiRegionPlan)
+    template <typename Reader, ImageLayoutSpec OutSpec>
+    requires RawReader<Reader>
+    [[nodiscard]] Result<void> read_regions(
+        const Reader& reader,
+        const MultiRegionPlan<PixelType, OutSpec>& plan,
+        std::span<const std::span<PixelType>> output_buffers) noexcept;
+
+    /// @brief Read the same region of several pages, batching the tiles of all the pages together
+    /// @param pages Extracted TIFF tags of the pages, in output order
+    /// @param output_buffer Output buffer of pages.size() * region.num_samples() samples (see PageStackPlan)
+    template <ImageLayoutSpec OutSpec, typename Reader, typename TagSpec>
+    requires RawReader<Reader> && (TiledImageTagSpec<TagSpec> || StrippedImageTagSpec<TagSpec>)
+    [[nodiscard]] Result<void> read_pages(
+        const Reader& reader,
+        std::span<const ExtractedTags<TagSpec>> pages,
+        const ImageRegion& region,
+        std::span<PixelType> output_buffer) noexcept;
+
+    /// @brief Read a prepared page stack (see PageStackPlan)
+    template <typename Reader, ImageLayoutSpec OutSpec>
+    requires RawReader<Reader>
+    [[nodiscard]] Result<void> read_pages(
+        const Reader& reader,
+        const PageStackPlan<PixelType, OutSpec>& plan,
+        std::span<PixelType> output_buffer) noexcept;
+
 private:
-    struct Batch {
-        size_t first_tile_index;
-        size_t tile_count;
-        size_t file_offset;
-        size_t total_size;
-    };
+    using Batch = IoBatch;
 
     // Task submitted to the shared worker pool
     using IOTask = std::function<void()>;
 
     Config config_;
+    BatchBufferArena buffers_; // Batch buffers, recycled once decoded (outlives the threads)
+    std::atomic<uint64_t> requests_{0};
+    std::atomic<uint64_t> bytes_read_{0};
+    std::atomic<uint64_t> bytes_needed_{0};
     
     // Shared thread pool state
     std::vector<std::thread> threads_;
@@ -240,12 +919,13 @@ private:
     void release_decoder(std::unique_ptr<TileDecoder<PixelType, DecompSpec>> decoder);
 
     void worker_loop();
-    
-    // Helper to create batches (stateless)
-    static void create_batches(
-        const std::vector<Tile>& tiles, 
-        const Config& config, 
-        std::vector<Batch>& out_batches);
+
+    /// @brief Read and decode every tile of a plan (I/O threads read, calling thread decodes)
+    template <typename Reader, detail::TileReadPlan<PixelType> Plan>
+    [[nodiscard]] Result<void> read_tiles(
+        const Reader& reader,
+        const Plan& plan,
+        typename Plan::output_type output_buffer) noexcept;
 };
 
 
@@ -260,6 +940,12 @@ private:
 /// - Dynamic Work Queue: Tiles are processed as workers become available.
 /// - Independent Workers: Each thread handles Read, Decode, and Extract for assigned tiles.
 /// - Per-Job Coordination: Each read_region() call has its own synchronization state.
+/// - Tile Cache: With a DecodedTileCache (Config::tile_cache) and the image identity
+///   (cache_scope), cached tiles are copied and only the others are read and decoded.
+/// - Multiple Regions: read_regions decodes each tile shared by several regions once
+///   (see MultiRegionPlan), e.g. for random training patches.
+/// - Page Stacks: read_pages distributes the tiles of several pages over the workers
+///   (see PageStackPlan), e.g. for z-stacks stored as one page per plane.
 ///
 /// Thread-safety:
 /// - read_region is thread-safe and can be called concurrently from multiple threads.
@@ -279,17 +965,71 @@ class CPULimitedReader {
 public:
     struct Config {
         size_t worker_threads = 0; // 0 = auto-detect
+        std::shared_ptr<DecodedTileCache<PixelType>> tile_cache{}; // Decoded tiles (optional, may be shared)
     };
 
     explicit CPULimitedReader(Config config = {});
     ~CPULimitedReader();
 
+    /// @param cache_scope Image identity: with a Config::tile_cache, cached
+    ///        tiles are not read again, and decoded tiles are cached
     template <ImageLayoutSpec OutSpec, typename Reader, typename TagSpec>
     requires RawReader<Reader> && (TiledImageTagSpec<TagSpec> || StrippedImageTagSpec<TagSpec>)
     [[nodiscard]] Result<void> read_region(
         const Reader& reader,
         const ExtractedTags<TagSpec>& metadata,
         const ImageRegion& region,
+        std::span<PixelType> output_buffer,
+        std::optional<TileCacheScope> cache_scope = std::nullopt) noexcept;
+
+    /// @brief Read a prepared region (see ReadPlan)
+    template <typename Reader, ImageLayoutSpec OutSpec>
+    requires RawReader<Reader>
+    [[nodiscard]] Result<void> read_region(
+        const Reader& reader,
+        const ReadPlan<PixelType, OutSpec>& plan,
+        std::span<PixelType> output_buffer,
+        std::optional<TileCacheScope> cache_scope = std::nullopt) noexcept;
+
+    /// @brief Read several regions, decoding their distinct tiles once
+    /// @param output_buffers One buffer per region (regions[i].num_samples() each)
+    /// @param cache_scope Image identity (see read_region)
+    template <ImageLayoutSpec OutSpec, typename Reader, typename TagSpec>
+    requires RawReader<Reader> && (TiledImageTagSpec<TagSpec> || StrippedImageTagSpec<TagSpec>)
+    [[nodiscard]] Result<void> read_regions(
+        const Reader& reader,
+        const ExtractedTags<TagSpec>& metadata,
+        std::span<const ImageRegion> regions,
+        std::span<const std::span<PixelType>> output_buffers,
+        std::optional<TileCacheScope> cache_scope = std::nullopt) noexcept;
+
+    /// @brief Read prepared regions (see MultiRegionPlan)
+    template <typename Reader, ImageLayoutSpec OutSpec>
+    requires RawReader<Reader>
+    [[nodiscard]] Result<void> read_regions(
+        const Reader& reader,
+        const MultiRegionPlan<PixelType, OutSpec>& plan,
+        std::span<const std::span<PixelType>> output_buffers,
+        std::optional<TileCacheScope> cache_scope = std::nullopt) noexcept;
+
+    /// @brief Read the same region of several pages, decoding the tiles of all the pages in parallel
+    /// @param pages Extracted TIFF tags of the pages, in output order
+    /// @param output_buffer Output buffer of pages.size() * region.num_samples() samples (see PageStackPlan)
+    /// @note The tile cache is not used (its scope is a single page)
+    template <ImageLayoutSpec OutSpec, typename Reader, typename TagSpec>
+    requires RawReader<Reader> && (TiledImageTagSpec<TagSpec> || StrippedImageTagSpec<TagSpec>)
+    [[nodiscard]] Result<void> read_pages(
+        const Reader& reader,
+        std::span<const ExtractedTags<TagSpec>> pages,
+        const ImageRegion& region,
+        std::span<PixelType> output_buffer) noexcept;
+
+    /// @brief Read a prepared page stack (see PageStackPlan)
+    template <typename Reader, ImageLayoutSpec OutSpec>
+    requires RawReader<Reader>
+    [[nodiscard]] Result<void> read_pages(
+        const Reader& reader,
+        const PageStackPlan<PixelType, OutSpec>& plan,
         std::span<PixelType> output_buffer) noexcept;
 
 private:
@@ -329,19 +1069,67 @@ private:
         Result<void> first_error = Ok();        // First error encountered (if any)
     };
 
-    template <ImageLayoutSpec OutSpec, typename Reader, typename TagSpec>
-    requires RawReader<Reader> && (TiledImageTagSpec<TagSpec> || StrippedImageTagSpec<TagSpec>)
+    /// @brief Copy the cached tiles of a plan, then read and decode the others
+    template <typename Reader, detail::TileReadPlan<PixelType> Plan>
+    [[nodiscard]] Result<void> read_plan(
+        const Reader& reader,
+        const Plan& plan,
+        typename Plan::output_type output_buffer,
+        std::optional<TileCacheScope> cache_scope) noexcept;
+
+    /// @brief Read and decode every tile of a plan (caching them if cache is enabled)
+    template <typename Reader, detail::TileReadPlan<PixelType> Plan>
+    requires RawReader<Reader>
+    [[nodiscard]] Result<void> read_tiles(
+        const Reader& reader,
+        const Plan& plan,
+        typename Plan::output_type output_buffer,
+        detail::TileCacheRef<PixelType> cache) noexcept;
+
+    template <typename Reader, detail::TileReadPlan<PixelType> Plan>
+    requires RawReader<Reader>
     static void process_tile_task(
         const Reader& reader,
-        const ExtractedTags<TagSpec>& metadata,
-        const ImageRegion& region,
-        std::span<PixelType> output_buffer,
-        const std::vector<Tile>& tiles,
+        const Plan& plan,
+        typename Plan::output_type output_buffer,
         size_t num_tiles_per_thread,
         size_t task_idx,
+        detail::TileCacheRef<PixelType> cache,
         std::shared_ptr<JobState> job_state) noexcept;
 };
 
+namespace detail {
+    /// @brief Async reader whose operation handles carry a numeric id,
+    ///        used to route completions back to the request that issued them
+    template <typename Reader>
+    concept IdentifiableAsyncReader = requires(const typename Reader::AsyncOperationHandle& handle) {
+        { handle.id } -> std::convertible_to<uint64_t>;
+    };
+    
+    /// @brief Async reader lending buffers registered with the kernel
+    ///        (e.g. IoUringFileReader with Config::use_registered_io)
+    /// 
+    /// acquire_buffer(size) returns a lease that is empty when no buffer is
+    /// available, and returns the buffer to the pool on destruction.
+    template <typename Reader>
+    concept PooledBufferAsyncReader = requires(const Reader& reader, std::size_t size) {
+        { reader.registered_buffer_size() } -> std::convertible_to<std::size_t>;
+        { reader.acquire_buffer(size).data() } -> std::convertible_to<std::span<std::byte>>;
+        { static_cast<bool>(reader.acquire_buffer(size)) };
+    };
+    
+    /// @brief Buffer lease type of an async reader (empty placeholder if it has no pool)
+    template <typename Reader>
+    struct AsyncBufferLease {
+        struct type {};
+    };
+    
+    template <PooledBufferAsyncReader Reader>
+    struct AsyncBufferLease<Reader> {
+        using type = decltype(std::declval<const Reader&>().acquire_buffer(std::size_t{}));
+    };
+} // namespace detail
+
 /// @brief Optimal reader combining async I/O with parallel processing
 ///
 /// This is the "ultimate" TIFF reader designed for maximum performance across
@@ -351,15 +1139,17 @@ private:
 /// - Async I/O: Submit all reads upfront using AsyncRawReader interface
 /// - Batching: Group adjacent tiles to minimize network round-trips
 /// - Parallel Processing: All threads (including caller) process completions concurrently
-/// - Non-blocking Workers: Workers poll for completions without blocking on I/O
+/// - Leader/Follower Reaping: One thread per job drains the completion queue while
+///   the others decode batches that are already available
 /// - Thread-Local Decoders: Each thread has its own decoder for cache locality
 ///
 /// Architecture:
 /// 1. Main thread collects tiles and creates batches (groups adjacent tiles)
 /// 2. Main thread submits ALL async reads upfront (maximizes queue depth)
-/// 3. Main thread + workers compete to poll completions and process them
-/// 4. Each completion: decode (decompress + predictor) + extract to output
-/// 5. Main thread waits until all tiles processed
+/// 3. Main thread + workers take turns reaping completions and routing them to
+///    the job that submitted them (completions are matched by handle id)
+/// 4. Each completed batch: decode (decompress + predictor) + extract to output
+/// 5. Main thread waits until all batches are processed or failed
 ///
 /// Thread Safety:
 /// - read_region is thread-safe and can be called concurrently from multiple threads
@@ -373,6 +1163,17 @@ private:
 /// - NAS/Network: Batching reduces round-trips, parallel I/O + decode
 /// - Cloud: Aggressive batching, massive parallelism
 /// - Memory: O(batch_buffer_size + decoder_scratch × threads)
+/// - Readers with registered buffers (PooledBufferAsyncReader) lend them to the
+///   batches, which are then capped at the registered buffer size; other batch
+///   buffers come from a BatchBufferArena owned by the FastReader
+/// - With a DecodedTileCache (Config::tile_cache), cached tiles are copied to the
+///   output before the batches are built, so only the others are read
+/// - read_regions reads several regions as one job: their distinct tiles are
+///   batched together and decoded once (see MultiRegionPlan)
+/// - read_pages reads the same region of several pages as one job, into a
+///   [page, ...] buffer (see PageStackPlan)
+/// - With direct I/O readers (AlignedIoReader), batches cover whole aligned
+///   blocks and are read in place into aligned buffers
 /// - CPU: Near 100% utilization when decompression is bottleneck
 /// - I/O: Maximum bandwidth utilization with sufficient batching
 ///
@@ -380,10 +1181,16 @@ private:
 /// - worker_threads: Processing threads (0 = auto-detect, typically # cores - 1)
 /// - max_batch_size: Maximum batch read size (4MB default, increase for high-latency)
 /// - max_gap_size: Maximum gap to bridge between tiles (64KB default)
+/// - batch_planner: AdaptiveBatchPlanner fed with the measured read times,
+///   which chooses the gaps to bridge instead of max_gap_size (optional)
+/// - max_cached_buffer_bytes: Free batch buffers kept for reuse (64MB default)
 ///
-/// @note Requires AsyncRawReader (io_uring on Linux, IOCP on Windows)
-/// @note Main thread participates in processing (no idle time)
-/// @note Workers never block on I/O (only poll completions)
+/// @note Requires AsyncRawReader (io_uring on Linux, IOCP on Windows) whose
+///       AsyncOperationHandle exposes a numeric `id`
+/// @note Main thread participates in processing of its own request
+/// @note Idle workers sleep on a condition variable and are woken when reads complete
+/// @note Completions of a reader are consumed by FastReader while a read_region
+///       call on it is in flight; do not mix with other async users of the same reader
 /// @note Thread-safe: multiple threads can call read_region concurrently
 ///
 /// Example:
@@ -406,11 +1213,27 @@ public:
         size_t worker_threads = 0;           ///< Processing threads (0 = auto, typically cores - 1)
         size_t max_batch_size = 4 * 1024 * 1024;  ///< Max bytes per batch (increase for network)
         size_t max_gap_size = 64 * 1024;     ///< Max gap to bridge between tiles
+        size_t max_cached_buffer_bytes = 64 * 1024 * 1024;  ///< Free batch buffers kept for reuse (0 = none)
+        std::shared_ptr<DecodedTileCache<PixelType>> tile_cache{};  ///< Decoded tiles (optional, may be shared)
+        std::shared_ptr<AdaptiveBatchPlanner> batch_planner{};  ///< Cost-model batching, replaces max_gap_size (optional, may be shared)
     };
 
     explicit FastReader(Config config = {});
     ~FastReader();
 
+    /// @brief Counters of the batch buffer arena shared by all read_region calls
+    [[nodiscard]] BufferArenaStats buffer_stats() const noexcept { return buffers_.stats(); }
+
+    /// @brief Requests and read amplification of all read_region calls
+    [[nodiscard]] BatchIoStats io_stats() const noexcept;
+
+    /// @brief Batches read_region would read for a prepared region (for inspection)
+    template <typename Reader, detail::TileReadPlan<PixelType> Plan>
+    requires AsyncRawReader<Reader>
+    [[nodiscard]] BatchPlan plan_batches(
+        const Reader& reader,
+        const Plan& plan) const;
+
     /// @brief Read a region using async I/O and parallel processing
     ///
     /// This method submits all reads upfront via async_read_into(), then
@@ -424,101 +1247,216 @@ public:
     /// @param metadata Extracted TIFF tags
     /// @param region Region to read
     /// @param output_buffer Output buffer (must be region.num_samples() size)
+    /// @param cache_scope Image identity: with a Config::tile_cache, cached
+    ///        tiles are copied without I/O, and decoded tiles are cached
     ///
     /// @return Ok on success, error otherwise
     ///
     /// Thread-safety: Safe to call concurrently from multiple threads
     template <ImageLayoutSpec OutSpec, typename Reader, typename TagSpec>
-    requires AsyncRawReader<Reader> && (TiledImageTagSpec<TagSpec> || StrippedImageTagSpec<TagSpec>)
+    requires AsyncRawReader<Reader> && detail::IdentifiableAsyncReader<Reader> &&
+             (TiledImageTagSpec<TagSpec> || StrippedImageTagSpec<TagSpec>)
+    [[nodiscard]] Result<void> read_region(
+        const Reader& reader,
+        const ExtractedTags<TagSpec>& metadata,
+        const ImageRegion& region,
+        std::span<PixelType> output_buffer,
+        std::optional<TileCacheScope> cache_scope = std::nullopt) noexcept;
+
+    /// @brief Read a prepared region (see ReadPlan)
+    template <typename Reader, ImageLayoutSpec OutSpec>
+    requires AsyncRawReader<Reader> && detail::IdentifiableAsyncReader<Reader>
     [[nodiscard]] Result<void> read_region(
+        const Reader& reader,
+        const ReadPlan<PixelType, OutSpec>& plan,
+        std::span<PixelType> output_buffer,
+        std::optional<TileCacheScope> cache_scope = std::nullopt) noexcept;
+
+    /// @brief Read several regions, batching and decoding their distinct tiles once
+    ///
+    /// Tiles shared by regions (e.g. overlapping patches) are read and decoded
+    /// once, then copied to every region; all the tiles are batched together.
+    ///
+    /// @param output_buffers One buffer per region (regions[i].num_samples() each)
+    /// @param cache_scope Image identity (see read_region)
+    template <ImageLayoutSpec OutSpec, typename Reader, typename TagSpec>
+    requires AsyncRawReader<Reader> && detail::IdentifiableAsyncReader<Reader> &&
+             (TiledImageTagSpec<TagSpec> || StrippedImageTagSpec<TagSpec>)
+    [[nodiscard]] Result<void> read_regions(
         const Reader& reader,
         const ExtractedTags<TagSpec>& metadata,
+        std::span<const ImageRegion> regions,
+        std::span<const std::span<PixelType>> output_buffers,
+        std::optional<TileCacheScope> cache_scope = std::nullopt) noexcept;
+
+    /// @brief Read prepared regions (see MultiRegionPlan)
+    template <typename Reader, ImageLayoutSpec OutSpec>
+    requires AsyncRawReader<Reader> && detail::IdentifiableAsyncReader<Reader>
+    [[nodiscard]] Result<void> read_regions(
+        const Reader& reader,
+        const MultiRegionPlan<PixelType, OutSpec>& plan,
+        std::span<const std::span<PixelType>> output_buffers,
+        std::optional<TileCacheScope> cache_scope = std::nullopt) noexcept;
+
+    /// @brief Read the same region of several pages as one job
+    ///
+    /// The tiles of all the pages are batched together (in file order, so
+    /// that consecutive pages stored next to each other share batches) and
+    /// decoded in parallel, page p into slice p of the output buffer.
+    ///
+    /// @param pages Extracted TIFF tags of the pages, in output order
+    /// @param output_buffer Output buffer of pages.size() * region.num_samples() samples (see PageStackPlan)
+    /// @note The tile cache is not used (its scope is a single page)
+    template <ImageLayoutSpec OutSpec, typename Reader, typename TagSpec>
+    requires AsyncRawReader<Reader> && detail::IdentifiableAsyncReader<Reader> &&
+             (TiledImageTagSpec<TagSpec> || StrippedImageTagSpec<TagSpec>)
+    [[nodiscard]] Result<void> read_pages(
+        const Reader& reader,
+        std::span<const ExtractedTags<TagSpec>> pages,
         const ImageRegion& region,
         std::span<PixelType> output_buffer) noexcept;
 
+    /// @brief Read a prepared page stack (see PageStackPlan)
+    template <typename Reader, ImageLayoutSpec OutSpec>
+    requires AsyncRawReader<Reader> && detail::IdentifiableAsyncReader<Reader>
+    [[nodiscard]] Result<void> read_pages(
+        const Reader& reader,
+        const PageStackPlan<PixelType, OutSpec>& plan,
+        std::span<PixelType> output_buffer) noexcept;
+
 private:
     /// @brief Batch of adjacent tiles for efficient I/O
-    struct Batch {
-        size_t first_tile_index;  ///< Index of first tile in batch
-        size_t tile_count;        ///< Number of tiles in batch
-        size_t file_offset;       ///< Starting file offset
-        size_t total_size;        ///< Total bytes to read (including gaps)
-    };
+    using Batch = IoBatch;
 
     /// @brief Context for a single async read operation
     struct ReadContext {
         size_t batch_index;                       ///< Which batch this belongs to
-        std::unique_ptr<std::byte[]> buffer;      ///< Allocated buffer for compressed data
-        size_t buffer_size;                       ///< Size of allocated buffer
+        BatchBufferArena::Buffer buffer;          ///< Arena buffer, if no registered buffer was lent
+        std::span<std::byte> data;                ///< Destination of the batch read (compressed data)
     };
 
-    Config config_;
-    
-    // Worker thread pool (persistent)
-    std::vector<std::thread> workers_;
-    std::atomic<bool> stop_workers_{false};
-
-    void worker_loop();
+    /// @brief Completion reaped from an async reader, reduced to what routing needs
+    struct Completion {
+        uint64_t id;           ///< AsyncOperationHandle::id of the finished read
+        Result<void> status;   ///< I/O outcome (data lives in the batch buffer)
+    };
 
     /// @brief Per-job state shared between all processing threads
     ///
     /// Synchronization:
-    /// - Atomic counters for lock-free fast path
-    /// - Mutex only for error tracking
-    /// - Main thread + workers all access this concurrently
+    /// - All scheduling fields are protected by FastReader::work_mutex_
+    /// - error_occurred is also readable without the lock (fast path)
+    /// - Batch decoding itself runs outside the lock
     struct JobState {
-        // Tracking
-        std::atomic<size_t> tiles_completed{0};   ///< Tiles processed so far
-        std::atomic<size_t> tiles_total{0};       ///< Total tiles to process
+        // Scheduling (protected by work_mutex_)
+        std::deque<size_t> ready_batches;   ///< Batches whose read completed, waiting for decode
+        size_t batches_in_flight{0};        ///< Submitted reads not yet reaped
+        size_t batches_remaining{0};        ///< Batches not yet decoded or failed
+        bool reaping{false};                ///< A thread is currently draining the reader for this job
+        const void* reader_key{nullptr};    ///< Identity of the reader the reads were submitted to
+
+        // Error handling (first_error protected by work_mutex_)
         std::atomic<bool> error_occurred{false};  ///< Fast-path error check
-        
-        // Error handling (protected by mutex)
-        std::mutex error_mutex;
         Result<void> first_error = Ok();
-        
-        // Synchronization for main thread
-        std::mutex completion_mutex;
-        std::condition_variable completion_cv;
+
+        // Cost-model feedback (with Config::batch_planner, protected by work_mutex_)
+        struct ReadTiming {
+            std::chrono::steady_clock::time_point submitted;
+            size_t size;
+        };
+        AdaptiveBatchPlanner* planner{nullptr};
+        std::vector<ReadTiming> read_timings;  ///< Per batch
+
+        /// Decode and extract every tile of a batch (type-erased, called without lock)
+        std::function<Result<void>(size_t)> process_batch;
+        /// Submit pending reads and wait briefly for completions (type-erased, called without lock)
+        std::function<void(std::vector<Completion>&)> reap;
+    };
+
+    /// @brief Key identifying an in-flight read across all readers in use
+    struct RouteKey {
+        const void* reader;
+        uint64_t id;
+        bool operator==(const RouteKey&) const noexcept = default;
     };
 
-    /// @brief Create batches from tiles (static helper)
-    static void create_batches(
-        const std::vector<Tile>& tiles, 
-        const Config& config, 
-        std::vector<Batch>& out_batches);
+    struct RouteKeyHash {
+        size_t operator()(const RouteKey& key) const noexcept {
+            return std::hash<const void*>{}(key.reader) ^ (std::hash<uint64_t>{}(key.id) * 0x9E3779B97F4A7C15ull);
+        }
+    };
 
-    /// @brief Process completions from async reader (worker function)
+    /// @brief Owner of an in-flight read
+    struct Route {
+        std::shared_ptr<JobState> job;
+        size_t batch_index;
+    };
+
+    Config config_;
+    BatchBufferArena buffers_;  ///< Batch buffers, recycled once decoded (outlives the jobs)
+    std::atomic<uint64_t> requests_{0};
+    std::atomic<uint64_t> bytes_read_{0};
+    std::atomic<uint64_t> bytes_needed_{0};
+    
+    // Worker thread pool (persistent)
+    std::vector<std::thread> workers_;
+
+    // Scheduling state shared by all jobs and workers
+    std::mutex work_mutex_;
+    std::condition_variable work_cv_;
+    bool stop_workers_ = false;
+    std::vector<std::shared_ptr<JobState>> active_jobs_;
+    std::unordered_map<RouteKey, Route, RouteKeyHash> routes_;
+
+    void worker_loop();
+
+    /// @brief Perform one unit of work (decode a ready batch or reap completions)
     ///
-    /// This function is called by both main thread and worker threads.
-    /// It polls for completions and processes them (decode + extract).
+    /// Called with work_mutex_ held; the lock is released while the work runs.
     ///
-    /// @param reader Async reader to poll completions from
-    /// @param job_state Shared job state
-    /// @param tiles Tile metadata
-    /// @param batches Batch information
-    /// @param contexts Read contexts (buffer ownership)
-    /// @param metadata TIFF metadata
-    /// @param region Image region
-    /// @param output_buffer Output buffer
-    /// @param compression Compression scheme
-    /// @param predictor Predictor scheme
-    /// @param is_main_thread True if this is the main thread (different behavior)
+    /// @param lock Held lock on work_mutex_
+    /// @param only_job If non-null, restrict work to this job (calling thread)
+    /// @return true if work was performed, false if nothing was available
+    bool run_one(std::unique_lock<std::mutex>& lock, JobState* only_job) noexcept;
+
+    /// @brief Hand reaped completions to the jobs owning them (work_mutex_ held)
     ///
-    /// @return Number of tiles processed
-    template <ImageLayoutSpec OutSpec, typename Reader, typename TagSpec>
-    requires AsyncRawReader<Reader> && (TiledImageTagSpec<TagSpec> || StrippedImageTagSpec<TagSpec>)
-    static size_t process_completions(
+    /// Completions of a shared reader may belong to any concurrent job; ids that
+    /// are not registered (not issued by this FastReader) are ignored.
+    void route_completions(const void* reader_key, std::vector<Completion>& completions) noexcept;
+
+    /// @brief Account for a finished or failed batch (work_mutex_ held)
+    void finish_batch(const std::shared_ptr<JobState>& job, Result<void> status) noexcept;
+
+    /// @brief Copy the cached tiles of a plan, then read and decode the others
+    template <typename Reader, detail::TileReadPlan<PixelType> Plan>
+    [[nodiscard]] Result<void> read_plan(
         const Reader& reader,
-        std::shared_ptr<JobState> job_state,
-        const std::vector<Tile>& tiles,
-        const std::vector<Batch>& batches,
-        std::vector<ReadContext>& contexts,
-        const ExtractedTags<TagSpec>& metadata,
-        const ImageRegion& region,
-        std::span<PixelType> output_buffer,
-        CompressionScheme compression,
-        Predictor predictor,
-        bool is_main_thread) noexcept;
+        const Plan& plan,
+        typename Plan::output_type output_buffer,
+        std::optional<TileCacheScope> cache_scope) noexcept;
+
+    /// @brief Read and decode every tile of a plan (caching them if cache is enabled)
+    template <typename Reader, detail::TileReadPlan<PixelType> Plan>
+    [[nodiscard]] Result<void> read_tiles(
+        const Reader& reader,
+        const Plan& plan,
+        typename Plan::output_type output_buffer,
+        detail::TileCacheRef<PixelType> cache) noexcept;
+
+    /// @brief Decode all tiles of a completed batch and extract them to the output
+    ///
+    /// Called by main thread and worker threads alike, each using its own
+    /// thread-local decoder.
+    ///
+    /// @return Ok if every tile of the batch was decoded and extracted
+    template <detail::TileReadPlan<PixelType> Plan>
+    static Result<void> process_batch(
+        const Batch& batch,
+        std::span<const std::byte> batch_data,
+        const Plan& plan,
+        typename Plan::output_type output_buffer,
+        const detail::TileCacheRef<PixelType>& cache) noexcept;
 };
 
 } // namespace tiffconcept
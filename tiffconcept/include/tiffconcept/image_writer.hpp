@@ -1,6 +1,7 @@
 #pragma once
 
 #include <algorithm>
+#include <memory>
 #include <span>
 #include <vector>
 #include "image_shape.hpp"
@@ -86,6 +87,12 @@ struct ChunkLayout {
 /// @note Uses configurable write strategies for flexible layout control
 /// @note Handles tile extraction, encoding, and writing
 /// @note Supports both tiled and stripped image layouts
+/// @note Chunks are written as soon as they are encoded (no whole-image staging)
+/// @note Parallel encoding: when Config::encoder_threads > 1 and the tile ordering
+///       strategy declares supports_parallel_encoding, chunks are encoded by a pool
+///       of workers (one ChunkEncoder each) while the calling thread writes them in
+///       the order chosen by the strategy. The output is byte-identical to the
+///       sequential path.
 /// @note NOT thread-safe - use separate instances per thread
 template <
     typename PixelType,
@@ -104,8 +111,20 @@ public:
     using BufferingStrat = typename WriteConfig::buffering_strategy;
     using OffsetResolution = typename WriteConfig::offset_resolution_strategy;
 
-    /// @brief Default constructor
+    /// @brief Encoding configuration
+    /// @note Parallel encoding is opt-in: the default encodes on the calling thread
+    /// @note If the workers cannot be set up, write_image() encodes on the calling thread
+    struct Config {
+        std::size_t encoder_threads = 1;       ///< Encoding workers (1 = encode on calling thread, 0 = one per hardware thread)
+        std::size_t max_chunks_in_flight = 0;  ///< Encoded chunks held before writing (0 = 4 × encoder_threads)
+    };
+
+    /// @brief Default constructor (sequential encoding)
     ImageWriter() = default;
+
+    /// @brief Construct with an encoding configuration
+    /// @param config Encoding configuration
+    explicit ImageWriter(Config config) noexcept;
     
     /// @brief Write complete image to file
     /// @tparam InputSpec Layout of input_data buffer (DHWC, DCHW, or CDHW)
@@ -130,6 +149,7 @@ public:
     /// @retval CompressionError Encoding failed
     /// @note Returns offset and size information for creating IFD tags
     /// @note Applies tile ordering strategy before writing
+    /// @note Encodes in parallel if enabled by Config and TileOrdering::supports_parallel_encoding
     /// @note Edge tiles are padded using replicate strategy
     /// @note Current limitation: tiles must be full size (no partial last tiles)
     template <ImageLayoutSpec InputSpec, typename Writer>
@@ -182,15 +202,100 @@ public:
         CompressionScheme compression,
         Predictor predictor,
         std::size_t data_start_offset) noexcept;
-    
+
+    /// @brief Encode a single chunk already in tile layout and write it at a given offset
+    /// @tparam Writer Writer type implementing RawWriter concept
+    /// @param writer The output writer
+    /// @param buffering_strategy Buffering strategy instance (flushed by the caller)
+    /// @param chunk_data Chunk pixels (tile_size.depth × height × width × nsamples, no padding needed)
+    /// @param chunk_index Linear index of the chunk in the image
+    /// @param tile_size Chunk dimensions (nsamples = 1 for planar chunks)
+    /// @param plane Plane index for planar configuration (0 for chunky)
+    /// @param compression Compression scheme to use
+    /// @param predictor Predictor to apply before compression
+    /// @param file_offset File offset where the encoded chunk is written
+    /// @return Result<std::size_t> containing the encoded (compressed) size in bytes
+    /// @retval Success Chunk encoded and written
+    /// @retval OutOfBounds chunk_data smaller than tile_size
+    /// @retval WriteError Failed to write chunk data
+    /// @retval CompressionError Encoding failed
+    /// @note Used for incremental writing where chunks are produced one at a time
+    template <typename Writer>
+        requires RawWriter<Writer>
+    [[nodiscard]] Result<std::size_t> write_chunk(
+        Writer& writer,
+        BufferingStrat& buffering_strategy,
+        std::span<const PixelType> chunk_data,
+        uint32_t chunk_index,
+        TileSize tile_size,
+        uint16_t plane,
+        CompressionScheme compression,
+        Predictor predictor,
+        std::size_t file_offset) noexcept;
+
     /// @brief Clear encoder state for memory management
-    /// @note Releases scratch buffers used by the encoder
+    /// @note Releases scratch buffers used by the encoders
     void clear() noexcept;
 
 private:
-    ChunkEncoder<PixelType, CompSpec> encoder_;
+    using EncoderType = ChunkEncoder<PixelType, CompSpec>;
+
+    /// @brief Geometry and settings shared by all chunks of one write_image call
+    struct EncodeParams {
+        std::span<const PixelType> input_data;
+        TileSize tile_size;       ///< Full tile dimensions (effective samples)
+        TileSize image_size;      ///< Image dimensions (all samples)
+        PlanarConfiguration planar_config;
+        CompressionScheme compression;
+        Predictor predictor;
+    };
+
+    Config config_;
+    EncoderType encoder_;
+    std::vector<std::unique_ptr<EncoderType>> worker_encoders_;  ///< One per encoding worker, reused across calls
     TileOrdering ordering_strategy_;
     OffsetResolution offset_strategy_;
+
+    /// @brief Extract one chunk from the input and encode it
+    /// @param encoder Encoder to use (owned by the calling thread)
+    /// @param tile_buffer Scratch buffer for the extracted tile (owned by the calling thread)
+    template <ImageLayoutSpec InputSpec>
+    [[nodiscard]] static Result<EncodedChunk> encode_chunk(
+        EncoderType& encoder,
+        std::vector<PixelType>& tile_buffer,
+        const ChunkWriteInfo& chunk_info,
+        const EncodeParams& params) noexcept;
+
+    /// @brief Write one encoded chunk at the end of the data written so far
+    /// @note Records its offset and byte count in info and advances current_offset
+    template <typename Writer>
+    [[nodiscard]] static Result<void> write_encoded_chunk(
+        Writer& writer,
+        BufferingStrat& buffering_strategy,
+        const EncodedChunk& encoded_chunk,
+        std::size_t& current_offset,
+        WrittenImageInfo& info) noexcept;
+
+    /// @brief Encode chunks on the calling thread, writing each as soon as it is ready
+    template <ImageLayoutSpec InputSpec, typename Writer>
+    [[nodiscard]] Result<void> encode_and_write_sequential(
+        Writer& writer,
+        BufferingStrat& buffering_strategy,
+        std::span<const ChunkWriteInfo> chunks,
+        const EncodeParams& params,
+        std::size_t& current_offset,
+        WrittenImageInfo& info) noexcept;
+
+    /// @brief Encode chunks on a worker pool, writing them in order on the calling thread
+    template <ImageLayoutSpec InputSpec, typename Writer>
+    [[nodiscard]] Result<void> encode_and_write_parallel(
+        Writer& writer,
+        BufferingStrat& buffering_strategy,
+        std::span<const ChunkWriteInfo> chunks,
+        const EncodeParams& params,
+        std::size_t num_threads,
+        std::size_t& current_offset,
+        WrittenImageInfo& info) noexcept;
 };
 
 } // namespace tiffconcept
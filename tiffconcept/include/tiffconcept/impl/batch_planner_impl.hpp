@@ -0,0 +1,161 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <span>
+
+#ifndef TIFFCONCEPT_BATCH_PLANNER_HEADER
+#include "../batch_planner.hpp" // for linters
+#endif
+
+namespace tiffconcept {
+
+inline BatchPlan make_batch_plan(
+    std::span<const Tile> tiles,
+    size_t alignment,
+    size_t max_batch_size,
+    size_t max_gap_size) {
+    // Group adjacent tiles into batches to minimize I/O round-trips
+    //
+    // Algorithm:
+    // - Start with the first tile
+    // - For each subsequent tile, check if it's close enough to merge:
+    //   * Gap between tiles ≤ max_gap_size (avoid reading too much unused data)
+    //   * Total batch size ≤ max_batch_size (avoid excessive memory usage)
+    // - If not mergeable, finalize current batch and start a new one
+    //
+    // Precondition: tiles are sorted by file offset (collect_tiles_for_region)
+    // Postcondition: batches cover all tiles exactly once, in order
+
+    BatchPlan plan;
+    if (tiles.empty()) {
+        return plan;
+    }
+
+    auto block_begin = [alignment](size_t offset) { return offset & ~(alignment - 1); };
+    auto block_end = [alignment](size_t end) { return (end + alignment - 1) & ~(alignment - 1); };
+
+    size_t start_idx = 0;
+    size_t current_offset = block_begin(tiles[0].location.offset);
+    size_t current_end = block_end(tiles[0].location.offset + tiles[0].location.length);
+    plan.bytes_needed = tiles[0].location.length;
+
+    for (size_t i = 1; i < tiles.size(); ++i) {
+        const auto& tile = tiles[i];
+        plan.bytes_needed += tile.location.length;
+
+        // Calculate gap between end of current batch and start of this tile
+        // (none if the tile starts in the last block of the batch)
+        size_t tile_begin = block_begin(tile.location.offset);
+        size_t gap = tile_begin > current_end ? tile_begin - current_end : 0;
+        size_t new_end = std::max(current_end, block_end(tile.location.offset + tile.location.length));
+        size_t new_size = new_end - current_offset;
+
+        // Break batch if gap is too large or total size exceeds limit
+        bool break_batch = (gap > max_gap_size) || (new_size > max_batch_size);
+
+        if (break_batch) {
+            // Finalize current batch
+            plan.batches.push_back({start_idx, i - start_idx, current_offset, current_end - current_offset});
+            plan.bytes_read += current_end - current_offset;
+
+            // Start new batch with current tile
+            start_idx = i;
+            current_offset = tile_begin;
+            current_end = block_end(tile.location.offset + tile.location.length);
+        } else {
+            // Extend current batch to include this tile
+            // (new_end uses max() to handle potential overlaps)
+            current_end = new_end;
+        }
+    }
+
+    // Finalize last batch
+    plan.batches.push_back({start_idx, tiles.size() - start_idx, current_offset, current_end - current_offset});
+    plan.bytes_read += current_end - current_offset;
+    return plan;
+}
+
+// ============================================================================
+// AdaptiveBatchPlanner Implementation
+// ============================================================================
+
+inline AdaptiveBatchPlanner::AdaptiveBatchPlanner()
+    : AdaptiveBatchPlanner(Config{}) {}
+
+inline AdaptiveBatchPlanner::AdaptiveBatchPlanner(Config config)
+    : config_(config),
+      latency_(std::chrono::duration<double>(config.initial_latency).count()),
+      seconds_per_byte_(1.0 / std::max(config.initial_bandwidth, 1.0)) {
+    config_.smoothing = std::clamp(config_.smoothing, 1e-6, 1.0);
+    config_.concurrency = std::max<size_t>(config_.concurrency, 1);
+}
+
+inline void AdaptiveBatchPlanner::record(size_t bytes, std::chrono::nanoseconds elapsed) noexcept {
+    const double x = static_cast<double>(bytes);
+    const double y = std::chrono::duration<double>(elapsed).count();
+    if (!(y >= 0.0)) {
+        return;
+    }
+
+    std::lock_guard lock(mutex_);
+    const double a = samples_ == 0 ? 1.0 : config_.smoothing;
+    mean_x_ += a * (x - mean_x_);
+    mean_y_ += a * (y - mean_y_);
+    mean_xx_ += a * (x * x - mean_xx_);
+    mean_xy_ += a * (x * y - mean_xy_);
+    ++samples_;
+
+    // Refit the line when the sizes vary enough to tell latency from transfer
+    // time, otherwise keep the slope and only move the intercept
+    const double variance = mean_xx_ - mean_x_ * mean_x_;
+    if (variance > 1e-4 * mean_x_ * mean_x_ && variance > 0.0) {
+        const double slope = (mean_xy_ - mean_x_ * mean_y_) / variance;
+        if (slope > 0.0) {
+            seconds_per_byte_ = slope;
+        }
+    }
+    latency_ = mean_y_ - seconds_per_byte_ * mean_x_;
+    if (latency_ < 0.0) {
+        // Reads are faster than the slope predicts: all transfer, no latency
+        latency_ = 0.0;
+        if (mean_x_ > 0.0) {
+            seconds_per_byte_ = mean_y_ / mean_x_;
+        }
+    }
+    // Bounded to 1 PB/s, so that break_even_gap() stays finite
+    seconds_per_byte_ = std::max(seconds_per_byte_, 1e-15);
+}
+
+inline IoCostEstimate AdaptiveBatchPlanner::estimate() const noexcept {
+    std::lock_guard lock(mutex_);
+    return IoCostEstimate{latency_, 1.0 / seconds_per_byte_, samples_};
+}
+
+inline size_t AdaptiveBatchPlanner::break_even_gap(const IoCostEstimate& estimate, size_t concurrency) noexcept {
+    const double gap = estimate.latency_seconds * estimate.bandwidth_bytes_per_second / static_cast<double>(concurrency);
+    if (!(gap < static_cast<double>(std::numeric_limits<size_t>::max() / 2))) {
+        return std::numeric_limits<size_t>::max() / 2;
+    }
+    return static_cast<size_t>(gap);
+}
+
+inline size_t AdaptiveBatchPlanner::break_even_gap() const noexcept {
+    return break_even_gap(estimate(), config_.concurrency);
+}
+
+inline BatchPlan AdaptiveBatchPlanner::plan(std::span<const Tile> tiles, size_t alignment, size_t max_batch_size) const {
+    // Costs add up over gaps: bridging each gap iff it is cheaper than a
+    // request is optimal, so the static algorithm applies with that threshold
+    const IoCostEstimate cost = estimate();
+    BatchPlan plan = make_batch_plan(tiles, alignment, max_batch_size, break_even_gap(cost, config_.concurrency));
+    plan.expected_seconds = static_cast<double>(plan.batches.size()) * cost.latency_seconds / static_cast<double>(config_.concurrency)
+        + static_cast<double>(plan.bytes_read) / cost.bandwidth_bytes_per_second;
+    return plan;
+}
+
+} // namespace tiffconcept
@@ -3,6 +3,7 @@
 // This file contains the implementation of IFD operations.
 // Do not include this file directly - it is included by ifd.hpp
 
+#include <algorithm>
 #include <cassert>
 #include <cstring>
 #include <span>
@@ -299,27 +300,88 @@ Result<IFDOffset> read_ifd_tags(
     return read_next_ifd_offset<Reader, TiffFormat, SourceEndian>(reader, ifd_desc);
 }
 
+namespace detail {
+
+/// Parse the tags and next offset of an IFD whose description is set
+/// (data starts right after the IFD header, and must be large enough)
+template <TiffFormatType TiffFormat, std::endian SourceEndian>
+void parse_ifd_body(std::span<const std::byte> data, IFD<TiffFormat, SourceEndian>& ifd) noexcept {
+    using TagType = typename IFDDescription<TiffFormat>::template TagType<SourceEndian>;
+    using OffsetType = typename IFDDescription<TiffFormat>::OffsetType;
+    
+    const std::size_t num_entries = ifd.description.num_entries;
+    assert(data.size() >= num_entries * sizeof(TagType) + sizeof(OffsetType));
+    
+    // Parse tags
+    ifd.tags.resize(num_entries);
+    if (num_entries > 0) {
+        std::memcpy(ifd.tags.data(), data.data(), num_entries * sizeof(TagType));
+    }
+    
+    // Parse next offset
+    OffsetType next_offset;
+    std::memcpy(&next_offset, data.data() + num_entries * sizeof(TagType), sizeof(OffsetType));
+    
+    if constexpr (SourceEndian != std::endian::native) {
+        convert_endianness<OffsetType, SourceEndian, std::endian::native>(next_offset);
+    }
+    
+    ifd.next_ifd_offset = IFDOffset(static_cast<std::size_t>(next_offset));
+}
+
+} // namespace detail
+
 template <RawReader Reader, TiffFormatType TiffFormat, std::endian SourceEndian>
 Result<void> read_ifd_into(
     const Reader& reader,
     IFDOffset offset,
-    IFD<TiffFormat, SourceEndian>& ifd) noexcept 
+    IFD<TiffFormat, SourceEndian>& ifd,
+    std::size_t speculative_read_size) noexcept 
 {
     using IFDHeaderType = typename IFDDescription<TiffFormat>::template HeaderType<SourceEndian>;
     using TagType = typename IFDDescription<TiffFormat>::template TagType<SourceEndian>;
     using OffsetType = typename IFDDescription<TiffFormat>::OffsetType;
     
-    // First, read just the header to know how many entries
-    auto header_result = parsing::detail::read_struct_no_endianness_conversion<Reader, IFDHeaderType>(reader, offset.value);
-    if (header_result.is_error()) [[unlikely]] {
-        return header_result.error();
+    std::size_t num_entries;
+    if (speculative_read_size > 0) {
+        // Read a whole window at the IFD offset: it usually holds the header,
+        // the tags and the next offset, which saves a round trip
+        const std::size_t window_size = std::max(
+            speculative_read_size, IFD<TiffFormat, SourceEndian>::size_in_bytes(0));
+        auto window_result = reader.read(offset.value, window_size);
+        if (window_result.is_error()) [[unlikely]] {
+            return Err(window_result.error().code, "Failed to read IFD: " + window_result.error().message);
+        }
+        
+        // The window is shorter than requested at the end of the file
+        const auto window = window_result.value().data();
+        if (window.size() < sizeof(IFDHeaderType)) [[unlikely]] {
+            return Err(Error::Code::UnexpectedEndOfFile, "Incomplete IFD header read");
+        }
+        
+        IFDHeaderType ifd_header;
+        std::memcpy(&ifd_header, window.data(), sizeof(IFDHeaderType));
+        num_entries = static_cast<std::size_t>(ifd_header.template get_num_entries<std::endian::native>());
+        ifd.description = IFDDescription<TiffFormat>(offset, num_entries);
+        
+        const auto body = window.subspan(sizeof(IFDHeaderType));
+        if (body.size() >= num_entries * sizeof(TagType) + sizeof(OffsetType)) {
+            detail::parse_ifd_body(body, ifd);
+            return Ok();
+        }
+        // The IFD does not fit in the window: read it in full below
+    } else {
+        // First, read just the header to know how many entries
+        auto header_result = parsing::detail::read_struct_no_endianness_conversion<Reader, IFDHeaderType>(reader, offset.value);
+        if (header_result.is_error()) [[unlikely]] {
+            return header_result.error();
+        }
+        
+        const auto& ifd_header = header_result.value();
+        num_entries = static_cast<std::size_t>(ifd_header.template get_num_entries<std::endian::native>());
+        ifd.description = IFDDescription<TiffFormat>(offset, num_entries);
     }
     
-    const auto& ifd_header = header_result.value();
-    std::size_t num_entries = static_cast<std::size_t>(ifd_header.template get_num_entries<std::endian::native>());
-    
-    ifd.description = IFDDescription<TiffFormat>(offset, num_entries);
-    
     if (num_entries == 0) {
         ifd.tags.clear();
         
@@ -347,29 +409,18 @@ Result<void> read_ifd_into(
         return Err(Error::Code::UnexpectedEndOfFile, "Incomplete IFD read");
     }
     
-    // Parse tags
-    ifd.tags.resize(num_entries);
-    std::memcpy(ifd.tags.data(), view.data().data(), num_entries * sizeof(TagType));
-    
-    // Parse next offset
-    OffsetType next_offset;
-    std::memcpy(&next_offset, view.data().data() + num_entries * sizeof(TagType), sizeof(OffsetType));
-    
-    if constexpr (SourceEndian != std::endian::native) {
-        convert_endianness<OffsetType, SourceEndian, std::endian::native>(next_offset);
-    }
-    
-    ifd.next_ifd_offset = IFDOffset(static_cast<std::size_t>(next_offset));
+    detail::parse_ifd_body(view.data(), ifd);
     return Ok();
 }
 
 template <RawReader Reader, TiffFormatType TiffFormat, std::endian SourceEndian>
 Result<IFD<TiffFormat, SourceEndian>> read_ifd(
     const Reader& reader,
-    IFDOffset offset) noexcept 
+    IFDOffset offset,
+    std::size_t speculative_read_size) noexcept 
 {
     IFD<TiffFormat, SourceEndian> ifd;
-    auto result = read_ifd_into<Reader, TiffFormat, SourceEndian>(reader, offset, ifd);
+    auto result = read_ifd_into<Reader, TiffFormat, SourceEndian>(reader, offset, ifd, speculative_read_size);
     
     if (result.is_error()) [[unlikely]] {
         return result.error();
@@ -1,13 +1,17 @@
 #pragma once
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <concepts>
 #include <condition_variable>
 #include <deque>
 #include <functional>
+#include <memory>
 #include <mutex>
 #include <span>
 #include <thread>
+#include <unordered_map>
 #include <vector>
 #include "../decompressors/decompressor_base.hpp"
 #include "../image_shape.hpp"
@@ -316,55 +320,54 @@ inline Result<void> collect_tiles_for_region(
     }
 }
 
-template <ImageLayoutSpec OutSpec, typename PixelType, typename TagSpec>
-requires (std::is_same_v<PixelType, uint8_t> || 
-          std::is_same_v<PixelType, uint16_t> ||
-          std::is_same_v<PixelType, uint32_t> ||
-          std::is_same_v<PixelType, uint64_t> ||
-          std::is_same_v<PixelType, int8_t> ||
-          std::is_same_v<PixelType, int16_t> ||
-          std::is_same_v<PixelType, int32_t> ||
-          std::is_same_v<PixelType, int64_t> ||
-          std::is_same_v<PixelType, float> ||
-          std::is_same_v<PixelType, double>) &&
-         (TiledImageTagSpec<TagSpec> || StrippedImageTagSpec<TagSpec>)
-[[nodiscard]] inline Result<void> extract_tile_to_buffer(
-    const Tile& tile,
-    const ImageRegion& region,
-    const ExtractedTags<TagSpec>& metadata,
-    std::span<const PixelType> decoded_tile,
-    std::span<PixelType> output_buffer) noexcept
+namespace detail {
+
+/// @brief Whether decoded tiles have the layout of the output buffer
+template <ImageLayoutSpec OutSpec>
+[[nodiscard]] inline bool layout_allows_direct_decode(
+    const ImageShape& shape,
+    const ImageRegion& region) noexcept
 {
-    // Extract image shape
-    ImageShape shape;
-    auto shape_result = shape.update_from_metadata(metadata);
-    if (!shape_result) {
-        return shape_result;
-    }
-    
-    // Validate pixel type
-    auto format_validation = shape.validate_pixel_type<PixelType>();
-    if (!format_validation) {
-        return format_validation;
+    if (shape.planar_configuration() == PlanarConfiguration::Planar) {
+        // Single sample tiles: the output layout does not matter for one channel
+        return region.num_channels == 1;
     }
-    
-    // Validate output buffer size
-    const std::size_t expected_size = region.num_samples();
-    if (output_buffer.size() != expected_size) [[unlikely]] {
-        return Err(Error::Code::OutOfBounds, 
-                  "Output buffer size doesn't match region size");
+    // Chunky tiles are DHWC with all the samples of each pixel
+    return region.start_channel == 0 &&
+           region.num_channels == shape.samples_per_pixel() &&
+           (OutSpec == ImageLayoutSpec::DHWC || region.num_channels == 1);
+}
+
+/// @brief Output offset of a tile decoded in place (see direct_decode_target)
+/// @return TileCopy::not_direct if the destination of the tile is not contiguous
+[[nodiscard]] inline std::size_t direct_decode_offset(
+    const Tile& tile,
+    const ImageRegion& region) noexcept
+{
+    const TileSize& size = tile.id.size;
+    const TileCoordinates& coords = tile.id.coords;
+    
+    const bool inside = coords.x >= region.start_x && coords.x + size.width <= region.end_x() &&
+                        coords.y >= region.start_y && coords.y + size.height <= region.end_y() &&
+                        coords.z >= region.start_z && coords.z + size.depth <= region.end_z();
+    if (!inside || size.width != region.width || size.nsamples != region.num_channels) {
+        return TileCopy::not_direct;
     }
-    
-    // Validate decoded tile size
-    const std::size_t expected_tile_size = static_cast<std::size_t>(tile.id.size.width) *
-                                           tile.id.size.height *
-                                           tile.id.size.depth *
-                                           tile.id.size.nsamples;
-    if (decoded_tile.size() != expected_tile_size) [[unlikely]] {
-        return Err(Error::Code::OutOfBounds,
-                  "Decoded tile size doesn't match tile dimensions");
+    if (size.depth > 1 && size.height != region.height) {
+        return TileCopy::not_direct;
     }
     
+    const std::size_t row_samples = static_cast<std::size_t>(region.width) * region.num_channels;
+    return (static_cast<std::size_t>(coords.z - region.start_z) * region.height +
+            (coords.y - region.start_y)) * row_samples;
+}
+
+/// @brief Overlap of a tile with the region, in tile and region coordinates
+[[nodiscard]] inline Result<TileCopy> make_tile_copy(
+    const Tile& tile,
+    const ImageRegion& region,
+    PlanarConfiguration planar_config) noexcept
+{
     // Calculate overlap between tile and region
     const uint32_t tile_x = tile.id.coords.x;
     const uint32_t tile_y = tile.id.coords.y;
@@ -391,13 +394,11 @@ requires (std::is_same_v<PixelType, uint8_t> ||
         return Err(Error::Code::InvalidOperation, "Tile doesn't overlap with region");
     }
     
-    // Calculate copy dimensions
-    const uint32_t copy_width = overlap_x_end - overlap_x_start;
-    const uint32_t copy_height = overlap_y_end - overlap_y_start;
-    const uint32_t copy_depth = overlap_z_end - overlap_z_start;
+    TileCopy copy;
+    copy.src_dims = tile.id.size;
     
     // Calculate source position in tile
-    TileCoordinates src_pos{
+    copy.src_pos = TileCoordinates{
         overlap_x_start - tile_x,
         overlap_y_start - tile_y,
         overlap_z_start - tile_z,
@@ -405,7 +406,7 @@ requires (std::is_same_v<PixelType, uint8_t> ||
     };
     
     // Calculate destination position in output buffer
-    TileCoordinates dst_pos{
+    copy.dst_pos = TileCoordinates{
         overlap_x_start - region.start_x,
         overlap_y_start - region.start_y,
         overlap_z_start - region.start_z,
@@ -413,9 +414,7 @@ requires (std::is_same_v<PixelType, uint8_t> ||
     };
     
     // Handle planar configuration
-    PlanarConfiguration planar_config = shape.planar_configuration();
     uint32_t copy_nsamples;
-    
     if (planar_config == PlanarConfiguration::Planar) {
         // For planar, tiles have 1 sample and correspond to a specific channel
         copy_nsamples = 1;
@@ -427,28 +426,50 @@ requires (std::is_same_v<PixelType, uint8_t> ||
         }
         
         // Set destination sample offset
-        dst_pos.s = tile_s - region.start_channel;
+        copy.dst_pos.s = tile_s - region.start_channel;
     } else {
         // For chunky, all channels are in the tile
         copy_nsamples = std::min(tile.id.size.nsamples, static_cast<uint32_t>(region.num_channels));
-        src_pos.s = region.start_channel;
-        dst_pos.s = 0;
+        copy.src_pos.s = region.start_channel;
+        copy.dst_pos.s = 0;
+    }
+    
+    copy.copy_dims = TileSize{
+        overlap_x_end - overlap_x_start,
+        overlap_y_end - overlap_y_start,
+        overlap_z_end - overlap_z_start,
+        copy_nsamples
+    };
+    
+    copy.direct_offset = direct_decode_offset(tile, region);
+    return Ok(copy);
+}
+
+/// @brief Copy the overlap of a decoded tile to the output buffer
+template <ImageLayoutSpec OutSpec, typename PixelType>
+[[nodiscard]] inline Result<void> copy_decoded_tile(
+    const TileCopy& copy,
+    const ImageRegion& region,
+    PlanarConfiguration planar_config,
+    std::span<const PixelType> decoded_tile,
+    std::span<PixelType> output_buffer) noexcept
+{
+    // Validate decoded tile size
+    const std::size_t expected_tile_size = static_cast<std::size_t>(copy.src_dims.width) *
+                                           copy.src_dims.height *
+                                           copy.src_dims.depth *
+                                           copy.src_dims.nsamples;
+    if (decoded_tile.size() != expected_tile_size) [[unlikely]] {
+        return Err(Error::Code::OutOfBounds,
+                  "Decoded tile size doesn't match tile dimensions");
     }
     
-    // Set up dimensions for copy
-    TileSize src_dims = tile.id.size;
     TileSize dst_dims{
         region.width,
         region.height,
         region.depth,
         region.num_channels
     };
-    TileSize copy_dims{
-        copy_width,
-        copy_height,
-        copy_depth,
-        copy_nsamples
-    };
     
     // Copy tile data to output buffer with layout conversion
     if (planar_config == PlanarConfiguration::Planar) {
@@ -456,26 +477,765 @@ requires (std::is_same_v<PixelType, uint8_t> ||
             decoded_tile,
             output_buffer,
             dst_dims,
-            src_dims,
-            copy_dims,
-            dst_pos,
-            src_pos
+            copy.src_dims,
+            copy.copy_dims,
+            copy.dst_pos,
+            copy.src_pos
         );
     } else {
         copy_tile_to_buffer<PlanarConfiguration::Chunky, OutSpec>(
             decoded_tile,
             output_buffer,
             dst_dims,
-            src_dims,
-            copy_dims,
-            dst_pos,
-            src_pos
+            copy.src_dims,
+            copy.copy_dims,
+            copy.dst_pos,
+            copy.src_pos
         );
     }
     
     return Ok();
 }
 
+} // namespace detail
+
+template <ImageLayoutSpec OutSpec, typename PixelType, typename TagSpec>
+requires (std::is_same_v<PixelType, uint8_t> || 
+          std::is_same_v<PixelType, uint16_t> ||
+          std::is_same_v<PixelType, uint32_t> ||
+          std::is_same_v<PixelType, uint64_t> ||
+          std::is_same_v<PixelType, int8_t> ||
+          std::is_same_v<PixelType, int16_t> ||
+          std::is_same_v<PixelType, int32_t> ||
+          std::is_same_v<PixelType, int64_t> ||
+          std::is_same_v<PixelType, float> ||
+          std::is_same_v<PixelType, double>) &&
+         (TiledImageTagSpec<TagSpec> || StrippedImageTagSpec<TagSpec>)
+[[nodiscard]] inline Result<void> extract_tile_to_buffer(
+    const Tile& tile,
+    const ImageRegion& region,
+    const ExtractedTags<TagSpec>& metadata,
+    std::span<const PixelType> decoded_tile,
+    std::span<PixelType> output_buffer) noexcept
+{
+    // Extract image shape
+    ImageShape shape;
+    auto shape_result = shape.update_from_metadata(metadata);
+    if (!shape_result) {
+        return shape_result;
+    }
+    
+    // Validate pixel type
+    auto format_validation = shape.validate_pixel_type<PixelType>();
+    if (!format_validation) {
+        return format_validation;
+    }
+    
+    // Validate output buffer size
+    const std::size_t expected_size = region.num_samples();
+    if (output_buffer.size() != expected_size) [[unlikely]] {
+        return Err(Error::Code::OutOfBounds, 
+                  "Output buffer size doesn't match region size");
+    }
+    
+    auto copy = detail::make_tile_copy(tile, region, shape.planar_configuration());
+    if (!copy) [[unlikely]] {
+        return copy.error();
+    }
+    
+    return detail::copy_decoded_tile<OutSpec, PixelType>(
+        copy.value(), region, shape.planar_configuration(), decoded_tile, output_buffer
+    );
+}
+
+template <ImageLayoutSpec OutSpec, typename PixelType, typename TagSpec>
+requires (TiledImageTagSpec<TagSpec> || StrippedImageTagSpec<TagSpec>)
+[[nodiscard]] inline bool can_decode_into_output(
+    const ImageRegion& region,
+    const ExtractedTags<TagSpec>& metadata,
+    std::span<const PixelType> output_buffer) noexcept
+{
+    ImageShape shape;
+    if (!shape.update_from_metadata(metadata)) {
+        return false;
+    }
+    if (!shape.template validate_pixel_type<PixelType>()) {
+        return false;
+    }
+    if (output_buffer.size() != region.num_samples()) {
+        return false;
+    }
+    return detail::layout_allows_direct_decode<OutSpec>(shape, region);
+}
+
+template <typename PixelType>
+[[nodiscard]] inline std::span<PixelType> direct_decode_target(
+    const Tile& tile,
+    const ImageRegion& region,
+    std::span<PixelType> output_buffer) noexcept
+{
+    const std::size_t offset = detail::direct_decode_offset(tile, region);
+    const std::size_t count = static_cast<std::size_t>(tile.id.size.width) * tile.id.size.height *
+                              tile.id.size.depth * tile.id.size.nsamples;
+    if (offset == TileCopy::not_direct || offset + count > output_buffer.size()) {
+        return {};
+    }
+    return output_buffer.subspan(offset, count);
+}
+
+// ============================================================================
+// ReadPlan Implementation
+// ============================================================================
+
+template <typename PixelType, ImageLayoutSpec OutSpec>
+template <typename TagSpec>
+requires (TiledImageTagSpec<TagSpec> || StrippedImageTagSpec<TagSpec>)
+inline Result<void> ReadPlan<PixelType, OutSpec>::prepare(
+    const ExtractedTags<TagSpec>& metadata,
+    const ImageRegion& region) noexcept
+{
+    tiles_.clear();
+    copies_.clear();
+    direct_output_ = false;
+    
+    auto shape_result = shape_.update_from_metadata(metadata);
+    if (!shape_result) {
+        return shape_result;
+    }
+    auto format_validation = shape_.template validate_pixel_type<PixelType>();
+    if (!format_validation) {
+        return format_validation;
+    }
+    
+    // Also validates the region against the image
+    auto collect_res = collect_tiles_for_region(region, metadata, tiles_);
+    if (!collect_res) {
+        return collect_res;
+    }
+    region_ = region;
+    
+    compression_ = optional::extract_tag_or<TagCode::Compression, TagSpec>(
+        metadata, CompressionScheme::None
+    );
+    byte_order_ = metadata.byte_order;
+    predictor_ = Predictor::None;
+    if constexpr (TagSpec::template has_tag<TagCode::Predictor>()) {
+        predictor_ = optional::extract_tag_or<TagCode::Predictor, TagSpec>(
+            metadata, Predictor::None
+        );
+    }
+    
+    try {
+        copies_.reserve(tiles_.size());
+    } catch (...) {
+        return Err(Error::Code::MemoryError, "Failed to allocate read plan");
+    }
+    const bool direct_layout = detail::layout_allows_direct_decode<OutSpec>(shape_, region_);
+    for (const auto& tile : tiles_) {
+        auto copy = detail::make_tile_copy(tile, region_, shape_.planar_configuration());
+        if (!copy) [[unlikely]] {
+            return copy.error();
+        }
+        if (!direct_layout) {
+            copy.value().direct_offset = TileCopy::not_direct;
+        }
+        direct_output_ = direct_output_ || copy.value().direct_offset != TileCopy::not_direct;
+        copies_.push_back(copy.value());
+    }
+    
+    return Ok();
+}
+
+template <typename PixelType, ImageLayoutSpec OutSpec>
+inline Result<void> ReadPlan<PixelType, OutSpec>::select_tiles(
+    const ReadPlan& plan,
+    std::span<const std::size_t> tile_indices) noexcept
+{
+    shape_ = plan.shape_;
+    region_ = plan.region_;
+    compression_ = plan.compression_;
+    predictor_ = plan.predictor_;
+    byte_order_ = plan.byte_order_;
+    tiles_.clear();
+    copies_.clear();
+    direct_output_ = false;
+    
+    try {
+        tiles_.reserve(tile_indices.size());
+        copies_.reserve(tile_indices.size());
+    } catch (...) {
+        return Err(Error::Code::MemoryError, "Failed to allocate read plan");
+    }
+    for (std::size_t tile_index : tile_indices) {
+        tiles_.push_back(plan.tiles_[tile_index]);
+        copies_.push_back(plan.copies_[tile_index]);
+        direct_output_ = direct_output_ || copies_.back().direct_offset != TileCopy::not_direct;
+    }
+    return Ok();
+}
+
+template <typename PixelType, ImageLayoutSpec OutSpec>
+inline Result<void> ReadPlan<PixelType, OutSpec>::validate_output(
+    std::span<const PixelType> output_buffer) const noexcept
+{
+    if (output_buffer.size() != region_.num_samples()) [[unlikely]] {
+        return Err(Error::Code::OutOfBounds, 
+                  "Output buffer size doesn't match region size");
+    }
+    return Ok();
+}
+
+template <typename PixelType, ImageLayoutSpec OutSpec>
+inline std::span<PixelType> ReadPlan<PixelType, OutSpec>::direct_target(
+    std::size_t tile_index,
+    std::span<PixelType> output_buffer) const noexcept
+{
+    const TileCopy& copy = copies_[tile_index];
+    if (copy.direct_offset == TileCopy::not_direct) {
+        return {};
+    }
+    const std::size_t count = static_cast<std::size_t>(copy.src_dims.width) * copy.src_dims.height *
+                              copy.src_dims.depth * copy.src_dims.nsamples;
+    return output_buffer.subspan(copy.direct_offset, count);
+}
+
+template <typename PixelType, ImageLayoutSpec OutSpec>
+inline Result<void> ReadPlan<PixelType, OutSpec>::place_tile(
+    std::size_t tile_index,
+    std::span<const PixelType> decoded_tile,
+    std::span<PixelType> output_buffer) const noexcept
+{
+    return detail::copy_decoded_tile<OutSpec, PixelType>(
+        copies_[tile_index], region_, shape_.planar_configuration(), decoded_tile, output_buffer
+    );
+}
+
+template <typename PixelType, ImageLayoutSpec OutSpec>
+template <typename DecompSpec>
+inline Result<void> ReadPlan<PixelType, OutSpec>::decode_tile(
+    TileDecoder<PixelType, DecompSpec>& decoder,
+    std::size_t tile_index,
+    std::span<const std::byte> compressed,
+    std::span<PixelType> output_buffer) const noexcept
+{
+    std::span<const PixelType> decoded;
+    return decode_tile(decoder, tile_index, compressed, output_buffer, decoded);
+}
+
+template <typename PixelType, ImageLayoutSpec OutSpec>
+template <typename DecompSpec>
+inline Result<void> ReadPlan<PixelType, OutSpec>::decode_tile(
+    TileDecoder<PixelType, DecompSpec>& decoder,
+    std::size_t tile_index,
+    std::span<const std::byte> compressed,
+    std::span<PixelType> output_buffer,
+    std::span<const PixelType>& decoded) const noexcept
+{
+    const Tile& tile = tiles_[tile_index];
+    
+    // Tiles matching the output layout are decoded in place, skipping the copy
+    auto target = direct_target(tile_index, output_buffer);
+    if (!target.empty()) {
+        decoded = target;
+        return decoder.decode_into(
+            compressed,
+            std::as_writable_bytes(target),
+            tile.id.size.width,
+            tile.id.size.height * tile.id.size.depth,
+            compression_,
+            predictor_,
+            tile.id.size.nsamples,
+            byte_order_
+        );
+    }
+    
+    auto decode_res = decoder.decode(
+        compressed,
+        tile.id.size.width,
+        tile.id.size.height * tile.id.size.depth, // Treat depth as height extension for decoding
+        compression_,
+        predictor_,
+        tile.id.size.nsamples,
+        byte_order_
+    );
+    if (!decode_res) [[unlikely]] {
+        return decode_res.error();
+    }
+    decoded = decode_res.value();
+    return place_tile(tile_index, decoded, output_buffer);
+}
+
+// ============================================================================
+// MultiRegionPlan Implementation
+// ============================================================================
+
+template <typename PixelType, ImageLayoutSpec OutSpec>
+template <typename TagSpec>
+requires (TiledImageTagSpec<TagSpec> || StrippedImageTagSpec<TagSpec>)
+inline Result<void> MultiRegionPlan<PixelType, OutSpec>::prepare(
+    const ExtractedTags<TagSpec>& metadata,
+    std::span<const ImageRegion> regions) noexcept
+{
+    plans_.reset();
+    tiles_.clear();
+    target_begin_.clear();
+    targets_.clear();
+    
+    /// @brief Tile of a region plan, with its source
+    struct Use {
+        const Tile* tile;
+        Target target;
+        bool direct;
+    };
+    
+    try {
+        auto plans = std::make_shared<std::vector<ReadPlan<PixelType, OutSpec>>>(regions.size());
+        std::size_t total_tiles = 0;
+        for (std::size_t region_index = 0; region_index < regions.size(); ++region_index) {
+            auto prepare_res = (*plans)[region_index].prepare(metadata, regions[region_index]);
+            if (!prepare_res) {
+                return prepare_res;
+            }
+            total_tiles += (*plans)[region_index].tiles().size();
+        }
+        
+        std::vector<Use> uses;
+        uses.reserve(total_tiles);
+        for (std::size_t region_index = 0; region_index < plans->size(); ++region_index) {
+            const auto& plan = (*plans)[region_index];
+            for (std::size_t tile_index = 0; tile_index < plan.tiles().size(); ++tile_index) {
+                uses.push_back({&plan.tiles()[tile_index], {region_index, tile_index},
+                                plan.tile_copy(tile_index).direct_offset != TileCopy::not_direct});
+            }
+        }
+        
+        // Uses of a tile end up adjacent (a tile index has one offset),
+        // the first one decoding in place if possible
+        std::sort(uses.begin(), uses.end(), [](const Use& a, const Use& b) {
+            if (a.tile->location.offset != b.tile->location.offset) {
+                return a.tile->location.offset < b.tile->location.offset;
+            }
+            if (a.tile->id.index != b.tile->id.index) {
+                return a.tile->id.index < b.tile->id.index;
+            }
+            return a.direct > b.direct;
+        });
+        
+        tiles_.reserve(uses.size());
+        target_begin_.reserve(uses.size() + 1);
+        targets_.reserve(uses.size());
+        for (const Use& use : uses) {
+            if (tiles_.empty() || tiles_.back().id.index != use.tile->id.index) {
+                tiles_.push_back(*use.tile);
+                target_begin_.push_back(targets_.size());
+            }
+            targets_.push_back(use.target);
+        }
+        target_begin_.push_back(targets_.size());
+        plans_ = std::move(plans);
+    } catch (...) {
+        tiles_.clear();
+        target_begin_.clear();
+        targets_.clear();
+        return Err(Error::Code::MemoryError, "Failed to allocate read plan");
+    }
+    return Ok();
+}
+
+template <typename PixelType, ImageLayoutSpec OutSpec>
+inline Result<void> MultiRegionPlan<PixelType, OutSpec>::select_tiles(
+    const MultiRegionPlan& plan,
+    std::span<const std::size_t> tile_indices) noexcept
+{
+    plans_ = plan.plans_;
+    tiles_.clear();
+    target_begin_.clear();
+    targets_.clear();
+    
+    try {
+        tiles_.reserve(tile_indices.size());
+        target_begin_.reserve(tile_indices.size() + 1);
+        for (std::size_t tile_index : tile_indices) {
+            tiles_.push_back(plan.tiles_[tile_index]);
+            target_begin_.push_back(targets_.size());
+            targets_.insert(targets_.end(),
+                            plan.targets_.begin() + static_cast<std::ptrdiff_t>(plan.target_begin_[tile_index]),
+                            plan.targets_.begin() + static_cast<std::ptrdiff_t>(plan.target_begin_[tile_index + 1]));
+        }
+        target_begin_.push_back(targets_.size());
+    } catch (...) {
+        return Err(Error::Code::MemoryError, "Failed to allocate read plan");
+    }
+    return Ok();
+}
+
+template <typename PixelType, ImageLayoutSpec OutSpec>
+inline Result<void> MultiRegionPlan<PixelType, OutSpec>::validate_output(
+    output_type output_buffers) const noexcept
+{
+    if (output_buffers.size() != num_regions()) [[unlikely]] {
+        return Err(Error::Code::OutOfBounds,
+                  "Number of output buffers doesn't match number of regions");
+    }
+    for (std::size_t region_index = 0; region_index < output_buffers.size(); ++region_index) {
+        auto output_res = (*plans_)[region_index].validate_output(output_buffers[region_index]);
+        if (!output_res) [[unlikely]] {
+            return output_res;
+        }
+    }
+    return Ok();
+}
+
+template <typename PixelType, ImageLayoutSpec OutSpec>
+inline Result<void> MultiRegionPlan<PixelType, OutSpec>::place_tile(
+    std::size_t tile_index,
+    std::span<const PixelType> decoded_tile,
+    output_type output_buffers) const noexcept
+{
+    for (std::size_t t = target_begin_[tile_index]; t < target_begin_[tile_index + 1]; ++t) {
+        const Target& target = targets_[t];
+        auto place_res = (*plans_)[target.region_index].place_tile(
+            target.tile_index, decoded_tile, output_buffers[target.region_index]
+        );
+        if (!place_res) [[unlikely]] {
+            return place_res;
+        }
+    }
+    return Ok();
+}
+
+template <typename PixelType, ImageLayoutSpec OutSpec>
+template <typename DecompSpec>
+inline Result<void> MultiRegionPlan<PixelType, OutSpec>::decode_tile(
+    TileDecoder<PixelType, DecompSpec>& decoder,
+    std::size_t tile_index,
+    std::span<const std::byte> compressed,
+    output_type output_buffers) const noexcept
+{
+    std::span<const PixelType> decoded;
+    return decode_tile(decoder, tile_index, compressed, output_buffers, decoded);
+}
+
+template <typename PixelType, ImageLayoutSpec OutSpec>
+template <typename DecompSpec>
+inline Result<void> MultiRegionPlan<PixelType, OutSpec>::decode_tile(
+    TileDecoder<PixelType, DecompSpec>& decoder,
+    std::size_t tile_index,
+    std::span<const std::byte> compressed,
+    output_type output_buffers,
+    std::span<const PixelType>& decoded) const noexcept
+{
+    // Decoded for the first region (in place if it allows it), then copied
+    const std::size_t first = target_begin_[tile_index];
+    const std::size_t last = target_begin_[tile_index + 1];
+    const Target& target = targets_[first];
+    auto decode_res = (*plans_)[target.region_index].decode_tile(
+        decoder, target.tile_index, compressed, output_buffers[target.region_index], decoded
+    );
+    if (!decode_res) [[unlikely]] {
+        return decode_res;
+    }
+    for (std::size_t t = first + 1; t < last; ++t) {
+        const Target& other = targets_[t];
+        auto place_res = (*plans_)[other.region_index].place_tile(
+            other.tile_index, decoded, output_buffers[other.region_index]
+        );
+        if (!place_res) [[unlikely]] {
+            return place_res;
+        }
+    }
+    return Ok();
+}
+
+// ============================================================================
+// PageStackPlan Implementation
+// ============================================================================
+
+template <typename PixelType, ImageLayoutSpec OutSpec>
+template <typename TagSpec>
+requires (TiledImageTagSpec<TagSpec> || StrippedImageTagSpec<TagSpec>)
+inline Result<void> PageStackPlan<PixelType, OutSpec>::prepare(
+    std::span<const ExtractedTags<TagSpec>> pages,
+    const ImageRegion& region) noexcept
+{
+    plans_.reset();
+    page_samples_ = region.num_samples();
+    tiles_.clear();
+    targets_.clear();
+    
+    try {
+        auto plans = std::make_shared<std::vector<ReadPlan<PixelType, OutSpec>>>(pages.size());
+        std::size_t total_tiles = 0;
+        for (std::size_t page_index = 0; page_index < pages.size(); ++page_index) {
+            auto prepare_res = (*plans)[page_index].prepare(pages[page_index], region);
+            if (!prepare_res) {
+                return prepare_res;
+            }
+            total_tiles += (*plans)[page_index].tiles().size();
+        }
+        
+        targets_.reserve(total_tiles);
+        for (std::size_t page_index = 0; page_index < plans->size(); ++page_index) {
+            for (std::size_t tile_index = 0; tile_index < (*plans)[page_index].tiles().size(); ++tile_index) {
+                targets_.push_back({page_index, tile_index});
+            }
+        }
+        
+        // Merged in file offset order, so that batches span consecutive pages
+        auto tile_of = [&plans](const Target& target) -> const Tile& {
+            return (*plans)[target.page_index].tiles()[target.tile_index];
+        };
+        std::stable_sort(targets_.begin(), targets_.end(), [&](const Target& a, const Target& b) {
+            return tile_of(a).location.offset < tile_of(b).location.offset;
+        });
+        
+        tiles_.reserve(targets_.size());
+        for (const Target& target : targets_) {
+            tiles_.push_back(tile_of(target));
+        }
+        plans_ = std::move(plans);
+    } catch (...) {
+        tiles_.clear();
+        targets_.clear();
+        return Err(Error::Code::MemoryError, "Failed to allocate read plan");
+    }
+    return Ok();
+}
+
+template <typename PixelType, ImageLayoutSpec OutSpec>
+inline Result<void> PageStackPlan<PixelType, OutSpec>::select_tiles(
+    const PageStackPlan& plan,
+    std::span<const std::size_t> tile_indices) noexcept
+{
+    plans_ = plan.plans_;
+    page_samples_ = plan.page_samples_;
+    tiles_.clear();
+    targets_.clear();
+    
+    try {
+        tiles_.reserve(tile_indices.size());
+        targets_.reserve(tile_indices.size());
+    } catch (...) {
+        return Err(Error::Code::MemoryError, "Failed to allocate read plan");
+    }
+    for (std::size_t tile_index : tile_indices) {
+        tiles_.push_back(plan.tiles_[tile_index]);
+        targets_.push_back(plan.targets_[tile_index]);
+    }
+    return Ok();
+}
+
+template <typename PixelType, ImageLayoutSpec OutSpec>
+inline Result<void> PageStackPlan<PixelType, OutSpec>::validate_output(
+    std::span<const PixelType> output_buffer) const noexcept
+{
+    if (output_buffer.size() != num_pages() * page_samples_) [[unlikely]] {
+        return Err(Error::Code::OutOfBounds,
+                  "Output buffer size doesn't match region size times number of pages");
+    }
+    return Ok();
+}
+
+template <typename PixelType, ImageLayoutSpec OutSpec>
+inline Result<void> PageStackPlan<PixelType, OutSpec>::place_tile(
+    std::size_t tile_index,
+    std::span<const PixelType> decoded_tile,
+    std::span<PixelType> output_buffer) const noexcept
+{
+    const Target& target = targets_[tile_index];
+    return (*plans_)[target.page_index].place_tile(
+        target.tile_index, decoded_tile, page_output(target.page_index, output_buffer)
+    );
+}
+
+template <typename PixelType, ImageLayoutSpec OutSpec>
+template <typename DecompSpec>
+inline Result<void> PageStackPlan<PixelType, OutSpec>::decode_tile(
+    TileDecoder<PixelType, DecompSpec>& decoder,
+    std::size_t tile_index,
+    std::span<const std::byte> compressed,
+    std::span<PixelType> output_buffer) const noexcept
+{
+    std::span<const PixelType> decoded;
+    return decode_tile(decoder, tile_index, compressed, output_buffer, decoded);
+}
+
+template <typename PixelType, ImageLayoutSpec OutSpec>
+template <typename DecompSpec>
+inline Result<void> PageStackPlan<PixelType, OutSpec>::decode_tile(
+    TileDecoder<PixelType, DecompSpec>& decoder,
+    std::size_t tile_index,
+    std::span<const std::byte> compressed,
+    std::span<PixelType> output_buffer,
+    std::span<const PixelType>& decoded) const noexcept
+{
+    // Each page has its own compression, predictor and tile geometry
+    const Target& target = targets_[tile_index];
+    return (*plans_)[target.page_index].decode_tile(
+        decoder, target.tile_index, compressed, page_output(target.page_index, output_buffer), decoded
+    );
+}
+
+namespace detail {
+
+template <typename PixelType, TileReadPlan<PixelType> Plan>
+inline Result<void> place_cached_tiles(
+    const TileCacheRef<PixelType>& cache,
+    const Plan& plan,
+    typename Plan::output_type output_buffer,
+    Plan& pending) noexcept
+{
+    const auto& tiles = plan.tiles();
+    std::vector<std::size_t> missing;
+    try {
+        missing.reserve(tiles.size());
+    } catch (...) {
+        return Err(Error::Code::MemoryError, "Failed to allocate read plan");
+    }
+    for (std::size_t tile_index = 0; tile_index < tiles.size(); ++tile_index) {
+        auto cached = cache.cache->find(TileCacheKey::of(cache.scope, tiles[tile_index]));
+        if (!cached) {
+            missing.push_back(tile_index);
+            continue;
+        }
+        auto place_res = plan.place_tile(tile_index, std::span<const PixelType>(*cached), output_buffer);
+        if (!place_res) [[unlikely]] {
+            return place_res;
+        }
+    }
+    return pending.select_tiles(plan, missing);
+}
+
+} // namespace detail
+
+// ============================================================================
+// BatchBufferArena Implementation
+// ============================================================================
+//
+// Size classes: class 0 holds buffers up to 4 KiB; above, each power of two
+// (2^k, 2^(k+1)] is split into four classes of 2^k + j * 2^(k-2), j = 1..4.
+// cached_bytes_ is reserved with a CAS before a buffer joins a free list, so
+// concurrent releases never push the free buffers past max_cached_bytes_.
+//
+// ============================================================================
+
+inline BatchBufferArena::Buffer::Buffer(Buffer&& other) noexcept
+    : arena_(std::exchange(other.arena_, nullptr)),
+      data_(std::exchange(other.data_, nullptr)),
+      size_class_(other.size_class_) {}
+
+inline BatchBufferArena::Buffer& BatchBufferArena::Buffer::operator=(Buffer&& other) noexcept {
+    if (this != &other) {
+        reset();
+        arena_ = std::exchange(other.arena_, nullptr);
+        data_ = std::exchange(other.data_, nullptr);
+        size_class_ = other.size_class_;
+    }
+    return *this;
+}
+
+inline void BatchBufferArena::Buffer::reset() noexcept {
+    if (data_) {
+        arena_->recycle(data_, size_class_);
+        arena_ = nullptr;
+        data_ = nullptr;
+    }
+}
+
+inline BatchBufferArena::~BatchBufferArena() {
+    release_cached();
+}
+
+inline unsigned BatchBufferArena::class_of(std::size_t size) noexcept {
+    if (size <= (std::size_t{1} << min_class_log2)) {
+        return 0;
+    }
+    const std::size_t last = size - 1;
+    const unsigned k = static_cast<unsigned>(std::bit_width(last)) - 1;  // 2^k <= last < 2^(k+1)
+    if (k >= max_class_log2) {
+        return num_classes;
+    }
+    const unsigned j = static_cast<unsigned>(last >> (k - 2)) & 3u;
+    return 1 + (k - min_class_log2) * 4 + j;
+}
+
+inline std::size_t BatchBufferArena::class_size(unsigned size_class) noexcept {
+    if (size_class == 0) {
+        return std::size_t{1} << min_class_log2;
+    }
+    const unsigned k = min_class_log2 + (size_class - 1) / 4;
+    const unsigned j = (size_class - 1) % 4;
+    return (std::size_t{1} << k) + (std::size_t{j + 1} << (k - 2));
+}
+
+inline BatchBufferArena::Buffer BatchBufferArena::acquire(std::size_t size) noexcept {
+    const unsigned size_class = class_of(size);
+    if (size_class >= num_classes) [[unlikely]] {
+        return Buffer{};
+    }
+
+    auto& sc = classes_[size_class];
+    {
+        std::lock_guard lock(sc.mutex);
+        if (!sc.free.empty()) {
+            std::byte* data = sc.free.back();
+            sc.free.pop_back();
+            cached_bytes_.fetch_sub(class_size(size_class), std::memory_order_relaxed);
+            hits_.fetch_add(1, std::memory_order_relaxed);
+            return Buffer(this, data, size_class);
+        }
+    }
+
+    misses_.fetch_add(1, std::memory_order_relaxed);
+    auto* data = static_cast<std::byte*>(
+        ::operator new(class_size(size_class), std::align_val_t{alignment}, std::nothrow));
+    if (!data) [[unlikely]] {
+        return Buffer{};
+    }
+    return Buffer(this, data, size_class);
+}
+
+inline void BatchBufferArena::recycle(std::byte* data, unsigned size_class) noexcept {
+    const std::size_t size = class_size(size_class);
+    std::size_t cached = cached_bytes_.load(std::memory_order_relaxed);
+    while (cached + size <= max_cached_bytes_) {
+        if (cached_bytes_.compare_exchange_weak(cached, cached + size, std::memory_order_relaxed)) {
+            auto& sc = classes_[size_class];
+            try {
+                std::lock_guard lock(sc.mutex);
+                sc.free.push_back(data);
+                return;
+            } catch (...) {
+                cached_bytes_.fetch_sub(size, std::memory_order_relaxed);
+                break;
+            }
+        }
+    }
+    dropped_.fetch_add(1, std::memory_order_relaxed);
+    ::operator delete(data, std::align_val_t{alignment});
+}
+
+inline void BatchBufferArena::release_cached() noexcept {
+    for (unsigned size_class = 0; size_class < num_classes; ++size_class) {
+        auto& sc = classes_[size_class];
+        std::lock_guard lock(sc.mutex);
+        for (std::byte* data : sc.free) {
+            ::operator delete(data, std::align_val_t{alignment});
+        }
+        cached_bytes_.fetch_sub(sc.free.size() * class_size(size_class), std::memory_order_relaxed);
+        sc.free.clear();
+    }
+}
+
+inline BufferArenaStats BatchBufferArena::stats() const noexcept {
+    return BufferArenaStats{
+        hits_.load(std::memory_order_relaxed),
+        misses_.load(std::memory_order_relaxed),
+        dropped_.load(std::memory_order_relaxed),
+        cached_bytes_.load(std::memory_order_relaxed)
+    };
+}
+
 // ============================================================================
 // IOLimitedReader Implementation
 // ============================================================================
@@ -529,7 +1289,7 @@ requires (std::is_same_v<PixelType, uint8_t> ||
 
 template <typename PixelType, typename DecompSpec>
 IOLimitedReader<PixelType, DecompSpec>::IOLimitedReader(Config config) 
-    : config_(config) {
+    : config_(config), buffers_(config.max_cached_buffer_bytes) {
     if (config_.io_threads == 0) {
         config_.io_threads = std::thread::hardware_concurrency();
         if (config_.io_threads == 0) config_.io_threads = 1;
@@ -621,67 +1381,26 @@ void IOLimitedReader<PixelType, DecompSpec>::worker_loop() {
 }
 
 template <typename PixelType, typename DecompSpec>
-void IOLimitedReader<PixelType, DecompSpec>::create_batches(
-    const std::vector<Tile>& tiles, 
-    const Config& config, 
-    std::vector<Batch>& out_batches) {
-    // Group adjacent tiles into batches to minimize I/O round-trips
-    //
-    // Algorithm:
-    // - Start with the first tile
-    // - For each subsequent tile, check if it's close enough to merge:
-    //   * Gap between tiles ≤ max_gap_size (avoid reading too much unused data)
-    //   * Total batch size ≤ max_batch_size (avoid excessive memory usage)
-    // - If not mergeable, finalize current batch and start a new one
-    //
-    // Precondition: tiles are sorted by file offset (collect_tiles_for_region)
-    // Postcondition: batches cover all tiles exactly once, in order
-    
-    if (tiles.empty()) return;
-
-    size_t start_idx = 0;
-    size_t current_offset = tiles[0].location.offset;
-    size_t current_end = current_offset + tiles[0].location.length;
+BatchIoStats IOLimitedReader<PixelType, DecompSpec>::io_stats() const noexcept {
+    return BatchIoStats{
+        requests_.load(std::memory_order_relaxed),
+        bytes_read_.load(std::memory_order_relaxed),
+        bytes_needed_.load(std::memory_order_relaxed)
+    };
+}
 
-    for (size_t i = 1; i < tiles.size(); ++i) {
-        const auto& tile = tiles[i];
-        
-        // Calculate gap between end of current batch and start of this tile
-        size_t gap = tile.location.offset - current_end;
-        size_t new_end = tile.location.offset + tile.location.length;
-        size_t new_size = new_end - current_offset;
-
-        // Break batch if gap is too large or total size exceeds limit
-        bool break_batch = (gap > config.max_gap_size) || 
-                          (new_size > config.max_batch_size);
-
-        if (break_batch) {
-            // Finalize current batch
-            out_batches.push_back({
-                start_idx, 
-                i - start_idx, 
-                current_offset, 
-                current_end - current_offset
-            });
-            
-            // Start new batch with current tile
-            start_idx = i;
-            current_offset = tile.location.offset;
-            current_end = current_offset + tile.location.length;
-        } else {
-            // Extend current batch to include this tile
-            // Use max() to handle potential overlaps (though shouldn't occur)
-            current_end = std::max(current_end, new_end);
-        }
+template <typename PixelType, typename DecompSpec>
+template <typename Reader, detail::TileReadPlan<PixelType> Plan>
+requires RawReader<Reader>
+BatchPlan IOLimitedReader<PixelType, DecompSpec>::plan_batches(
+    const Reader& reader,
+    const Plan& plan) const {
+    // Batches start and end on multiples of alignment (see AlignedIoReader)
+    const size_t alignment = detail::io_alignment(reader);
+    if (config_.batch_planner) {
+        return config_.batch_planner->plan(plan.tiles(), alignment, config_.max_batch_size);
     }
-    
-    // Finalize last batch
-    out_batches.push_back({
-        start_idx, 
-        tiles.size() - start_idx, 
-        current_offset, 
-        current_end - current_offset
-    });
+    return make_batch_plan(plan.tiles(), alignment, config_.max_batch_size, config_.max_gap_size);
 }
 
 template <typename PixelType, typename DecompSpec>
@@ -693,22 +1412,103 @@ Result<void> IOLimitedReader<PixelType, DecompSpec>::read_region(
     const ImageRegion& region,
     std::span<PixelType> output_buffer) noexcept {
 
+    // Identify which tiles overlap the requested region, and how to decode them
+    ReadPlan<PixelType, OutSpec> plan;
+    auto prepare_res = plan.prepare(metadata, region);
+    if (!prepare_res) return prepare_res;
+
+    return read_region(reader, plan, output_buffer);
+}
+
+template <typename PixelType, typename DecompSpec>
+template <typename Reader, ImageLayoutSpec OutSpec>
+requires RawReader<Reader>
+Result<void> IOLimitedReader<PixelType, DecompSpec>::read_region(
+    const Reader& reader,
+    const ReadPlan<PixelType, OutSpec>& plan,
+    std::span<PixelType> output_buffer) noexcept {
+    return read_tiles(reader, plan, output_buffer);
+}
+
+template <typename PixelType, typename DecompSpec>
+template <ImageLayoutSpec OutSpec, typename Reader, typename TagSpec>
+requires RawReader<Reader> && (TiledImageTagSpec<TagSpec> || StrippedImageTagSpec<TagSpec>)
+Result<void> IOLimitedReader<PixelType, DecompSpec>::read_regions(
+    const Reader& reader,
+    const ExtractedTags<TagSpec>& metadata,
+    std::span<const ImageRegion> regions,
+    std::span<const std::span<PixelType>> output_buffers) noexcept {
+
+    // Distinct tiles of all the regions, and the regions each one is copied to
+    MultiRegionPlan<PixelType, OutSpec> plan;
+    auto prepare_res = plan.prepare(metadata, regions);
+    if (!prepare_res) return prepare_res;
+
+    return read_tiles(reader, plan, output_buffers);
+}
+
+template <typename PixelType, typename DecompSpec>
+template <typename Reader, ImageLayoutSpec OutSpec>
+requires RawReader<Reader>
+Result<void> IOLimitedReader<PixelType, DecompSpec>::read_regions(
+    const Reader& reader,
+    const MultiRegionPlan<PixelType, OutSpec>& plan,
+    std::span<const std::span<PixelType>> output_buffers) noexcept {
+    return read_tiles(reader, plan, output_buffers);
+}
+
+template <typename PixelType, typename DecompSpec>
+template <ImageLayoutSpec OutSpec, typename Reader, typename TagSpec>
+requires RawReader<Reader> && (TiledImageTagSpec<TagSpec> || StrippedImageTagSpec<TagSpec>)
+Result<void> IOLimitedReader<PixelType, DecompSpec>::read_pages(
+    const Reader& reader,
+    std::span<const ExtractedTags<TagSpec>> pages,
+    const ImageRegion& region,
+    std::span<PixelType> output_buffer) noexcept {
+
+    // Tiles of all the pages in file order, batched as one read
+    PageStackPlan<PixelType, OutSpec> plan;
+    auto prepare_res = plan.prepare(pages, region);
+    if (!prepare_res) return prepare_res;
+
+    return read_tiles(reader, plan, output_buffer);
+}
+
+template <typename PixelType, typename DecompSpec>
+template <typename Reader, ImageLayoutSpec OutSpec>
+requires RawReader<Reader>
+Result<void> IOLimitedReader<PixelType, DecompSpec>::read_pages(
+    const Reader& reader,
+    const PageStackPlan<PixelType, OutSpec>& plan,
+    std::span<PixelType> output_buffer) noexcept {
+    return read_tiles(reader, plan, output_buffer);
+}
+
+template <typename PixelType, typename DecompSpec>
+template <typename Reader, detail::TileReadPlan<PixelType> Plan>
+Result<void> IOLimitedReader<PixelType, DecompSpec>::read_tiles(
+    const Reader& reader,
+    const Plan& plan,
+    typename Plan::output_type output_buffer) noexcept {
+
     // ========================================================================
     // Phase 1: Preparation (thread-local, no synchronization needed)
     // ========================================================================
-    
-    // Identify which tiles overlap the requested region
-    std::vector<Tile> tiles;
-    auto collect_res = collect_tiles_for_region(region, metadata, tiles);
-    if (!collect_res) return collect_res;
 
+    auto output_res = plan.validate_output(output_buffer);
+    if (!output_res) return output_res;
+
+    const auto& tiles = plan.tiles();
     if (tiles.empty()) return Ok();
 
     // Group tiles into batches for efficient I/O
-    std::vector<Batch> batches;
-    create_batches(tiles, config_, batches);
+    const BatchPlan batch_plan = plan_batches(reader, plan);
+    const std::vector<Batch>& batches = batch_plan.batches;
 
     if (batches.empty()) return Ok();
+    requests_.fetch_add(batches.size(), std::memory_order_relaxed);
+    bytes_read_.fetch_add(batch_plan.bytes_read, std::memory_order_relaxed);
+    bytes_needed_.fetch_add(batch_plan.bytes_needed, std::memory_order_relaxed);
 
     // ========================================================================
     // Phase 2: Setup Job State (per-call state for coordinating I/O and processing)
@@ -717,7 +1517,7 @@ Result<void> IOLimitedReader<PixelType, DecompSpec>::read_region(
     /// @brief Completed batch with loaded data
     struct CompletedBatch {
         size_t batch_index;                             // Which batch this is
-        std::shared_ptr<std::vector<std::byte>> data;   // Batch data from I/O
+        BatchBufferArena::Buffer data;                  // Batch data from I/O (total_size bytes)
     };
 
     /// @brief Per-job state shared between I/O threads and processing thread
@@ -753,13 +1553,21 @@ Result<void> IOLimitedReader<PixelType, DecompSpec>::read_region(
             // - reader by reference (MUST wait for tasks before returning!)
             // - batch parameters by value (safe, copied at capture)
             pending_tasks_.push_back(
-                [&reader, offset=batch.file_offset, size=batch.total_size, 
-                 batch_idx=i, job_state]() {
+                [&reader, buffers=&buffers_, planner=config_.batch_planner.get(),
+                 offset=batch.file_offset, size=batch.total_size, batch_idx=i, job_state]() {
                     try {
-                        // Use shared_ptr to allow processing thread to hold reference
-                        auto data_ptr = std::make_shared<std::vector<std::byte>>(size);
-                        // Perform I/O operation
-                        auto res = reader.read_into(data_ptr->data(), offset, size);
+                        // Arena buffer, handed over to the processing thread and
+                        // recycled once decoded (aligned so that direct I/O
+                        // readers read in place)
+                        auto data_ptr = buffers->acquire(size);
+                        // Perform I/O operation (timed for the cost model)
+                        const auto start = std::chrono::steady_clock::now();
+                        auto res = data_ptr
+                            ? reader.read_into(data_ptr.data(), offset, size)
+                            : Result<void>(Err(Error::Code::MemoryError, "Failed to allocate batch buffer"));
+                        if (planner && res.is_ok()) {
+                            planner->record(size, std::chrono::steady_clock::now() - start);
+                        }
                         
                         // Report result to job state
                         {
@@ -829,18 +1637,6 @@ Result<void> IOLimitedReader<PixelType, DecompSpec>::read_region(
     size_t batches_processed = 0;
     Result<void> final_result = Ok();
 
-    // Get compression and predictor from tags
-    CompressionScheme compression = optional::extract_tag_or<TagCode::Compression, TagSpec>(
-        metadata, CompressionScheme::None
-    );
-    
-    Predictor predictor = Predictor::None;
-    if constexpr (TagSpec::template has_tag<TagCode::Predictor>()) {
-        predictor = optional::extract_tag_or<TagCode::Predictor, TagSpec>(
-            metadata, Predictor::None
-        );
-    }
-
     // Process batches as they arrive from I/O threads
     while (batches_processed < batches.size()) {
         std::unique_lock lock(job_state->mutex);
@@ -860,7 +1656,7 @@ Result<void> IOLimitedReader<PixelType, DecompSpec>::read_region(
 
         // Process all available batches
         while (!job_state->completed_queue.empty()) {
-            auto item = job_state->completed_queue.front();
+            auto item = std::move(job_state->completed_queue.front());
             job_state->completed_queue.pop_front();
             
             // Release lock during CPU-intensive decoding/extraction
@@ -868,12 +1664,13 @@ Result<void> IOLimitedReader<PixelType, DecompSpec>::read_region(
             lock.unlock();
 
             const auto& batch = batches[item.batch_index];
-            const auto& buffer = *item.data;
+            const std::span<const std::byte> buffer(item.data.data(), batch.total_size);
 
             // Process each tile in this batch
             for (size_t i = 0; i < batch.tile_count; ++i) {
                 try {
-                    const auto& tile = tiles[batch.first_tile_index + i];
+                    const size_t tile_index = batch.first_tile_index + i;
+                    const auto& tile = tiles[tile_index];
                     
                     // Calculate tile's position within the batch buffer
                     size_t offset_in_batch = tile.location.offset - batch.file_offset;
@@ -894,15 +1691,8 @@ Result<void> IOLimitedReader<PixelType, DecompSpec>::read_region(
                         tile.location.length
                     );
 
-                    // Decode tile (decompress + predictor)
-                    auto decode_res = decoder.decode(
-                        compressed_span,
-                        tile.id.size.width,
-                        tile.id.size.height * tile.id.size.depth,
-                        compression,
-                        predictor,
-                        tile.id.size.nsamples
-                    );
+                    // Decode tile (decompress + predictor) and place it in the output buffer
+                    auto decode_res = plan.decode_tile(decoder, tile_index, compressed_span, output_buffer);
 
                     if (!decode_res) {
                         std::lock_guard err_lock(job_state->mutex);
@@ -911,19 +1701,6 @@ Result<void> IOLimitedReader<PixelType, DecompSpec>::read_region(
                         final_result = decode_res.error();
                         goto wait_for_io_completion;
                     }
-
-                    // Extract tile data to output buffer (with layout conversion)
-                    auto extract_res = extract_tile_to_buffer<OutSpec, PixelType>(
-                        tile, region, metadata, decode_res.value(), output_buffer
-                    );
-
-                    if (!extract_res) {
-                        std::lock_guard err_lock(job_state->mutex);
-                        job_state->error_occurred.store(true, std::memory_order_release);
-                        job_state->first_error = extract_res.error();
-                        final_result = extract_res.error();
-                        goto wait_for_io_completion;
-                    }
                 } catch (...) {
                     // Exception during decode/extract (should not happen, but defend against it)
                     std::lock_guard err_lock(job_state->mutex);
@@ -1064,32 +1841,137 @@ void CPULimitedReader<PixelType, DecompSpec>::worker_loop() {
             pending_tasks_.pop_front();
         }
 
-        // Execute tile processing task
-        // The task has captured all necessary context including the decoder reference
-        if (task) {
-            task();
-        }
+        // Execute tile processing task
+        // The task has captured all necessary context including the decoder reference
+        if (task) {
+            task();
+        }
+    }
+}
+
+template <typename PixelType, typename DecompSpec>
+template <ImageLayoutSpec OutSpec, typename Reader, typename TagSpec>
+requires RawReader<Reader> && (TiledImageTagSpec<TagSpec> || StrippedImageTagSpec<TagSpec>)
+Result<void> CPULimitedReader<PixelType, DecompSpec>::read_region(
+    const Reader& reader,
+    const ExtractedTags<TagSpec>& metadata,
+    const ImageRegion& region,
+    std::span<PixelType> output_buffer,
+    std::optional<TileCacheScope> cache_scope) noexcept {
+
+    // Identify which tiles overlap the requested region, and how to decode them
+    ReadPlan<PixelType, OutSpec> plan;
+    auto prepare_res = plan.prepare(metadata, region);
+    if (!prepare_res) return prepare_res;
+
+    return read_region(reader, plan, output_buffer, cache_scope);
+}
+
+template <typename PixelType, typename DecompSpec>
+template <typename Reader, ImageLayoutSpec OutSpec>
+requires RawReader<Reader>
+Result<void> CPULimitedReader<PixelType, DecompSpec>::read_region(
+    const Reader& reader,
+    const ReadPlan<PixelType, OutSpec>& plan,
+    std::span<PixelType> output_buffer,
+    std::optional<TileCacheScope> cache_scope) noexcept {
+    return read_plan(reader, plan, output_buffer, cache_scope);
+}
+
+template <typename PixelType, typename DecompSpec>
+template <ImageLayoutSpec OutSpec, typename Reader, typename TagSpec>
+requires RawReader<Reader> && (TiledImageTagSpec<TagSpec> || StrippedImageTagSpec<TagSpec>)
+Result<void> CPULimitedReader<PixelType, DecompSpec>::read_regions(
+    const Reader& reader,
+    const ExtractedTags<TagSpec>& metadata,
+    std::span<const ImageRegion> regions,
+    std::span<const std::span<PixelType>> output_buffers,
+    std::optional<TileCacheScope> cache_scope) noexcept {
+
+    // Distinct tiles of all the regions, and the regions each one is copied to
+    MultiRegionPlan<PixelType, OutSpec> plan;
+    auto prepare_res = plan.prepare(metadata, regions);
+    if (!prepare_res) return prepare_res;
+
+    return read_plan(reader, plan, output_buffers, cache_scope);
+}
+
+template <typename PixelType, typename DecompSpec>
+template <typename Reader, ImageLayoutSpec OutSpec>
+requires RawReader<Reader>
+Result<void> CPULimitedReader<PixelType, DecompSpec>::read_regions(
+    const Reader& reader,
+    const MultiRegionPlan<PixelType, OutSpec>& plan,
+    std::span<const std::span<PixelType>> output_buffers,
+    std::optional<TileCacheScope> cache_scope) noexcept {
+    return read_plan(reader, plan, output_buffers, cache_scope);
+}
+
+template <typename PixelType, typename DecompSpec>
+template <ImageLayoutSpec OutSpec, typename Reader, typename TagSpec>
+requires RawReader<Reader> && (TiledImageTagSpec<TagSpec> || StrippedImageTagSpec<TagSpec>)
+Result<void> CPULimitedReader<PixelType, DecompSpec>::read_pages(
+    const Reader& reader,
+    std::span<const ExtractedTags<TagSpec>> pages,
+    const ImageRegion& region,
+    std::span<PixelType> output_buffer) noexcept {
+
+    // Tiles of all the pages, shared out among the workers as one job
+    PageStackPlan<PixelType, OutSpec> plan;
+    auto prepare_res = plan.prepare(pages, region);
+    if (!prepare_res) return prepare_res;
+
+    return read_plan(reader, plan, output_buffer, std::nullopt);
+}
+
+template <typename PixelType, typename DecompSpec>
+template <typename Reader, ImageLayoutSpec OutSpec>
+requires RawReader<Reader>
+Result<void> CPULimitedReader<PixelType, DecompSpec>::read_pages(
+    const Reader& reader,
+    const PageStackPlan<PixelType, OutSpec>& plan,
+    std::span<PixelType> output_buffer) noexcept {
+    return read_plan(reader, plan, output_buffer, std::nullopt);
+}
+
+template <typename PixelType, typename DecompSpec>
+template <typename Reader, detail::TileReadPlan<PixelType> Plan>
+Result<void> CPULimitedReader<PixelType, DecompSpec>::read_plan(
+    const Reader& reader,
+    const Plan& plan,
+    typename Plan::output_type output_buffer,
+    std::optional<TileCacheScope> cache_scope) noexcept {
+
+    auto output_res = plan.validate_output(output_buffer);
+    if (!output_res) return output_res;
+
+    if (!config_.tile_cache || !cache_scope) {
+        return read_tiles(reader, plan, output_buffer, {});
     }
+
+    // Cached tiles are copied before any I/O; only the others are read
+    const detail::TileCacheRef<PixelType> cache{config_.tile_cache.get(), *cache_scope};
+    Plan pending;
+    auto cached_res = detail::place_cached_tiles(cache, plan, output_buffer, pending);
+    if (!cached_res) return cached_res;
+
+    return read_tiles(reader, pending, output_buffer, cache);
 }
 
 template <typename PixelType, typename DecompSpec>
-template <ImageLayoutSpec OutSpec, typename Reader, typename TagSpec>
-requires RawReader<Reader> && (TiledImageTagSpec<TagSpec> || StrippedImageTagSpec<TagSpec>)
-Result<void> CPULimitedReader<PixelType, DecompSpec>::read_region(
+template <typename Reader, detail::TileReadPlan<PixelType> Plan>
+requires RawReader<Reader>
+Result<void> CPULimitedReader<PixelType, DecompSpec>::read_tiles(
     const Reader& reader,
-    const ExtractedTags<TagSpec>& metadata,
-    const ImageRegion& region,
-    std::span<PixelType> output_buffer) noexcept {
+    const Plan& plan,
+    typename Plan::output_type output_buffer,
+    detail::TileCacheRef<PixelType> cache) noexcept {
 
     // ========================================================================
     // Phase 1: Preparation (thread-local, no synchronization needed)
     // ========================================================================
-    
-    // Identify which tiles overlap the requested region
-    std::vector<Tile> tiles;
-    auto collect_res = collect_tiles_for_region(region, metadata, tiles);
-    if (!collect_res) return collect_res;
 
+    const auto& tiles = plan.tiles();
     if (tiles.empty()) return Ok();
 
     // ========================================================================
@@ -1117,20 +1999,19 @@ Result<void> CPULimitedReader<PixelType, DecompSpec>::read_region(
                 // Each task captures:
                 // - job_state by shared_ptr (keeps it alive)
                 // - reader by reference (MUST wait for tasks before returning!)
-                // - tiles by reference
-                // - metadata, region, output_buffer by reference
+                // - plan by reference (tiles and their placement)
+                // - output_buffer by value (span)
                 // - task_idx by value (each thread processes a range of tiles)
-                // - num_tiles_per_thread by value
+                // - num_tiles_per_thread and cache by value
                 pending_tasks_.push_back(
-                    [&reader, &metadata, &region, output_buffer, &tiles, num_tiles_per_thread, task_idx, job_state]() {
-                        CPULimitedReader::process_tile_task<OutSpec>(
+                    [&reader, &plan, output_buffer, num_tiles_per_thread, task_idx, cache, job_state]() {
+                        CPULimitedReader::process_tile_task(
                             reader,
-                            metadata,
-                            region,
+                            plan,
                             output_buffer,
-                            tiles,
                             num_tiles_per_thread,
                             task_idx,
+                            cache,
                             job_state
                         );
                     }
@@ -1141,14 +2022,13 @@ Result<void> CPULimitedReader<PixelType, DecompSpec>::read_region(
     }
 
     // Process first task on calling thread
-    CPULimitedReader::process_tile_task<OutSpec>(
+    CPULimitedReader::process_tile_task(
         reader,
-        metadata,
-        region,
+        plan,
         output_buffer,
-        tiles,
         num_tiles_per_thread,
         0, // task_idx
+        cache,
         job_state
     );
 
@@ -1157,7 +2037,7 @@ Result<void> CPULimitedReader<PixelType, DecompSpec>::read_region(
     // ========================================================================
     //
     // We MUST wait for all tile processing tasks to finish before returning:
-    // 1. Tasks hold references to reader, metadata, region, and output_buffer
+    // 1. Tasks hold references to reader, plan, and output_buffer
     // 2. Tasks hold a shared_ptr to job_state
     // 3. Returning early would invalidate these references, causing UB
     //
@@ -1180,16 +2060,15 @@ Result<void> CPULimitedReader<PixelType, DecompSpec>::read_region(
 
 
 template <typename PixelType, typename DecompSpec>
-template <ImageLayoutSpec OutSpec, typename Reader, typename TagSpec>
-requires RawReader<Reader> && (TiledImageTagSpec<TagSpec> || StrippedImageTagSpec<TagSpec>)
+template <typename Reader, detail::TileReadPlan<PixelType> Plan>
+requires RawReader<Reader>
 inline void CPULimitedReader<PixelType, DecompSpec>::process_tile_task(
     const Reader& reader,
-    const ExtractedTags<TagSpec>& metadata,
-    const ImageRegion& region,
-    std::span<PixelType> output_buffer,
-    const std::vector<Tile>& tiles,
+    const Plan& plan,
+    typename Plan::output_type output_buffer,
     size_t num_tiles_per_thread,
     size_t task_idx,
+    detail::TileCacheRef<PixelType> cache,
     std::shared_ptr<CPULimitedReader<PixelType, DecompSpec>::JobState> job_state) noexcept {
 {
     // RAII helper to ensure counter is always decremented
@@ -1213,18 +2092,9 @@ inline void CPULimitedReader<PixelType, DecompSpec>::process_tile_task(
             thread_local TileDecoder<PixelType, DecompSpec> thread_decoder;
             thread_local std::vector<std::byte> encoded_tile_buffer;
 
-            // Get compression and predictor from tags
-            CompressionScheme compression = optional::extract_tag_or<TagCode::Compression, TagSpec>(
-                metadata, CompressionScheme::None
-            );
-            
-            Predictor predictor = Predictor::None;
-            if constexpr (TagSpec::template has_tag<TagCode::Predictor>()) {
-                predictor = optional::extract_tag_or<TagCode::Predictor, TagSpec>(
-                    metadata, Predictor::None
-                );
-            }
-            Result<std::span<const PixelType>> decode_res{std::span<const PixelType>{}};
+            const auto& tiles = plan.tiles();
+            Result<void> decode_res = Ok();
+            std::span<const PixelType> decoded;
 
             for (size_t local_tile_idx = 0; local_tile_idx < num_tiles_per_thread; ++local_tile_idx) {
                 size_t tile_idx = task_idx * num_tiles_per_thread + local_tile_idx;
@@ -1248,14 +2118,9 @@ inline void CPULimitedReader<PixelType, DecompSpec>::process_tile_task(
                         return;
                     }
 
-                    // Decode tile (decompress + predictor)
-                    decode_res = thread_decoder.decode(
-                        read_res.value().data(),
-                        tile.id.size.width,
-                        tile.id.size.height * tile.id.size.depth,
-                        compression,
-                        predictor,
-                        tile.id.size.nsamples
+                    // Decode tile (decompress + predictor) into the output buffer
+                    decode_res = plan.decode_tile(
+                        thread_decoder, tile_idx, read_res.value().data(), output_buffer, decoded
                     );
                 } else {
                     // for cache locality, reuse buffer for each tile
@@ -1281,17 +2146,16 @@ inline void CPULimitedReader<PixelType, DecompSpec>::process_tile_task(
                         return;
                     }
 
-                    // Decode tile (decompress + predictor)
-                    decode_res = thread_decoder.decode(
+                    // Decode tile (decompress + predictor) into the output buffer
+                    decode_res = plan.decode_tile(
+                        thread_decoder,
+                        tile_idx,
                         std::span<const std::byte>(
                             encoded_tile_buffer.data(), 
                             tile.location.length
                         ),
-                        tile.id.size.width,
-                        tile.id.size.height * tile.id.size.depth,
-                        compression,
-                        predictor,
-                        tile.id.size.nsamples
+                        output_buffer,
+                        decoded
                     );
                 }
                 if (!decode_res) [[unlikely]] {
@@ -1305,22 +2169,7 @@ inline void CPULimitedReader<PixelType, DecompSpec>::process_tile_task(
                     }
                     return;
                 }
-
-                // Extract tile data to output buffer (with layout conversion)
-                auto extract_res = extract_tile_to_buffer<OutSpec, PixelType>(
-                    tile, region, metadata, decode_res.value(), output_buffer
-                );
-                if (!extract_res) [[unlikely]] {
-                    std::lock_guard lock(job_state->mutex);
-                    bool expected = false;
-                    if (job_state->error_occurred.compare_exchange_strong(
-                            expected, true, 
-                            std::memory_order_release, 
-                            std::memory_order_relaxed)) {
-                        job_state->first_error = extract_res.error();
-                    }
-                    return;
-                }
+                cache.insert(tile, decoded);
             }
         } catch (...) {
             // Exception during processing (should not happen, but defend against it)
@@ -1358,21 +2207,25 @@ inline void CPULimitedReader<PixelType, DecompSpec>::process_tile_task(
 //    to minimize round-trips on high-latency storage (NAS, cloud). Small gaps
 //    are bridged to avoid issuing separate requests.
 //
-// 3. **Parallel Processing**: All threads (main + workers) compete to poll
-//    completions and process them. This maximizes both I/O and CPU utilization.
+// 3. **Parallel Processing**: For each job one thread at a time acts as the
+//    reaper (waits on the reader's completion queue) and routes completions
+//    to the job that issued them; every other thread decodes ready batches.
+//    This maximizes both I/O and CPU utilization.
 //
-// 4. **Non-blocking Workers**: Workers poll for completions without blocking,
-//    allowing them to process work from any concurrent read_region() call.
+// 4. **Sleeping Workers**: Idle workers block on a condition variable and are
+//    woken when a job is submitted, a batch becomes ready or the reaper role
+//    is released. They serve work from any concurrent read_region() call.
 //
 // 5. **Thread-Local Decoders**: Each thread maintains its own decoder for
 //    optimal cache locality and zero contention.
 //
 // Thread Model:
 // -------------
-// - Main thread: Submits all reads, then participates in processing
-// - Worker threads: Continuously poll for completions from any job
-// - All threads: Independent, no synchronization during processing
-// - Completion: Lock-free atomic counters, mutex only for errors
+// - Main thread: Submits all reads, then reaps/decodes for its own job
+// - Worker threads: Reap/decode for any active job, sleep when idle
+// - Scheduling: one mutex for queues and counters, decoding runs unlocked
+// - Completion: every batch is counted once (success or failure), so an I/O
+//   error can never leave the main thread waiting
 //
 // Performance Characteristics by Storage Type:
 // ---------------------------------------------
@@ -1417,7 +2270,7 @@ inline void CPULimitedReader<PixelType, DecompSpec>::process_tile_task(
 
 template <typename PixelType, typename DecompSpec>
 FastReader<PixelType, DecompSpec>::FastReader(Config config)
-    : config_(config) {
+    : config_(config), buffers_(config.max_cached_buffer_bytes) {
     
     if (config_.worker_threads == 0) {
         // Auto-detect: use hardware concurrency minus 1 (main thread participates)
@@ -1439,7 +2292,11 @@ FastReader<PixelType, DecompSpec>::FastReader(Config config)
 template <typename PixelType, typename DecompSpec>
 FastReader<PixelType, DecompSpec>::~FastReader() {
     // Signal workers to stop
-    stop_workers_.store(true, std::memory_order_release);
+    {
+        std::lock_guard lock(work_mutex_);
+        stop_workers_ = true;
+    }
+    work_cv_.notify_all();
     
     // Wait for all workers to finish
     for (auto& worker : workers_) {
@@ -1451,368 +2308,477 @@ FastReader<PixelType, DecompSpec>::~FastReader() {
 
 template <typename PixelType, typename DecompSpec>
 void FastReader<PixelType, DecompSpec>::worker_loop() {
-    // Worker threads don't block - they just check for work periodically
-    // This allows them to process completions from any concurrent read_region() call
-    
-    while (!stop_workers_.load(std::memory_order_acquire)) {
-        // Workers sleep briefly when no work is available
-        // This is fine because:
-        // 1. Main threads do most of the work anyway
-        // 2. Workers wake up quickly when work arrives
-        // 3. Prevents busy-waiting and wasting CPU
-        std::this_thread::sleep_for(std::chrono::microseconds(100));
+    // Workers serve every active job: they decode ready batches and take over
+    // completion reaping when no other thread is doing it. When there is
+    // nothing to do they sleep until a job is added or a read completes.
+    std::unique_lock lock(work_mutex_);
+    while (!stop_workers_) {
+        if (!run_one(lock, nullptr)) {
+            work_cv_.wait(lock);
+        }
     }
 }
 
 template <typename PixelType, typename DecompSpec>
-void FastReader<PixelType, DecompSpec>::create_batches(
-    const std::vector<Tile>& tiles,
-    const Config& config,
-    std::vector<Batch>& out_batches) {
+bool FastReader<PixelType, DecompSpec>::run_one(
+    std::unique_lock<std::mutex>& lock,
+    JobState* only_job) noexcept {
     
-    // Same batching algorithm as IOLimitedReader
-    // Group adjacent tiles to minimize I/O round-trips
+    // 1. Decoding ready batches has priority: it is the actual work
+    for (auto& job : active_jobs_) {
+        if (only_job && job.get() != only_job) {
+            continue;
+        }
+        if (job->ready_batches.empty()) {
+            continue;
+        }
+        
+        std::shared_ptr<JobState> owner = job;  // active_jobs_ may change while unlocked
+        size_t batch_idx = owner->ready_batches.front();
+        owner->ready_batches.pop_front();
+        
+        Result<void> status = Ok();
+        if (!owner->error_occurred.load(std::memory_order_acquire)) {
+            lock.unlock();
+            status = owner->process_batch(batch_idx);
+            lock.lock();
+        }
+        finish_batch(owner, std::move(status));
+        return true;
+    }
     
-    if (tiles.empty()) {
-        return;
+    // 2. Otherwise become the reaper of a job that has reads in flight
+    for (auto& job : active_jobs_) {
+        if (only_job && job.get() != only_job) {
+            continue;
+        }
+        if (job->reaping || job->batches_in_flight == 0) {
+            continue;
+        }
+        
+        std::shared_ptr<JobState> owner = job;
+        owner->reaping = true;
+        lock.unlock();
+        
+        std::vector<Completion> completions;
+        owner->reap(completions);
+        
+        lock.lock();
+        owner->reaping = false;
+        route_completions(owner->reader_key, completions);
+        // Wake everyone: there may be new ready batches and the reaper role is free
+        work_cv_.notify_all();
+        return true;
     }
     
-    size_t start_idx = 0;
-    size_t current_offset = tiles[0].location.offset;
-    size_t current_end = current_offset + tiles[0].location.length;
+    return false;
+}
+
+template <typename PixelType, typename DecompSpec>
+void FastReader<PixelType, DecompSpec>::route_completions(
+    const void* reader_key,
+    std::vector<Completion>& completions) noexcept {
     
-    for (size_t i = 1; i < tiles.size(); ++i) {
-        const auto& tile = tiles[i];
-        
-        // Calculate gap and potential new batch size
-        size_t gap = tile.location.offset - current_end;
-        size_t new_end = tile.location.offset + tile.location.length;
-        size_t new_size = new_end - current_offset;
+    for (auto& completion : completions) {
+        auto it = routes_.find(RouteKey{reader_key, completion.id});
+        if (it == routes_.end()) {
+            continue;
+        }
         
-        // Break batch if gap is too large or size exceeds limit
-        bool break_batch = (gap > config.max_gap_size) ||
-                          (new_size > config.max_batch_size);
+        std::shared_ptr<JobState> job = std::move(it->second.job);
+        size_t batch_idx = it->second.batch_index;
+        routes_.erase(it);
         
-        if (break_batch) {
-            // Finalize current batch
-            out_batches.push_back({
-                start_idx,
-                i - start_idx,
-                current_offset,
-                current_end - current_offset
-            });
-            
-            // Start new batch
-            start_idx = i;
-            current_offset = tile.location.offset;
-            current_end = tile.location.offset + tile.location.length;
+        job->batches_in_flight--;
+        if (completion.status) {
+            if (job->planner) {
+                // Measured at reaping time, within the reap wait of the submit time
+                const auto& timing = job->read_timings[batch_idx];
+                job->planner->record(timing.size, std::chrono::steady_clock::now() - timing.submitted);
+            }
+            job->ready_batches.push_back(batch_idx);
         } else {
-            // Extend current batch
-            current_end = new_end;
+            finish_batch(job, std::move(completion.status));
+        }
+    }
+}
+
+template <typename PixelType, typename DecompSpec>
+void FastReader<PixelType, DecompSpec>::finish_batch(
+    const std::shared_ptr<JobState>& job,
+    Result<void> status) noexcept {
+    
+    if (!status) {
+        bool expected = false;
+        if (job->error_occurred.compare_exchange_strong(
+                expected, true,
+                std::memory_order_release,
+                std::memory_order_relaxed)) {
+            job->first_error = std::move(status);
         }
     }
     
-    // Finalize last batch
-    out_batches.push_back({
-        start_idx,
-        tiles.size() - start_idx,
-        current_offset,
-        current_end - current_offset
-    });
+    // Every batch is accounted for exactly once, whether it succeeded or not,
+    // so the calling thread can never wait on a batch that will not come.
+    if (--job->batches_remaining == 0) {
+        std::erase(active_jobs_, job);
+        work_cv_.notify_all();
+    }
+}
+
+template <typename PixelType, typename DecompSpec>
+BatchIoStats FastReader<PixelType, DecompSpec>::io_stats() const noexcept {
+    return BatchIoStats{
+        requests_.load(std::memory_order_relaxed),
+        bytes_read_.load(std::memory_order_relaxed),
+        bytes_needed_.load(std::memory_order_relaxed)
+    };
+}
+
+template <typename PixelType, typename DecompSpec>
+template <typename Reader, detail::TileReadPlan<PixelType> Plan>
+requires AsyncRawReader<Reader>
+BatchPlan FastReader<PixelType, DecompSpec>::plan_batches(
+    const Reader& reader,
+    const Plan& plan) const {
+    // Batches are sized to fit the registered buffers of the reader, if it has
+    // some, and on whole blocks for direct I/O readers, read in place into
+    // aligned buffers
+    size_t max_batch_size = config_.max_batch_size;
+    if constexpr (detail::PooledBufferAsyncReader<Reader>) {
+        const size_t pooled_size = reader.registered_buffer_size();
+        if (pooled_size > 0) {
+            max_batch_size = std::min(max_batch_size, pooled_size);
+        }
+    }
+    const size_t alignment = detail::io_alignment(reader);
+    if (config_.batch_planner) {
+        return config_.batch_planner->plan(plan.tiles(), alignment, max_batch_size);
+    }
+    return make_batch_plan(plan.tiles(), alignment, max_batch_size, config_.max_gap_size);
 }
 
 template <typename PixelType, typename DecompSpec>
 template <ImageLayoutSpec OutSpec, typename Reader, typename TagSpec>
-requires AsyncRawReader<Reader> && (TiledImageTagSpec<TagSpec> || StrippedImageTagSpec<TagSpec>)
+requires AsyncRawReader<Reader> && detail::IdentifiableAsyncReader<Reader> &&
+         (TiledImageTagSpec<TagSpec> || StrippedImageTagSpec<TagSpec>)
+Result<void> FastReader<PixelType, DecompSpec>::read_region(
+    const Reader& reader,
+    const ExtractedTags<TagSpec>& metadata,
+    const ImageRegion& region,
+    std::span<PixelType> output_buffer,
+    std::optional<TileCacheScope> cache_scope) noexcept {
+    
+    // Identify which tiles overlap the requested region, and how to decode them
+    ReadPlan<PixelType, OutSpec> plan;
+    auto prepare_res = plan.prepare(metadata, region);
+    if (!prepare_res) {
+        return prepare_res;
+    }
+    
+    return read_region(reader, plan, output_buffer, cache_scope);
+}
+
+template <typename PixelType, typename DecompSpec>
+template <typename Reader, ImageLayoutSpec OutSpec>
+requires AsyncRawReader<Reader> && detail::IdentifiableAsyncReader<Reader>
 Result<void> FastReader<PixelType, DecompSpec>::read_region(
+    const Reader& reader,
+    const ReadPlan<PixelType, OutSpec>& plan,
+    std::span<PixelType> output_buffer,
+    std::optional<TileCacheScope> cache_scope) noexcept {
+    return read_plan(reader, plan, output_buffer, cache_scope);
+}
+
+template <typename PixelType, typename DecompSpec>
+template <ImageLayoutSpec OutSpec, typename Reader, typename TagSpec>
+requires AsyncRawReader<Reader> && detail::IdentifiableAsyncReader<Reader> &&
+         (TiledImageTagSpec<TagSpec> || StrippedImageTagSpec<TagSpec>)
+Result<void> FastReader<PixelType, DecompSpec>::read_regions(
     const Reader& reader,
     const ExtractedTags<TagSpec>& metadata,
+    std::span<const ImageRegion> regions,
+    std::span<const std::span<PixelType>> output_buffers,
+    std::optional<TileCacheScope> cache_scope) noexcept {
+    
+    // Distinct tiles of all the regions, and the regions each one is copied to
+    MultiRegionPlan<PixelType, OutSpec> plan;
+    auto prepare_res = plan.prepare(metadata, regions);
+    if (!prepare_res) {
+        return prepare_res;
+    }
+    
+    return read_plan(reader, plan, output_buffers, cache_scope);
+}
+
+template <typename PixelType, typename DecompSpec>
+template <typename Reader, ImageLayoutSpec OutSpec>
+requires AsyncRawReader<Reader> && detail::IdentifiableAsyncReader<Reader>
+Result<void> FastReader<PixelType, DecompSpec>::read_regions(
+    const Reader& reader,
+    const MultiRegionPlan<PixelType, OutSpec>& plan,
+    std::span<const std::span<PixelType>> output_buffers,
+    std::optional<TileCacheScope> cache_scope) noexcept {
+    return read_plan(reader, plan, output_buffers, cache_scope);
+}
+
+template <typename PixelType, typename DecompSpec>
+template <ImageLayoutSpec OutSpec, typename Reader, typename TagSpec>
+requires AsyncRawReader<Reader> && detail::IdentifiableAsyncReader<Reader> &&
+         (TiledImageTagSpec<TagSpec> || StrippedImageTagSpec<TagSpec>)
+Result<void> FastReader<PixelType, DecompSpec>::read_pages(
+    const Reader& reader,
+    std::span<const ExtractedTags<TagSpec>> pages,
     const ImageRegion& region,
     std::span<PixelType> output_buffer) noexcept {
     
-    // ========================================================================
-    // Phase 1: Collect tiles and create batches
-    // ========================================================================
+    // Tiles of all the pages in file order, batched and submitted as one job
+    PageStackPlan<PixelType, OutSpec> plan;
+    auto prepare_res = plan.prepare(pages, region);
+    if (!prepare_res) {
+        return prepare_res;
+    }
     
-    std::vector<Tile> tiles;
-    auto collect_res = collect_tiles_for_region(region, metadata, tiles);
-    if (!collect_res) {
-        return collect_res;
+    return read_plan(reader, plan, output_buffer, std::nullopt);
+}
+
+template <typename PixelType, typename DecompSpec>
+template <typename Reader, ImageLayoutSpec OutSpec>
+requires AsyncRawReader<Reader> && detail::IdentifiableAsyncReader<Reader>
+Result<void> FastReader<PixelType, DecompSpec>::read_pages(
+    const Reader& reader,
+    const PageStackPlan<PixelType, OutSpec>& plan,
+    std::span<PixelType> output_buffer) noexcept {
+    return read_plan(reader, plan, output_buffer, std::nullopt);
+}
+
+template <typename PixelType, typename DecompSpec>
+template <typename Reader, detail::TileReadPlan<PixelType> Plan>
+Result<void> FastReader<PixelType, DecompSpec>::read_plan(
+    const Reader& reader,
+    const Plan& plan,
+    typename Plan::output_type output_buffer,
+    std::optional<TileCacheScope> cache_scope) noexcept {
+    
+    auto output_res = plan.validate_output(output_buffer);
+    if (!output_res) {
+        return output_res;
+    }
+    
+    if (!config_.tile_cache || !cache_scope) {
+        return read_tiles(reader, plan, output_buffer, {});
+    }
+    
+    // Cached tiles are copied before any read is submitted; only the others are batched
+    const detail::TileCacheRef<PixelType> cache{config_.tile_cache.get(), *cache_scope};
+    Plan pending;
+    auto cached_res = detail::place_cached_tiles(cache, plan, output_buffer, pending);
+    if (!cached_res) {
+        return cached_res;
     }
     
+    return read_tiles(reader, pending, output_buffer, cache);
+}
+
+template <typename PixelType, typename DecompSpec>
+template <typename Reader, detail::TileReadPlan<PixelType> Plan>
+Result<void> FastReader<PixelType, DecompSpec>::read_tiles(
+    const Reader& reader,
+    const Plan& plan,
+    typename Plan::output_type output_buffer,
+    detail::TileCacheRef<PixelType> cache) noexcept {
+    
+    // ========================================================================
+    // Phase 1: Create batches
+    // ========================================================================
+    
+    const auto& tiles = plan.tiles();
     if (tiles.empty()) {
         return Ok();
     }
     
     // Create batches for efficient I/O
-    std::vector<Batch> batches;
-    create_batches(tiles, config_, batches);
+    const BatchPlan batch_plan = plan_batches(reader, plan);
+    const std::vector<Batch>& batches = batch_plan.batches;
+    requests_.fetch_add(batches.size(), std::memory_order_relaxed);
+    bytes_read_.fetch_add(batch_plan.bytes_read, std::memory_order_relaxed);
+    bytes_needed_.fetch_add(batch_plan.bytes_needed, std::memory_order_relaxed);
     
-    // Extract compression and predictor settings
-    CompressionScheme compression = optional::extract_tag_or<TagCode::Compression, TagSpec>(
-        metadata, CompressionScheme::None
-    );
+    // ========================================================================
+    // Phase 2: Create shared job state
+    // ========================================================================
     
-    Predictor predictor = Predictor::None;
-    if constexpr (TagSpec::template has_tag<TagCode::Predictor>()) {
-        predictor = optional::extract_tag_or<TagCode::Predictor, TagSpec>(
-            metadata, Predictor::None
-        );
+    // Batches borrow registered buffers while the pool has free ones,
+    // and fall back to arena buffers otherwise
+    using BufferLease = typename detail::AsyncBufferLease<Reader>::type;
+    std::vector<BufferLease> leases(batches.size());
+    
+    std::vector<ReadContext> contexts;
+    contexts.reserve(batches.size());
+    for (size_t batch_idx = 0; batch_idx < batches.size(); ++batch_idx) {
+        const size_t size = batches[batch_idx].total_size;
+        ReadContext context{batch_idx, {}, {}};
+        if constexpr (detail::PooledBufferAsyncReader<Reader>) {
+            leases[batch_idx] = reader.acquire_buffer(size);
+            if (leases[batch_idx]) {
+                context.data = leases[batch_idx].data().subspan(0, size);
+            }
+        }
+        if (context.data.empty()) {
+            context.buffer = buffers_.acquire(size);
+            if (!context.buffer) {
+                return Err(Error::Code::MemoryError, "Failed to allocate batch buffer");
+            }
+            context.data = std::span<std::byte>(context.buffer.data(), size);
+        }
+        contexts.push_back(std::move(context));
+    }
+    
+    auto job_state = std::make_shared<JobState>();
+    job_state->reader_key = static_cast<const void*>(&reader);
+    if (config_.batch_planner) {
+        job_state->planner = config_.batch_planner.get();
+        job_state->read_timings.resize(batches.size());
     }
     
+    // The plan, batches, contexts, leases and the output all outlive the job:
+    // read_region only returns once every submitted batch is accounted for.
+    job_state->process_batch = [&](size_t batch_idx) -> Result<void> {
+        auto& context = contexts[batch_idx];
+        auto res = process_batch(
+            batches[batch_idx],
+            std::span<const std::byte>(context.data),
+            plan,
+            output_buffer,
+            cache
+        );
+        // Compressed data no longer needed: recycle the buffer
+        context.buffer.reset();
+        leases[batch_idx] = BufferLease{};
+        return res;
+    };
+    
+    job_state->reap = [&reader](std::vector<Completion>& out) {
+        // Flush reads queued by any submitter, then wait briefly for completions
+        (void)reader.submit_pending();
+        auto completions = reader.wait_completions_for(std::chrono::milliseconds(1), 0);
+        out.reserve(completions.size());
+        for (auto& [handle, result] : completions) {
+            out.push_back(Completion{
+                static_cast<uint64_t>(handle.id),
+                result ? Result<void>(Ok()) : Result<void>(result.error())
+            });
+        }
+    };
+    
     // ========================================================================
-    // Phase 2: Submit ALL async reads upfront
+    // Phase 3: Submit ALL async reads upfront
     // ========================================================================
     
-    std::vector<typename Reader::AsyncOperationHandle> handles;
-    std::vector<ReadContext> contexts;
-    handles.reserve(batches.size());
-    contexts.reserve(batches.size());
+    std::unique_lock lock(work_mutex_);
     
+    // Routes are registered under work_mutex_, so a completion reaped by any
+    // thread before registration finishes simply waits for the lock.
     for (size_t batch_idx = 0; batch_idx < batches.size(); ++batch_idx) {
         const auto& batch = batches[batch_idx];
         
-        // Allocate buffer for this batch
-        auto buffer = std::make_unique<std::byte[]>(batch.total_size);
-        std::span<std::byte> buffer_span(buffer.get(), batch.total_size);
-        
-        // Submit async read
         auto handle_res = reader.async_read_into(
-            buffer_span,
+            contexts[batch_idx].data,
             batch.file_offset,
             batch.total_size
         );
         
         if (!handle_res) {
-            return handle_res.error();
+            // Reads already submitted still target our buffers: record the
+            // error and fall through to wait for them before returning.
+            job_state->error_occurred.store(true, std::memory_order_release);
+            job_state->first_error = handle_res.error();
+            break;
         }
         
-        handles.push_back(std::move(handle_res.value()));
-        contexts.push_back(ReadContext{
-            batch_idx,
-            std::move(buffer),
-            batch.total_size
-        });
+        routes_.emplace(
+            RouteKey{job_state->reader_key, static_cast<uint64_t>(handle_res.value().id)},
+            Route{job_state, batch_idx}
+        );
+        if (job_state->planner) {
+            job_state->read_timings[batch_idx] = {std::chrono::steady_clock::now(), batch.total_size};
+        }
+        job_state->batches_in_flight++;
+        job_state->batches_remaining++;
     }
     
-    // Force submission to OS (critical for io_uring, no-op for IOCP)
-    auto submit_res = reader.submit_pending();
-    if (!submit_res) {
-        return submit_res.error();
+    if (job_state->batches_remaining == 0) {
+        return job_state->first_error;
     }
     
-    // ========================================================================
-    // Phase 3: Create shared job state
-    // ========================================================================
-    
-    auto job_state = std::make_shared<JobState>();
-    job_state->tiles_total.store(tiles.size(), std::memory_order_release);
+    active_jobs_.push_back(job_state);
+    lock.unlock();
     
-    // ========================================================================
-    // Phase 4: Main thread + workers process completions
-    // ========================================================================
+    // Force submission to OS (critical for io_uring, no-op for IOCP)
+    auto submit_res = reader.submit_pending();
     
-    // Main thread participates in processing
-    // Workers will also pick up completions if available
-    while (job_state->tiles_completed.load(std::memory_order_acquire) < tiles.size()) {
-        
-        // Check for errors (fast path)
-        if (job_state->error_occurred.load(std::memory_order_acquire)) {
-            break;
-        }
-        
-        // Process completions (main thread)
-        size_t processed = process_completions<OutSpec, Reader, TagSpec>(
-            reader,
-            job_state,
-            tiles,
-            batches,
-            contexts,
-            metadata,
-            region,
-            output_buffer,
-            compression,
-            predictor,
-            true  // is_main_thread
-        );
-        
-        // If no completions available, wait briefly before retrying
-        if (processed == 0) {
-            // Wait with timeout (allows checking for completion)
-            auto completions = reader.wait_completions_for(
-                std::chrono::milliseconds(1),
-                0  // Get all available
-            );
-            
-            // Process any completions that arrived
-            if (!completions.empty()) {
-                // Re-process with completions available
-                continue;
-            }
+    lock.lock();
+    if (!submit_res) {
+        // Queued reads are flushed again by the next reap
+        bool expected = false;
+        if (job_state->error_occurred.compare_exchange_strong(
+                expected, true,
+                std::memory_order_release,
+                std::memory_order_relaxed)) {
+            job_state->first_error = submit_res.error();
         }
     }
+    work_cv_.notify_all();
     
     // ========================================================================
-    // Phase 5: Wait for any remaining work
+    // Phase 4: Main thread + workers process completions
     // ========================================================================
     
-    // Ensure all tiles are complete
-    {
-        std::unique_lock lock(job_state->completion_mutex);
-        job_state->completion_cv.wait(lock, [&] {
-            return job_state->tiles_completed.load(std::memory_order_acquire) >= tiles.size();
-        });
-    }
-    
-    // Check for errors
-    if (job_state->error_occurred.load(std::memory_order_acquire)) {
-        std::lock_guard lock(job_state->error_mutex);
-        return job_state->first_error;
+    // The calling thread only serves its own job; workers serve all jobs.
+    // A reaper may still be inside reader.wait_completions_for() after the last
+    // batch was finished through another route, so also wait for it to leave.
+    while (job_state->batches_remaining > 0 || job_state->reaping) {
+        if (!run_one(lock, job_state.get())) {
+            work_cv_.wait(lock);
+        }
     }
     
-    return Ok();
+    return job_state->first_error;
 }
 
 template <typename PixelType, typename DecompSpec>
-template <ImageLayoutSpec OutSpec, typename Reader, typename TagSpec>
-requires AsyncRawReader<Reader> && (TiledImageTagSpec<TagSpec> || StrippedImageTagSpec<TagSpec>)
-size_t FastReader<PixelType, DecompSpec>::process_completions(
-    const Reader& reader,
-    std::shared_ptr<JobState> job_state,
-    const std::vector<Tile>& tiles,
-    const std::vector<Batch>& batches,
-    std::vector<ReadContext>& contexts,
-    const ExtractedTags<TagSpec>& metadata,
-    const ImageRegion& region,
-    std::span<PixelType> output_buffer,
-    CompressionScheme compression,
-    Predictor predictor,
-    [[maybe_unused]] bool is_main_thread) noexcept {
+template <detail::TileReadPlan<PixelType> Plan>
+Result<void> FastReader<PixelType, DecompSpec>::process_batch(
+    const Batch& batch,
+    std::span<const std::byte> batch_data,
+    const Plan& plan,
+    typename Plan::output_type output_buffer,
+    const detail::TileCacheRef<PixelType>& cache) noexcept {
     
     // Thread-local decoder (one per thread, never shared)
     thread_local TileDecoder<PixelType, DecompSpec> decoder;
+    std::span<const PixelType> decoded;
     
-    // Poll for completions (non-blocking)
-    auto completions = reader.poll_completions(0);  // Get all available
-    
-    if (completions.empty()) {
-        return 0;
-    }
-    
-    size_t tiles_processed = 0;
-    
-    for (auto& [handle, result] : completions) {
-        // Check if job already failed
-        if (job_state->error_occurred.load(std::memory_order_acquire)) {
-            break;
-        }
+    // Process each tile in this batch
+    for (size_t i = 0; i < batch.tile_count; ++i) {
+        const size_t tile_index = batch.first_tile_index + i;
+        const auto& tile = plan.tiles()[tile_index];
         
-        // Check I/O result
-        if (!result) {
-            // Record first error
-            bool expected = false;
-            if (job_state->error_occurred.compare_exchange_strong(
-                    expected, true,
-                    std::memory_order_release,
-                    std::memory_order_relaxed)) {
-                std::lock_guard lock(job_state->error_mutex);
-                job_state->first_error = result.error();
-            }
-            continue;
-        }
-        
-        // Find which batch this completion corresponds to
-        // Note: In a production implementation, you'd store the batch_idx
-        // in the handle or use a map. For now, we'll find it.
-        size_t batch_idx = 0;
-        for (size_t i = 0; i < contexts.size(); ++i) {
-            if (contexts[i].buffer != nullptr) {
-                // Match by buffer pointer (simple but effective)
-                if (result.value().data().data() == 
-                    reinterpret_cast<const std::byte*>(contexts[i].buffer.get())) {
-                    batch_idx = i;
-                    break;
-                }
-            }
-        }
-        
-        const auto& batch = batches[batch_idx];
-        const auto& batch_data = result.value().data();
-        
-        // Process each tile in this batch
-        for (size_t i = 0; i < batch.tile_count; ++i) {
-            const auto& tile = tiles[batch.first_tile_index + i];
-            
-            // Calculate tile's offset within batch
-            size_t tile_offset_in_batch = tile.location.offset - batch.file_offset;
-            
-            // Extract compressed data for this tile
-            std::span<const std::byte> compressed_data(
-                batch_data.data() + tile_offset_in_batch,
-                tile.location.length
-            );
-            
-            // Decode tile
-            auto decode_res = decoder.decode(
-                compressed_data,
-                tile.id.size.width,
-                tile.id.size.height * tile.id.size.depth,
-                compression,
-                predictor,
-                tile.id.size.nsamples
-            );
-            
-            if (!decode_res) {
-                // Record first error
-                bool expected = false;
-                if (job_state->error_occurred.compare_exchange_strong(
-                        expected, true,
-                        std::memory_order_release,
-                        std::memory_order_relaxed)) {
-                    std::lock_guard lock(job_state->error_mutex);
-                    job_state->first_error = decode_res.error();
-                }
-                break;
-            }
-            
-            // Extract to output buffer
-            auto extract_res = extract_tile_to_buffer<OutSpec, PixelType>(
-                tile,
-                region,
-                metadata,
-                decode_res.value(),
-                output_buffer
-            );
-            
-            if (!extract_res) {
-                // Record first error
-                bool expected = false;
-                if (job_state->error_occurred.compare_exchange_strong(
-                        expected, true,
-                        std::memory_order_release,
-                        std::memory_order_relaxed)) {
-                    std::lock_guard lock(job_state->error_mutex);
-                    job_state->first_error = extract_res.error();
-                }
-                break;
-            }
-            
-            tiles_processed++;
-        }
+        // Calculate tile's offset within batch
+        size_t tile_offset_in_batch = tile.location.offset - batch.file_offset;
         
-        // Update completion counter
-        size_t completed = job_state->tiles_completed.fetch_add(
-            batch.tile_count,
-            std::memory_order_acq_rel
-        ) + batch.tile_count;
+        // Extract compressed data for this tile
+        auto compressed_data = batch_data.subspan(tile_offset_in_batch, tile.location.length);
         
-        // Notify main thread if all tiles complete
-        if (completed >= job_state->tiles_total.load(std::memory_order_acquire)) {
-            job_state->completion_cv.notify_one();
+        // Decode tile into the output buffer
+        auto decode_res = plan.decode_tile(decoder, tile_index, compressed_data, output_buffer, decoded);
+        if (!decode_res) {
+            return decode_res.error();
         }
+        cache.insert(tile, decoded);
     }
     
-    return tiles_processed;
+    return Ok();
 }
 
 } // namespace tiffconcept
\ No newline at end of file
@@ -3,7 +3,14 @@
 #pragma once
 
 #include <algorithm>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
 #include <span>
+#include <thread>
+#include <utility>
 #include <vector>
 #include "../lowlevel/encoder.hpp"
 #include "../lowlevel/ifd_builder.hpp"
@@ -90,6 +97,291 @@ namespace tiffconcept {
     );
 }
 
+/// Construct with an encoding configuration
+template <
+    typename PixelType,
+    typename CompSpec,
+    typename WriteConfig_,
+    TiffFormatType TiffFormat,
+    std::endian TargetEndian
+>
+    requires ValidCompressorSpec<CompSpec> &&
+             predictor::DeltaDecodable<PixelType>
+inline ImageWriter<PixelType, CompSpec, WriteConfig_, TiffFormat, TargetEndian>::ImageWriter(Config config) noexcept
+    : config_(config) {
+    if (config_.encoder_threads == 0) {
+        config_.encoder_threads = std::max<std::size_t>(1, std::thread::hardware_concurrency());
+    }
+}
+
+/// Extract one chunk from the input buffer (with edge padding) and encode it
+template <
+    typename PixelType,
+    typename CompSpec,
+    typename WriteConfig_,
+    TiffFormatType TiffFormat,
+    std::endian TargetEndian
+>
+    requires ValidCompressorSpec<CompSpec> &&
+             predictor::DeltaDecodable<PixelType>
+template <ImageLayoutSpec InputSpec>
+inline Result<EncodedChunk> ImageWriter<PixelType, CompSpec, WriteConfig_, TiffFormat, TargetEndian>::encode_chunk(
+    EncoderType& encoder,
+    std::vector<PixelType>& tile_buffer,
+    const ChunkWriteInfo& chunk_info,
+    const EncodeParams& params) noexcept {
+    
+    const TileSize& tile = params.tile_size;
+    
+    // Calculate tile size (full tile dimensions, not actual chunk dimensions)
+    std::size_t tile_size = static_cast<std::size_t>(tile.width) * tile.height * tile.depth * tile.nsamples;
+    tile_buffer.resize(tile_size);
+
+    // TODO: tiled and strips differ for the strategy of the last tile/strip
+    // Tiles are always full size, but the height of the last strip may be less than rows_per_strip
+    // For now we assume full tiles only and have asserts for stripped images in such cases
+
+    TileCoordinates coords{
+        chunk_info.pixel_x,
+        chunk_info.pixel_y,
+        chunk_info.pixel_z,
+        chunk_info.plane
+    };
+
+    // Use fetch_tile_from_buffer to extract and pad tile data
+    if (params.planar_config == PlanarConfiguration::Planar && tile.nsamples == 1) {
+        fetch_tile_from_buffer<PlanarConfiguration::Planar, InputSpec, PixelType>(
+            params.input_data, std::span<PixelType>(tile_buffer), tile, params.image_size, coords);
+    } else {
+        fetch_tile_from_buffer<PlanarConfiguration::Chunky, InputSpec, PixelType>(
+            params.input_data, std::span<PixelType>(tile_buffer), tile, params.image_size, coords);
+    }
+    
+    // Encode chunk (use full tile dimensions for encoding)
+    return encoder.encode(
+        std::span<const PixelType>(tile_buffer),
+        chunk_info.chunk_index,
+        0,  // Tile is already extracted, so starts at 0
+        0,
+        0,
+        tile.width,
+        tile.height,
+        tile.depth,
+        chunk_info.plane,
+        params.compression,
+        params.predictor,
+        tile.nsamples,
+        TargetEndian
+    );
+}
+
+/// Write one encoded chunk at current_offset and record its location
+template <
+    typename PixelType,
+    typename CompSpec,
+    typename WriteConfig_,
+    TiffFormatType TiffFormat,
+    std::endian TargetEndian
+>
+    requires ValidCompressorSpec<CompSpec> &&
+             predictor::DeltaDecodable<PixelType>
+template <typename Writer>
+inline Result<void> ImageWriter<PixelType, CompSpec, WriteConfig_, TiffFormat, TargetEndian>::write_encoded_chunk(
+    Writer& writer,
+    BufferingStrat& buffering_strategy,
+    const EncodedChunk& encoded_chunk,
+    std::size_t& current_offset,
+    WrittenImageInfo& info) noexcept {
+    
+    // Record offset
+    info.tile_offsets[encoded_chunk.info.chunk_index] = current_offset;
+    info.tile_byte_counts[encoded_chunk.info.chunk_index] = encoded_chunk.info.compressed_size;
+    
+    // Write chunk data
+    auto write_result = buffering_strategy.write(
+        writer,
+        current_offset,
+        std::span<const std::byte>(encoded_chunk.data)
+    );
+    
+    if (write_result.is_error()) [[unlikely]] {
+        return Err(write_result.error().code, "Failed to write chunk data: " + write_result.error().message);
+    }
+    
+    current_offset += encoded_chunk.info.compressed_size;
+    return Ok();
+}
+
+/// Sequential path: encode and write chunk by chunk on the calling thread
+template <
+    typename PixelType,
+    typename CompSpec,
+    typename WriteConfig_,
+    TiffFormatType TiffFormat,
+    std::endian TargetEndian
+>
+    requires ValidCompressorSpec<CompSpec> &&
+             predictor::DeltaDecodable<PixelType>
+template <ImageLayoutSpec InputSpec, typename Writer>
+inline Result<void> ImageWriter<PixelType, CompSpec, WriteConfig_, TiffFormat, TargetEndian>::encode_and_write_sequential(
+    Writer& writer,
+    BufferingStrat& buffering_strategy,
+    std::span<const ChunkWriteInfo> chunks,
+    const EncodeParams& params,
+    std::size_t& current_offset,
+    WrittenImageInfo& info) noexcept {
+    
+    std::vector<PixelType> tile_buffer;  // Reused for extracting tile data
+    
+    for (const auto& chunk_info : chunks) {
+        auto encoded_result = encode_chunk<InputSpec>(encoder_, tile_buffer, chunk_info, params);
+        if (encoded_result.is_error()) [[unlikely]] {
+            return encoded_result.error();
+        }
+        
+        auto write_result = write_encoded_chunk(
+            writer, buffering_strategy, encoded_result.value(), current_offset, info);
+        if (write_result.is_error()) [[unlikely]] {
+            return write_result;
+        }
+    }
+    
+    return Ok();
+}
+
+/// Parallel path: workers encode chunks out of order, the calling thread
+/// writes them strictly in the order chosen by the tile ordering strategy.
+///
+/// Chunks are handed out by position in the ordered chunk list. A worker may
+/// only start position p once p < next_to_write + window, so at most `window`
+/// encoded chunks are held in memory at any time. Encoded chunks are parked
+/// in a ring of `window` slots until the writer reaches them.
+template <
+    typename PixelType,
+    typename CompSpec,
+    typename WriteConfig_,
+    TiffFormatType TiffFormat,
+    std::endian TargetEndian
+>
+    requires ValidCompressorSpec<CompSpec> &&
+             predictor::DeltaDecodable<PixelType>
+template <ImageLayoutSpec InputSpec, typename Writer>
+inline Result<void> ImageWriter<PixelType, CompSpec, WriteConfig_, TiffFormat, TargetEndian>::encode_and_write_parallel(
+    Writer& writer,
+    BufferingStrat& buffering_strategy,
+    std::span<const ChunkWriteInfo> chunks,
+    const EncodeParams& params,
+    std::size_t num_threads,
+    std::size_t& current_offset,
+    WrittenImageInfo& info) noexcept {
+    
+    const std::size_t window = config_.max_chunks_in_flight > 0
+        ? config_.max_chunks_in_flight
+        : 4 * num_threads;
+    
+    // Shared state (protected by mutex)
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::vector<std::optional<EncodedChunk>> slots;
+    std::size_t next_to_encode = 0;
+    std::size_t next_to_write = 0;
+    bool failed = false;
+    Result<void> first_error = Ok();
+    
+    auto record_error = [&](Result<void> error) {
+        // mutex held by caller
+        if (!failed) {
+            failed = true;
+            first_error = std::move(error);
+        }
+        cv.notify_all();
+    };
+    
+    auto worker = [&](EncoderType& encoder) {
+        std::vector<PixelType> tile_buffer;  // Per-worker extraction buffer
+        std::unique_lock lock(mutex);
+        while (true) {
+            cv.wait(lock, [&] {
+                return failed ||
+                       next_to_encode >= chunks.size() ||
+                       next_to_encode < next_to_write + window;
+            });
+            if (failed || next_to_encode >= chunks.size()) {
+                return;
+            }
+            
+            std::size_t position = next_to_encode++;
+            lock.unlock();
+            
+            auto encoded_result = encode_chunk<InputSpec>(encoder, tile_buffer, chunks[position], params);
+            
+            lock.lock();
+            if (encoded_result.is_error()) [[unlikely]] {
+                record_error(encoded_result.error());
+                return;
+            }
+            slots[position % window] = std::move(encoded_result.value());
+            cv.notify_all();
+        }
+    };
+    
+    // Setup may fail (allocation, thread creation). Nothing has been written
+    // yet: stop the workers already started and encode on the calling thread.
+    std::vector<std::thread> threads;
+    try {
+        // One encoder per worker, kept across calls to reuse scratch buffers
+        while (worker_encoders_.size() < num_threads) {
+            worker_encoders_.push_back(std::make_unique<EncoderType>());
+        }
+        slots.resize(window);
+        threads.reserve(num_threads);
+        for (std::size_t i = 0; i < num_threads; ++i) {
+            threads.emplace_back(worker, std::ref(*worker_encoders_[i]));
+        }
+    } catch (...) {
+        {
+            std::lock_guard lock(mutex);
+            failed = true;
+        }
+        cv.notify_all();
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        return encode_and_write_sequential<InputSpec>(
+            writer, buffering_strategy, chunks, params, current_offset, info);
+    }
+    
+    // Calling thread: write chunks in order as they become available
+    for (std::size_t position = 0; position < chunks.size(); ++position) {
+        std::optional<EncodedChunk> encoded_chunk;
+        {
+            std::unique_lock lock(mutex);
+            cv.wait(lock, [&] { return failed || slots[position % window].has_value(); });
+            if (failed) {
+                break;
+            }
+            encoded_chunk = std::move(slots[position % window]);
+            slots[position % window].reset();
+            next_to_write = position + 1;
+        }
+        cv.notify_all();  // A slot was freed
+        
+        auto write_result = write_encoded_chunk(
+            writer, buffering_strategy, *encoded_chunk, current_offset, info);
+        if (write_result.is_error()) [[unlikely]] {
+            std::lock_guard lock(mutex);
+            record_error(std::move(write_result));
+            break;
+        }
+    }
+    
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    
+    return first_error;
+}
+
 /// Image writer - coordinates encoding and writing of image data
 /// Uses configurable write strategies for flexible layout control
 template <
@@ -141,122 +433,46 @@ inline Result<WrittenImageInfo> ImageWriter<PixelType, CompSpec, WriteConfig_, T
     // Apply tile ordering strategy
     ordering_strategy_.order_chunks(std::span<ChunkWriteInfo>(layout.chunks));
     
-    // Encode all chunks
-    std::vector<EncodedChunk> encoded_chunks;
-    encoded_chunks.reserve(layout.chunks.size());
-    
-    std::vector<PixelType> tile_buffer;  // Reused for extracting tile data
-    
     uint16_t effective_samples = (planar_config == PlanarConfiguration::Planar) ? 1 : samples_per_pixel;
     
-    for (const auto& chunk_info : layout.chunks) {
-        // Calculate tile size (full tile dimensions, not actual chunk dimensions)
-        std::size_t tile_size = static_cast<std::size_t>(tile_width) * tile_height * tile_depth * effective_samples;
-        tile_buffer.resize(tile_size);
-
-
-        // TODO: tiled and strips differ for the strategy of the last tile/strip
-        // Tiles are always full size, but the height of the last strip may be less than rows_per_strip
-        // For now we assume full tiles only and have asserts for stripped images in such cases
-
-        // Use fetch_tile_from_buffer to extract and pad tile data
-        if (planar_config == PlanarConfiguration::Planar && effective_samples == 1) {
-            fetch_tile_from_buffer<PlanarConfiguration::Planar, InputSpec, PixelType>(
-                input_data,
-                std::span<PixelType>(tile_buffer),
-                TileSize{
-                    tile_width,
-                    tile_height,
-                    tile_depth,
-                    effective_samples
-                },
-                TileSize{
-                    image_width,
-                    image_height,
-                    image_depth,
-                    samples_per_pixel
-                },
-                TileCoordinates{
-                    chunk_info.pixel_x,
-                    chunk_info.pixel_y,
-                    chunk_info.pixel_z,
-                    chunk_info.plane
-                }
-            );
-        } else {
-            fetch_tile_from_buffer<PlanarConfiguration::Chunky, InputSpec, PixelType>(
-                input_data,
-                std::span<PixelType>(tile_buffer),
-                TileSize{
-                    tile_width,
-                    tile_height,
-                    tile_depth,
-                    effective_samples
-                },
-                TileSize{
-                    image_width,
-                    image_height,
-                    image_depth,
-                    samples_per_pixel
-                },
-                TileCoordinates{
-                    chunk_info.pixel_x,
-                    chunk_info.pixel_y,
-                    chunk_info.pixel_z,
-                    chunk_info.plane
-                }
-            );
-        }
-        
-        // Encode chunk (use actual chunk dimensions for encoding)
-        auto encoded_result = encoder_.encode(
-            std::span<const PixelType>(tile_buffer),
-            chunk_info.chunk_index,
-            0,  // Tile is already extracted, so starts at 0
-            0,
-            0,
-            tile_width,   // Use full tile dimensions
-            tile_height,
-            tile_depth,
-            chunk_info.plane,
-            compression,
-            predictor,
-            effective_samples
-        );
-        
-        if (encoded_result.is_error()) [[unlikely]] {
-            return encoded_result.error();
-        }
-        
-        encoded_chunks.push_back(std::move(encoded_result.value()));
-    }
+    EncodeParams params{
+        input_data,
+        TileSize{tile_width, tile_height, tile_depth, effective_samples},
+        TileSize{image_width, image_height, image_depth, samples_per_pixel},
+        planar_config,
+        compression,
+        predictor
+    };
     
-    // Write chunks to file using buffering strategy
+    // Encode and write chunks using buffering strategy.
+    // Each chunk is written as soon as it is encoded (and its predecessors
+    // in file order are written), so memory stays bounded.
     BufferingStrat buffering_strategy;
     std::size_t current_offset = data_start_offset;
     
     WrittenImageInfo info;
-    info.tile_offsets.resize(encoded_chunks.size());
-    info.tile_byte_counts.resize(encoded_chunks.size());
+    info.tile_offsets.resize(layout.chunks.size());
+    info.tile_byte_counts.resize(layout.chunks.size());
     info.image_data_start_offset = data_start_offset;
     
-    for (auto& encoded_chunk : encoded_chunks) {
-        // Record offset
-        info.tile_offsets[encoded_chunk.info.chunk_index] = current_offset;
-        info.tile_byte_counts[encoded_chunk.info.chunk_index] = encoded_chunk.info.compressed_size;
-        
-        // Write chunk data
-        auto write_result = buffering_strategy.write(
-            writer,
-            current_offset,
-            std::span<const std::byte>(encoded_chunk.data)
-        );
-        
-        if (write_result.is_error()) [[unlikely]] {
-            return Err(write_result.error().code, "Failed to write chunk data: " + write_result.error().message);
+    std::size_t num_threads = std::min<std::size_t>(config_.encoder_threads, layout.chunks.size());
+    
+    Result<void> encode_result = Ok();
+    if constexpr (TileOrdering::supports_parallel_encoding) {
+        if (num_threads > 1) {
+            encode_result = encode_and_write_parallel<InputSpec>(
+                writer, buffering_strategy, layout.chunks, params, num_threads, current_offset, info);
+        } else {
+            encode_result = encode_and_write_sequential<InputSpec>(
+                writer, buffering_strategy, layout.chunks, params, current_offset, info);
         }
-        
-        current_offset += encoded_chunk.info.compressed_size;
+    } else {
+        encode_result = encode_and_write_sequential<InputSpec>(
+            writer, buffering_strategy, layout.chunks, params, current_offset, info);
+    }
+    
+    if (encode_result.is_error()) [[unlikely]] {
+        return encode_result.error();
     }
     
     // Flush buffered data
@@ -315,6 +531,67 @@ inline Result<WrittenImageInfo> ImageWriter<PixelType, CompSpec, WriteConfig_, T
     );
 }
 
+/// Encode and write a single chunk supplied in tile layout
+template <
+    typename PixelType,
+    typename CompSpec,
+    typename WriteConfig_,
+    TiffFormatType TiffFormat,
+    std::endian TargetEndian
+>
+    requires ValidCompressorSpec<CompSpec> &&
+             predictor::DeltaDecodable<PixelType>
+template <typename Writer>
+    requires RawWriter<Writer>
+inline Result<std::size_t> ImageWriter<PixelType, CompSpec, WriteConfig_, TiffFormat, TargetEndian>::write_chunk(
+    Writer& writer,
+    BufferingStrat& buffering_strategy,
+    std::span<const PixelType> chunk_data,
+    uint32_t chunk_index,
+    TileSize tile_size,
+    uint16_t plane,
+    CompressionScheme compression,
+    Predictor predictor,
+    std::size_t file_offset) noexcept {
+
+    std::size_t expected_samples = static_cast<std::size_t>(tile_size.width) * tile_size.height *
+                                   tile_size.depth * tile_size.nsamples;
+    if (chunk_data.size() < expected_samples) [[unlikely]] {
+        return Err(Error::Code::OutOfBounds, "Chunk data size too small for tile dimensions");
+    }
+
+    auto encoded_result = encoder_.encode(
+        chunk_data.subspan(0, expected_samples),
+        chunk_index,
+        0,
+        0,
+        0,
+        tile_size.width,
+        tile_size.height,
+        tile_size.depth,
+        plane,
+        compression,
+        predictor,
+        tile_size.nsamples,
+        TargetEndian
+    );
+    if (encoded_result.is_error()) [[unlikely]] {
+        return encoded_result.error();
+    }
+
+    const EncodedChunk& encoded_chunk = encoded_result.value();
+    auto write_result = buffering_strategy.write(
+        writer,
+        file_offset,
+        std::span<const std::byte>(encoded_chunk.data)
+    );
+    if (write_result.is_error()) [[unlikely]] {
+        return Err(write_result.error().code, "Failed to write chunk data: " + write_result.error().message);
+    }
+
+    return Ok(encoded_chunk.info.compressed_size);
+}
+
 /// Clear encoder state (for memory management)
 template <
     typename PixelType,
@@ -327,6 +604,7 @@ template <
              predictor::DeltaDecodable<PixelType>
 inline void ImageWriter<PixelType, CompSpec, WriteConfig_, TiffFormat, TargetEndian>::clear() noexcept {
     encoder_.clear();
+    worker_encoders_.clear();
 }
 
 } // namespace tiffconcept
@@ -0,0 +1,329 @@
+#pragma once
+
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <span>
+#include <string>
+#include <system_error>
+#include <unordered_set>
+#include <vector>
+#include "../ifd.hpp"
+#include "../types/result.hpp"
+#include "../types/tiff_spec.hpp"
+
+#ifndef TIFFCONCEPT_PAGE_INDEX_HEADER
+#include "../page_index.hpp" // for linters
+#endif
+
+namespace tiffconcept {
+
+namespace page_index_impl {
+
+// Binary layout (little-endian):
+//   magic "TCPI" | version u16 | format u8 (42 Classic, 43 BigTIFF) | byte order u8 ('I', 'M')
+//   file size u64 | mtime_ns i64 | page count u64
+//   page count x (IFD offset u64 | entry count u64)
+//   FNV-1a 64 checksum of all the preceding bytes u64
+inline constexpr char magic[4] = {'T', 'C', 'P', 'I'};
+inline constexpr uint16_t version = 1;
+inline constexpr std::size_t header_size = 32;
+inline constexpr std::size_t entry_size = 16;
+inline constexpr std::size_t checksum_size = 8;
+
+template <typename T>
+void put(std::byte* dst, T value) noexcept {
+    convert_endianness<T, std::endian::native, std::endian::little>(value);
+    std::memcpy(dst, &value, sizeof(T));
+}
+
+template <typename T>
+[[nodiscard]] T get(const std::byte* src) noexcept {
+    T value;
+    std::memcpy(&value, src, sizeof(T));
+    convert_endianness<T, std::endian::little, std::endian::native>(value);
+    return value;
+}
+
+[[nodiscard]] inline uint64_t checksum(std::span<const std::byte> data) noexcept {
+    uint64_t h = 0xCBF29CE484222325ull;
+    for (std::byte b : data) {
+        h ^= static_cast<uint64_t>(b);
+        h *= 0x100000001B3ull;
+    }
+    return h;
+}
+
+/// Create a temporary file next to path with a name no other writer uses
+/// (random suffix, exclusive creation; retried on a name collision)
+/// @param temp_path Output, the created file
+/// @return The open file, nullptr on failure
+[[nodiscard]] inline std::FILE* create_temp_file(const std::filesystem::path& path,
+                                                 std::filesystem::path& temp_path) noexcept {
+    static std::atomic<uint64_t> counter{0};
+    uint64_t seed = static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+    try {
+        std::random_device device;
+        seed ^= (static_cast<uint64_t>(device()) << 32) | device();
+    } catch (...) {
+        // The clock and the counter still separate concurrent writers
+    }
+    for (int attempt = 0; attempt < 16; ++attempt) {
+        // splitmix64 of the seed and a process-wide counter
+        uint64_t z = seed + counter.fetch_add(1, std::memory_order_relaxed) * 0x9E3779B97F4A7C15ull;
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        z ^= z >> 31;
+        char suffix[24];
+        std::snprintf(suffix, sizeof(suffix), ".%016llx.tmp", static_cast<unsigned long long>(z));
+        try {
+            temp_path = path;
+            temp_path += suffix;
+        } catch (...) {
+            return nullptr;
+        }
+#if defined(_WIN32) || defined(_WIN64)
+        std::FILE* file = _wfopen(temp_path.c_str(), L"wbx");
+#else
+        std::FILE* file = std::fopen(temp_path.c_str(), "wbx");
+#endif
+        if (file != nullptr) {
+            return file;
+        }
+        std::error_code ec;
+        if (!std::filesystem::exists(temp_path, ec)) {
+            return nullptr; // Not a collision (e.g. unwritable directory)
+        }
+    }
+    return nullptr;
+}
+
+} // namespace page_index_impl
+
+// ============================================================================
+// FileStamp Implementation
+// ============================================================================
+
+inline Result<FileStamp> FileStamp::of(const std::filesystem::path& path) noexcept {
+    std::error_code ec;
+    const auto size = std::filesystem::file_size(path, ec);
+    if (ec) {
+        return Err(Error::Code::FileNotFound, "Cannot get the size of " + path.string() + ": " + ec.message());
+    }
+    const auto mtime = std::filesystem::last_write_time(path, ec);
+    if (ec) {
+        return Err(Error::Code::FileNotFound, "Cannot get the write time of " + path.string() + ": " + ec.message());
+    }
+    const auto mtime_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(mtime.time_since_epoch()).count();
+    return Ok(FileStamp{static_cast<uint64_t>(size), static_cast<int64_t>(mtime_ns)});
+}
+
+// ============================================================================
+// PageIndex Implementation
+// ============================================================================
+
+template <RawReader Reader, TiffFormatType TiffFormat, std::endian SourceEndian>
+Result<PageIndex> PageIndex::build(
+    const Reader& reader,
+    FileStamp stamp,
+    std::size_t speculative_read_size) noexcept
+{
+    auto first_offset = ifd::get_first_ifd_offset<Reader, TiffFormat, SourceEndian>(reader);
+    if (!first_offset) [[unlikely]] {
+        return first_offset.error();
+    }
+
+    PageIndex index;
+    index.format_ = TiffFormat;
+    index.byte_order_ = SourceEndian;
+    index.stamp_ = stamp;
+
+    // One IFD read per page (a single request with a speculative window)
+    std::unordered_set<std::size_t> visited;
+    ifd::IFD<TiffFormat, SourceEndian> current_ifd;
+    ifd::IFDOffset current = first_offset.value();
+    while (current) {
+        if (!visited.insert(current.value).second) [[unlikely]] {
+            return Err(Error::Code::InvalidFormat,
+                       "IFD chain loops back to offset " + std::to_string(current.value));
+        }
+        auto res = ifd::read_ifd_into<Reader, TiffFormat, SourceEndian>(reader, current, current_ifd, speculative_read_size);
+        if (!res) [[unlikely]] {
+            return res.error();
+        }
+        index.offsets_.push_back(current);
+        index.num_entries_.push_back(static_cast<uint64_t>(current_ifd.description.num_entries));
+        current = current_ifd.next_ifd_offset;
+    }
+    return Ok(std::move(index));
+}
+
+template <RawReader Reader, TiffFormatType TiffFormat, std::endian SourceEndian>
+Result<PageIndex> PageIndex::open(
+    const Reader& reader,
+    const std::filesystem::path& path,
+    std::size_t speculative_read_size) noexcept
+{
+    auto stamp = FileStamp::of(path);
+    if (!stamp) [[unlikely]] {
+        return stamp.error();
+    }
+
+    const auto sidecar = sidecar_path(path);
+    if (auto loaded = load(sidecar, stamp.value());
+        loaded && loaded.value().format() == TiffFormat && loaded.value().byte_order() == SourceEndian) {
+        return loaded;
+    }
+
+    auto built = build<Reader, TiffFormat, SourceEndian>(reader, stamp.value(), speculative_read_size);
+    if (built) {
+        // Best effort: the index is valid without its sidecar
+        [[maybe_unused]] auto saved = built.value().save(sidecar);
+    }
+    return built;
+}
+
+inline Result<PageIndexEntry> PageIndex::page(std::size_t page) const noexcept {
+    if (page >= offsets_.size()) [[unlikely]] {
+        return Err(Error::Code::InvalidPageIndex,
+                   "Page " + std::to_string(page) + " out of range (" + std::to_string(offsets_.size()) + " pages)");
+    }
+    const ifd::IFDOffset next = page + 1 < offsets_.size() ? offsets_[page + 1] : ifd::IFDOffset();
+    return Ok(PageIndexEntry{offsets_[page], num_entries_[page], next});
+}
+
+inline std::vector<std::byte> PageIndex::serialize() const {
+    using namespace page_index_impl;
+
+    std::vector<std::byte> data(header_size + offsets_.size() * entry_size + checksum_size);
+    std::byte* p = data.data();
+    std::memcpy(p, magic, sizeof(magic));
+    put<uint16_t>(p + 4, version);
+    put<uint8_t>(p + 6, format_ == TiffFormatType::Classic ? 42 : 43);
+    put<uint8_t>(p + 7, byte_order_ == std::endian::little ? 'I' : 'M');
+    put<uint64_t>(p + 8, stamp_.size);
+    put<int64_t>(p + 16, stamp_.mtime_ns);
+    put<uint64_t>(p + 24, offsets_.size());
+    p += header_size;
+    for (std::size_t i = 0; i < offsets_.size(); ++i, p += entry_size) {
+        put<uint64_t>(p, offsets_[i].value);
+        put<uint64_t>(p + 8, num_entries_[i]);
+    }
+    put<uint64_t>(p, checksum(std::span<const std::byte>(data.data(), p - data.data())));
+    return data;
+}
+
+inline Result<PageIndex> PageIndex::deserialize(std::span<const std::byte> data, const FileStamp& expected) noexcept {
+    using namespace page_index_impl;
+
+    if (data.size() < header_size + checksum_size || std::memcmp(data.data(), magic, sizeof(magic)) != 0) [[unlikely]] {
+        return Err(Error::Code::InvalidHeader, "Not a page index");
+    }
+    const std::byte* p = data.data();
+    if (get<uint16_t>(p + 4) != version) [[unlikely]] {
+        return Err(Error::Code::InvalidHeader, "Unsupported page index version " + std::to_string(get<uint16_t>(p + 4)));
+    }
+
+    const uint64_t num_pages = get<uint64_t>(p + 24);
+    if (num_pages > (data.size() - header_size - checksum_size) / entry_size
+        || data.size() != header_size + num_pages * entry_size + checksum_size) [[unlikely]] {
+        return Err(Error::Code::InvalidFormat, "Page index size does not match its page count");
+    }
+    const std::size_t body_size = data.size() - checksum_size;
+    if (get<uint64_t>(p + body_size) != checksum(data.first(body_size))) [[unlikely]] {
+        return Err(Error::Code::InvalidFormat, "Page index checksum mismatch");
+    }
+
+    const uint8_t format = get<uint8_t>(p + 6);
+    const uint8_t byte_order = get<uint8_t>(p + 7);
+    if ((format != 42 && format != 43) || (byte_order != 'I' && byte_order != 'M')) [[unlikely]] {
+        return Err(Error::Code::InvalidFormat, "Invalid page index format");
+    }
+
+    const FileStamp stamp{get<uint64_t>(p + 8), get<int64_t>(p + 16)};
+    if (stamp != expected) {
+        return Err(Error::Code::InvalidOperation, "Page index is stale (file size or modification time changed)");
+    }
+
+    PageIndex index;
+    index.format_ = format == 42 ? TiffFormatType::Classic : TiffFormatType::BigTIFF;
+    index.byte_order_ = byte_order == 'I' ? std::endian::little : std::endian::big;
+    index.stamp_ = stamp;
+    try {
+        index.offsets_.reserve(num_pages);
+        index.num_entries_.reserve(num_pages);
+    } catch (...) {
+        return Err(Error::Code::MemoryError, "Failed to allocate page index");
+    }
+    p += header_size;
+    for (uint64_t i = 0; i < num_pages; ++i, p += entry_size) {
+        index.offsets_.emplace_back(static_cast<std::size_t>(get<uint64_t>(p)));
+        index.num_entries_.push_back(get<uint64_t>(p + 8));
+    }
+    return Ok(std::move(index));
+}
+
+inline Result<void> PageIndex::save(const std::filesystem::path& path) const noexcept {
+    std::vector<std::byte> data;
+    try {
+        data = serialize();
+    } catch (...) {
+        return Err(Error::Code::MemoryError, "Failed to serialize page index");
+    }
+
+    // Readers of the sidecar never see a partially written file, and each
+    // writer has its own temporary file (several processes may open the
+    // same TIFF at once)
+    std::filesystem::path temp_path;
+    std::FILE* file = page_index_impl::create_temp_file(path, temp_path);
+    if (file == nullptr) {
+        return Err(Error::Code::WriteError, "Failed to create a temporary file for page index " + path.string());
+    }
+    const bool written = std::fwrite(data.data(), 1, data.size(), file) == data.size();
+    const bool closed = std::fclose(file) == 0;
+    std::error_code ec;
+    if (!written || !closed) {
+        std::filesystem::remove(temp_path, ec);
+        return Err(Error::Code::WriteError, "Failed to write page index " + temp_path.string());
+    }
+    std::filesystem::rename(temp_path, path, ec);
+    if (ec) {
+        std::filesystem::remove(temp_path, ec);
+        return Err(Error::Code::WriteError, "Failed to replace page index " + path.string());
+    }
+    return Ok();
+}
+
+inline Result<PageIndex> PageIndex::load(const std::filesystem::path& path, const FileStamp& expected) noexcept {
+    std::ifstream in(path, std::ios::binary | std::ios::ate);
+    if (!in) {
+        return Err(Error::Code::FileNotFound, "Cannot open page index " + path.string());
+    }
+    const auto size = static_cast<std::size_t>(in.tellg());
+    std::vector<std::byte> data;
+    try {
+        data.resize(size);
+    } catch (...) {
+        return Err(Error::Code::MemoryError, "Failed to allocate page index");
+    }
+    in.seekg(0);
+    if (!in.read(reinterpret_cast<char*>(data.data()), static_cast<std::streamsize>(size))) {
+        return Err(Error::Code::ReadError, "Failed to read page index " + path.string());
+    }
+    return deserialize(data, expected);
+}
+
+inline std::filesystem::path PageIndex::sidecar_path(const std::filesystem::path& path) {
+    auto sidecar = path;
+    sidecar += ".pidx";
+    return sidecar;
+}
+
+} // namespace tiffconcept
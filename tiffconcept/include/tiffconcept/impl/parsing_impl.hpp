@@ -3,10 +3,13 @@
 #include <array>
 #include <bit>
 #include <cstring>
+#include <memory>
 #include <span>
 #include <vector>
+#include "../lowlevel/byteswap.hpp"
 #include "../types/result.hpp"
 #include "../reader_base.hpp"
+#include "../types/tag_array_view.hpp"
 #include "../types/tag_spec.hpp"
 #include "../types/tiff_spec.hpp"
 
@@ -69,10 +72,14 @@ inline Result<void> read_array_into(const Reader& reader, std::size_t offset, st
 
     std::memcpy(output.data(), view.data().data(), total_size);
     
-    // Convert endianness for each element
+    // Convert endianness (vectorized for plain numbers)
     if constexpr (SourceEndian != TargetEndian) {
-        for (auto& val : output) {
-            convert_endianness<T, SourceEndian, TargetEndian>(val);
+        if constexpr (ByteSwappable<T>) {
+            byteswap_array(output);
+        } else {
+            for (auto& val : output) {
+                convert_endianness<T, SourceEndian, TargetEndian>(val);
+            }
         }
     }
     
@@ -648,6 +655,70 @@ template <typename TagDesc>
 }
 
 
+/// Parse an integer array into a TagArrayView sharing the read data (no copy, decoded on access)
+template <typename TagDesc, typename Reader, TiffFormatType TiffFormat, std::endian SourceEndian, std::endian TargetEndian>
+inline Result<typename TagDesc::value_type> parse_array_view(
+    const TagType<TiffFormat, SourceEndian>& tag,
+    const Reader& reader) noexcept 
+    requires RawReader<Reader>
+{
+    using ViewType = typename TagDesc::value_type;
+    const std::size_t tag_count = static_cast<std::size_t>(tag.template get_count<std::endian::native>());
+    const TiffDataType tag_datatype = tag.template get_datatype<std::endian::native>();
+    constexpr bool byteswap = SourceEndian != TargetEndian;
+
+    // Any accepted integer type is decoded on access: no promotion
+    if (tag.template get_code<std::endian::native>() != static_cast<uint16_t>(TagDesc::code)) [[unlikely]] {
+        return Err(Error::Code::InvalidTag, 
+                   "Tag code mismatch: expected " + 
+                   std::to_string(static_cast<uint16_t>(TagDesc::code)) +
+                   ", got " + std::to_string(tag.template get_code<std::endian::native>()));
+    }
+    if (tag_datatype != TagDesc::datatype && !is_alternate_type<TagDesc>(tag_datatype)) [[unlikely]] {
+        return Err(Error::Code::InvalidTagType,
+                   "Tag " + std::to_string(tag.template get_code<std::endian::native>()) + 
+                   " has unsupported datatype " + 
+                   std::to_string(static_cast<uint16_t>(tag_datatype)));
+    }
+
+    const std::size_t element_size = tiffconcept::detail::tag_array_view_element_size(tag_datatype);
+    if (element_size == 0 || element_size > sizeof(typename ViewType::value_type)) [[unlikely]] {
+        return Err(Error::Code::InvalidTagType,
+                   "Tag " + std::to_string(tag.template get_code<std::endian::native>()) +
+                   " has datatype " + std::to_string(static_cast<uint16_t>(tag_datatype)) +
+                   ", which cannot be viewed as an array of " + std::to_string(sizeof(typename ViewType::value_type)) +
+                   "-byte integers");
+    }
+    if (tag_count == 0) {
+        return Ok(ViewType{});
+    }
+
+    const std::size_t data_size = tag_count * element_size;
+    try {
+        if (data_size <= tag.inline_bytecount_limit()) {
+            // The tag entry does not outlive the IFD: keep a copy of its value
+            auto inline_data = std::make_shared<std::array<std::byte, sizeof(tag.value)>>();
+            std::memcpy(inline_data->data(), &tag.value, sizeof(tag.value));
+            const std::span<const std::byte> data(inline_data->data(), data_size);
+            return Ok(ViewType(std::move(inline_data), data, element_size, byteswap));
+        }
+
+        auto read_result = reader.read(tag.template get_offset<std::endian::native>(), data_size);
+        if (read_result.is_error()) [[unlikely]] {
+            return Err(read_result.error().code, "Failed to read tag array value: " + read_result.error().message);
+        }
+        if (read_result.value().size() < data_size) [[unlikely]] {
+            return Err(Error::Code::UnexpectedEndOfFile, "Incomplete tag array value");
+        }
+        // The array owns the reader's view: a shared mapping, or the buffer the data was read into
+        auto view = std::make_shared<typename Reader::ReadViewType>(std::move(read_result.value()));
+        const std::span<const std::byte> data = view->data().first(data_size);
+        return Ok(ViewType(std::move(view), data, element_size, byteswap));
+    } catch (...) {
+        return Err(Error::Code::MemoryError, "Failed to allocate tag array view");
+    }
+}
+
 // Forward declaration for type promotion helper
 template <typename TagDesc, typename Reader, TiffFormatType TiffFormat, std::endian SourceEndian, std::endian TargetEndian>
 inline Result<typename TagDesc::value_type> do_type_promotion(
@@ -843,7 +914,11 @@ inline Result<typename TagDesc::value_type> do_type_promotion(
 
 template <RawReader Reader, typename TagDesc, TiffFormatType TiffFormat, std::endian TargetEndian, std::endian SourceEndian>
 inline Result<typename TagDesc::value_type> parse_tag(const Reader& reader, const TagType<TiffFormat, SourceEndian>& tag) noexcept {
-    return detail::parse_tag_value_with_promotion<TagDesc, Reader, TiffFormat, SourceEndian, TargetEndian>(tag, reader);
+    if constexpr (tiffconcept::detail::is_tag_array_view_v<typename TagDesc::value_type>) {
+        return detail::parse_array_view<TagDesc, Reader, TiffFormat, SourceEndian, TargetEndian>(tag, reader);
+    } else {
+        return detail::parse_tag_value_with_promotion<TagDesc, Reader, TiffFormat, SourceEndian, TargetEndian>(tag, reader);
+    }
 }
 
 } // namespace parsing
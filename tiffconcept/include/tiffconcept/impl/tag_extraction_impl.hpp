@@ -3,6 +3,10 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
+#include <cstring>
+#include <memory>
+#include <optional>
 #include <tuple>
 #include <utility>
 #include "../ifd.hpp"
@@ -51,6 +55,174 @@ template <typename... Tags, typename Storage>
     return all_optional;
 }
 
+/// RawReader serving the out-of-line data of the tags of an IFD from a few
+/// coalesced reads issued upfront (prefetch()), instead of one read per tag.
+/// Reads outside the prefetched ranges go to the underlying reader.
+/// MaxRanges bounds the number of tags prefetched (the size of the TagSpec).
+template <RawReader Reader, std::size_t MaxRanges>
+class PrefetchedTagReader {
+public:
+    using InnerView = typename Reader::ReadViewType;
+
+    class ReadViewType {
+    public:
+        ReadViewType() noexcept = default;
+        ReadViewType(std::span<const std::byte> data, std::shared_ptr<const InnerView> owner) noexcept
+            : data_(data), owner_(std::move(owner)) {}
+        explicit ReadViewType(InnerView&& inner) noexcept : inner_(std::move(inner)) {}
+
+        [[nodiscard]] std::span<const std::byte> data() const noexcept {
+            return inner_ ? inner_->data() : data_;
+        }
+        [[nodiscard]] std::size_t size() const noexcept { return data().size(); }
+        [[nodiscard]] bool empty() const noexcept { return data().empty(); }
+
+    private:
+        std::span<const std::byte> data_;
+        std::shared_ptr<const InnerView> owner_; // Prefetched read the data belongs to
+        std::optional<InnerView> inner_;
+    };
+
+    static constexpr bool read_must_allocate = Reader::read_must_allocate;
+
+    /// Gaps of up to this many bytes between tag data are read through
+    /// rather than split into separate requests
+    static constexpr std::size_t max_gap = 4096;
+
+    explicit PrefetchedTagReader(const Reader& reader) noexcept : reader_(reader) {}
+
+    /// Read the out-of-line data of the file tags listed in Tags, merging
+    /// ranges that overlap or are at most max_gap bytes apart.
+    /// Failures are not reported: the tags concerned are then read (and
+    /// their errors reported) one by one when parsed.
+    template <TiffFormatType TiffFormat, std::endian SourceEndian, typename... Tags>
+    void prefetch(std::span<const parsing::TagType<TiffFormat, SourceEndian>> file_tags) noexcept {
+        static_assert(sizeof...(Tags) <= MaxRanges);
+        constexpr std::array<uint16_t, sizeof...(Tags)> codes{static_cast<uint16_t>(Tags::code)...};
+
+        auto file_size = reader_.size();
+        if (!file_size) [[unlikely]] {
+            return;
+        }
+
+        std::array<Range, MaxRanges> wanted;
+        std::size_t num_wanted = 0;
+        for (const auto& tag : file_tags) {
+            if (tag.is_inline() ||
+                std::find(codes.begin(), codes.end(), tag.template get_code<std::endian::native>()) == codes.end()) {
+                continue;
+            }
+            const std::size_t offset = static_cast<std::size_t>(tag.template get_offset<std::endian::native>());
+            const std::size_t size = tag.data_size();
+            // Out of the file: left to the per-tag read to report
+            if (offset >= file_size.value() || size > file_size.value() - offset) [[unlikely]] {
+                continue;
+            }
+            if (num_wanted == MaxRanges) [[unlikely]] {
+                break; // Duplicated tag codes
+            }
+            wanted[num_wanted++] = {offset, size};
+        }
+        if (num_wanted < 2) {
+            return; // Nothing to batch
+        }
+        // Insertion sort by offset: at most sizeof...(Tags) entries
+        for (std::size_t i = 1; i < num_wanted; ++i) {
+            const Range range = wanted[i];
+            std::size_t j = i;
+            for (; j > 0 && wanted[j - 1].offset > range.offset; --j) {
+                wanted[j] = wanted[j - 1];
+            }
+            wanted[j] = range;
+        }
+
+        Range current = wanted[0];
+        auto flush = [&]() {
+            auto view = reader_.read(current.offset, current.size);
+            if (view && view.value().size() == current.size) [[likely]] {
+                // Shared, as parsed values (TagArrayView) may keep the data
+                try {
+                    views_[num_ranges_] = std::make_shared<const InnerView>(std::move(view.value()));
+                } catch (...) {
+                    return;
+                }
+                ranges_[num_ranges_] = current;
+                ++num_ranges_;
+            }
+        };
+        for (std::size_t i = 1; i < num_wanted; ++i) {
+            const std::size_t end = current.offset + current.size;
+            if (wanted[i].offset <= end + max_gap) {
+                current.size = std::max(end, wanted[i].offset + wanted[i].size) - current.offset;
+            } else {
+                flush();
+                current = wanted[i];
+            }
+        }
+        flush();
+    }
+
+    /// Number of reads issued by prefetch() that succeeded
+    [[nodiscard]] std::size_t num_prefetched() const noexcept { return num_ranges_; }
+
+    [[nodiscard]] Result<ReadViewType> read(std::size_t offset, std::size_t size) const noexcept {
+        if (auto [data, owner] = find(offset, size); !data.empty()) {
+            return Ok(ReadViewType(data, *owner));
+        }
+        auto view = reader_.read(offset, size);
+        if (!view) [[unlikely]] {
+            return view.error();
+        }
+        return Ok(ReadViewType(std::move(view.value())));
+    }
+
+    [[nodiscard]] Result<void> read_into(void* buffer, std::size_t offset, std::size_t size) const noexcept {
+        if (auto data = find(offset, size).first; !data.empty()) {
+            std::memcpy(buffer, data.data(), size);
+            return Ok();
+        }
+        return reader_.read_into(buffer, offset, size);
+    }
+
+    [[nodiscard]] Result<std::size_t> size() const noexcept { return reader_.size(); }
+    [[nodiscard]] bool is_valid() const noexcept { return reader_.is_valid(); }
+
+private:
+    struct Range {
+        std::size_t offset;
+        std::size_t size;
+    };
+
+    using Found = std::pair<std::span<const std::byte>, const std::shared_ptr<const InnerView>*>;
+
+    /// Prefetched bytes [offset, offset + size) and the read holding them,
+    /// or an empty span if not prefetched
+    [[nodiscard]] Found find(std::size_t offset, std::size_t size) const noexcept {
+        if (size == 0) {
+            return {};
+        }
+        // Ranges are sorted and disjoint: only the last one starting at or before offset can cover it
+        const auto ranges_end = ranges_.begin() + static_cast<std::ptrdiff_t>(num_ranges_);
+        auto it = std::upper_bound(ranges_.begin(), ranges_end, offset,
+            [](std::size_t value, const Range& r) { return value < r.offset; });
+        if (it == ranges_.begin()) {
+            return {};
+        }
+        --it;
+        const std::size_t rel = offset - it->offset;
+        if (rel > it->size || size > it->size - rel) {
+            return {};
+        }
+        const auto& view = views_[static_cast<std::size_t>(it - ranges_.begin())];
+        return {view->data().subspan(rel, size), &view};
+    }
+
+    const Reader& reader_;
+    std::array<Range, MaxRanges> ranges_{};
+    std::array<std::shared_ptr<const InnerView>, MaxRanges> views_;
+    std::size_t num_ranges_ = 0;
+};
+
 /// Extraction: O(n+m) two-pointer algorithm (requires sorted tags - tiff spec compliant)
 template <typename Reader, TiffFormatType TiffFormat, std::endian SourceEndian, typename... Tags, typename Storage>
 [[nodiscard]] inline bool extract_tags_sorted(
@@ -221,6 +393,28 @@ struct ExtractedTagsImpl<TagSpec<Tags...>> {
         clear_impl<0, Tags...>(values);
     }
 
+    template <RawReader Reader, TiffFormatType TiffFormat, std::endian SourceEndian>
+    [[nodiscard]] static Result<void> extract_sorted_impl(
+        Storage& values,
+        const Reader& reader,
+        std::span<const parsing::TagType<TiffFormat, SourceEndian>> tag_buffer) noexcept {
+        // Out-of-line tag data is fetched in a few coalesced reads, not one read per tag
+        using Prefetched = PrefetchedTagReader<Reader, sizeof...(Tags)>;
+        Prefetched prefetched(reader);
+        prefetched.template prefetch<TiffFormat, SourceEndian, Tags...>(tag_buffer);
+
+        Error last_error{Error::Code::Success};
+        // Assumes sorted tags (O(n+m) two-pointer)
+        bool success = detail::extract_tags_sorted<Prefetched, TiffFormat, SourceEndian, Tags...>(
+            values, prefetched, tag_buffer, last_error);
+
+        if (!success) [[unlikely]] {
+            return last_error;
+        }
+        
+        return Ok();
+    }
+
     template <RawReader Reader, TiffFormatType TiffFormat, std::endian SourceEndian>
     [[nodiscard]] static Result<void> extract_impl(
         Storage& values,
@@ -243,16 +437,7 @@ struct ExtractedTagsImpl<TagSpec<Tags...>> {
                 });
         }
 
-        Error last_error{Error::Code::Success};
-        // Assumes sorted tags (O(n+m) two-pointer)
-        bool success = detail::extract_tags_sorted<Reader, TiffFormat, SourceEndian, Tags...>(
-            values, reader, tag_buffer, last_error);
-
-        if (!success) [[unlikely]] {
-            return last_error;
-        }
-        
-        return Ok();
+        return extract_sorted_impl<Reader, TiffFormat, SourceEndian>(values, reader, tag_buffer);
     }
 
     template <RawReader Reader, TiffFormatType TiffFormat, std::endian SourceEndian>
@@ -260,16 +445,7 @@ struct ExtractedTagsImpl<TagSpec<Tags...>> {
         Storage& values,
         const Reader& reader,
         const std::span<parsing::TagType<TiffFormat, SourceEndian>> tag_buffer) noexcept {
-        Error last_error{Error::Code::Success};
-        // Assumes sorted tags (O(n+m) two-pointer)
-        bool success = detail::extract_tags_sorted<Reader, TiffFormat, SourceEndian, Tags...>(
-            values, reader, tag_buffer, last_error);
-
-        if (!success) [[unlikely]] {
-            return last_error;
-        }
-        
-        return Ok();
+        return extract_sorted_impl<Reader, TiffFormat, SourceEndian>(values, reader, tag_buffer);
     }
 
     template <TagCode Code, TiffFormatType TiffFormat>
@@ -422,6 +598,7 @@ template <RawReader Reader, TiffFormatType TiffFormat, std::endian SourceEndian>
 inline Result<void> ExtractedTags<Args...>::extract(
     const Reader& reader,
     std::span<parsing::TagType<TiffFormat, SourceEndian>> tag_buffer) noexcept {
+    byte_order = SourceEndian;
     return Implementation::template extract_impl<Reader, TiffFormat, SourceEndian>(
         values, reader, tag_buffer);
 }
@@ -439,6 +616,7 @@ inline Result<void> ExtractedTags<Args...>::extract_strict(
     const Reader& reader,
     const std::span<parsing::TagType<TiffFormat, SourceEndian>> tag_buffer) noexcept {
     Error last_error{Error::Code::Success};
+    byte_order = SourceEndian;
     return Implementation::template extract_strict_impl<Reader, TiffFormat, SourceEndian>(
         values, reader, tag_buffer);
 }
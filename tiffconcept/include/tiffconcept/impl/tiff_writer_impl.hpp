@@ -2,8 +2,11 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstring>
+#include <optional>
 #include <span>
+#include <string>
 #include <vector>
 #include "../lowlevel/encoder.hpp"
 #include "../ifd.hpp"
@@ -27,6 +30,12 @@ template <typename PixelType, typename CompSpec, typename WriteConfig_, TiffForm
 TiffWriter<PixelType, CompSpec, WriteConfig_, TiffFormat, TargetEndian>::TiffWriter(IFDPlacement placement)
     : placement_strategy_(placement), ifd_builder_(placement) {}
 
+template <typename PixelType, typename CompSpec, typename WriteConfig_, TiffFormatType TiffFormat, std::endian TargetEndian>
+    requires ValidCompressorSpec<CompSpec> && predictor::DeltaDecodable<PixelType>
+TiffWriter<PixelType, CompSpec, WriteConfig_, TiffFormat, TargetEndian>::TiffWriter(
+    typename ImageWriterType::Config writer_config, IFDPlacement placement)
+    : image_writer_(writer_config), ifd_builder_(placement), placement_strategy_(placement) {}
+
 template <typename PixelType, typename CompSpec, typename WriteConfig_, TiffFormatType TiffFormat, std::endian TargetEndian>
     requires ValidCompressorSpec<CompSpec> && predictor::DeltaDecodable<PixelType>
 template <typename Writer>
@@ -630,7 +639,7 @@ inline Result<void> TiffWriter<PixelType, CompSpec, WriteConfig_, TiffFormat, Ta
 
         std::size_t num_real_tags = mandatory_tags.num_defined_tags() + additional_tags.num_defined_tags();
         std::size_t estimated_ifd_size = ifd::IFD<TiffFormat, TargetEndian>::size_in_bytes(num_real_tags)
-            + mandatory_tags.extra_byte_size() + additional_tags.extra_byte_size();
+            + mandatory_tags.template extra_byte_size<TiffFormat>() + additional_tags.template extra_byte_size<TiffFormat>();
         
         // Reserve space for IFD
         std::size_t ifd_start = current_file_pos;
@@ -812,12 +821,325 @@ inline Result<void> TiffWriter<PixelType, CompSpec, WriteConfig_, TiffFormat, Ta
     );
 }
     
+/// Validate the geometry and tags of an incremental session and set up its state
+template <typename PixelType, typename CompSpec, typename WriteConfig_, TiffFormatType TiffFormat, std::endian TargetEndian>
+    requires ValidCompressorSpec<CompSpec> && predictor::DeltaDecodable<PixelType>
+template <typename... TagArgs>
+inline Result<void> TiffWriter<PixelType, CompSpec, WriteConfig_, TiffFormat, TargetEndian>::begin_image_impl(
+    uint32_t image_width,
+    uint32_t image_height,
+    uint32_t image_depth,
+    uint32_t tile_width,
+    uint32_t tile_height,
+    uint32_t tile_depth,
+    bool     is_tiled,
+    uint16_t samples_per_pixel,
+    PlanarConfiguration planar_config,
+    CompressionScheme compression,
+    Predictor predictor,
+    const ExtractedTags<TagArgs...>& additional_tags) noexcept {
+
+    if (stream_.has_value()) [[unlikely]] {
+        return Err(Error::Code::InvalidOperation, "An incremental image session is already in progress");
+    }
+
+    if (image_width == 0 || image_height == 0 || image_depth == 0 ||
+        tile_width == 0 || tile_height == 0 || tile_depth == 0 || samples_per_pixel == 0) [[unlikely]] {
+        return Err(Error::Code::OutOfBounds, "Image and tile dimensions must be non-zero");
+    }
+
+    auto validation_result = validate_user_tags(
+        additional_tags, image_width, image_height, image_depth,
+        tile_width, tile_height, tile_depth,
+        is_tiled, samples_per_pixel, planar_config, compression, predictor);
+    if (validation_result.is_error()) [[unlikely]] {
+        return validation_result;
+    }
+
+    StreamState state;
+    state.ifd_builder = IFDBuilderType(placement_strategy_);
+    state.tiles_across = (image_width + tile_width - 1) / tile_width;
+    state.tiles_down = (image_height + tile_height - 1) / tile_height;
+    state.tiles_deep = (image_depth + tile_depth - 1) / tile_depth;
+    state.num_planes = (planar_config == PlanarConfiguration::Planar) ? samples_per_pixel : 1;
+    uint32_t num_chunks = state.tiles_across * state.tiles_down * state.tiles_deep * state.num_planes;
+
+    uint16_t effective_samples = (planar_config == PlanarConfiguration::Planar) ? 1 : samples_per_pixel;
+    state.tile_size = TileSize{tile_width, tile_height, tile_depth, effective_samples};
+    state.image_size = TileSize{image_width, image_height, image_depth, effective_samples};
+    state.is_tiled = is_tiled;
+    state.compression = compression;
+    state.predictor = predictor;
+
+    fill_mandatory_tags(
+        state.mandatory_tags, additional_tags,
+        image_width, image_height, image_depth,
+        tile_width, tile_height, tile_depth,
+        is_tiled, samples_per_pixel, planar_config, compression, predictor,
+        num_chunks);
+
+    // User tags do not depend on the chunk locations: encode them now so that
+    // the session does not need to keep a copy of them.
+    auto add_result = state.ifd_builder.add_tags(additional_tags);
+    if (add_result.is_error()) [[unlikely]] {
+        return add_result;
+    }
+
+    state.info.tile_offsets.assign(num_chunks, 0);
+    state.info.tile_byte_counts.assign(num_chunks, 0);
+    state.info.total_data_size = 0;
+    state.chunks_written = 0;
+
+    std::size_t current_file_pos = sizeof(HeaderType);
+    state.ifd_start = 0;
+    state.reserved_ifd_size = 0;
+    if (!placement_strategy_.write_data_before_ifd) {
+        // The IFD size only depends on the tag set and array lengths, which are known now
+        std::size_t num_real_tags = state.mandatory_tags.num_defined_tags() + additional_tags.num_defined_tags();
+        state.reserved_ifd_size = ifd::IFD<TiffFormat, TargetEndian>::size_in_bytes(num_real_tags)
+            + state.mandatory_tags.template extra_byte_size<TiffFormat>() + additional_tags.template extra_byte_size<TiffFormat>();
+        state.ifd_start = current_file_pos;
+        current_file_pos += state.reserved_ifd_size;
+    }
+    state.info.image_data_start_offset = current_file_pos;
+    state.current_file_pos = current_file_pos;
+
+    stream_.emplace(std::move(state));
+    return Ok();
+}
+
+/// Start an incremental tiled image session
+template <typename PixelType, typename CompSpec, typename WriteConfig_, TiffFormatType TiffFormat, std::endian TargetEndian>
+    requires ValidCompressorSpec<CompSpec> && predictor::DeltaDecodable<PixelType>
+template <typename... TagArgs>
+inline Result<void> TiffWriter<PixelType, CompSpec, WriteConfig_, TiffFormat, TargetEndian>::begin_tiled_image(
+    uint32_t image_width,
+    uint32_t image_height,
+    uint32_t image_depth,
+    uint32_t tile_width,
+    uint32_t tile_height,
+    uint32_t tile_depth,
+    uint16_t samples_per_pixel,
+    PlanarConfiguration planar_config,
+    CompressionScheme compression,
+    Predictor predictor,
+    const ExtractedTags<TagArgs...>& additional_tags) noexcept {
+    return begin_image_impl(
+        image_width,
+        image_height,
+        image_depth,
+        tile_width,
+        tile_height,
+        tile_depth,
+        true, // is_tiled
+        samples_per_pixel,
+        planar_config,
+        compression,
+        predictor,
+        additional_tags
+    );
+}
+
+/// Start an incremental stripped image session
+template <typename PixelType, typename CompSpec, typename WriteConfig_, TiffFormatType TiffFormat, std::endian TargetEndian>
+    requires ValidCompressorSpec<CompSpec> && predictor::DeltaDecodable<PixelType>
+template <typename... TagArgs>
+inline Result<void> TiffWriter<PixelType, CompSpec, WriteConfig_, TiffFormat, TargetEndian>::begin_stripped_image(
+    uint32_t image_width,
+    uint32_t image_height,
+    uint32_t rows_per_strip,
+    uint16_t samples_per_pixel,
+    PlanarConfiguration planar_config,
+    CompressionScheme compression,
+    Predictor predictor,
+    const ExtractedTags<TagArgs...>& additional_tags) noexcept {
+
+    if (rows_per_strip == 0 || image_height % rows_per_strip != 0) [[unlikely]] {
+        return Err(Error::Code::UnsupportedFeature, "Current limitation: rows per strip must evenly divide image height");
+    }
+
+    return begin_image_impl(
+        image_width,
+        image_height,
+        1, // image_depth
+        image_width,  // tile_width = full width
+        rows_per_strip,
+        1, // tile_depth
+        false, // is_tiled
+        samples_per_pixel,
+        planar_config,
+        compression,
+        predictor,
+        additional_tags
+    );
+}
+
+/// Encode one tile of the current session and append it after the data written so far
+template <typename PixelType, typename CompSpec, typename WriteConfig_, TiffFormatType TiffFormat, std::endian TargetEndian>
+    requires ValidCompressorSpec<CompSpec> && predictor::DeltaDecodable<PixelType>
+template <typename Writer>
+    requires RawWriter<Writer>
+inline Result<void> TiffWriter<PixelType, CompSpec, WriteConfig_, TiffFormat, TargetEndian>::write_tile(
+    Writer& writer,
+    uint32_t tile_x,
+    uint32_t tile_y,
+    uint32_t tile_z,
+    uint16_t plane,
+    std::span<const PixelType> tile_data) noexcept {
+
+    if (!stream_.has_value()) [[unlikely]] {
+        return Err(Error::Code::InvalidOperation, "No incremental image session in progress");
+    }
+    StreamState& state = *stream_;
+
+    if (tile_x >= state.tiles_across || tile_y >= state.tiles_down ||
+        tile_z >= state.tiles_deep || plane >= state.num_planes) [[unlikely]] {
+        return Err(Error::Code::OutOfBounds, "Tile index out of range");
+    }
+
+    // Same linear order as ChunkLayout::create_tiled
+    uint32_t chunk_index = ((static_cast<uint32_t>(plane) * state.tiles_deep + tile_z) * state.tiles_down + tile_y)
+                           * state.tiles_across + tile_x;
+    if (state.info.tile_byte_counts[chunk_index] != 0) [[unlikely]] {
+        return Err(Error::Code::InvalidOperation, "Tile has already been written");
+    }
+
+    const TileSize& tile = state.tile_size;
+    // Part of the tile that lies inside the image
+    TileSize valid{
+        std::min(tile.width, state.image_size.width - tile_x * tile.width),
+        std::min(tile.height, state.image_size.height - tile_y * tile.height),
+        std::min(tile.depth, state.image_size.depth - tile_z * tile.depth),
+        tile.nsamples
+    };
+    std::size_t full_samples = static_cast<std::size_t>(tile.width) * tile.height * tile.depth * tile.nsamples;
+    std::size_t valid_samples = static_cast<std::size_t>(valid.width) * valid.height * valid.depth * valid.nsamples;
+
+    std::span<const PixelType> chunk_data = tile_data;
+    if (tile_data.size() != full_samples) {
+        if (tile_data.size() != valid_samples) [[unlikely]] {
+            return Err(Error::Code::OutOfBounds, "Tile data size matches neither the full tile nor its part inside the image");
+        }
+        // Edge tile supplied cropped: pad to the full tile size
+        state.tile_buffer.resize(full_samples);
+        fetch_tile_from_buffer<PlanarConfiguration::Chunky, ImageLayoutSpec::DHWC, PixelType>(
+            tile_data, std::span<PixelType>(state.tile_buffer), tile, valid, TileCoordinates{0, 0, 0, 0});
+        chunk_data = std::span<const PixelType>(state.tile_buffer);
+    }
+
+    auto write_result = image_writer_.write_chunk(
+        writer,
+        state.buffering,
+        chunk_data,
+        chunk_index,
+        tile,
+        plane,
+        state.compression,
+        state.predictor,
+        state.current_file_pos
+    );
+    if (write_result.is_error()) [[unlikely]] {
+        return write_result.error();
+    }
+
+    std::size_t byte_count = write_result.value();
+    state.info.tile_offsets[chunk_index] = state.current_file_pos;
+    state.info.tile_byte_counts[chunk_index] = byte_count;
+    state.current_file_pos += byte_count;
+    state.chunks_written++;
+    return Ok();
+}
+
+/// Encode one strip of the current session and append it after the data written so far
+template <typename PixelType, typename CompSpec, typename WriteConfig_, TiffFormatType TiffFormat, std::endian TargetEndian>
+    requires ValidCompressorSpec<CompSpec> && predictor::DeltaDecodable<PixelType>
+template <typename Writer>
+    requires RawWriter<Writer>
+inline Result<void> TiffWriter<PixelType, CompSpec, WriteConfig_, TiffFormat, TargetEndian>::write_strip(
+    Writer& writer,
+    uint32_t strip_index,
+    uint16_t plane,
+    std::span<const PixelType> strip_data) noexcept {
+    return write_tile(writer, 0, strip_index, 0, plane, strip_data);
+}
+
+/// Write the offset arrays, IFD and header of the current session
+template <typename PixelType, typename CompSpec, typename WriteConfig_, TiffFormatType TiffFormat, std::endian TargetEndian>
+    requires ValidCompressorSpec<CompSpec> && predictor::DeltaDecodable<PixelType>
+template <typename Writer>
+    requires RawWriter<Writer>
+inline Result<void> TiffWriter<PixelType, CompSpec, WriteConfig_, TiffFormat, TargetEndian>::finish_image(
+    Writer& writer) noexcept {
+
+    if (!stream_.has_value()) [[unlikely]] {
+        return Err(Error::Code::InvalidOperation, "No incremental image session in progress");
+    }
+    StreamState& state = *stream_;
+
+    if (state.chunks_written != state.info.tile_offsets.size()) [[unlikely]] {
+        return Err(Error::Code::InvalidOperation,
+            "Cannot finish image: " + std::to_string(state.info.tile_offsets.size() - state.chunks_written) +
+            " chunks were not written");
+    }
+
+    auto flush_result = state.buffering.flush(writer);
+    if (flush_result.is_error()) [[unlikely]] {
+        return Err(flush_result.error().code, "Failed to flush buffered data: " + flush_result.error().message);
+    }
+    state.info.total_data_size = state.current_file_pos - state.info.image_data_start_offset;
+
+    if (state.is_tiled) {
+        fill_tile_arrays(state.mandatory_tags, state.info);
+    } else {
+        fill_strip_arrays(state.mandatory_tags, state.info);
+    }
+
+    // The builder is only mutated on success so that a failed finish can be retried
+    IFDBuilderType ifd_builder = state.ifd_builder;
+    auto add_result = ifd_builder.add_tags(state.mandatory_tags);
+    if (add_result.is_error()) [[unlikely]] {
+        return add_result;
+    }
+
+    std::size_t ifd_position = state.current_file_pos;
+    if (!placement_strategy_.write_data_before_ifd) {
+        assert(ifd_builder.calculate_total_size() == state.reserved_ifd_size &&
+                "IFD size greater than estimated size reserved");
+        ifd_position = state.ifd_start;
+    }
+
+    auto ifd_offset_result = ifd_builder.write_to_file(writer, ifd_position);
+    if (ifd_offset_result.is_error()) [[unlikely]] {
+        return ifd_offset_result.error();
+    }
+
+    auto header_result = write_header(writer, ifd_offset_result.value());
+    if (header_result.is_error()) [[unlikely]] {
+        return header_result;
+    }
+
+    auto writer_flush_result = writer.flush();
+    if (writer_flush_result.is_error()) [[unlikely]] {
+        return writer_flush_result;
+    }
+
+    stream_.reset();
+    return Ok();
+}
+
+template <typename PixelType, typename CompSpec, typename WriteConfig_, TiffFormatType TiffFormat, std::endian TargetEndian>
+    requires ValidCompressorSpec<CompSpec> && predictor::DeltaDecodable<PixelType>
+inline bool TiffWriter<PixelType, CompSpec, WriteConfig_, TiffFormat, TargetEndian>::image_in_progress() const noexcept {
+    return stream_.has_value();
+}
+    
 /// Clear writer state for reuse
 template <typename PixelType, typename CompSpec, typename WriteConfig_, TiffFormatType TiffFormat, std::endian TargetEndian>
     requires ValidCompressorSpec<CompSpec> && predictor::DeltaDecodable<PixelType>
 inline void TiffWriter<PixelType, CompSpec, WriteConfig_, TiffFormat, TargetEndian>::clear() noexcept {
     image_writer_.clear();
     ifd_builder_.clear();
+    stream_.reset();
 }
 
 } // namespace tiffconcept
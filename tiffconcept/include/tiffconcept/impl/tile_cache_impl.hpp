@@ -0,0 +1,125 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <vector>
+
+#ifndef TIFFCONCEPT_TILE_CACHE_HEADER
+#include "../tile_cache.hpp" // for linters
+#endif
+
+namespace tiffconcept {
+
+template <typename PixelType>
+DecodedTileCache<PixelType>::DecodedTileCache(Config config)
+    : shard_count_(std::bit_ceil(std::max<size_t>(config.shards, 1))),
+      shard_budget_(config.max_bytes / shard_count_),
+      shards_(std::make_unique<Shard[]>(shard_count_)) {}
+
+template <typename PixelType>
+size_t DecodedTileCache<PixelType>::KeyHash::operator()(const TileCacheKey& key) const noexcept {
+    // splitmix64 finalizer over the combined fields
+    uint64_t h = key.file_id * 0x9E3779B97F4A7C15ull;
+    h ^= key.ifd_offset + 0x632BE59BD9B4E019ull + (h << 6) + (h >> 2);
+    h ^= uint64_t{key.tile_index} + 0x9E3779B97F4A7C15ull + (h << 6) + (h >> 2);
+    h = (h ^ (h >> 30)) * 0xBF58476D1CE4E5B9ull;
+    h = (h ^ (h >> 27)) * 0x94D049BB133111EBull;
+    return static_cast<size_t>(h ^ (h >> 31));
+}
+
+template <typename PixelType>
+typename DecodedTileCache<PixelType>::Shard& DecodedTileCache<PixelType>::shard_of(const TileCacheKey& key) noexcept {
+    // High bits select the shard, low bits the bucket in the shard map
+    const uint64_t h = KeyHash{}(key);
+    return shards_[static_cast<size_t>(h >> 32) & (shard_count_ - 1)];
+}
+
+template <typename PixelType>
+typename DecodedTileCache<PixelType>::TileData DecodedTileCache<PixelType>::find(const TileCacheKey& key) noexcept {
+    Shard& shard = shard_of(key);
+    {
+        std::lock_guard lock(shard.mutex);
+        auto it = shard.index.find(key);
+        if (it != shard.index.end()) {
+            shard.lru.splice(shard.lru.begin(), shard.lru, it->second);
+            hits_.fetch_add(1, std::memory_order_relaxed);
+            return it->second->data;
+        }
+    }
+    misses_.fetch_add(1, std::memory_order_relaxed);
+    return nullptr;
+}
+
+template <typename PixelType>
+void DecodedTileCache<PixelType>::insert(const TileCacheKey& key, std::span<const PixelType> tile) noexcept {
+    const size_t bytes = tile.size_bytes();
+    if (bytes > shard_budget_) {
+        return;
+    }
+
+    try {
+        // Copy outside the lock
+        TileData data = std::make_shared<const std::vector<PixelType>>(tile.begin(), tile.end());
+
+        Shard& shard = shard_of(key);
+        std::lock_guard lock(shard.mutex);
+        if (shard.index.contains(key)) {
+            return;
+        }
+        shard.lru.push_front(Entry{key, std::move(data), bytes});
+        try {
+            shard.index.emplace(key, shard.lru.begin());
+        } catch (...) {
+            shard.lru.pop_front();
+            return;
+        }
+        shard.bytes += bytes;
+        insertions_.fetch_add(1, std::memory_order_relaxed);
+        bytes_.fetch_add(bytes, std::memory_order_relaxed);
+        entries_.fetch_add(1, std::memory_order_relaxed);
+
+        while (shard.bytes > shard_budget_) {
+            const Entry& victim = shard.lru.back();
+            shard.bytes -= victim.bytes;
+            bytes_.fetch_sub(victim.bytes, std::memory_order_relaxed);
+            entries_.fetch_sub(1, std::memory_order_relaxed);
+            evictions_.fetch_add(1, std::memory_order_relaxed);
+            shard.index.erase(victim.key);
+            shard.lru.pop_back();
+        }
+    } catch (...) {
+        // Out of memory: the tile is simply not cached
+    }
+}
+
+template <typename PixelType>
+void DecodedTileCache<PixelType>::clear() noexcept {
+    for (size_t i = 0; i < shard_count_; ++i) {
+        Shard& shard = shards_[i];
+        std::lock_guard lock(shard.mutex);
+        bytes_.fetch_sub(shard.bytes, std::memory_order_relaxed);
+        entries_.fetch_sub(shard.lru.size(), std::memory_order_relaxed);
+        shard.index.clear();
+        shard.lru.clear();
+        shard.bytes = 0;
+    }
+}
+
+template <typename PixelType>
+TileCacheStats DecodedTileCache<PixelType>::stats() const noexcept {
+    return TileCacheStats{
+        hits_.load(std::memory_order_relaxed),
+        misses_.load(std::memory_order_relaxed),
+        insertions_.load(std::memory_order_relaxed),
+        evictions_.load(std::memory_order_relaxed),
+        bytes_.load(std::memory_order_relaxed),
+        entries_.load(std::memory_order_relaxed)
+    };
+}
+
+} // namespace tiffconcept
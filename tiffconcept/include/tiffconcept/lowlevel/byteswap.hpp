@@ -0,0 +1,33 @@
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+#include "../types/tiff_spec.hpp"
+#include "cpu_features.hpp"
+
+namespace tiffconcept {
+
+/// Concept for the element types byteswap_array can convert
+/// (integers and floating point types, including Float16 and Float24)
+template <typename T>
+concept ByteSwappable = (std::is_arithmetic_v<T> && !std::is_same_v<T, bool>) ||
+                        std::is_same_v<T, Float16> ||
+                        std::is_same_v<T, Float24>;
+
+/// Reverse the byte order of every element of an array in place
+///
+/// Used to convert tag arrays and pixel data stored in the non-native byte
+/// order. 16-, 32- and 64-bit elements use SSE2/AVX2 kernels on x86-64
+/// (selected at runtime, see cpu::simd_level()).
+///
+/// @tparam T Element type
+/// @param data Elements to convert (modified in place)
+template <ByteSwappable T>
+void byteswap_array(std::span<T> data) noexcept;
+
+} // namespace tiffconcept
+
+#define TIFFCONCEPT_BYTESWAP_HEADER
+#include "impl/byteswap_impl.hpp"
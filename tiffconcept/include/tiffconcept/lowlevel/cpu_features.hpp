@@ -0,0 +1,90 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define TIFFCONCEPT_X86_64 1
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+#endif
+
+/// Function attribute enabling AVX2 code generation for a single function
+/// (GCC/Clang need it to use AVX2 intrinsics without -mavx2, MSVC does not)
+#if defined(TIFFCONCEPT_X86_64) && (defined(__GNUC__) || defined(__clang__))
+#define TIFFCONCEPT_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define TIFFCONCEPT_TARGET_AVX2
+#endif
+
+namespace tiffconcept {
+
+namespace cpu {
+
+/// SIMD instruction set levels used by the vectorized kernels
+/// SSE2 is part of the x86-64 baseline, AVX2 is detected at runtime
+enum class SimdLevel : uint8_t {
+    Scalar = 0,
+    SSE2 = 1,
+    AVX2 = 2
+};
+
+namespace detail {
+
+[[nodiscard]] inline SimdLevel detect_simd_level() noexcept {
+#if defined(TIFFCONCEPT_X86_64)
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        return SimdLevel::AVX2;
+    }
+#elif defined(_MSC_VER)
+    int regs[4];
+    __cpuid(regs, 0);
+    if (regs[0] >= 7) {
+        __cpuid(regs, 1);
+        const bool osxsave = (regs[2] & (1 << 27)) != 0;
+        const bool avx = (regs[2] & (1 << 28)) != 0;
+        // The OS must save the YMM registers on context switches
+        if (osxsave && avx && (_xgetbv(0) & 0x6) == 0x6) {
+            __cpuidex(regs, 7, 0);
+            if ((regs[1] & (1 << 5)) != 0) {
+                return SimdLevel::AVX2;
+            }
+        }
+    }
+#endif
+    return SimdLevel::SSE2;
+#else
+    return SimdLevel::Scalar;
+#endif
+}
+
+inline std::atomic<SimdLevel> simd_level_limit{SimdLevel::AVX2};
+
+} // namespace detail
+
+/// Best SIMD level supported by the CPU (detected once)
+[[nodiscard]] inline SimdLevel detected_simd_level() noexcept {
+    static const SimdLevel level = detail::detect_simd_level();
+    return level;
+}
+
+/// SIMD level used by the vectorized kernels:
+/// the detected level, capped by set_simd_level_limit()
+[[nodiscard]] inline SimdLevel simd_level() noexcept {
+    SimdLevel limit = detail::simd_level_limit.load(std::memory_order_relaxed);
+    SimdLevel detected = detected_simd_level();
+    return limit < detected ? limit : detected;
+}
+
+/// Cap the SIMD level used by the vectorized kernels
+/// Mostly useful to test and benchmark the fallback paths
+inline void set_simd_level_limit(SimdLevel limit) noexcept {
+    detail::simd_level_limit.store(limit, std::memory_order_relaxed);
+}
+
+} // namespace cpu
+
+} // namespace tiffconcept
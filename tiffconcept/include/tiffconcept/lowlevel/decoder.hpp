@@ -25,8 +25,9 @@
  * 
  * For each tile:
  * 1. Decompress using the specified compression scheme
- * 2. Apply predictor decoding if needed (in-place)
- * 3. Return decoded pixel data
+ * 2. Convert the samples to native byte order if the file is not (in-place)
+ * 3. Apply predictor decoding if needed (in-place)
+ * 4. Return decoded pixel data
  * 
  * ## Thread Safety
  * 
@@ -62,10 +63,12 @@
  * @note The decoder maintains internal state (scratch buffer) for efficiency
  */
 
+#include <bit>
 #include <cstring>
 #include <span>
 #include <vector>
 #include "../decompressors/decompressor_base.hpp"
+#include "byteswap.hpp"
 #include "predictor.hpp"
 #include "../types/result.hpp"
 #include "../types/tiff_spec.hpp"
@@ -103,16 +106,18 @@ class TileDecoder {
 private:
     DecompressorStorage<DecompSpec> decompressors_;
     mutable std::vector<PixelType> scratch_buffer_;  // Reusable buffer for decode()
+    mutable std::vector<uint8_t> fp_row_buffer_;     // Row buffer of the floating point predictor
     mutable std::mutex safety_mutex_; // For people who ignore thread-safety notes
     
-    /// Apply predictor decoding in-place (implementation in decoder_impl.hpp)
+    /// Apply byte order conversion and predictor decoding in-place (implementation in decoder_impl.hpp)
     [[nodiscard]] Result<void> apply_predictor(
         std::span<std::byte> data,
         uint32_t width,
         uint32_t height,
         uint32_t stride,
         Predictor predictor,
-        uint16_t samples_per_pixel) const noexcept;
+        uint16_t samples_per_pixel,
+        std::endian byte_order) const noexcept;
     
 public:
     /**
@@ -131,7 +136,8 @@ public:
      * 
      * The decoding process:
      * 1. Decompress data using the specified compression scheme
-     * 2. Apply predictor decoding if predictor != None
+     * 2. Convert the samples from byte_order to native byte order
+     * 3. Apply predictor decoding if predictor != None
      * 
      * @param compressed_input Compressed tile data
      * @param decompressed_output Output buffer (must be large enough)
@@ -140,6 +146,7 @@ public:
      * @param compression Compression scheme used
      * @param predictor Predictor used (None, Horizontal, or FloatingPoint)
      * @param samples_per_pixel Number of samples per pixel (channels)
+     * @param byte_order Byte order of the file the tile was read from
      * @return Ok() on success, or Error on failure
      * 
      * @throws None (noexcept)
@@ -151,6 +158,8 @@ public:
      * @note Predictor decoding is applied in-place in the output buffer
      * @note For floating-point types, only FloatingPoint predictor is applied
      * @note For integer types, only Horizontal predictor is applied
+     * @note For non-native byte orders, each row is byte-swapped right before
+     *       its predictor decoding (FloatingPoint predictor output is always native)
      */
     [[nodiscard]] Result<void> decode_into(
         std::span<const std::byte> compressed_input,
@@ -159,7 +168,8 @@ public:
         uint32_t height,
         CompressionScheme compression = CompressionScheme::None,
         Predictor predictor = Predictor::None,
-        uint16_t samples_per_pixel = 1) const noexcept;
+        uint16_t samples_per_pixel = 1,
+        std::endian byte_order = std::endian::native) const noexcept;
     
     /**
      * @brief Decode tile using internal scratch buffer
@@ -178,6 +188,7 @@ public:
      * @param compression Compression scheme used
      * @param predictor Predictor used (None, Horizontal, or FloatingPoint)
      * @param samples_per_pixel Number of samples per pixel (channels)
+     * @param byte_order Byte order of the file the tile was read from
      * @return Result containing span over decoded pixels, or an error
      * 
      * @throws None (noexcept)
@@ -205,7 +216,8 @@ public:
         uint32_t height,
         CompressionScheme compression = CompressionScheme::None,
         Predictor predictor = Predictor::None,
-        uint16_t samples_per_pixel = 1) noexcept;
+        uint16_t samples_per_pixel = 1,
+        std::endian byte_order = std::endian::native) noexcept;
     
     /**
      * @brief Decode tile and return owned copy
@@ -220,6 +232,7 @@ public:
      * @param compression Compression scheme used
      * @param predictor Predictor used (None, Horizontal, or FloatingPoint)
      * @param samples_per_pixel Number of samples per pixel (channels)
+     * @param byte_order Byte order of the file the tile was read from
      * @return Result containing vector of decoded pixels, or an error
      * 
      * @throws None (noexcept)
@@ -247,7 +260,8 @@ public:
         uint32_t height,
         CompressionScheme compression = CompressionScheme::None,
         Predictor predictor = Predictor::None,
-        uint16_t samples_per_pixel = 1) const noexcept;
+        uint16_t samples_per_pixel = 1,
+        std::endian byte_order = std::endian::native) const noexcept;
 
 private:
     [[nodiscard]] Result<void> decode_into_impl(
@@ -257,7 +271,8 @@ private:
         uint32_t height,
         CompressionScheme compression,
         Predictor predictor,
-        uint16_t samples_per_pixel) const noexcept;
+        uint16_t samples_per_pixel,
+        std::endian byte_order) const noexcept;
 };
 
 } // namespace tiffconcept
@@ -1,9 +1,11 @@
 #pragma once
 
+#include <bit>
 #include <cstring>
 #include <span>
 #include <vector>
 #include "../compressors/compressor_base.hpp"
+#include "byteswap.hpp"
 #include "predictor.hpp"
 #include "../types/result.hpp"
 #include "../strategy/write_strategy.hpp"
@@ -43,6 +45,7 @@ public:
     /// @param compression Compression scheme to apply
     /// @param predictor Predictor to apply before compression
     /// @param samples_per_pixel Number of samples per pixel
+    /// @param byte_order Byte order of the file (samples are stored in it after predictor encoding)
     /// @return Result<EncodedChunk> containing compressed data and metadata
     /// @retval Success Chunk encoded successfully
     /// @retval UnsupportedFeature Empty chunk (width/height/depth is zero)
@@ -63,7 +66,8 @@ public:
         uint16_t plane,
         CompressionScheme compression = CompressionScheme::None,
         Predictor predictor = Predictor::None,
-        uint16_t samples_per_pixel = 1) noexcept;
+        uint16_t samples_per_pixel = 1,
+        std::endian byte_order = std::endian::native) noexcept;
     
     /// @brief Encode a 2D chunk (convenience wrapper for common case)
     /// @param input_data Input pixel data for the chunk
@@ -76,6 +80,7 @@ public:
     /// @param compression Compression scheme to apply
     /// @param predictor Predictor to apply before compression
     /// @param samples_per_pixel Number of samples per pixel
+    /// @param byte_order Byte order of the file (samples are stored in it after predictor encoding)
     /// @return Result<EncodedChunk> containing compressed data and metadata
     /// @retval Success Chunk encoded successfully
     /// @retval UnsupportedFeature Empty chunk
@@ -92,7 +97,8 @@ public:
         uint16_t plane,
         CompressionScheme compression = CompressionScheme::None,
         Predictor predictor = Predictor::None,
-        uint16_t samples_per_pixel = 1) noexcept;
+        uint16_t samples_per_pixel = 1,
+        std::endian byte_order = std::endian::native) noexcept;
     
     /// @brief Encode chunk using tile indices instead of pixel coordinates
     /// @param input_data Input pixel data for the chunk
@@ -107,6 +113,7 @@ public:
     /// @param compression Compression scheme to apply
     /// @param predictor Predictor to apply before compression
     /// @param samples_per_pixel Number of samples per pixel
+    /// @param byte_order Byte order of the file (samples are stored in it after predictor encoding)
     /// @return Result<EncodedChunk> containing compressed data and metadata
     /// @retval Success Chunk encoded successfully
     /// @retval UnsupportedFeature Empty chunk
@@ -127,7 +134,8 @@ public:
         uint16_t plane,
         CompressionScheme compression = CompressionScheme::None,
         Predictor predictor = Predictor::None,
-        uint16_t samples_per_pixel = 1) noexcept;
+        uint16_t samples_per_pixel = 1,
+        std::endian byte_order = std::endian::native) noexcept;
     
     /// @brief Clear scratch buffers and release memory
     /// @note Useful for memory management after batch encoding
@@ -142,9 +150,10 @@ public:
 private:
     CompressorStorage<CompSpec> compressors_;
     std::vector<PixelType> predictor_buffer_;  // Reusable buffer for predictor encoding
+    std::vector<uint8_t> fp_row_buffer_;       // Row buffer of the floating point predictor
     std::vector<std::byte> compressed_buffer_; // Reusable buffer for compression output
     
-    /// Apply predictor encoding (modifies data in-place)
+    /// Apply predictor encoding and byte order conversion (modifies data in-place)
     /// Returns the span to use for compression (either original or predictor_buffer_)
     [[nodiscard]] Result<std::span<const std::byte>> apply_predictor(
         std::span<const PixelType> input_data,
@@ -152,7 +161,8 @@ private:
         uint32_t height,
         uint32_t stride,
         Predictor predictor,
-        uint16_t samples_per_pixel) noexcept;
+        uint16_t samples_per_pixel,
+        std::endian byte_order) noexcept;
 };
 
 } // namespace tiffconcept
@@ -0,0 +1,169 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <utility>
+#include "../../types/tiff_spec.hpp"
+#include "../cpu_features.hpp"
+
+#if defined(TIFFCONCEPT_X86_64)
+#include <immintrin.h>
+#endif
+
+#ifndef TIFFCONCEPT_BYTESWAP_HEADER
+#include "../byteswap.hpp" // for linters
+#endif
+
+/// Vectorized byte order reversal of 16-, 32- and 64-bit elements
+///
+/// AVX2 reverses the bytes of each element with a single vpshufb per
+/// register. SSE2 has no byte shuffle: it swaps the two bytes of every
+/// 16-bit word with shifts, then reorders the words of each element with
+/// pshuflw/pshufhw. The elements left over at the end of the array go
+/// through the scalar loop.
+
+namespace tiffconcept {
+
+namespace detail {
+
+template <std::size_t Size>
+inline void byteswap_scalar(std::byte* data, std::size_t count) noexcept {
+    if constexpr (Size == 3) {
+        for (std::size_t i = 0; i < count; ++i) {
+            std::swap(data[i * 3], data[i * 3 + 2]);
+        }
+    } else {
+        using U = std::conditional_t<Size == 2, uint16_t, std::conditional_t<Size == 4, uint32_t, uint64_t>>;
+        for (std::size_t i = 0; i < count; ++i) {
+            U value;
+            std::memcpy(&value, data + i * Size, Size);
+            value = byteswap(value);
+            std::memcpy(data + i * Size, &value, Size);
+        }
+    }
+}
+
+namespace simd {
+
+#if defined(TIFFCONCEPT_X86_64)
+
+// ============================================================================
+// SSE2 kernel
+// ============================================================================
+
+template <std::size_t Size>
+inline __m128i byteswap_128(__m128i v) noexcept {
+    v = _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+    if constexpr (Size == 4) {
+        v = _mm_shufflelo_epi16(v, _MM_SHUFFLE(2, 3, 0, 1));
+        v = _mm_shufflehi_epi16(v, _MM_SHUFFLE(2, 3, 0, 1));
+    } else if constexpr (Size == 8) {
+        v = _mm_shufflelo_epi16(v, _MM_SHUFFLE(0, 1, 2, 3));
+        v = _mm_shufflehi_epi16(v, _MM_SHUFFLE(0, 1, 2, 3));
+    }
+    return v;
+}
+
+template <std::size_t Size>
+inline void byteswap_sse2(std::byte* data, std::size_t count) noexcept {
+    const std::size_t n = count * Size;
+    std::size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i + 16));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(data + i), byteswap_128<Size>(a));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(data + i + 16), byteswap_128<Size>(b));
+    }
+    if (i + 16 <= n) {
+        __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(data + i), byteswap_128<Size>(a));
+        i += 16;
+    }
+    byteswap_scalar<Size>(data + i, (n - i) / Size);
+}
+
+// ============================================================================
+// AVX2 kernel
+// ============================================================================
+
+/// pshufb indices reversing the bytes of each Size-byte element of a lane
+template <std::size_t Size>
+inline constexpr std::array<uint8_t, 32> byteswap_shuffle = [] {
+    std::array<uint8_t, 32> indices{};
+    for (std::size_t i = 0; i < indices.size(); ++i) {
+        const std::size_t in_lane = i % 16;
+        indices[i] = static_cast<uint8_t>(in_lane - in_lane % Size + (Size - 1 - in_lane % Size));
+    }
+    return indices;
+}();
+
+template <std::size_t Size>
+TIFFCONCEPT_TARGET_AVX2
+inline void byteswap_avx2(std::byte* data, std::size_t count) noexcept {
+    const __m256i shuffle = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(byteswap_shuffle<Size>.data()));
+    const std::size_t n = count * Size;
+    std::size_t i = 0;
+    for (; i + 64 <= n; i += 64) {
+        __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i + 32));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(data + i), _mm256_shuffle_epi8(a, shuffle));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(data + i + 32), _mm256_shuffle_epi8(b, shuffle));
+    }
+    if (i + 32 <= n) {
+        __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(data + i), _mm256_shuffle_epi8(a, shuffle));
+        i += 32;
+    }
+    if (i + 16 <= n) {
+        __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(data + i), _mm_shuffle_epi8(a, _mm256_castsi256_si128(shuffle)));
+        i += 16;
+    }
+    byteswap_scalar<Size>(data + i, (n - i) / Size);
+}
+
+#endif // TIFFCONCEPT_X86_64
+
+/// Whether byteswap_simd has a kernel for this element size at this SIMD level
+[[nodiscard]] inline bool has_byteswap_kernel(std::size_t element_size, cpu::SimdLevel level) noexcept {
+    return level != cpu::SimdLevel::Scalar && (element_size == 2 || element_size == 4 || element_size == 8);
+}
+
+/// Vectorized byte order reversal at the given SIMD level
+/// The caller checks has_byteswap_kernel() first
+template <std::size_t Size>
+inline void byteswap_simd(std::byte* data, std::size_t count, [[maybe_unused]] cpu::SimdLevel level) noexcept {
+#if defined(TIFFCONCEPT_X86_64)
+    if constexpr (Size == 2 || Size == 4 || Size == 8) {
+        if (level == cpu::SimdLevel::AVX2) {
+            byteswap_avx2<Size>(data, count);
+        } else {
+            byteswap_sse2<Size>(data, count);
+        }
+    }
+#else
+    (void)data; (void)count;
+#endif
+}
+
+} // namespace simd
+
+} // namespace detail
+
+template <ByteSwappable T>
+inline void byteswap_array(std::span<T> data) noexcept {
+    if constexpr (sizeof(T) > 1) {
+        std::byte* bytes = reinterpret_cast<std::byte*>(data.data());
+        const cpu::SimdLevel level = cpu::simd_level();
+        if (detail::simd::has_byteswap_kernel(sizeof(T), level)) {
+            detail::simd::byteswap_simd<sizeof(T)>(bytes, data.size(), level);
+        } else {
+            detail::byteswap_scalar<sizeof(T)>(bytes, data.size());
+        }
+    }
+}
+
+} // namespace tiffconcept
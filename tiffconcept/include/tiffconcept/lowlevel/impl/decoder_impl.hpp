@@ -4,10 +4,12 @@
 
 #pragma once
 
+#include <bit>
 #include <cstring>
 #include <span>
 #include <vector>
 #include "../../decompressors/decompressor_base.hpp"
+#include "../byteswap.hpp"
 #include "../predictor.hpp"
 #include "../../types/result.hpp"
 #include "../../types/tiff_spec.hpp"
@@ -31,7 +33,8 @@ Result<void> TileDecoder<PixelType, DecompSpec>::apply_predictor(
     uint32_t height,
     uint32_t stride,
     Predictor predictor,
-    uint16_t samples_per_pixel) const noexcept {
+    uint16_t samples_per_pixel,
+    std::endian byte_order) const noexcept {
     
     // Cast byte span to typed span
     std::span<PixelType> typed_data(
@@ -39,13 +42,43 @@ Result<void> TileDecoder<PixelType, DecompSpec>::apply_predictor(
         data.size() / sizeof(PixelType)
     );
     
+    // The floating point predictor reassembles the samples in native byte order
+    if (sizeof(PixelType) > 1 && byte_order != std::endian::native && predictor != Predictor::FloatingPoint) {
+        const std::size_t row_size = static_cast<std::size_t>(width) * samples_per_pixel;
+        if constexpr (!std::is_floating_point_v<PixelType>) {
+            if (predictor == Predictor::Horizontal) {
+                // Each row is swapped while in cache, right before its predictor decoding
+                for (std::size_t row = 0; row < height; ++row) {
+                    auto row_data = typed_data.subspan(row * stride, row_size);
+                    byteswap_array(row_data);
+                    predictor::delta_decode_horizontal(row_data, width, 1, row_size, samples_per_pixel);
+                }
+                return Ok();
+            }
+        }
+        for (std::size_t row = 0; row < height; ++row) {
+            byteswap_array(typed_data.subspan(row * stride, row_size));
+        }
+        return Ok();
+    }
+    
     if (predictor == Predictor::Horizontal) {
         if constexpr (!std::is_floating_point_v<PixelType>) {
             predictor::delta_decode_horizontal(typed_data, width, height, stride, samples_per_pixel);
         }
     } else if (predictor == Predictor::FloatingPoint) {
         if constexpr (std::is_floating_point_v<PixelType>) {
-            predictor::delta_decode_floating_point(typed_data, width, height, stride, samples_per_pixel);
+            const std::size_t row_buffer_size =
+                predictor::floating_point_row_buffer_size<PixelType>(width, samples_per_pixel);
+            if (fp_row_buffer_.size() < row_buffer_size) {
+                try {
+                    fp_row_buffer_.resize(row_buffer_size);
+                } catch (...) {
+                    return Err(Error::Code::MemoryError, "Failed to allocate predictor row buffer");
+                }
+            }
+            predictor::delta_decode_floating_point(typed_data, width, height, stride, samples_per_pixel,
+                                                   std::span<uint8_t>(fp_row_buffer_));
         }
     }
     return Ok();
@@ -59,7 +92,7 @@ template <typename PixelType, typename DecompSpec>
     requires predictor::DeltaDecodable<PixelType> &&
              ValidDecompressorSpec<DecompSpec>
 TileDecoder<PixelType, DecompSpec>::TileDecoder() 
-    : decompressors_(), scratch_buffer_() {}
+    : decompressors_(), scratch_buffer_(), fp_row_buffer_() {}
 
 template <typename PixelType, typename DecompSpec>
     requires predictor::DeltaDecodable<PixelType> &&
@@ -71,7 +104,8 @@ inline Result<void> TileDecoder<PixelType, DecompSpec>::decode_into_impl(
     uint32_t height,
     CompressionScheme compression,
     Predictor predictor,
-    uint16_t samples_per_pixel) const noexcept {
+    uint16_t samples_per_pixel,
+    std::endian byte_order) const noexcept {
 
     if (decompressed_output.size() < width * height * samples_per_pixel * sizeof(PixelType)) {
         return Err(Error::Code::OutOfBounds, "Insufficient decompressed output size");
@@ -90,7 +124,7 @@ inline Result<void> TileDecoder<PixelType, DecompSpec>::decode_into_impl(
     
     // Apply predictor decoding if needed (in-place)
     // Stride in elements is width * samples_per_pixel
-    return apply_predictor(decompressed_output, width, height, width * samples_per_pixel, predictor, samples_per_pixel);
+    return apply_predictor(decompressed_output, width, height, width * samples_per_pixel, predictor, samples_per_pixel, byte_order);
 }
 
 template <typename PixelType, typename DecompSpec>
@@ -103,7 +137,8 @@ inline Result<void> TileDecoder<PixelType, DecompSpec>::decode_into(
     uint32_t height,
     CompressionScheme compression,
     Predictor predictor,
-    uint16_t samples_per_pixel) const noexcept {
+    uint16_t samples_per_pixel,
+    std::endian byte_order) const noexcept {
 
     std::lock_guard<std::mutex> lock(safety_mutex_);
     
@@ -118,7 +153,8 @@ inline Result<void> TileDecoder<PixelType, DecompSpec>::decode_into(
         height,
         compression,
         predictor,
-        samples_per_pixel
+        samples_per_pixel,
+        byte_order
     );
 }
 
@@ -131,7 +167,8 @@ inline Result<std::span<const PixelType>> TileDecoder<PixelType, DecompSpec>::de
     uint32_t height,
     CompressionScheme compression,
     Predictor predictor,
-    uint16_t samples_per_pixel) noexcept {
+    uint16_t samples_per_pixel,
+    std::endian byte_order) noexcept {
 
     std::lock_guard<std::mutex> lock(safety_mutex_);
     
@@ -148,7 +185,7 @@ inline Result<std::span<const PixelType>> TileDecoder<PixelType, DecompSpec>::de
     );
     
     // Decode into scratch buffer
-    auto result = decode_into_impl(compressed_input, output, width, height, compression, predictor, samples_per_pixel);
+    auto result = decode_into_impl(compressed_input, output, width, height, compression, predictor, samples_per_pixel, byte_order);
     if (result.is_error()) [[unlikely]] {
         return result.error();
     }
@@ -166,7 +203,8 @@ inline Result<std::vector<PixelType>> TileDecoder<PixelType, DecompSpec>::decode
     uint32_t height,
     CompressionScheme compression,
     Predictor predictor,
-    uint16_t samples_per_pixel) const noexcept {
+    uint16_t samples_per_pixel,
+    std::endian byte_order) const noexcept {
 
     std::lock_guard<std::mutex> lock(safety_mutex_);
     
@@ -181,7 +219,7 @@ inline Result<std::vector<PixelType>> TileDecoder<PixelType, DecompSpec>::decode
     );
     
     // Decode directly into the vector
-    auto result = decode_into_impl(compressed_input, output_span, width, height, compression, predictor, samples_per_pixel);
+    auto result = decode_into_impl(compressed_input, output_span, width, height, compression, predictor, samples_per_pixel, byte_order);
     if (result.is_error()) [[unlikely]] {
         return result.error();
     }
@@ -1,9 +1,11 @@
 #pragma once
 
+#include <bit>
 #include <cstring>
 #include <span>
 #include <vector>
 #include "../../compressors/compressor_base.hpp"
+#include "../byteswap.hpp"
 #include "../predictor.hpp"
 #include "../../types/result.hpp"
 #include "../../types/tiff_spec.hpp"
@@ -21,9 +23,9 @@ namespace tiffconcept {
 template <typename PixelType, typename CompSpec>
     requires predictor::DeltaDecodable<PixelType> && ValidCompressorSpec<CompSpec>
 ChunkEncoder<PixelType, CompSpec>::ChunkEncoder() 
-    : compressors_(), predictor_buffer_(), compressed_buffer_() {}
+    : compressors_(), predictor_buffer_(), fp_row_buffer_(), compressed_buffer_() {}
     
-/// Apply predictor encoding (modifies data in-place)
+/// Apply predictor encoding and byte order conversion (modifies data in-place)
 /// Returns the span to use for compression (either original or predictor_buffer_)
 template <typename PixelType, typename CompSpec>
     requires predictor::DeltaDecodable<PixelType> && ValidCompressorSpec<CompSpec>
@@ -33,9 +35,13 @@ template <typename PixelType, typename CompSpec>
     uint32_t height,
     uint32_t stride,
     Predictor predictor,
-    uint16_t samples_per_pixel) noexcept {
+    uint16_t samples_per_pixel,
+    std::endian byte_order) noexcept {
     
-    if (predictor == Predictor::None) {
+    // The floating point predictor writes the samples in big-endian byte planes whatever the file byte order
+    const bool swap = sizeof(PixelType) > 1 && byte_order != std::endian::native && predictor != Predictor::FloatingPoint;
+    
+    if (predictor == Predictor::None && !swap) {
         // No encoding needed, return input as bytes
         return Ok(std::span<const std::byte>(
             reinterpret_cast<const std::byte*>(input_data.data()),
@@ -51,32 +57,47 @@ template <typename PixelType, typename CompSpec>
     
     // Copy input to predictor buffer
     std::memcpy(predictor_buffer_.data(), input_data.data(), required_size * sizeof(PixelType));
+    std::span<PixelType> data(predictor_buffer_.data(), required_size);
     
     // Apply predictor encoding in-place
     if (predictor == Predictor::Horizontal) {
         if constexpr (!std::is_floating_point_v<PixelType>) {
-            predictor::delta_encode_horizontal(
-                std::span<PixelType>(predictor_buffer_.data(), required_size),
-                width, height, stride, samples_per_pixel
-            );
+            if (swap) {
+                // Each row is swapped while in cache, right after its predictor encoding
+                const std::size_t row_size = static_cast<std::size_t>(width) * samples_per_pixel;
+                for (std::size_t row = 0; row < height; ++row) {
+                    auto row_data = data.subspan(row * stride, row_size);
+                    predictor::delta_encode_horizontal(row_data, width, 1, row_size, samples_per_pixel);
+                    byteswap_array(row_data);
+                }
+                return Ok(std::as_bytes(data));
+            }
+            predictor::delta_encode_horizontal(data, width, height, stride, samples_per_pixel);
         }
     } else if (predictor == Predictor::FloatingPoint) {
         if constexpr (std::is_floating_point_v<PixelType>) {
-            predictor::delta_encode_floating_point(
-                std::span<PixelType>(predictor_buffer_.data(), required_size),
-                width, height, stride, samples_per_pixel
-            );
+            const std::size_t row_buffer_size =
+                predictor::floating_point_row_buffer_size<PixelType>(width, samples_per_pixel);
+            if (fp_row_buffer_.size() < row_buffer_size) {
+                try {
+                    fp_row_buffer_.resize(row_buffer_size);
+                } catch (...) {
+                    return Err(Error::Code::MemoryError, "Failed to allocate predictor row buffer");
+                }
+            }
+            predictor::delta_encode_floating_point(data, width, height, stride, samples_per_pixel,
+                                                   std::span<uint8_t>(fp_row_buffer_));
         }
     }
+    if (swap) {
+        byteswap_array(data);
+    }
     
     // Return encoded data as byte span
-    return Ok(std::span<const std::byte>(
-        reinterpret_cast<const std::byte*>(predictor_buffer_.data()),
-        required_size * sizeof(PixelType)
-    ));
+    return Ok(std::as_bytes(data));
 }
 
-    
+
 /// Encode chunk (tile or strip) and return as EncodedChunk
 /// The chunk info will be populated with uncompressed and compressed sizes
 /// The returned EncodedChunk owns the compressed data
@@ -94,7 +115,8 @@ template <typename PixelType, typename CompSpec>
     uint16_t plane,
     CompressionScheme compression,
     Predictor predictor,
-    uint16_t samples_per_pixel) noexcept {
+    uint16_t samples_per_pixel,
+    std::endian byte_order) noexcept {
 
     // Validate dimensions are non-zero
     if (width == 0 || height == 0 || depth == 0) [[unlikely]] {
@@ -116,7 +138,7 @@ template <typename PixelType, typename CompSpec>
     auto predictor_result = apply_predictor(
         input_data.subspan(0, expected_size),
         width, effective_height, width * samples_per_pixel,
-        predictor, samples_per_pixel
+        predictor, samples_per_pixel, byte_order
     );
     
     if (predictor_result.is_error()) [[unlikely]] {
@@ -179,7 +201,8 @@ template <typename PixelType, typename CompSpec>
     uint16_t plane,
     CompressionScheme compression,
     Predictor predictor,
-    uint16_t samples_per_pixel) noexcept {
+    uint16_t samples_per_pixel,
+    std::endian byte_order) noexcept {
     
     return encode(
         input_data,
@@ -189,7 +212,8 @@ template <typename PixelType, typename CompSpec>
         plane,
         compression,
         predictor,
-        samples_per_pixel
+        samples_per_pixel,
+        byte_order
     );
 }
 
@@ -210,7 +234,8 @@ template <typename PixelType, typename CompSpec>
     uint16_t plane,
     CompressionScheme compression,
     Predictor predictor,
-    uint16_t samples_per_pixel) noexcept {
+    uint16_t samples_per_pixel,
+    std::endian byte_order) noexcept {
     
     return encode(
         input_data,
@@ -224,7 +249,8 @@ template <typename PixelType, typename CompSpec>
         plane,
         compression,
         predictor,
-        samples_per_pixel
+        samples_per_pixel,
+        byte_order
     );
 }
 
@@ -234,6 +260,8 @@ template <typename PixelType, typename CompSpec>
 void ChunkEncoder<PixelType, CompSpec>::clear() noexcept {
     predictor_buffer_.clear();
     predictor_buffer_.shrink_to_fit();
+    fp_row_buffer_.clear();
+    fp_row_buffer_.shrink_to_fit();
     compressed_buffer_.clear();
     compressed_buffer_.shrink_to_fit();
 }
@@ -1,15 +1,21 @@
 #pragma once
 
 #include <algorithm>
+#include <bit>
 #include <concepts>
 #include <cstdint>
+#include <cstring>
 #include <span>
+#include <vector>
 #include "../../types/tiff_spec.hpp"
+#include "../cpu_features.hpp"
 
 #ifndef TIFFCONCEPT_PREDICTOR_HEADER
 #include "../predictor.hpp" // for linters
 #endif
 
+#include "predictor_simd_impl.hpp"
+
 namespace tiffconcept {
 
 namespace predictor {
@@ -41,77 +47,87 @@ inline void delta_decode_horizontal_impl(
     }
 }
 
-/// Apply floating point horizontal differencing - specialized implementation
+/// Memory index of the byte of significance `s` (0 = most significant) in a sample
+/// Float16/Float24 are always stored little-endian, float/double in host order
+template <DeltaDecodableFloat FloatType>
+constexpr std::size_t fp_byte_index(std::size_t s) noexcept {
+    if constexpr (DeltaDecodableNativeFloat<FloatType> && std::endian::native == std::endian::big) {
+        return s;
+    } else {
+        return sizeof(FloatType) - 1 - s;
+    }
+}
+
+/// Decode one row of floating point predictor data - reference implementation
 /// 
-/// @tparam FloatType float or double
-/// @tparam SamplesPerPixel Number of samples per pixel (compile-time constant for optimization)
-template <DeltaDecodableNativeFloat FloatType, std::size_t SamplesPerPixel>
-inline void delta_decode_floating_point_impl(
-    std::span<FloatType> buffer,
-    std::size_t width,
-    std::size_t height,
-    std::size_t stride) noexcept {
+/// @param planes Byte planes of the row, most significant first, `count` bytes
+///        each (accumulated in place)
+/// @param samples Output samples (count * sizeof(FloatType) bytes)
+/// @param count Number of samples in the row (width * samples_per_pixel)
+template <DeltaDecodableFloat FloatType>
+inline void fp_decode_row_scalar(
+    uint8_t* planes,
+    uint8_t* samples,
+    std::size_t count,
+    std::size_t samples_per_pixel) noexcept {
     
-    using UIntType = std::conditional_t<std::is_same_v<FloatType, float>, 
-                                        uint32_t, 
-                                        uint64_t>;
+    constexpr std::size_t bytes = sizeof(FloatType);
     
-    static_assert(sizeof(FloatType) == sizeof(UIntType));
+    // Byte-wise horizontal accumulation over the whole row of planes
+    for (std::size_t i = samples_per_pixel; i < count * bytes; ++i) {
+        planes[i] += planes[i - samples_per_pixel];
+    }
     
-    for (std::size_t y = 0; y < height; ++y) {
-        std::size_t row_offset = y * stride;
-        
-        // Unrolled loop for each channel - compiler can optimize better
-        for (std::size_t x = 1; x < width; ++x) {
-            for (std::size_t s = 0; s < SamplesPerPixel; ++s) {
-                std::size_t curr_idx = row_offset + x * SamplesPerPixel + s;
-                std::size_t prev_idx = row_offset + (x - 1) * SamplesPerPixel + s;
-                
-                auto prev_int = std::bit_cast<UIntType>(buffer[prev_idx]);
-                auto curr_int = std::bit_cast<UIntType>(buffer[curr_idx]);
-                
-                buffer[curr_idx] = std::bit_cast<FloatType>(prev_int + curr_int);
-            }
+    // Byte planes back to samples
+    for (std::size_t s = 0; s < bytes; ++s) {
+        const uint8_t* plane = planes + s * count;
+        const std::size_t b = fp_byte_index<FloatType>(s);
+        for (std::size_t c = 0; c < count; ++c) {
+            samples[c * bytes + b] = plane[c];
         }
     }
 }
 
-/// Apply floating point horizontal differencing for non-native float types - specialized implementation
+/// Encode one row of floating point predictor data - reference implementation
 /// 
-/// @tparam FloatType Float16 or Float24
-/// @tparam SamplesPerPixel Number of samples per pixel (compile-time constant for optimization)
-template <DeltaDecodableNonNativeFloat FloatType, std::size_t SamplesPerPixel>
-inline void delta_decode_nonnative_float_impl(
-    std::span<FloatType> buffer,
-    std::size_t width,
-    std::size_t height,
-    std::size_t stride) noexcept {
+/// @param samples Input samples (count * sizeof(FloatType) bytes)
+/// @param planes Output byte planes, most significant first, `count` bytes each
+/// @param count Number of samples in the row (width * samples_per_pixel)
+template <DeltaDecodableFloat FloatType>
+inline void fp_encode_row_scalar(
+    const uint8_t* samples,
+    uint8_t* planes,
+    std::size_t count,
+    std::size_t samples_per_pixel) noexcept {
     
-    using UIntType = std::conditional_t<std::is_same_v<FloatType, Float16>, 
-                                        uint16_t, 
-                                        uint32_t>;
+    constexpr std::size_t bytes = sizeof(FloatType);
     
-    for (std::size_t y = 0; y < height; ++y) {
-        std::size_t row_offset = y * stride;
-        
-        for (std::size_t x = 1; x < width; ++x) {
-            for (std::size_t s = 0; s < SamplesPerPixel; ++s) {
-                std::size_t curr_idx = row_offset + x * SamplesPerPixel + s;
-                std::size_t prev_idx = row_offset + (x - 1) * SamplesPerPixel + s;
-                
-                UIntType prev_int, curr_int;
-                if constexpr (std::is_same_v<FloatType, Float16>) {
-                    prev_int = buffer[prev_idx].as_uint16();
-                    curr_int = buffer[curr_idx].as_uint16();
-                    buffer[curr_idx].from_uint16(static_cast<uint16_t>(prev_int + curr_int));
-                } else { // Float24
-                    prev_int = buffer[prev_idx].as_uint32();
-                    curr_int = buffer[curr_idx].as_uint32();
-                    buffer[curr_idx].from_uint32((prev_int + curr_int) & 0xFFFFFF);
-                }
-            }
+    // Samples to byte planes
+    for (std::size_t s = 0; s < bytes; ++s) {
+        uint8_t* plane = planes + s * count;
+        const std::size_t b = fp_byte_index<FloatType>(s);
+        for (std::size_t c = 0; c < count; ++c) {
+            plane[c] = samples[c * bytes + b];
         }
     }
+    
+    // Byte-wise horizontal differencing, from right to left
+    for (std::size_t i = count * bytes; i-- > samples_per_pixel;) {
+        planes[i] -= planes[i - samples_per_pixel];
+    }
+}
+
+/// Padding of the floating point predictor row buffer: it lets the
+/// vectorized kernels load a register past the row
+inline constexpr std::size_t fp_row_padding = 32;
+
+/// Per-thread row buffer of the floating point predictor (grown, never shrunk)
+[[nodiscard]] inline std::span<uint8_t> fp_row_buffer(std::size_t size) noexcept {
+    thread_local std::vector<uint8_t> buffer;
+    if (buffer.size() < size) {
+        buffer.resize(size);
+    }
+    return std::span<uint8_t>(buffer.data(), size);
 }
 
 /// Apply horizontal differencing (TIFF predictor=2) encoding in place - specialized implementation
@@ -139,79 +155,6 @@ inline void delta_encode_horizontal_impl(
     }
 }
 
-/// Apply floating point horizontal differencing encoding - specialized implementation
-/// 
-/// @tparam FloatType float or double
-/// @tparam SamplesPerPixel Number of samples per pixel (compile-time constant for optimization)
-template <DeltaDecodableNativeFloat FloatType, std::size_t SamplesPerPixel>
-inline void delta_encode_floating_point_impl(
-    std::span<FloatType> buffer,
-    std::size_t width,
-    std::size_t height,
-    std::size_t stride) noexcept {
-    
-    using UIntType = std::conditional_t<std::is_same_v<FloatType, float>, 
-                                        uint32_t, 
-                                        uint64_t>;
-    
-    static_assert(sizeof(FloatType) == sizeof(UIntType));
-    
-    for (std::size_t y = 0; y < height; ++y) {
-        std::size_t row_offset = y * stride;
-        
-        // Process from right to left to avoid overwriting values we need
-        for (std::size_t x = width - 1; x > 0; --x) {
-            for (std::size_t s = 0; s < SamplesPerPixel; ++s) {
-                std::size_t curr_idx = row_offset + x * SamplesPerPixel + s;
-                std::size_t prev_idx = row_offset + (x - 1) * SamplesPerPixel + s;
-                
-                auto prev_int = std::bit_cast<UIntType>(buffer[prev_idx]);
-                auto curr_int = std::bit_cast<UIntType>(buffer[curr_idx]);
-                
-                buffer[curr_idx] = std::bit_cast<FloatType>(curr_int - prev_int);
-            }
-        }
-    }
-}
-
-/// Apply floating point horizontal differencing encoding for non-native float types - specialized implementation
-template <DeltaDecodableNonNativeFloat FloatType, std::size_t SamplesPerPixel>
-inline void delta_encode_nonnative_float_impl(
-    std::span<FloatType> buffer,
-    std::size_t width,
-    std::size_t height,
-    std::size_t stride) noexcept {
-    
-    using UIntType = std::conditional_t<std::is_same_v<FloatType, Float16>, 
-                                        uint16_t, 
-                                        uint32_t>;
-    
-    for (std::size_t y = 0; y < height; ++y) {
-        std::size_t row_offset = y * stride;
-        
-        // Process from right to left to avoid overwriting values we need
-        for (std::size_t x = width - 1; x > 0; --x) {
-            for (std::size_t s = 0; s < SamplesPerPixel; ++s) {
-                std::size_t curr_idx = row_offset + x * SamplesPerPixel + s;
-                std::size_t prev_idx = row_offset + (x - 1) * SamplesPerPixel + s;
-                
-                UIntType prev_int, curr_int;
-                if constexpr (std::is_same_v<FloatType, Float16>) {
-                    prev_int = buffer[prev_idx].as_uint16();
-                    curr_int = buffer[curr_idx].as_uint16();
-                    buffer[curr_idx].from_uint16(static_cast<uint16_t>(curr_int - prev_int));
-                } else { // Float24
-                    prev_int = buffer[prev_idx].as_uint32();
-                    curr_int = buffer[curr_idx].as_uint32();
-                    buffer[curr_idx].from_uint32((curr_int - prev_int) & 0xFFFFFF);
-                }
-            }
-        }
-    }
-}
-
-template <class... T> constexpr bool always_false = false;
-
 } // namespace detail
 
 /// Apply horizontal differencing (TIFF predictor=2) decoding in place
@@ -234,6 +177,15 @@ inline void delta_decode_horizontal(
     std::size_t stride,
     std::size_t samples_per_pixel) noexcept {
     
+    // 8/16-bit samples with 1-4 channels: vectorized kernels when available
+    if constexpr (sizeof(T) <= 2) {
+        const cpu::SimdLevel level = cpu::simd_level();
+        if (detail::simd::has_horizontal_kernel<T>(samples_per_pixel, level)) {
+            detail::simd::delta_decode_horizontal_simd(buffer, width, height, stride, samples_per_pixel, level);
+            return;
+        }
+    }
+    
     // Dispatch to optimized implementations for common cases
     switch (samples_per_pixel) {
         case 1:
@@ -265,6 +217,27 @@ inline void delta_decode_horizontal(
     }
 }
 
+/// Size in bytes of the row buffer of the floating point predictor
+template <DeltaDecodableFloat FloatType>
+constexpr std::size_t floating_point_row_buffer_size(
+    std::size_t width,
+    std::size_t samples_per_pixel) noexcept {
+    return width * samples_per_pixel * sizeof(FloatType) + detail::fp_row_padding;
+}
+
+/// Apply floating point predictor (TIFF predictor=3) decoding in place
+/// 
+/// Each row is stored as byte planes (most significant byte of every sample
+/// first, then the next byte...), horizontally differenced byte by byte,
+/// as specified by Adobe's TIFF Technical Note 3. Decoding accumulates the
+/// bytes and reassembles the samples in native byte order.
+/// 
+/// @tparam FloatType float, double, Float16 or Float24
+/// @param buffer Buffer containing the encoded data (modified in place)
+/// @param width Number of pixels per row
+/// @param height Number of rows
+/// @param stride Number of elements (samples) between row starts (>= width * samples_per_pixel)
+/// @param samples_per_pixel Number of samples (channels) per pixel (default 1)
 template <DeltaDecodableFloat FloatType>
 inline void delta_decode_floating_point(
     std::span<FloatType> buffer,
@@ -272,91 +245,42 @@ inline void delta_decode_floating_point(
     std::size_t height,
     std::size_t stride,
     std::size_t samples_per_pixel) noexcept {
+    if (width == 0 || height == 0 || samples_per_pixel == 0) {
+        return;
+    }
+    delta_decode_floating_point(buffer, width, height, stride, samples_per_pixel,
+        detail::fp_row_buffer(floating_point_row_buffer_size<FloatType>(width, samples_per_pixel)));
+}
+
+/// Floating point predictor decoding with a caller-provided row buffer
+template <DeltaDecodableFloat FloatType>
+inline void delta_decode_floating_point(
+    std::span<FloatType> buffer,
+    std::size_t width,
+    std::size_t height,
+    std::size_t stride,
+    std::size_t samples_per_pixel,
+    std::span<uint8_t> row_buffer) noexcept {
     
-    if constexpr (DeltaDecodableNativeFloat<FloatType>) {
-        using UIntType = std::conditional_t<std::is_same_v<FloatType, float>, 
-                                            uint32_t, 
-                                            uint64_t>;
-        
-        static_assert(sizeof(FloatType) == sizeof(UIntType));
-        
-        // Dispatch to optimized implementations for common cases
-        switch (samples_per_pixel) {
-            case 1:
-                detail::delta_decode_floating_point_impl<FloatType, 1>(buffer, width, height, stride);
-                break;
-            case 2:
-                detail::delta_decode_floating_point_impl<FloatType, 2>(buffer, width, height, stride);
-                break;
-            case 3:
-                detail::delta_decode_floating_point_impl<FloatType, 3>(buffer, width, height, stride);
-                break;
-            case 4:
-                detail::delta_decode_floating_point_impl<FloatType, 4>(buffer, width, height, stride);
-                break;
-            default:
-                // Generic fallback for uncommon channel counts
-                for (std::size_t y = 0; y < height; ++y) {
-                    std::size_t row_offset = y * stride;
-                    
-                    for (std::size_t x = 1; x < width; ++x) {
-                        for (std::size_t s = 0; s < samples_per_pixel; ++s) {
-                            std::size_t curr_idx = row_offset + x * samples_per_pixel + s;
-                            std::size_t prev_idx = row_offset + (x - 1) * samples_per_pixel + s;
-                            
-                            auto prev_int = std::bit_cast<UIntType>(buffer[prev_idx]);
-                            auto curr_int = std::bit_cast<UIntType>(buffer[curr_idx]);
-                            
-                            buffer[curr_idx] = std::bit_cast<FloatType>(prev_int + curr_int);
-                        }
-                    }
-                }
-                break;
-        }
-    } else if constexpr (DeltaDecodableNonNativeFloat<FloatType>) {
-        switch (samples_per_pixel) {
-            case 1:
-                detail::delta_decode_nonnative_float_impl<FloatType, 1>(buffer, width, height, stride);
-                break;
-            case 2:
-                detail::delta_decode_nonnative_float_impl<FloatType, 2>(buffer, width, height, stride);
-                break;
-            case 3:
-                detail::delta_decode_nonnative_float_impl<FloatType, 3>(buffer, width, height, stride);
-                break;
-            case 4:
-                detail::delta_decode_nonnative_float_impl<FloatType, 4>(buffer, width, height, stride);
-                break;
-            default:
-                // Generic fallback
-                using UIntType = std::conditional_t<std::is_same_v<FloatType, Float16>, 
-                                                    uint16_t, 
-                                                    uint32_t>;
-                for (std::size_t y = 0; y < height; ++y) {
-                    std::size_t row_offset = y * stride;
-                    
-                    for (std::size_t x = 1; x < width; ++x) {
-                        for (std::size_t s = 0; s < samples_per_pixel; ++s) {
-                            std::size_t curr_idx = row_offset + x * samples_per_pixel + s;
-                            std::size_t prev_idx = row_offset + (x - 1) * samples_per_pixel + s;
-                            
-                            UIntType prev_int, curr_int;
-                            if constexpr (std::is_same_v<FloatType, Float16>) {
-                                prev_int = buffer[prev_idx].as_uint16();
-                                curr_int = buffer[curr_idx].as_uint16();
-                                buffer[curr_idx].from_uint16(static_cast<uint16_t>(prev_int + curr_int));
-                            } else {
-                                prev_int = buffer[prev_idx].as_uint32();
-                                curr_int = buffer[curr_idx].as_uint32();
-                                buffer[curr_idx].from_uint32((prev_int + curr_int) & 0xFFFFFF);
-                            }
-                        }
-                    }
-                }
-                break;
+    const std::size_t count = width * samples_per_pixel;
+    const std::size_t row_bytes = count * sizeof(FloatType);
+    if (row_bytes == 0 || height == 0) {
+        return;
+    }
+    
+    // The planes are copied out of the row, which receives the samples
+    uint8_t* planes = row_buffer.data();
+    const cpu::SimdLevel level = cpu::simd_level();
+    const bool vectorized = detail::simd::has_fp_kernel<FloatType>(count, level);
+    
+    for (std::size_t y = 0; y < height; ++y) {
+        uint8_t* row = reinterpret_cast<uint8_t*>(buffer.data() + y * stride);
+        std::memcpy(planes, row, row_bytes);
+        if (vectorized) {
+            detail::simd::fp_decode_row_simd<FloatType>(planes, row, count, samples_per_pixel, level);
+        } else {
+            detail::fp_decode_row_scalar<FloatType>(planes, row, count, samples_per_pixel);
         }
-    } else {
-        static_assert(detail::always_false<FloatType>, "Unsupported FloatType for delta_decode_floating_point");
     }
 }
 
@@ -413,14 +337,13 @@ inline void delta_encode_horizontal(
     }
 }
 
-/// Apply floating point horizontal differencing encoding in place
+/// Apply floating point predictor (TIFF predictor=3) encoding in place
 /// 
-/// This encodes floating point data by storing the difference between each
-/// pixel's bit representation and the previous pixel in the same row. The
-/// differencing is done on the integer bit representation to ensure
-/// lossless encoding.
+/// Each row is split into byte planes (most significant byte of every
+/// sample first, then the next byte...), which are then horizontally
+/// differenced byte by byte, as specified by Adobe's TIFF Technical Note 3.
 /// 
-/// @tparam FloatType float or double
+/// @tparam FloatType float, double, Float16 or Float24
 /// @param buffer Buffer containing the raw floating point data (modified in place)
 /// @param width Number of pixels per row
 /// @param height Number of rows
@@ -433,91 +356,42 @@ inline void delta_encode_floating_point(
     std::size_t height,
     std::size_t stride,
     std::size_t samples_per_pixel) noexcept {
-    if constexpr (DeltaDecodableNativeFloat<FloatType>) {
-        using UIntType = std::conditional_t<std::is_same_v<FloatType, float>, 
-                                            uint32_t, 
-                                            uint64_t>;
-        
-        static_assert(sizeof(FloatType) == sizeof(UIntType));
-        
-        // Dispatch to optimized implementations for common cases
-        switch (samples_per_pixel) {
-            case 1:
-                detail::delta_encode_floating_point_impl<FloatType, 1>(buffer, width, height, stride);
-                break;
-            case 2:
-                detail::delta_encode_floating_point_impl<FloatType, 2>(buffer, width, height, stride);
-                break;
-            case 3:
-                detail::delta_encode_floating_point_impl<FloatType, 3>(buffer, width, height, stride);
-                break;
-            case 4:
-                detail::delta_encode_floating_point_impl<FloatType, 4>(buffer, width, height, stride);
-                break;
-            default:
-                // Generic fallback for uncommon channel counts
-                for (std::size_t y = 0; y < height; ++y) {
-                    std::size_t row_offset = y * stride;
-                    
-                    // Process from right to left to avoid overwriting values we need
-                    for (std::size_t x = width - 1; x > 0; --x) {
-                        for (std::size_t s = 0; s < samples_per_pixel; ++s) {
-                            std::size_t curr_idx = row_offset + x * samples_per_pixel + s;
-                            std::size_t prev_idx = row_offset + (x - 1) * samples_per_pixel + s;
-                            
-                            auto prev_int = std::bit_cast<UIntType>(buffer[prev_idx]);
-                            auto curr_int = std::bit_cast<UIntType>(buffer[curr_idx]);
-                            
-                            buffer[curr_idx] = std::bit_cast<FloatType>(curr_int - prev_int);
-                        }
-                    }
-                }
-                break;
-        }
-    } else if constexpr (DeltaDecodableNonNativeFloat<FloatType>) {
-        switch (samples_per_pixel) {
-            case 1:
-                detail::delta_encode_nonnative_float_impl<FloatType, 1>(buffer, width, height, stride);
-                break;
-            case 2:
-                detail::delta_encode_nonnative_float_impl<FloatType, 2>(buffer, width, height, stride);
-                break;
-            case 3:
-                detail::delta_encode_nonnative_float_impl<FloatType, 3>(buffer, width, height, stride);
-                break;
-            case 4:
-                detail::delta_encode_nonnative_float_impl<FloatType, 4>(buffer, width, height, stride);
-                break;
-            default:
-                // Generic fallback
-                using UIntType = std::conditional_t<std::is_same_v<FloatType, Float16>, 
-                                                    uint16_t, 
-                                                    uint32_t>;
-                for (std::size_t y = 0; y < height; ++y) {
-                    std::size_t row_offset = y * stride;
-                    
-                    for (std::size_t x = width - 1; x > 0; --x) {
-                        for (std::size_t s = 0; s < samples_per_pixel; ++s) {
-                            std::size_t curr_idx = row_offset + x * samples_per_pixel + s;
-                            std::size_t prev_idx = row_offset + (x - 1) * samples_per_pixel + s;
-                            
-                            UIntType prev_int, curr_int;
-                            if constexpr (std::is_same_v<FloatType, Float16>) {
-                                prev_int = buffer[prev_idx].as_uint16();
-                                curr_int = buffer[curr_idx].as_uint16();
-                                buffer[curr_idx].from_uint16(static_cast<uint16_t>(curr_int - prev_int));
-                            } else {
-                                prev_int = buffer[prev_idx].as_uint32();
-                                curr_int = buffer[curr_idx].as_uint32();
-                                buffer[curr_idx].from_uint32((curr_int - prev_int) & 0xFFFFFF);
-                            }
-                        }
-                    }
-                }
-                break;
+    if (width == 0 || height == 0 || samples_per_pixel == 0) {
+        return;
+    }
+    delta_encode_floating_point(buffer, width, height, stride, samples_per_pixel,
+        detail::fp_row_buffer(floating_point_row_buffer_size<FloatType>(width, samples_per_pixel)));
+}
+
+/// Floating point predictor encoding with a caller-provided row buffer
+template <DeltaDecodableFloat FloatType>
+inline void delta_encode_floating_point(
+    std::span<FloatType> buffer,
+    std::size_t width,
+    std::size_t height,
+    std::size_t stride,
+    std::size_t samples_per_pixel,
+    std::span<uint8_t> row_buffer) noexcept {
+    
+    const std::size_t count = width * samples_per_pixel;
+    const std::size_t row_bytes = count * sizeof(FloatType);
+    if (row_bytes == 0 || height == 0) {
+        return;
+    }
+    
+    // The samples are copied out of the row, which receives the planes
+    uint8_t* samples = row_buffer.data();
+    const cpu::SimdLevel level = cpu::simd_level();
+    const bool vectorized = detail::simd::has_fp_kernel<FloatType>(count, level);
+    
+    for (std::size_t y = 0; y < height; ++y) {
+        uint8_t* row = reinterpret_cast<uint8_t*>(buffer.data() + y * stride);
+        std::memcpy(samples, row, row_bytes);
+        if (vectorized) {
+            detail::simd::fp_encode_row_simd<FloatType>(samples, row, count, samples_per_pixel, level);
+        } else {
+            detail::fp_encode_row_scalar<FloatType>(samples, row, count, samples_per_pixel);
         }
-    } else {
-        static_assert(detail::always_false<FloatType>, "Unsupported FloatType for delta_encode_floating_point");
     }
 }
 
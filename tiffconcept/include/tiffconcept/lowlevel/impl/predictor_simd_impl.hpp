@@ -0,0 +1,896 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include "../cpu_features.hpp"
+
+#if defined(TIFFCONCEPT_X86_64)
+#include <immintrin.h>
+#endif
+
+#ifndef TIFFCONCEPT_PREDICTOR_HEADER
+#include "../predictor.hpp" // for linters
+#endif
+
+/// Vectorized horizontal predictor decoding for 8- and 16-bit samples
+///
+/// Decoding a row is an inclusive prefix sum over the samples of each
+/// channel. Every register is processed in three steps:
+/// 1. In-register prefix sum: log2 shift-and-add steps, shifting by whole
+///    pixels so that only samples of the same channel are added together.
+/// 2. (AVX2 only) The last pixel of the low 128-bit lane is added to the
+///    high lane, as byte shifts do not cross lanes.
+/// 3. The running total of the previous registers (the carry, one pixel
+///    repeated over the register) is added.
+/// The carry is updated from the register sums of step 1/2 rather than from
+/// the final output, so the loop-carried dependency is a single addition.
+///
+/// A register only advances by whole pixels (15 bytes for 3 x uint8 in SSE2),
+/// so for 3 samples per pixel consecutive registers overlap by a few samples.
+/// The next register is always loaded before the current one is stored,
+/// and the overlapping samples are stored with their final decoded values.
+///
+/// Rows are decoded independently, the stride padding is never written.
+
+namespace tiffconcept {
+
+namespace predictor {
+
+namespace detail {
+
+namespace simd {
+
+#if defined(TIFFCONCEPT_X86_64)
+
+// ============================================================================
+// SSE2 kernels
+// ============================================================================
+
+template <typename U>
+inline __m128i add_128(__m128i a, __m128i b) noexcept {
+    if constexpr (sizeof(U) == 1) {
+        return _mm_add_epi8(a, b);
+    } else {
+        return _mm_add_epi16(a, b);
+    }
+}
+
+/// Add to each sample the samples Shift, 2*Shift, 4*Shift... bytes below it
+template <typename U, int Shift>
+inline __m128i prefix_sum_128(__m128i v) noexcept {
+    if constexpr (Shift < 16) {
+        return prefix_sum_128<U, Shift * 2>(add_128<U>(v, _mm_slli_si128(v, Shift)));
+    } else {
+        return v;
+    }
+}
+
+/// Repeat the pattern held by the low Shift bytes over the whole register
+template <int Shift>
+inline __m128i repeat_128(__m128i v) noexcept {
+    if constexpr (Shift < 16) {
+        return repeat_128<Shift * 2>(_mm_or_si128(v, _mm_slli_si128(v, Shift)));
+    } else {
+        return v;
+    }
+}
+
+/// Repeat the PixelBytes wide pixel ending at byte End over the whole register
+template <int PixelBytes, int End>
+inline __m128i broadcast_pixel_128(__m128i v) noexcept {
+    if constexpr (End == 16 && PixelBytes == 8) {
+        return _mm_shuffle_epi32(v, 0xEE);
+    } else if constexpr (End == 16 && PixelBytes == 4) {
+        return _mm_shuffle_epi32(v, 0xFF);
+    } else if constexpr (End == 16 && PixelBytes == 2) {
+        return _mm_shuffle_epi32(_mm_shufflehi_epi16(v, 0xFF), 0xFF);
+    } else if constexpr (End == 16 && PixelBytes == 1) {
+        return _mm_shuffle_epi32(_mm_shufflehi_epi16(_mm_unpackhi_epi8(v, v), 0xFF), 0xFF);
+    } else {
+        // Move the pixel to the low bytes, clearing everything above it
+        __m128i pixel = _mm_srli_si128(_mm_slli_si128(v, 16 - End), 16 - PixelBytes);
+        return repeat_128<PixelBytes>(pixel);
+    }
+}
+
+/// Decode one row of `count` samples (SSE2)
+template <typename U, std::size_t SamplesPerPixel>
+inline void delta_decode_row_sse2(U* row, std::size_t count) noexcept {
+    constexpr std::size_t lanes = 16 / sizeof(U);
+    constexpr std::size_t step = (lanes / SamplesPerPixel) * SamplesPerPixel;
+    constexpr int pixel_bytes = static_cast<int>(SamplesPerPixel * sizeof(U));
+    constexpr int step_bytes = static_cast<int>(step * sizeof(U));
+
+    std::size_t done = SamplesPerPixel;
+    if (count >= lanes) {
+        std::size_t i = 0;
+        __m128i carry = _mm_setzero_si128();
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row));
+        while (true) {
+            __m128i sums = prefix_sum_128<U, pixel_bytes>(v);
+            __m128i out = add_128<U>(sums, carry);
+            carry = add_128<U>(carry, broadcast_pixel_128<pixel_bytes, step_bytes>(sums));
+
+            const bool more = i + step + lanes <= count;
+            if (more) {
+                v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row + i + step));
+            }
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(row + i), out);
+            if (!more) {
+                break;
+            }
+            i += step;
+        }
+        done = i + lanes;
+    }
+
+    for (std::size_t i = done; i < count; ++i) {
+        row[i] += row[i - SamplesPerPixel];
+    }
+}
+
+// ============================================================================
+// AVX2 kernels
+// ============================================================================
+
+/// pshufb tables moving the last pixel of a 128-bit lane into place
+/// @tparam ElemBytes Sample size in bytes
+template <std::size_t ElemBytes, std::size_t SamplesPerPixel>
+struct Avx2CarryTables {
+    static constexpr std::size_t lane_elems = 16 / ElemBytes;
+    static constexpr std::size_t step = (2 * lane_elems / SamplesPerPixel) * SamplesPerPixel;
+
+    /// Applied to the low lane moved into the high lane: every sample of the
+    /// high lane picks the last sample of its channel in the low lane
+    static constexpr std::array<int8_t, 32> make_lane_table() noexcept {
+        std::array<int8_t, 32> table{};
+        for (std::size_t b = 0; b < 32; ++b) {
+            if (b < 16) {
+                table[b] = -1; // zeroed
+                continue;
+            }
+            std::size_t channel = (lane_elems + (b - 16) / ElemBytes) % SamplesPerPixel;
+            std::size_t last = lane_elems - 1;
+            std::size_t src = last - ((last % SamplesPerPixel + SamplesPerPixel - channel) % SamplesPerPixel);
+            table[b] = static_cast<int8_t>(src * ElemBytes + b % ElemBytes);
+        }
+        return table;
+    }
+
+    /// Applied to the high lane copied into both lanes: every sample picks
+    /// its channel in the last whole pixel of the register
+    static constexpr std::array<int8_t, 32> make_carry_table() noexcept {
+        std::array<int8_t, 32> table{};
+        for (std::size_t b = 0; b < 32; ++b) {
+            std::size_t channel = (b / ElemBytes) % SamplesPerPixel;
+            std::size_t src = step - SamplesPerPixel + channel - lane_elems;
+            table[b] = static_cast<int8_t>(src * ElemBytes + b % ElemBytes);
+        }
+        return table;
+    }
+
+    static constexpr std::array<int8_t, 32> lane = make_lane_table();
+    static constexpr std::array<int8_t, 32> carry = make_carry_table();
+};
+
+template <typename U>
+TIFFCONCEPT_TARGET_AVX2 inline __m256i add_256(__m256i a, __m256i b) noexcept {
+    if constexpr (sizeof(U) == 1) {
+        return _mm256_add_epi8(a, b);
+    } else {
+        return _mm256_add_epi16(a, b);
+    }
+}
+
+/// Per 128-bit lane counterpart of prefix_sum_128
+template <typename U, int Shift>
+TIFFCONCEPT_TARGET_AVX2 inline __m256i prefix_sum_256(__m256i v) noexcept {
+    if constexpr (Shift < 16) {
+        return prefix_sum_256<U, Shift * 2>(add_256<U>(v, _mm256_slli_si256(v, Shift)));
+    } else {
+        return v;
+    }
+}
+
+/// Decode one row of `count` samples (AVX2)
+template <typename U, std::size_t SamplesPerPixel>
+TIFFCONCEPT_TARGET_AVX2 inline void delta_decode_row_avx2(U* row, std::size_t count) noexcept {
+    using Tables = Avx2CarryTables<sizeof(U), SamplesPerPixel>;
+    constexpr std::size_t lanes = 32 / sizeof(U);
+    constexpr std::size_t step = Tables::step;
+    constexpr int pixel_bytes = static_cast<int>(SamplesPerPixel * sizeof(U));
+
+    std::size_t done = SamplesPerPixel;
+    if (count >= lanes) {
+        const __m256i lane_table = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(Tables::lane.data()));
+        const __m256i carry_table = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(Tables::carry.data()));
+
+        std::size_t i = 0;
+        __m256i carry = _mm256_setzero_si256();
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(row));
+        while (true) {
+            __m256i sums = prefix_sum_256<U, pixel_bytes>(v);
+            // Low lane into the high lane (low lane zeroed)
+            __m256i low = _mm256_permute2x128_si256(sums, sums, 0x08);
+            sums = add_256<U>(sums, _mm256_shuffle_epi8(low, lane_table));
+            __m256i out = add_256<U>(sums, carry);
+            // High lane into both lanes
+            __m256i high = _mm256_permute2x128_si256(sums, sums, 0x11);
+            carry = add_256<U>(carry, _mm256_shuffle_epi8(high, carry_table));
+
+            const bool more = i + step + lanes <= count;
+            if (more) {
+                v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(row + i + step));
+            }
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(row + i), out);
+            if (!more) {
+                break;
+            }
+            i += step;
+        }
+        done = i + lanes;
+    }
+
+    for (std::size_t i = done; i < count; ++i) {
+        row[i] += row[i - SamplesPerPixel];
+    }
+}
+
+// ============================================================================
+// Row loops
+// ============================================================================
+
+template <typename U, std::size_t SamplesPerPixel>
+inline void delta_decode_horizontal_sse2(
+    U* data, std::size_t width, std::size_t height, std::size_t stride) noexcept {
+    for (std::size_t y = 0; y < height; ++y) {
+        delta_decode_row_sse2<U, SamplesPerPixel>(data + y * stride, width * SamplesPerPixel);
+    }
+}
+
+template <typename U, std::size_t SamplesPerPixel>
+TIFFCONCEPT_TARGET_AVX2 inline void delta_decode_horizontal_avx2(
+    U* data, std::size_t width, std::size_t height, std::size_t stride) noexcept {
+    for (std::size_t y = 0; y < height; ++y) {
+        delta_decode_row_avx2<U, SamplesPerPixel>(data + y * stride, width * SamplesPerPixel);
+    }
+}
+
+// ============================================================================
+// Floating point predictor kernels
+// ============================================================================
+//
+// A block of samples is loaded as one register per byte plane (most
+// significant plane first), and converted from/to consecutive samples with
+// byte interleaving networks (unpack to interleave, pack to deinterleave).
+// Decoding accumulates each plane register on the fly, like the horizontal
+// kernels; the running sums start at the totals of the previous planes,
+// computed beforehand. Encoding differences each plane register with itself
+// shifted by one pixel.
+// Registers of AVX2 blocks hold the first half of the block in their low
+// lane and the second half in their high lane, so that the networks (which
+// work per lane) produce contiguous planes.
+
+/// Interleave the bytes of two registers (even bytes from `even`)
+inline void merge_bytes_128(__m128i even, __m128i odd, __m128i& lo, __m128i& hi) noexcept {
+    lo = _mm_unpacklo_epi8(even, odd);
+    hi = _mm_unpackhi_epi8(even, odd);
+}
+
+/// Inverse of merge_bytes_128
+inline void split_bytes_128(__m128i lo, __m128i hi, __m128i& even, __m128i& odd) noexcept {
+    const __m128i mask = _mm_set1_epi16(0x00FF);
+    even = _mm_packus_epi16(_mm_and_si128(lo, mask), _mm_and_si128(hi, mask));
+    odd = _mm_packus_epi16(_mm_srli_epi16(lo, 8), _mm_srli_epi16(hi, 8));
+}
+
+/// 4 x 24-bit samples held in 32-bit lanes to 12 packed bytes (last 4 bytes zero)
+inline __m128i pack_24_128(__m128i v) noexcept {
+    __m128i pairs = _mm_or_si128(
+        _mm_and_si128(v, _mm_set1_epi64x(0x0000000000FFFFFF)),
+        _mm_and_si128(_mm_srli_epi64(v, 8), _mm_set1_epi64x(0x0000FFFFFF000000)));
+    return _mm_or_si128(
+        _mm_and_si128(pairs, _mm_set_epi64x(0, -1)),
+        _mm_srli_si128(_mm_and_si128(pairs, _mm_set_epi64x(-1, 0)), 2));
+}
+
+/// Inverse of pack_24_128 (only the first 12 bytes of `v` are used)
+inline __m128i unpack_24_128(__m128i v) noexcept {
+    __m128i pairs = _mm_or_si128(
+        _mm_and_si128(v, _mm_set_epi64x(0, 0x0000FFFFFFFFFFFF)),
+        _mm_and_si128(_mm_slli_si128(v, 2), _mm_set_epi64x(0x0000FFFFFFFFFFFF, 0)));
+    return _mm_or_si128(
+        _mm_and_si128(pairs, _mm_set1_epi64x(0x0000000000FFFFFF)),
+        _mm_and_si128(_mm_slli_epi64(pairs, 8), _mm_set1_epi64x(0x00FFFFFF00000000)));
+}
+
+/// Number of registers holding 16 samples of the given size
+template <std::size_t Bytes>
+inline constexpr std::size_t fp_sample_registers = Bytes == 3 ? 4 : Bytes;
+
+/// Byte planes to samples (16 samples)
+/// @param b Planes in memory byte order (b[0] holds byte 0 of every sample)
+/// @param out Consecutive samples; for Float24, 12 bytes (4 samples) per register
+template <std::size_t Bytes>
+inline void interleave_128(const __m128i* b, __m128i* out) noexcept {
+    if constexpr (Bytes == 2) {
+        merge_bytes_128(b[0], b[1], out[0], out[1]);
+    } else if constexpr (Bytes == 3 || Bytes == 4) {
+        __m128i top = _mm_setzero_si128();
+        if constexpr (Bytes == 4) {
+            top = b[3];
+        }
+        __m128i e01, e23, o01, o23;
+        merge_bytes_128(b[0], b[2], e01, e23);
+        merge_bytes_128(b[1], top, o01, o23);
+        merge_bytes_128(e01, o01, out[0], out[1]);
+        merge_bytes_128(e23, o23, out[2], out[3]);
+        if constexpr (Bytes == 3) {
+            for (std::size_t i = 0; i < 4; ++i) {
+                out[i] = pack_24_128(out[i]);
+            }
+        }
+    } else {
+        __m128i ee[2], eo[2], oe[2], oo[2], e[4], o[4];
+        merge_bytes_128(b[0], b[4], ee[0], ee[1]);
+        merge_bytes_128(b[2], b[6], eo[0], eo[1]);
+        merge_bytes_128(b[1], b[5], oe[0], oe[1]);
+        merge_bytes_128(b[3], b[7], oo[0], oo[1]);
+        merge_bytes_128(ee[0], eo[0], e[0], e[1]);
+        merge_bytes_128(ee[1], eo[1], e[2], e[3]);
+        merge_bytes_128(oe[0], oo[0], o[0], o[1]);
+        merge_bytes_128(oe[1], oo[1], o[2], o[3]);
+        for (std::size_t i = 0; i < 4; ++i) {
+            merge_bytes_128(e[i], o[i], out[2 * i], out[2 * i + 1]);
+        }
+    }
+}
+
+/// Samples to byte planes (16 samples), inverse of interleave_128
+template <std::size_t Bytes>
+inline void deinterleave_128(const __m128i* in, __m128i* b) noexcept {
+    if constexpr (Bytes == 2) {
+        split_bytes_128(in[0], in[1], b[0], b[1]);
+    } else if constexpr (Bytes == 3 || Bytes == 4) {
+        __m128i w[4];
+        for (std::size_t i = 0; i < 4; ++i) {
+            w[i] = Bytes == 3 ? unpack_24_128(in[i]) : in[i];
+        }
+        __m128i e01, e23, o01, o23, top;
+        split_bytes_128(w[0], w[1], e01, o01);
+        split_bytes_128(w[2], w[3], e23, o23);
+        split_bytes_128(e01, e23, b[0], b[2]);
+        split_bytes_128(o01, o23, b[1], top);
+        if constexpr (Bytes == 4) {
+            b[3] = top;
+        }
+    } else {
+        __m128i ee[2], eo[2], oe[2], oo[2], e[4], o[4];
+        for (std::size_t i = 0; i < 4; ++i) {
+            split_bytes_128(in[2 * i], in[2 * i + 1], e[i], o[i]);
+        }
+        split_bytes_128(e[0], e[1], ee[0], eo[0]);
+        split_bytes_128(e[2], e[3], ee[1], eo[1]);
+        split_bytes_128(o[0], o[1], oe[0], oo[0]);
+        split_bytes_128(o[2], o[3], oe[1], oo[1]);
+        split_bytes_128(ee[0], ee[1], b[0], b[4]);
+        split_bytes_128(eo[0], eo[1], b[2], b[6]);
+        split_bytes_128(oe[0], oe[1], b[1], b[5]);
+        split_bytes_128(oo[0], oo[1], b[3], b[7]);
+    }
+}
+
+/// Starting value of the running sums of each plane: per-channel totals of
+/// the planes before it (the accumulation runs over the whole row of planes)
+/// @param offsets Output, offsets[s * SamplesPerPixel + channel]
+template <std::size_t Bytes, std::size_t SamplesPerPixel>
+inline void fp_plane_offsets(const uint8_t* planes, std::size_t count, uint8_t* offsets) noexcept {
+    constexpr std::size_t K = SamplesPerPixel;
+    uint8_t running[K] = {};
+    for (std::size_t s = 0; s < Bytes; ++s) {
+        for (std::size_t j = 0; j < K; ++j) {
+            offsets[s * K + j] = running[j];
+        }
+        if (s + 1 == Bytes) {
+            break;
+        }
+        // Lane b of the byte-wise sum only holds channel b % K, as K divides 16
+        const uint8_t* plane = planes + s * count;
+        __m128i acc = _mm_setzero_si128();
+        std::size_t i = 0;
+        for (; i + 16 <= count; i += 16) {
+            acc = _mm_add_epi8(acc, _mm_loadu_si128(reinterpret_cast<const __m128i*>(plane + i)));
+        }
+        alignas(16) uint8_t lanes[16];
+        _mm_store_si128(reinterpret_cast<__m128i*>(lanes), acc);
+        for (std::size_t b = 0; b < 16; ++b) {
+            running[b % K] += lanes[b];
+        }
+        for (; i < count; ++i) {
+            running[i % K] += plane[i];
+        }
+    }
+}
+
+/// Scalar end of a row for the decode kernels (c >= SamplesPerPixel)
+template <std::size_t Bytes, std::size_t SamplesPerPixel>
+inline void fp_decode_tail(const uint8_t* planes, uint8_t* samples, std::size_t count, std::size_t c) noexcept {
+    const uint8_t* src = planes + c;
+    uint8_t* dst = samples + c * Bytes;
+    for (std::size_t n = count - c; n > 0; --n, ++src, dst += Bytes) {
+        const uint8_t* plane = src;
+        for (std::size_t s = 0; s < Bytes; ++s, plane += count) {
+            const std::size_t b = Bytes - 1 - s;
+            uint8_t v = *plane;
+            if constexpr (SamplesPerPixel != 0) {
+                v += (dst - SamplesPerPixel * Bytes)[b];
+            }
+            dst[b] = v;
+        }
+    }
+}
+
+/// Scalar end of a row for the encode kernels (c >= SamplesPerPixel)
+template <std::size_t Bytes, std::size_t SamplesPerPixel>
+inline void fp_encode_tail(const uint8_t* samples, uint8_t* planes, std::size_t count, std::size_t c) noexcept {
+    const uint8_t* src = samples + c * Bytes;
+    uint8_t* dst = planes + c;
+    for (std::size_t n = count - c; n > 0; --n, src += Bytes, ++dst) {
+        uint8_t* plane = dst;
+        for (std::size_t s = 0; s < Bytes; ++s, plane += count) {
+            const std::size_t b = Bytes - 1 - s;
+            uint8_t v = src[b];
+            if constexpr (SamplesPerPixel != 0) {
+                v -= (src - SamplesPerPixel * Bytes)[b];
+            }
+            *plane = v;
+        }
+    }
+}
+
+/// Decode one row of floating point predictor data (SSE2)
+/// @tparam SamplesPerPixel 1, 2 or 4 to accumulate the planes on the fly,
+///         0 if `planes` is already accumulated
+/// @param planes Byte planes of the row, most significant first (count bytes each)
+/// @param samples Output samples
+/// @param count Number of samples in the row, at least 32
+template <std::size_t Bytes, std::size_t SamplesPerPixel>
+inline void fp_decode_row_sse2(const uint8_t* planes, uint8_t* samples, std::size_t count) noexcept {
+    constexpr std::size_t K = SamplesPerPixel;
+    constexpr std::size_t regs = fp_sample_registers<Bytes>;
+    constexpr std::size_t chunk_bytes = Bytes == 3 ? 12 : 16;
+    // Float24 chunks are written with 16-byte stores: the last one of a
+    // block overflows by 4 bytes (2 samples), which must stay in the row
+    constexpr std::size_t slack = Bytes == 3 ? 2 : 0;
+
+    __m128i carry[Bytes];
+    if constexpr (K != 0) {
+        uint8_t offsets[Bytes * (K == 0 ? 1 : K)];
+        fp_plane_offsets<Bytes, K>(planes, count, offsets);
+        for (std::size_t s = 0; s < Bytes; ++s) {
+            alignas(16) uint8_t pattern[16];
+            for (std::size_t b = 0; b < 16; ++b) {
+                pattern[b] = offsets[s * K + b % K];
+            }
+            carry[s] = _mm_load_si128(reinterpret_cast<const __m128i*>(pattern));
+        }
+    }
+
+    std::size_t c = 0;
+    for (; c + 16 + slack <= count; c += 16) {
+        __m128i b[Bytes];
+        for (std::size_t s = 0; s < Bytes; ++s) {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(planes + s * count + c));
+            if constexpr (K != 0) {
+                __m128i sums = prefix_sum_128<uint8_t, static_cast<int>(K)>(v);
+                v = _mm_add_epi8(sums, carry[s]);
+                carry[s] = _mm_add_epi8(carry[s], broadcast_pixel_128<static_cast<int>(K), 16>(sums));
+            }
+            b[Bytes - 1 - s] = v;
+        }
+        __m128i out[regs];
+        interleave_128<Bytes>(b, out);
+        uint8_t* dst = samples + c * Bytes;
+        for (std::size_t i = 0; i < regs; ++i) {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i * chunk_bytes), out[i]);
+        }
+    }
+
+    fp_decode_tail<Bytes, K>(planes, samples, count, c);
+}
+
+/// Encode one row of floating point predictor data (SSE2)
+/// @tparam SamplesPerPixel 1 to 4 to difference the planes on the fly,
+///         0 to only split the samples into planes
+/// @param samples Input samples, readable up to 16 bytes past the row
+/// @param planes Output byte planes, most significant first (count bytes each)
+/// @param count Number of samples in the row, at least 32
+template <std::size_t Bytes, std::size_t SamplesPerPixel>
+inline void fp_encode_row_sse2(const uint8_t* samples, uint8_t* planes, std::size_t count) noexcept {
+    constexpr std::size_t K = SamplesPerPixel;
+    constexpr std::size_t regs = fp_sample_registers<Bytes>;
+    constexpr std::size_t chunk_bytes = Bytes == 3 ? 12 : 16;
+
+    // Previous register of each plane: the first one continues the end of
+    // the previous plane (only its last K bytes are used)
+    __m128i prev[Bytes];
+    if constexpr (K != 0) {
+        for (std::size_t s = 0; s < Bytes; ++s) {
+            alignas(16) uint8_t init[16] = {};
+            if (s > 0) {
+                for (std::size_t t = 0; t < K; ++t) {
+                    init[16 - K + t] = samples[(count - K + t) * Bytes + (Bytes - s)];
+                }
+            }
+            prev[s] = _mm_load_si128(reinterpret_cast<const __m128i*>(init));
+        }
+    }
+
+    std::size_t c = 0;
+    for (; c + 16 <= count; c += 16) {
+        const uint8_t* src = samples + c * Bytes;
+        __m128i in[regs];
+        for (std::size_t i = 0; i < regs; ++i) {
+            in[i] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i * chunk_bytes));
+        }
+        __m128i b[Bytes];
+        deinterleave_128<Bytes>(in, b);
+        for (std::size_t s = 0; s < Bytes; ++s) {
+            __m128i v = b[Bytes - 1 - s];
+            if constexpr (K != 0) {
+                constexpr int shift = static_cast<int>(K);
+                __m128i before = _mm_or_si128(_mm_slli_si128(v, shift), _mm_srli_si128(prev[s], 16 - shift));
+                prev[s] = v;
+                v = _mm_sub_epi8(v, before);
+            }
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(planes + s * count + c), v);
+        }
+    }
+
+    fp_encode_tail<Bytes, K>(samples, planes, count, c);
+}
+
+/// Interleave the bytes of two registers, per 128-bit lane
+TIFFCONCEPT_TARGET_AVX2 inline void merge_bytes_256(__m256i even, __m256i odd, __m256i& lo, __m256i& hi) noexcept {
+    lo = _mm256_unpacklo_epi8(even, odd);
+    hi = _mm256_unpackhi_epi8(even, odd);
+}
+
+/// Inverse of merge_bytes_256
+TIFFCONCEPT_TARGET_AVX2 inline void split_bytes_256(__m256i lo, __m256i hi, __m256i& even, __m256i& odd) noexcept {
+    const __m256i mask = _mm256_set1_epi16(0x00FF);
+    even = _mm256_packus_epi16(_mm256_and_si256(lo, mask), _mm256_and_si256(hi, mask));
+    odd = _mm256_packus_epi16(_mm256_srli_epi16(lo, 8), _mm256_srli_epi16(hi, 8));
+}
+
+/// Per-lane counterpart of interleave_128 (2, 4 or 8 byte samples)
+template <std::size_t Bytes>
+TIFFCONCEPT_TARGET_AVX2 inline void interleave_256(const __m256i* b, __m256i* out) noexcept {
+    if constexpr (Bytes == 2) {
+        merge_bytes_256(b[0], b[1], out[0], out[1]);
+    } else if constexpr (Bytes == 4) {
+        __m256i e01, e23, o01, o23;
+        merge_bytes_256(b[0], b[2], e01, e23);
+        merge_bytes_256(b[1], b[3], o01, o23);
+        merge_bytes_256(e01, o01, out[0], out[1]);
+        merge_bytes_256(e23, o23, out[2], out[3]);
+    } else {
+        __m256i ee[2], eo[2], oe[2], oo[2], e[4], o[4];
+        merge_bytes_256(b[0], b[4], ee[0], ee[1]);
+        merge_bytes_256(b[2], b[6], eo[0], eo[1]);
+        merge_bytes_256(b[1], b[5], oe[0], oe[1]);
+        merge_bytes_256(b[3], b[7], oo[0], oo[1]);
+        merge_bytes_256(ee[0], eo[0], e[0], e[1]);
+        merge_bytes_256(ee[1], eo[1], e[2], e[3]);
+        merge_bytes_256(oe[0], oo[0], o[0], o[1]);
+        merge_bytes_256(oe[1], oo[1], o[2], o[3]);
+        for (std::size_t i = 0; i < 4; ++i) {
+            merge_bytes_256(e[i], o[i], out[2 * i], out[2 * i + 1]);
+        }
+    }
+}
+
+/// Per-lane counterpart of deinterleave_128 (2, 4 or 8 byte samples)
+template <std::size_t Bytes>
+TIFFCONCEPT_TARGET_AVX2 inline void deinterleave_256(const __m256i* in, __m256i* b) noexcept {
+    if constexpr (Bytes == 2) {
+        split_bytes_256(in[0], in[1], b[0], b[1]);
+    } else if constexpr (Bytes == 4) {
+        __m256i e01, e23, o01, o23;
+        split_bytes_256(in[0], in[1], e01, o01);
+        split_bytes_256(in[2], in[3], e23, o23);
+        split_bytes_256(e01, e23, b[0], b[2]);
+        split_bytes_256(o01, o23, b[1], b[3]);
+    } else {
+        __m256i ee[2], eo[2], oe[2], oo[2], e[4], o[4];
+        for (std::size_t i = 0; i < 4; ++i) {
+            split_bytes_256(in[2 * i], in[2 * i + 1], e[i], o[i]);
+        }
+        split_bytes_256(e[0], e[1], ee[0], eo[0]);
+        split_bytes_256(e[2], e[3], ee[1], eo[1]);
+        split_bytes_256(o[0], o[1], oe[0], oo[0]);
+        split_bytes_256(o[2], o[3], oe[1], oo[1]);
+        split_bytes_256(ee[0], ee[1], b[0], b[4]);
+        split_bytes_256(eo[0], eo[1], b[2], b[6]);
+        split_bytes_256(oe[0], oe[1], b[1], b[5]);
+        split_bytes_256(oo[0], oo[1], b[3], b[7]);
+    }
+}
+
+/// Decode one row of floating point predictor data (AVX2, 2, 4 or 8 byte samples)
+/// Same contract as fp_decode_row_sse2
+template <std::size_t Bytes, std::size_t SamplesPerPixel>
+TIFFCONCEPT_TARGET_AVX2 inline void fp_decode_row_avx2(const uint8_t* planes, uint8_t* samples, std::size_t count) noexcept {
+    constexpr std::size_t K = SamplesPerPixel;
+    constexpr std::size_t half = Bytes / 2;
+
+    __m256i carry[Bytes];
+    __m256i lane_table = _mm256_setzero_si256();
+    __m256i carry_table = _mm256_setzero_si256();
+    if constexpr (K != 0) {
+        using Tables = Avx2CarryTables<1, K>;
+        lane_table = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Tables::lane.data()));
+        carry_table = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Tables::carry.data()));
+
+        uint8_t offsets[Bytes * (K == 0 ? 1 : K)];
+        fp_plane_offsets<Bytes, K>(planes, count, offsets);
+        for (std::size_t s = 0; s < Bytes; ++s) {
+            alignas(32) uint8_t pattern[32];
+            for (std::size_t b = 0; b < 32; ++b) {
+                pattern[b] = offsets[s * K + b % K];
+            }
+            carry[s] = _mm256_load_si256(reinterpret_cast<const __m256i*>(pattern));
+        }
+    }
+
+    std::size_t c = 0;
+    for (; c + 32 <= count; c += 32) {
+        __m256i b[Bytes];
+        for (std::size_t s = 0; s < Bytes; ++s) {
+            __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(planes + s * count + c));
+            if constexpr (K != 0) {
+                __m256i sums = prefix_sum_256<uint8_t, static_cast<int>(K)>(v);
+                __m256i low = _mm256_permute2x128_si256(sums, sums, 0x08);
+                sums = _mm256_add_epi8(sums, _mm256_shuffle_epi8(low, lane_table));
+                v = _mm256_add_epi8(sums, carry[s]);
+                __m256i high = _mm256_permute2x128_si256(sums, sums, 0x11);
+                carry[s] = _mm256_add_epi8(carry[s], _mm256_shuffle_epi8(high, carry_table));
+            }
+            b[Bytes - 1 - s] = v;
+        }
+        __m256i out[Bytes];
+        interleave_256<Bytes>(b, out);
+        // out[i] holds chunk i of both halves of the block
+        __m256i* dst = reinterpret_cast<__m256i*>(samples + c * Bytes);
+        for (std::size_t j = 0; j < half; ++j) {
+            _mm256_storeu_si256(dst + j, _mm256_permute2x128_si256(out[2 * j], out[2 * j + 1], 0x20));
+            _mm256_storeu_si256(dst + j + half, _mm256_permute2x128_si256(out[2 * j], out[2 * j + 1], 0x31));
+        }
+    }
+
+    fp_decode_tail<Bytes, K>(planes, samples, count, c);
+}
+
+/// Encode one row of floating point predictor data (AVX2, 2, 4 or 8 byte samples)
+/// Same contract as fp_encode_row_sse2
+template <std::size_t Bytes, std::size_t SamplesPerPixel>
+TIFFCONCEPT_TARGET_AVX2 inline void fp_encode_row_avx2(const uint8_t* samples, uint8_t* planes, std::size_t count) noexcept {
+    constexpr std::size_t K = SamplesPerPixel;
+    constexpr std::size_t half = Bytes / 2;
+
+    __m256i prev[Bytes];
+    if constexpr (K != 0) {
+        for (std::size_t s = 0; s < Bytes; ++s) {
+            alignas(32) uint8_t init[32] = {};
+            if (s > 0) {
+                for (std::size_t t = 0; t < K; ++t) {
+                    init[32 - K + t] = samples[(count - K + t) * Bytes + (Bytes - s)];
+                }
+            }
+            prev[s] = _mm256_load_si256(reinterpret_cast<const __m256i*>(init));
+        }
+    }
+
+    std::size_t c = 0;
+    for (; c + 32 <= count; c += 32) {
+        const __m256i* src = reinterpret_cast<const __m256i*>(samples + c * Bytes);
+        // Chunk i of both halves of the block in in[i]
+        __m256i in[Bytes];
+        for (std::size_t j = 0; j < half; ++j) {
+            __m256i first = _mm256_loadu_si256(src + j);
+            __m256i second = _mm256_loadu_si256(src + j + half);
+            in[2 * j] = _mm256_permute2x128_si256(first, second, 0x20);
+            in[2 * j + 1] = _mm256_permute2x128_si256(first, second, 0x31);
+        }
+        __m256i b[Bytes];
+        deinterleave_256<Bytes>(in, b);
+        for (std::size_t s = 0; s < Bytes; ++s) {
+            __m256i v = b[Bytes - 1 - s];
+            if constexpr (K != 0) {
+                // v shifted up by K bytes across lanes, with the end of prev below
+                __m256i below = _mm256_permute2x128_si256(prev[s], v, 0x21);
+                __m256i before = _mm256_alignr_epi8(v, below, static_cast<int>(16 - K));
+                prev[s] = v;
+                v = _mm256_sub_epi8(v, before);
+            }
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(planes + s * count + c), v);
+        }
+    }
+
+    fp_encode_tail<Bytes, K>(samples, planes, count, c);
+}
+
+#endif // TIFFCONCEPT_X86_64
+
+/// Whether delta_decode_horizontal_simd() has a kernel for this configuration
+/// 3 x 16-bit pixels are left to the scalar code on SSE2: a register only
+/// holds 2 of them and the kernel is slower than the scalar loop
+template <DeltaDecodableInteger T>
+[[nodiscard]] inline bool has_horizontal_kernel(
+    std::size_t samples_per_pixel, cpu::SimdLevel level) noexcept {
+    if (sizeof(T) > 2 || samples_per_pixel < 1 || samples_per_pixel > 4) {
+        return false;
+    }
+    if (level == cpu::SimdLevel::SSE2) {
+        return sizeof(T) == 1 || samples_per_pixel != 3;
+    }
+    return level == cpu::SimdLevel::AVX2;
+}
+
+/// Vectorized horizontal predictor decoding at the given SIMD level
+/// The caller checks has_horizontal_kernel() first
+/// Signed samples go through the unsigned kernels: the wrap-around sums are identical
+template <DeltaDecodableInteger T>
+inline void delta_decode_horizontal_simd(
+    std::span<T> buffer,
+    std::size_t width,
+    std::size_t height,
+    std::size_t stride,
+    std::size_t samples_per_pixel,
+    [[maybe_unused]] cpu::SimdLevel level) noexcept {
+#if defined(TIFFCONCEPT_X86_64)
+    if constexpr (sizeof(T) <= 2) {
+        using U = std::make_unsigned_t<T>;
+        U* data = reinterpret_cast<U*>(buffer.data());
+        if (level == cpu::SimdLevel::AVX2) {
+            switch (samples_per_pixel) {
+                case 1: delta_decode_horizontal_avx2<U, 1>(data, width, height, stride); return;
+                case 2: delta_decode_horizontal_avx2<U, 2>(data, width, height, stride); return;
+                case 3: delta_decode_horizontal_avx2<U, 3>(data, width, height, stride); return;
+                case 4: delta_decode_horizontal_avx2<U, 4>(data, width, height, stride); return;
+                default: return;
+            }
+        }
+        switch (samples_per_pixel) {
+            case 1: delta_decode_horizontal_sse2<U, 1>(data, width, height, stride); return;
+            case 2: delta_decode_horizontal_sse2<U, 2>(data, width, height, stride); return;
+            case 3:
+                if constexpr (sizeof(U) == 1) {
+                    delta_decode_horizontal_sse2<U, 3>(data, width, height, stride);
+                }
+                return;
+            case 4: delta_decode_horizontal_sse2<U, 4>(data, width, height, stride); return;
+            default: return;
+        }
+    }
+#else
+    (void)buffer; (void)width; (void)height; (void)stride; (void)samples_per_pixel;
+#endif
+}
+
+/// Whether fp_decode_row_simd()/fp_encode_row_simd() should be used for rows
+/// of `count` samples (shorter rows are not worth the setup)
+template <DeltaDecodableFloat FloatType>
+[[nodiscard]] inline bool has_fp_kernel(std::size_t count, cpu::SimdLevel level) noexcept {
+#if defined(TIFFCONCEPT_X86_64)
+    if constexpr (DeltaDecodableNativeFloat<FloatType> && std::endian::native != std::endian::little) {
+        return false;
+    }
+    return level != cpu::SimdLevel::Scalar && count >= 32;
+#else
+    (void)count; (void)level;
+    return false;
+#endif
+}
+
+/// Vectorized floating point predictor decoding of one row
+/// The caller checks has_fp_kernel() first
+/// @param planes Byte planes of the row, most significant first (clobbered)
+/// @param samples Output samples
+template <DeltaDecodableFloat FloatType>
+inline void fp_decode_row_simd(
+    uint8_t* planes,
+    uint8_t* samples,
+    std::size_t count,
+    std::size_t samples_per_pixel,
+    [[maybe_unused]] cpu::SimdLevel level) noexcept {
+#if defined(TIFFCONCEPT_X86_64)
+    constexpr std::size_t bytes = sizeof(FloatType);
+    const bool avx2 = bytes != 3 && level == cpu::SimdLevel::AVX2;
+    auto decode = [&]<std::size_t K>() {
+        if constexpr (bytes != 3) {
+            if (avx2) {
+                fp_decode_row_avx2<bytes, K>(planes, samples, count);
+                return;
+            }
+        }
+        fp_decode_row_sse2<bytes, K>(planes, samples, count);
+    };
+    switch (samples_per_pixel) {
+        case 1: decode.template operator()<1>(); return;
+        case 2: decode.template operator()<2>(); return;
+        case 4: decode.template operator()<4>(); return;
+        default: break;
+    }
+    // Other pixel sizes do not divide the registers: accumulate the planes
+    // first (they form a single row of count * bytes bytes), then interleave
+    const std::size_t n = count * bytes;
+    if (has_horizontal_kernel<uint8_t>(samples_per_pixel, level)) {
+        delta_decode_horizontal_simd<uint8_t>(std::span<uint8_t>(planes, n), n / samples_per_pixel, 1, n, samples_per_pixel, level);
+        // The kernel works on whole pixels: finish the bytes left over
+        for (std::size_t i = n - n % samples_per_pixel; i < n; ++i) {
+            planes[i] += planes[i - samples_per_pixel];
+        }
+    } else {
+        for (std::size_t i = samples_per_pixel; i < n; ++i) {
+            planes[i] += planes[i - samples_per_pixel];
+        }
+    }
+    decode.template operator()<0>();
+#else
+    (void)planes; (void)samples; (void)count; (void)samples_per_pixel;
+#endif
+}
+
+/// Vectorized floating point predictor encoding of one row
+/// The caller checks has_fp_kernel() first
+/// @param samples Input samples, readable up to 16 bytes past the row
+/// @param planes Output byte planes, most significant first
+template <DeltaDecodableFloat FloatType>
+inline void fp_encode_row_simd(
+    const uint8_t* samples,
+    uint8_t* planes,
+    std::size_t count,
+    std::size_t samples_per_pixel,
+    [[maybe_unused]] cpu::SimdLevel level) noexcept {
+#if defined(TIFFCONCEPT_X86_64)
+    constexpr std::size_t bytes = sizeof(FloatType);
+    const bool avx2 = bytes != 3 && level == cpu::SimdLevel::AVX2;
+    auto encode = [&]<std::size_t K>() {
+        if constexpr (bytes != 3) {
+            if (avx2) {
+                fp_encode_row_avx2<bytes, K>(samples, planes, count);
+                return;
+            }
+        }
+        fp_encode_row_sse2<bytes, K>(samples, planes, count);
+    };
+    switch (samples_per_pixel) {
+        case 1: encode.template operator()<1>(); return;
+        case 2: encode.template operator()<2>(); return;
+        case 3: encode.template operator()<3>(); return;
+        case 4: encode.template operator()<4>(); return;
+        default: break;
+    }
+    encode.template operator()<0>();
+    for (std::size_t i = count * bytes; i-- > samples_per_pixel;) {
+        planes[i] -= planes[i - samples_per_pixel];
+    }
+#else
+    (void)samples; (void)planes; (void)count; (void)samples_per_pixel;
+#endif
+}
+
+} // namespace simd
+
+} // namespace detail
+
+} // namespace predictor
+
+} // namespace tiffconcept
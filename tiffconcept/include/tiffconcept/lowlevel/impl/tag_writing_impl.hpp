@@ -104,7 +104,8 @@ template <typename TagDesc, std::endian TargetEndian, typename ValueType>
         } else {
             // Container of scalars
             using RefType = typename TagDesc::reference_type;
-            if constexpr (TargetEndian == std::endian::native && std::is_same_v<ElementType, RefType>) {
+            if constexpr (TargetEndian == std::endian::native && std::is_same_v<ElementType, RefType> &&
+                          requires { value.data(); }) {
                 std::memcpy(dest, value.data(), value.size() * sizeof(ElementType));
             } else {
                 std::size_t offset = 0;
@@ -152,8 +153,8 @@ template <typename TagDesc, typename ValueType>
         }
         return total_size;
     }
-    // For std::vector (count = dynamic size)
-    else if constexpr (requires { value.size(); value.data(); typename RawType::value_type; } &&
+    // For std::vector, TagArrayView (count = dynamic size)
+    else if constexpr (requires { value.size(); typename RawType::value_type; } &&
                        !requires { std::tuple_size<RawType>::value; }) {
         return value.size() * type_size;
     }
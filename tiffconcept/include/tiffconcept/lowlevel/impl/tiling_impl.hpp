@@ -527,7 +527,7 @@ inline void copy_tile_to_tile(
         }
     }
     else {
-        static_assert(false, "Unsupported combination of input and output specifications");
+        static_assert(sizeof(PixelType) == 0, "Unsupported combination of input and output specifications");
     }
 }
 
@@ -576,7 +576,7 @@ inline void copy_tile_to_buffer(
             copy_dims, dst_pos, src_pos
         );
     } else {
-        static_assert(false, "Unsupported PlanarConfiguration");
+        static_assert(sizeof(PixelType) == 0, "Unsupported PlanarConfiguration");
     }
 }
 
@@ -851,12 +851,25 @@ Result<void> TiledImageInfo<PixelType>::update_from_metadata(
         );
     }
     
-    // Copy vector data (reuses allocation if size matches)
+    // Share lazy arrays, copy containers (reuses allocation if not shared)
     const auto& offsets = optional::unwrap_value(tile_offsets_val);
     const auto& byte_counts = optional::unwrap_value(tile_byte_counts_val);
     
-    tile_offsets_.assign(offsets.begin(), offsets.end());
-    tile_byte_counts_.assign(byte_counts.begin(), byte_counts.end());
+    if constexpr (detail::is_tag_array_view_v<std::remove_cvref_t<decltype(offsets)>> &&
+                  std::is_constructible_v<TagArrayView<std::size_t>, decltype(offsets)>) {
+        tile_offsets_ = TagArrayView<std::size_t>(offsets);
+    } else {
+        tile_offsets_.assign(offsets);
+    }
+    if constexpr (detail::is_tag_array_view_v<std::remove_cvref_t<decltype(byte_counts)>> &&
+                  std::is_constructible_v<TagArrayView<std::size_t>, decltype(byte_counts)>) {
+        tile_byte_counts_ = TagArrayView<std::size_t>(byte_counts);
+    } else {
+        tile_byte_counts_.assign(byte_counts);
+    }
+    if (tile_byte_counts_.size() < tile_offsets_.size()) [[unlikely]] {
+        return Err(Error::Code::InvalidTag, "TileByteCounts has fewer entries than TileOffsets");
+    }
     
     compression_ = optional::extract_tag_or<TagCode::Compression, TagSpec>(
         metadata, CompressionScheme::None
@@ -5,6 +5,7 @@
 #include <cstdint>
 #include <span>
 #include "../types/tiff_spec.hpp"
+#include "cpu_features.hpp"
 
 namespace tiffconcept {
 
@@ -43,6 +44,9 @@ concept DeltaDecodable = DeltaDecodableInteger<T> ||
 /// from the previous pixel in the same row. For multi-channel images,
 /// each channel is predicted separately from its own previous value.
 /// 
+/// 8- and 16-bit samples with 1 to 4 samples per pixel use SSE2/AVX2
+/// kernels on x86-64 (selected at runtime, see cpu::simd_level()).
+/// 
 /// @tparam T Pixel type (uint8_t, uint16_t, etc.)
 /// @param buffer Buffer containing the encoded data (modified in place)
 /// @param width Number of pixels per row
@@ -57,12 +61,47 @@ void delta_decode_horizontal(
     std::size_t stride,
     std::size_t samples_per_pixel = 1) noexcept;
 
+/// Apply floating point predictor (TIFF predictor=3) decoding in place
+/// 
+/// Each row is stored as byte planes (most significant byte of every sample
+/// first, then the next byte...), horizontally differenced byte by byte,
+/// as specified by Adobe's TIFF Technical Note 3. Decoding accumulates the
+/// bytes and reassembles the samples in native byte order. On x86-64 both
+/// steps are fused in SSE2/AVX2 kernels (selected at runtime).
+/// 
+/// @tparam FloatType float, double, Float16 or Float24
+/// @param buffer Buffer containing the encoded data (modified in place)
+/// @param width Number of pixels per row
+/// @param height Number of rows
+/// @param stride Number of elements (samples) between row starts (>= width * samples_per_pixel)
+/// @param samples_per_pixel Number of samples (channels) per pixel (default 1)
+/// @note Uses a per-thread row buffer: use the overload taking a row buffer
+///       to handle allocation failures
+template <DeltaDecodableFloat FloatType>
+void delta_decode_floating_point(
+    std::span<FloatType> buffer,
+    std::size_t width,
+    std::size_t height,
+    std::size_t stride,
+    std::size_t samples_per_pixel = 1) noexcept;
+
+/// Apply floating point predictor (TIFF predictor=3) decoding in place,
+/// using a caller-provided row buffer
+/// @param row_buffer At least floating_point_row_buffer_size<FloatType>(width, samples_per_pixel) bytes
 template <DeltaDecodableFloat FloatType>
 void delta_decode_floating_point(
     std::span<FloatType> buffer,
     std::size_t width,
     std::size_t height,
     std::size_t stride,
+    std::size_t samples_per_pixel,
+    std::span<uint8_t> row_buffer) noexcept;
+
+/// Size in bytes of the row buffer of the floating point predictor
+/// (one row, plus padding for the vectorized kernels)
+template <DeltaDecodableFloat FloatType>
+[[nodiscard]] constexpr std::size_t floating_point_row_buffer_size(
+    std::size_t width,
     std::size_t samples_per_pixel = 1) noexcept;
 
 /// Apply horizontal differencing (TIFF predictor=2) encoding in place
@@ -86,19 +125,21 @@ void delta_encode_horizontal(
     std::size_t stride,
     std::size_t samples_per_pixel = 1) noexcept;
 
-/// Apply floating point horizontal differencing encoding in place
+/// Apply floating point predictor (TIFF predictor=3) encoding in place
 /// 
-/// This encodes floating point data by storing the difference between each
-/// pixel's bit representation and the previous pixel in the same row. The
-/// differencing is done on the integer bit representation to ensure
-/// lossless encoding.
+/// Each row is split into byte planes (most significant byte of every
+/// sample first, then the next byte...), which are then horizontally
+/// differenced byte by byte, as specified by Adobe's TIFF Technical Note 3.
+/// On x86-64 both steps are fused in SSE2/AVX2 kernels (selected at runtime).
 /// 
-/// @tparam FloatType float or double
+/// @tparam FloatType float, double, Float16 or Float24
 /// @param buffer Buffer containing the raw floating point data (modified in place)
 /// @param width Number of pixels per row
 /// @param height Number of rows
 /// @param stride Number of elements (samples) between row starts (>= width * samples_per_pixel)
 /// @param samples_per_pixel Number of samples (channels) per pixel (default 1)
+/// @note Uses a per-thread row buffer: use the overload taking a row buffer
+///       to handle allocation failures
 template <DeltaDecodableFloat FloatType>
 void delta_encode_floating_point(
     std::span<FloatType> buffer,
@@ -107,6 +148,18 @@ void delta_encode_floating_point(
     std::size_t stride,
     std::size_t samples_per_pixel = 1) noexcept;
 
+/// Apply floating point predictor (TIFF predictor=3) encoding in place,
+/// using a caller-provided row buffer
+/// @param row_buffer At least floating_point_row_buffer_size<FloatType>(width, samples_per_pixel) bytes
+template <DeltaDecodableFloat FloatType>
+void delta_encode_floating_point(
+    std::span<FloatType> buffer,
+    std::size_t width,
+    std::size_t height,
+    std::size_t stride,
+    std::size_t samples_per_pixel,
+    std::span<uint8_t> row_buffer) noexcept;
+
 } // namespace predictor
 
 } // namespace tiffconcept
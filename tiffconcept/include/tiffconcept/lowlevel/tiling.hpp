@@ -71,6 +71,7 @@
 #include <vector>
 #include "../image_shape.hpp"
 #include "../types/result.hpp"
+#include "../types/tag_array_view.hpp"
 #include "../types/tiff_spec.hpp"
 #include "../types/tile_info.hpp"
 
@@ -275,6 +276,7 @@ void fetch_tile_from_buffer(
  * 
  * @note Thread-safe for read operations after initialization
  * @note update_from_metadata() reuses allocations when possible
+ * @note Tile arrays parsed as TagArrayView (e.g. MinTiledViewSpec) are shared, not copied
  */
 template <typename PixelType>
 class TiledImageInfo {
@@ -285,8 +287,9 @@ private:
     uint32_t tile_height_;
     uint32_t tile_depth_;
     
-    std::vector<std::size_t> tile_offsets_;
-    std::vector<std::size_t> tile_byte_counts_;
+    // Shared with the metadata when it holds TagArrayView tile arrays
+    TagArrayView<std::size_t> tile_offsets_;
+    TagArrayView<std::size_t> tile_byte_counts_;
     
     CompressionScheme compression_;
     Predictor predictor_;
@@ -0,0 +1,134 @@
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <vector>
+#include "ifd.hpp"
+#include "reader_base.hpp"
+#include "types/result.hpp"
+#include "types/tiff_spec.hpp"
+
+namespace tiffconcept {
+
+/// @brief Size and modification time of a file, identifying one version of it
+struct FileStamp {
+    uint64_t size = 0;      ///< File size in bytes
+    int64_t mtime_ns = 0;   ///< Last write time (nanoseconds since the file clock epoch)
+
+    /// @brief Stamp of the file at path
+    /// @retval Error::Code::FileNotFound The file does not exist or cannot be queried
+    [[nodiscard]] static Result<FileStamp> of(const std::filesystem::path& path) noexcept;
+
+    bool operator==(const FileStamp&) const noexcept = default;
+};
+
+/// @brief IFD of a page, as recorded in a PageIndex
+struct PageIndexEntry {
+    ifd::IFDOffset offset;           ///< Offset of the IFD
+    uint64_t num_entries;            ///< Number of tags of the IFD
+    ifd::IFDOffset next_ifd_offset;  ///< Next IFD in the chain (null for the last page)
+};
+
+/// @brief Offsets of all the IFDs of a multipage file, for random page access
+///
+/// Reaching page N of a TIFF file means following N next-IFD pointers. A
+/// PageIndex walks the chain once (build()) and records the offset, entry
+/// count and next pointer of every IFD, so that any page can then be read
+/// directly:
+///
+/// @code
+/// auto index = PageIndex::open<MmapFileReader, TiffFormatType::Classic, std::endian::little>(
+///     reader, "stack.tif");
+/// auto page = index.value().page(5000);
+/// auto ifd = ifd::read_ifd<MmapFileReader, TiffFormatType::Classic, std::endian::little>(
+///     reader, page.value().offset, ifd::default_speculative_read_size);
+/// @endcode
+///
+/// An index serializes to a compact blob (16 bytes per page plus a 40-byte
+/// frame, see serialize()), kept in memory or saved as a sidecar file next to
+/// the TIFF file. The blob records the FileStamp of the file it was built
+/// from: it is only accepted back for the same size and modification time,
+/// so that later opens skip the walk but never use a stale index.
+///
+/// Classic TIFF and BigTIFF files of either byte order are supported.
+class PageIndex {
+public:
+    PageIndex() noexcept = default;
+
+    /// @brief Walk the IFD chain of a file
+    /// @param reader Reader of the file
+    /// @param stamp Stamp of the file (see FileStamp::of), recorded for validation
+    /// @param speculative_read_size Window of the IFD reads (see ifd::read_ifd_into)
+    /// @retval Error::Code::InvalidFormat The IFD chain loops
+    /// @note Other errors are those of ifd::get_first_ifd_offset and ifd::read_ifd_into
+    template <RawReader Reader, TiffFormatType TiffFormat = TiffFormatType::Classic, std::endian SourceEndian = std::endian::native>
+    [[nodiscard]] static Result<PageIndex> build(
+        const Reader& reader,
+        FileStamp stamp,
+        std::size_t speculative_read_size = ifd::default_speculative_read_size) noexcept;
+
+    /// @brief Load the sidecar of a file if it is valid, otherwise build the index
+    ///        and (re)write the sidecar
+    ///
+    /// Failing to write the sidecar (e.g. read-only directory) is not an error.
+    ///
+    /// @param reader Reader of the file
+    /// @param path Path of the file (for its FileStamp and sidecar_path())
+    template <RawReader Reader, TiffFormatType TiffFormat = TiffFormatType::Classic, std::endian SourceEndian = std::endian::native>
+    [[nodiscard]] static Result<PageIndex> open(
+        const Reader& reader,
+        const std::filesystem::path& path,
+        std::size_t speculative_read_size = ifd::default_speculative_read_size) noexcept;
+
+    [[nodiscard]] std::size_t size() const noexcept { return offsets_.size(); }
+    [[nodiscard]] bool empty() const noexcept { return offsets_.empty(); }
+    [[nodiscard]] TiffFormatType format() const noexcept { return format_; }
+    [[nodiscard]] std::endian byte_order() const noexcept { return byte_order_; }
+    [[nodiscard]] const FileStamp& stamp() const noexcept { return stamp_; }
+
+    /// @brief IFD of a page
+    /// @retval Error::Code::InvalidPageIndex page >= size()
+    [[nodiscard]] Result<PageIndexEntry> page(std::size_t page) const noexcept;
+
+    /// @brief IFD offsets of all pages, in chain order
+    [[nodiscard]] std::span<const ifd::IFDOffset> offsets() const noexcept { return offsets_; }
+
+    /// @brief Binary form of the index (little-endian, checksummed)
+    [[nodiscard]] std::vector<std::byte> serialize() const;
+
+    /// @brief Index from its binary form
+    /// @param data Output of serialize()
+    /// @param expected Current stamp of the file
+    /// @retval Error::Code::InvalidHeader Not a page index, or of an unsupported version
+    /// @retval Error::Code::InvalidFormat Truncated or corrupted data
+    /// @retval Error::Code::InvalidOperation The index is stale (built for another stamp)
+    [[nodiscard]] static Result<PageIndex> deserialize(std::span<const std::byte> data, const FileStamp& expected) noexcept;
+
+    /// @brief Write serialize() to a file (through a uniquely named temporary file, renamed over it)
+    /// @retval Error::Code::WriteError The file cannot be written
+    [[nodiscard]] Result<void> save(const std::filesystem::path& path) const noexcept;
+
+    /// @brief Read an index saved by save()
+    /// @retval Error::Code::FileNotFound No such file
+    /// @note Other errors are those of deserialize()
+    [[nodiscard]] static Result<PageIndex> load(const std::filesystem::path& path, const FileStamp& expected) noexcept;
+
+    /// @brief Path of the sidecar of a TIFF file ("<path>.pidx")
+    [[nodiscard]] static std::filesystem::path sidecar_path(const std::filesystem::path& path);
+
+private:
+    TiffFormatType format_ = TiffFormatType::Classic;
+    std::endian byte_order_ = std::endian::little;
+    FileStamp stamp_;
+    // The next pointer of a page is the offset of the following page
+    std::vector<ifd::IFDOffset> offsets_;
+    std::vector<uint64_t> num_entries_;
+};
+
+} // namespace tiffconcept
+
+#define TIFFCONCEPT_PAGE_INDEX_HEADER
+#include "impl/page_index_impl.hpp"
@@ -177,7 +177,14 @@ using TagType = std::conditional_t<TiffFormat == TiffFormatType::Classic,
  * auto result = parsing::parse_tag<MmapFileReader, WidthTag>(reader, width_tag);
  * // Returns uint32_t regardless of whether source was SHORT or LONG
  * @endcode
- * 
+ *
+ * ## Lazy integer arrays
+ *
+ * A descriptor whose value_type is a TagArrayView (e.g. TileOffsetsTag_View)
+ * is parsed without copying: the view keeps the data read by the reader and
+ * decodes elements of the primary or any alternate type on access, byte-swapping
+ * them if SourceEndian differs from TargetEndian.
+ *
  * ## Implementation Notes
  * 
  * - **Performance**: Minimizes allocations; inline data accessed via memcpy
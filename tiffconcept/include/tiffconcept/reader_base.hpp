@@ -89,6 +89,16 @@ concept RawReader = requires(const T reader, void* buffer, std::size_t offset, s
     { T::read_must_allocate } -> std::convertible_to<bool>;
 };
 
+/// Optional reader capability: alignment of efficient reads (e.g. O_DIRECT)
+/// Reads whose file offset, length and destination address are multiples of
+/// io_alignment() go straight to the destination; others are widened by the
+/// reader and copied from an aligned bounce buffer.
+/// io_alignment() is a power of two, 1 when reads are unconstrained.
+template <typename T>
+concept AlignedIoReader = RawReader<T> && requires(const T reader) {
+    { reader.io_alignment() } -> std::convertible_to<std::size_t>;
+};
+
 /// Concept for a raw writer that provides thread-safe positioned writes
 template <typename T>
 concept RawWriter = requires(T writer, std::size_t offset, std::size_t size) {
@@ -0,0 +1,725 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <span>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "../reader_base.hpp"
+
+namespace tiffconcept {
+namespace caching_impl {
+
+/// Read-only view into a cached block, a block run or a caller buffer
+/// (keeps the memory it views alive, if it owns any)
+class CachedReadView {
+private:
+    std::span<const std::byte> data_;
+    std::shared_ptr<const void> owner_;
+
+public:
+    CachedReadView() noexcept = default;
+
+    CachedReadView(std::span<const std::byte> data, std::shared_ptr<const void> owner) noexcept
+        : data_(data), owner_(std::move(owner)) {}
+
+    [[nodiscard]] std::span<const std::byte> data() const noexcept { return data_; }
+    [[nodiscard]] std::size_t size() const noexcept { return data_.size(); }
+    [[nodiscard]] bool empty() const noexcept { return data_.empty(); }
+
+    // Move-only
+    CachedReadView(CachedReadView&&) noexcept = default;
+    CachedReadView& operator=(CachedReadView&&) noexcept = default;
+    CachedReadView(const CachedReadView&) = delete;
+    CachedReadView& operator=(const CachedReadView&) = delete;
+};
+
+static_assert(DataReadOnlyView<CachedReadView>, "CachedReadView must satisfy DataReadOnlyView concept");
+
+/// Allocation of block runs: aligned on 4096 bytes, so that direct I/O inner
+/// readers fill whole aligned blocks in place
+inline constexpr std::size_t run_alignment = 4096;
+
+[[nodiscard]] inline std::shared_ptr<std::byte[]> allocate_run(std::size_t size) noexcept {
+    auto* data = static_cast<std::byte*>(::operator new[](size, std::align_val_t{run_alignment}, std::nothrow));
+    if (!data) [[unlikely]] {
+        return nullptr;
+    }
+    try {
+        return std::shared_ptr<std::byte[]>(data, [](std::byte* p) {
+            ::operator delete[](p, std::align_val_t{run_alignment});
+        });
+    } catch (...) {
+        // The deleter has been called on data
+        return nullptr;
+    }
+}
+
+/// Cached block of the file (shorter than the block size at the end of file)
+struct Block {
+    std::shared_ptr<const std::byte> data;
+    std::size_t length = 0;
+};
+
+/// Sharded LRU of file blocks, keyed by block index
+///
+/// Each shard has its own lock, LRU list and share of the byte budget
+/// (every block is accounted at the block size). Small budgets use fewer
+/// shards, so that each shard holds at least one block.
+class BlockCache {
+public:
+    BlockCache(std::size_t max_bytes, std::size_t block_size, std::size_t shards)
+        : shard_count_(std::min(std::bit_ceil(std::max<std::size_t>(shards, 1)),
+                                std::bit_floor(std::max<std::size_t>(max_bytes / block_size, 1)))),
+          blocks_per_shard_(max_bytes / block_size / shard_count_),
+          shards_(std::make_unique<Shard[]>(shard_count_)) {}
+
+    [[nodiscard]] Block find(uint64_t index) noexcept {
+        Shard& shard = shard_of(index);
+        std::lock_guard lock(shard.mutex);
+        auto it = shard.index.find(index);
+        if (it == shard.index.end()) {
+            return {};
+        }
+        shard.lru.splice(shard.lru.begin(), shard.lru, it->second);
+        return it->second->block;
+    }
+
+    /// @return Number of blocks evicted
+    std::size_t insert(uint64_t index, Block block) noexcept {
+        if (blocks_per_shard_ == 0) {
+            return 0;
+        }
+        Shard& shard = shard_of(index);
+        std::lock_guard lock(shard.mutex);
+        if (shard.index.contains(index)) {
+            return 0;
+        }
+        try {
+            shard.lru.push_front(Entry{index, std::move(block)});
+            try {
+                shard.index.emplace(index, shard.lru.begin());
+            } catch (...) {
+                shard.lru.pop_front();
+                return 0;
+            }
+        } catch (...) {
+            return 0;
+        }
+        std::size_t evicted = 0;
+        while (shard.lru.size() > blocks_per_shard_) {
+            shard.index.erase(shard.lru.back().index);
+            shard.lru.pop_back();
+            ++evicted;
+        }
+        return evicted;
+    }
+
+    [[nodiscard]] std::size_t block_count() const noexcept {
+        std::size_t count = 0;
+        for (std::size_t i = 0; i < shard_count_; ++i) {
+            std::lock_guard lock(shards_[i].mutex);
+            count += shards_[i].lru.size();
+        }
+        return count;
+    }
+
+    void clear() noexcept {
+        for (std::size_t i = 0; i < shard_count_; ++i) {
+            std::lock_guard lock(shards_[i].mutex);
+            shards_[i].index.clear();
+            shards_[i].lru.clear();
+        }
+    }
+
+private:
+    struct Entry {
+        uint64_t index;
+        Block block;
+    };
+
+    struct alignas(64) Shard {
+        mutable std::mutex mutex;
+        std::list<Entry> lru;  // Most recently used first
+        std::unordered_map<uint64_t, std::list<Entry>::iterator> index;
+    };
+
+    [[nodiscard]] Shard& shard_of(uint64_t index) noexcept {
+        // Consecutive blocks go to different shards
+        return shards_[(index * 0x9E3779B97F4A7C15ull) >> 32 & (shard_count_ - 1)];
+    }
+
+    std::size_t shard_count_;
+    std::size_t blocks_per_shard_;
+    std::unique_ptr<Shard[]> shards_;
+};
+
+} // namespace caching_impl
+
+/// Counters of a CachingReader (snapshot, see CachingReader::cache_stats)
+struct BlockCacheStats {
+    uint64_t hits = 0;         ///< Block lookups served from memory
+    uint64_t misses = 0;       ///< Block lookups that went to the inner reader
+    uint64_t evictions = 0;    ///< Blocks removed to stay within budget
+    uint64_t inner_reads = 0;  ///< Reads issued to the inner reader
+    std::size_t blocks = 0;    ///< Blocks currently cached
+};
+
+/// RawReader decorator caching fixed-size aligned blocks of the inner reader
+///
+/// Reads are split into blocks of Config::block_size bytes, looked up in a
+/// sharded, byte-budgeted LRU. Each run of consecutive missing blocks is
+/// fetched with a single read_into() of the inner reader, so repeated
+/// metadata walks (IFDs, external tag arrays) and repeated tile reads are
+/// served from memory. Reads that fit in one block return zero-copy views
+/// of the cached block. Reads larger than Config::max_cached_read bypass
+/// the cache.
+///
+/// When Inner is an AsyncRawReader whose handles carry an id (io_uring,
+/// IOCP), so is the CachingReader: reads whose blocks are all cached
+/// complete immediately, others are forwarded and fill the cache on
+/// completion.
+///
+/// Example:
+/// @code
+/// CachingReader<PreadFileReader> reader(PreadFileReader("image.tif"), {.max_bytes = 32 << 20});
+/// auto ifd = ifd::read_ifd<decltype(reader), TiffFormatType::Classic, std::endian::little>(reader, offset);
+/// @endcode
+///
+/// @tparam Inner Underlying reader (owned)
+/// @note Thread-safe if Inner is. The file is assumed not to change while cached.
+template <RawReader Inner>
+class CachingReader {
+public:
+    using ReadViewType = caching_impl::CachedReadView;
+    using AsyncReadResult = Result<ReadViewType>;
+
+    /// Handle of an async read (ids are issued by the CachingReader)
+    struct AsyncOperationHandle {
+        uint64_t id;
+
+        AsyncOperationHandle() noexcept : id(0) {}
+        explicit AsyncOperationHandle(uint64_t id_) noexcept : id(id_) {}
+
+        // Non-copyable
+        AsyncOperationHandle(const AsyncOperationHandle&) = delete;
+        AsyncOperationHandle& operator=(const AsyncOperationHandle&) = delete;
+
+        // Movable
+        AsyncOperationHandle(AsyncOperationHandle&& other) noexcept : id(other.id) {
+            other.id = 0;
+        }
+        AsyncOperationHandle& operator=(AsyncOperationHandle&& other) noexcept {
+            if (this != &other) {
+                id = other.id;
+                other.id = 0;
+            }
+            return *this;
+        }
+
+        bool operator==(const AsyncOperationHandle& other) const noexcept {
+            return id == other.id;
+        }
+    };
+
+    // Reads that fit in a block are zero-copy, others are assembled
+    static constexpr bool read_must_allocate = true;
+
+    struct Config {
+        std::size_t block_size = 64 * 1024;         ///< Cached block size (power of two)
+        std::size_t max_bytes = 64 * 1024 * 1024;   ///< Byte budget of the cached blocks (less than a block disables caching)
+        std::size_t shards = 16;                    ///< Number of shards (rounded up to a power of two, at most one per block)
+        std::size_t max_cached_read = 1024 * 1024;  ///< Larger reads bypass the cache
+    };
+
+    explicit CachingReader(Inner inner, Config config = {})
+        : inner_(std::move(inner)),
+          config_(config),
+          state_(std::make_unique<State>(config)) {
+        config_.block_size = std::bit_ceil(std::max<std::size_t>(config_.block_size, 512));
+        if (auto size = inner_.size()) {
+            file_size_ = size.value();
+        }
+    }
+
+    CachingReader(CachingReader&&) noexcept = default;
+    CachingReader& operator=(CachingReader&&) noexcept = default;
+
+    [[nodiscard]] const Inner& inner() const noexcept { return inner_; }
+    [[nodiscard]] const Config& config() const noexcept { return config_; }
+
+    [[nodiscard]] bool is_valid() const noexcept { return state_ && inner_.is_valid(); }
+
+    [[nodiscard]] Result<std::size_t> size() const noexcept {
+        if (!is_valid()) [[unlikely]] {
+            return Err(Error::Code::ReadError, "Reader not open");
+        }
+        return Ok(file_size_);
+    }
+
+    [[nodiscard]] BlockCacheStats cache_stats() const noexcept {
+        return BlockCacheStats{
+            state_->hits.load(std::memory_order_relaxed),
+            state_->misses.load(std::memory_order_relaxed),
+            state_->evictions.load(std::memory_order_relaxed),
+            state_->inner_reads.load(std::memory_order_relaxed),
+            state_->cache.block_count()
+        };
+    }
+
+    /// Drop every cached block (e.g. after the file changed)
+    void clear_cache() noexcept { state_->cache.clear(); }
+
+    [[nodiscard]] Result<ReadViewType> read(std::size_t offset, std::size_t size) const noexcept {
+        auto range = clip(offset, size);
+        if (!range) [[unlikely]] {
+            return range.error();
+        }
+        size = range.value();
+
+        if (size > config_.max_cached_read) {
+            auto buffer = caching_impl::allocate_run(size);
+            if (!buffer) [[unlikely]] {
+                return Err(Error::Code::MemoryError, "Failed to allocate read buffer");
+            }
+            state_->inner_reads.fetch_add(1, std::memory_order_relaxed);
+            auto res = inner_.read_into(buffer.get(), offset, size);
+            if (!res) [[unlikely]] {
+                return res.error();
+            }
+            std::span<const std::byte> data(buffer.get(), size);
+            return Ok(ReadViewType(data, std::move(buffer)));
+        }
+
+        // Within one block: view of the cached block
+        const std::size_t first = offset / config_.block_size;
+        if ((offset + size - 1) / config_.block_size == first) {
+            caching_impl::Block block;
+            auto res = fetch_blocks(first, first + 1, &block);
+            if (!res) [[unlikely]] {
+                return res.error();
+            }
+            std::span<const std::byte> data(block.data.get() + (offset - first * config_.block_size), size);
+            return Ok(ReadViewType(data, std::move(block.data)));
+        }
+
+        auto buffer = caching_impl::allocate_run(size);
+        if (!buffer) [[unlikely]] {
+            return Err(Error::Code::MemoryError, "Failed to allocate read buffer");
+        }
+        auto res = copy_cached(buffer.get(), offset, size);
+        if (!res) [[unlikely]] {
+            return res.error();
+        }
+        std::span<const std::byte> data(buffer.get(), size);
+        return Ok(ReadViewType(data, std::move(buffer)));
+    }
+
+    [[nodiscard]] Result<void> read_into(void* dest_buffer, std::size_t offset, std::size_t size) const noexcept {
+        auto range = clip(offset, size);
+        if (!range) [[unlikely]] {
+            return range.error();
+        }
+        size = range.value();
+
+        if (size > config_.max_cached_read) {
+            state_->inner_reads.fetch_add(1, std::memory_order_relaxed);
+            return inner_.read_into(dest_buffer, offset, size);
+        }
+        return copy_cached(static_cast<std::byte*>(dest_buffer), offset, size);
+    }
+
+    // ========================================================================
+    // AsyncRawReader (when Inner is one)
+    // ========================================================================
+
+    /// Reads whose blocks are all cached complete immediately; others are
+    /// forwarded to the inner reader
+    [[nodiscard]] Result<AsyncOperationHandle> async_read_into(
+        std::span<std::byte> buffer, std::size_t offset, std::size_t size) const noexcept
+        requires AsyncRawReader<Inner> {
+        auto& async = state_->async;
+
+        if (buffer.size() < size) [[unlikely]] {
+            return Err(Error::Code::InvalidOperation, "Buffer too small for requested read size");
+        }
+
+        if (size <= config_.max_cached_read && cached_into(buffer.data(), offset, size)) {
+            std::lock_guard lock(async.mutex);
+            const uint64_t id = async.next_id++;
+            try {
+                async.ready.emplace_back(id, std::span<const std::byte>(buffer.data(), size));
+            } catch (...) {
+                return Err(Error::Code::MemoryError, "Failed to queue completion");
+            }
+            return Ok(AsyncOperationHandle{id});
+        }
+
+        // Registered under the lock, before any thread can reap the completion.
+        // The tracking node is allocated (and the map grown) before submitting,
+        // so that nothing can fail once the inner read is in flight.
+        std::lock_guard lock(async.mutex);
+        typename ForwardedMap::node_type node;
+        try {
+            ForwardedMap staging;
+            node = staging.extract(staging.emplace(0, ForwardedRead{}).first);
+            async.forwarded.reserve(async.forwarded.size() + 1);
+        } catch (...) {
+            return Err(Error::Code::MemoryError, "Failed to track async read");
+        }
+        state_->inner_reads.fetch_add(1, std::memory_order_relaxed);
+        auto inner_handle = inner_.async_read_into(buffer, offset, size);
+        if (!inner_handle) [[unlikely]] {
+            return inner_handle.error();
+        }
+        const uint64_t id = async.next_id++;
+        node.key() = static_cast<uint64_t>(inner_handle.value().id);
+        node.mapped() = ForwardedRead{id, buffer.data(), offset, size};
+        async.forwarded.insert(std::move(node));
+        return Ok(AsyncOperationHandle{id});
+    }
+
+    [[nodiscard]] std::vector<std::pair<AsyncOperationHandle, AsyncReadResult>>
+    poll_completions(std::size_t max_completions = 0) const noexcept
+        requires AsyncRawReader<Inner> {
+        std::vector<std::pair<AsyncOperationHandle, AsyncReadResult>> results;
+        const std::size_t remaining = take_ready(results, max_completions);
+        if (remaining != 0 || max_completions == 0) {
+            if (const std::size_t limit = reserve_forwarded(results, remaining)) {
+                forward_completions(inner_.poll_completions(limit), results);
+            }
+        }
+        return results;
+    }
+
+    [[nodiscard]] std::vector<std::pair<AsyncOperationHandle, AsyncReadResult>>
+    wait_completions(std::size_t max_completions = 0) const noexcept
+        requires AsyncRawReader<Inner> {
+        std::vector<std::pair<AsyncOperationHandle, AsyncReadResult>> results;
+        const std::size_t remaining = take_ready(results, max_completions);
+        if (!results.empty()) {
+            if (remaining != 0 || max_completions == 0) {
+                if (const std::size_t limit = reserve_forwarded(results, remaining)) {
+                    forward_completions(inner_.poll_completions(limit), results);
+                }
+            }
+            return results;
+        }
+        if (const std::size_t limit = reserve_forwarded(results, max_completions)) {
+            forward_completions(inner_.wait_completions(limit), results);
+        }
+        return results;
+    }
+
+    [[nodiscard]] std::vector<std::pair<AsyncOperationHandle, AsyncReadResult>>
+    wait_completions_for(std::chrono::milliseconds timeout, std::size_t max_completions = 0) const noexcept
+        requires AsyncRawReader<Inner> {
+        std::vector<std::pair<AsyncOperationHandle, AsyncReadResult>> results;
+        const std::size_t remaining = take_ready(results, max_completions);
+        if (!results.empty()) {
+            if (remaining != 0 || max_completions == 0) {
+                if (const std::size_t limit = reserve_forwarded(results, remaining)) {
+                    forward_completions(inner_.poll_completions(limit), results);
+                }
+            }
+            return results;
+        }
+        if (const std::size_t limit = reserve_forwarded(results, max_completions)) {
+            forward_completions(inner_.wait_completions_for(timeout, limit), results);
+        }
+        return results;
+    }
+
+    [[nodiscard]] std::size_t pending_operations() const noexcept
+        requires AsyncRawReader<Inner> {
+        std::lock_guard lock(state_->async.mutex);
+        return state_->async.ready.size() + inner_.pending_operations();
+    }
+
+    [[nodiscard]] Result<std::size_t> submit_pending() const noexcept
+        requires AsyncRawReader<Inner> {
+        return inner_.submit_pending();
+    }
+
+private:
+    /// Forwarded async read, until its completion is reaped
+    struct ForwardedRead {
+        uint64_t id;
+        std::byte* buffer;
+        std::size_t offset;
+        std::size_t size;
+    };
+
+    using ForwardedMap = std::unordered_map<uint64_t, ForwardedRead>;
+
+    struct AsyncState {
+        std::mutex mutex;
+        uint64_t next_id = 1;
+        std::deque<std::pair<uint64_t, std::span<const std::byte>>> ready;  // Served from the cache
+        ForwardedMap forwarded;                                              // By inner handle id
+    };
+
+    struct State {
+        explicit State(const Config& config)
+            : cache(config.max_bytes, std::bit_ceil(std::max<std::size_t>(config.block_size, 512)), config.shards) {}
+
+        caching_impl::BlockCache cache;
+        std::atomic<uint64_t> hits{0};
+        std::atomic<uint64_t> misses{0};
+        std::atomic<uint64_t> evictions{0};
+        std::atomic<uint64_t> inner_reads{0};
+        AsyncState async;
+    };
+
+    /// Validate a read and clip it to the end of file (as the file readers do)
+    [[nodiscard]] Result<std::size_t> clip(std::size_t offset, std::size_t size) const noexcept {
+        if (!is_valid()) [[unlikely]] {
+            return Err(Error::Code::ReadError, "Reader not open");
+        }
+        if (offset >= file_size_) [[unlikely]] {
+            return Err(Error::Code::OutOfBounds, "Read offset beyond file size");
+        }
+        return Ok(std::min(size, file_size_ - offset));
+    }
+
+    void insert_block(uint64_t index, caching_impl::Block block) const noexcept {
+        const std::size_t evicted = state_->cache.insert(index, std::move(block));
+        if (evicted > 0) {
+            state_->evictions.fetch_add(evicted, std::memory_order_relaxed);
+        }
+    }
+
+    /// Blocks [first, last), fetching each run of missing blocks with one inner read
+    [[nodiscard]] Result<void> fetch_blocks(std::size_t first, std::size_t last, caching_impl::Block* blocks) const noexcept {
+        const std::size_t block_size = config_.block_size;
+        std::size_t missing = 0;
+        for (std::size_t i = first; i < last; ++i) {
+            blocks[i - first] = state_->cache.find(i);
+            missing += blocks[i - first].data ? 0 : 1;
+        }
+        state_->hits.fetch_add((last - first) - missing, std::memory_order_relaxed);
+        if (missing == 0) {
+            return Ok();
+        }
+        state_->misses.fetch_add(missing, std::memory_order_relaxed);
+
+        std::size_t i = first;
+        while (i < last) {
+            if (blocks[i - first].data) {
+                ++i;
+                continue;
+            }
+            std::size_t run_end = i + 1;
+            while (run_end < last && !blocks[run_end - first].data) {
+                ++run_end;
+            }
+
+            const std::size_t run_offset = i * block_size;
+            const std::size_t run_size = std::min(run_end * block_size, file_size_) - run_offset;
+            auto run = caching_impl::allocate_run(run_size);
+            if (!run) [[unlikely]] {
+                return Err(Error::Code::MemoryError, "Failed to allocate cache block");
+            }
+            state_->inner_reads.fetch_add(1, std::memory_order_relaxed);
+            auto res = inner_.read_into(run.get(), run_offset, run_size);
+            if (!res) [[unlikely]] {
+                return res;
+            }
+
+            // Blocks of a run share its allocation
+            for (std::size_t j = i; j < run_end; ++j) {
+                const std::size_t begin = (j - i) * block_size;
+                caching_impl::Block block{
+                    std::shared_ptr<const std::byte>(run, run.get() + begin),
+                    std::min(block_size, run_size - begin)
+                };
+                blocks[j - first] = block;
+                insert_block(j, std::move(block));
+            }
+            i = run_end;
+        }
+        return Ok();
+    }
+
+    /// Copy [offset, offset + size) to dest through the cache
+    [[nodiscard]] Result<void> copy_cached(std::byte* dest, std::size_t offset, std::size_t size) const noexcept {
+        if (size == 0) {
+            return Ok();
+        }
+        const std::size_t block_size = config_.block_size;
+        const std::size_t first = offset / block_size;
+        const std::size_t last = (offset + size - 1) / block_size + 1;
+
+        std::vector<caching_impl::Block> blocks;
+        try {
+            blocks.resize(last - first);
+        } catch (...) {
+            return Err(Error::Code::MemoryError, "Failed to allocate block list");
+        }
+        auto res = fetch_blocks(first, last, blocks.data());
+        if (!res) [[unlikely]] {
+            return res;
+        }
+        copy_blocks(dest, offset, size, first, blocks.data());
+        return Ok();
+    }
+
+    void copy_blocks(std::byte* dest, std::size_t offset, std::size_t size,
+                     std::size_t first, const caching_impl::Block* blocks) const noexcept {
+        const std::size_t block_size = config_.block_size;
+        std::size_t position = offset;
+        const std::size_t end = offset + size;
+        while (position < end) {
+            const std::size_t index = position / block_size;
+            const std::size_t in_block = position - index * block_size;
+            const std::size_t count = std::min(end - position, block_size - in_block);
+            std::memcpy(dest + (position - offset), blocks[index - first].data.get() + in_block, count);
+            position += count;
+        }
+    }
+
+    /// Copy a read to dest if all its blocks are cached
+    [[nodiscard]] bool cached_into(std::byte* dest, std::size_t offset, std::size_t size) const noexcept {
+        if (!is_valid() || size == 0 || offset + size > file_size_) {
+            return false;
+        }
+        const std::size_t block_size = config_.block_size;
+        const std::size_t first = offset / block_size;
+        const std::size_t last = (offset + size - 1) / block_size + 1;
+
+        std::vector<caching_impl::Block> blocks;
+        try {
+            blocks.resize(last - first);
+        } catch (...) {
+            return false;
+        }
+        for (std::size_t i = first; i < last; ++i) {
+            blocks[i - first] = state_->cache.find(i);
+            if (!blocks[i - first].data) {
+                state_->misses.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+        }
+        state_->hits.fetch_add(last - first, std::memory_order_relaxed);
+        copy_blocks(dest, offset, size, first, blocks.data());
+        return true;
+    }
+
+    /// Cache the blocks entirely covered by a completed forwarded read
+    void cache_completed(const ForwardedRead& read) const noexcept {
+        const std::size_t block_size = config_.block_size;
+        const std::size_t end = read.offset + read.size;
+        for (std::size_t index = (read.offset + block_size - 1) / block_size;; ++index) {
+            const std::size_t begin = index * block_size;
+            const std::size_t length = std::min(block_size, file_size_ - std::min(begin, file_size_));
+            if (length == 0 || begin + length > end) {
+                break;
+            }
+            auto copy = caching_impl::allocate_run(length);
+            if (!copy) [[unlikely]] {
+                return;
+            }
+            std::memcpy(copy.get(), read.buffer + (begin - read.offset), length);
+            insert_block(index, caching_impl::Block{std::shared_ptr<const std::byte>(copy, copy.get()), length});
+        }
+    }
+
+    /// Move up to max_completions (0 = all) cache-served completions to results
+    /// @return Number of completions that may still be added (0 if unlimited)
+    std::size_t take_ready(std::vector<std::pair<AsyncOperationHandle, AsyncReadResult>>& results,
+                           std::size_t max_completions) const noexcept {
+        auto& async = state_->async;
+        std::lock_guard lock(async.mutex);
+        try {
+            while (!async.ready.empty() && (max_completions == 0 || results.size() < max_completions)) {
+                auto& [id, data] = async.ready.front();
+                results.emplace_back(AsyncOperationHandle{id}, Ok(ReadViewType(data, nullptr)));
+                async.ready.pop_front();
+            }
+        } catch (...) {
+            // Left in the queue for the next call
+        }
+        return max_completions == 0 ? 0 : max_completions - results.size();
+    }
+
+    /// Reserve room in results for the completions of the forwarded reads,
+    /// so that no completion reaped from the inner reader is ever dropped
+    /// @param max_completions Limit on the completions to add (0 = no limit)
+    /// @return Number of inner completions that may be reaped (0 = do not reap)
+    std::size_t reserve_forwarded(std::vector<std::pair<AsyncOperationHandle, AsyncReadResult>>& results,
+                                  std::size_t max_completions) const noexcept {
+        std::size_t count;
+        {
+            std::lock_guard lock(state_->async.mutex);
+            count = state_->async.forwarded.size();
+        }
+        if (max_completions != 0) {
+            count = std::min(count, max_completions);
+        }
+        if (count == 0) {
+            return 0;
+        }
+        try {
+            results.reserve(results.size() + count);
+        } catch (...) {
+            return 0;  // Left in the inner reader for the next call
+        }
+        return count;
+    }
+
+    /// Copy of an inner error (without its message if it cannot be allocated)
+    [[nodiscard]] static Error copy_error(const Error& error) noexcept {
+        try {
+            return error;
+        } catch (...) {
+            return Error{error.code, {}};
+        }
+    }
+
+    /// Translate completions of the inner reader, caching the data they read
+    /// (room for them was reserved in results by reserve_forwarded)
+    template <typename InnerCompletions>
+    void forward_completions(InnerCompletions&& completions,
+                             std::vector<std::pair<AsyncOperationHandle, AsyncReadResult>>& results) const noexcept {
+        auto& async = state_->async;
+        for (auto& [inner_handle, inner_result] : completions) {
+            ForwardedRead read;
+            {
+                std::lock_guard lock(async.mutex);
+                auto it = async.forwarded.find(static_cast<uint64_t>(inner_handle.id));
+                if (it == async.forwarded.end()) [[unlikely]] {
+                    continue;  // Not issued through this reader
+                }
+                read = it->second;
+                async.forwarded.erase(it);
+            }
+            if (inner_result) {
+                if (read.size <= config_.max_cached_read) {
+                    cache_completed(read);
+                }
+                results.emplace_back(AsyncOperationHandle{read.id},
+                                     Ok(ReadViewType(inner_result.value().data(), nullptr)));
+            } else {
+                results.emplace_back(AsyncOperationHandle{read.id}, copy_error(inner_result.error()));
+            }
+        }
+    }
+
+    Inner inner_;
+    Config config_;
+    std::size_t file_size_ = 0;
+    std::unique_ptr<State> state_;
+};
+
+} // namespace tiffconcept
@@ -0,0 +1,324 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "../reader_base.hpp"
+
+namespace tiffconcept {
+namespace simulated_remote_impl {
+
+/// Read-only view returned by SimulatedRemoteReader: the view of the inner
+/// reader (kept alive by owner) or the caller buffer of an async read
+class RemoteReadView {
+private:
+    std::span<const std::byte> data_;
+    std::shared_ptr<const void> owner_;
+
+public:
+    RemoteReadView() noexcept = default;
+
+    RemoteReadView(std::span<const std::byte> data, std::shared_ptr<const void> owner) noexcept
+        : data_(data), owner_(std::move(owner)) {}
+
+    [[nodiscard]] std::span<const std::byte> data() const noexcept { return data_; }
+    [[nodiscard]] std::size_t size() const noexcept { return data_.size(); }
+    [[nodiscard]] bool empty() const noexcept { return data_.empty(); }
+
+    // Move-only
+    RemoteReadView(RemoteReadView&&) noexcept = default;
+    RemoteReadView& operator=(RemoteReadView&&) noexcept = default;
+    RemoteReadView(const RemoteReadView&) = delete;
+    RemoteReadView& operator=(const RemoteReadView&) = delete;
+};
+
+static_assert(DataReadOnlyView<RemoteReadView>, "RemoteReadView must satisfy DataReadOnlyView concept");
+
+} // namespace simulated_remote_impl
+
+/// Counters of a SimulatedRemoteReader (snapshot, see SimulatedRemoteReader::stats)
+struct RemoteReaderStats {
+    uint64_t requests = 0;  ///< Read requests issued (sync and async)
+    uint64_t bytes = 0;     ///< Bytes requested (clipped to the end of file)
+};
+
+/// RawReader decorator simulating remote storage (object store, NAS)
+///
+/// Every request completes after a fixed latency, plus the time its bytes
+/// take on a shared link of limited bandwidth. At most
+/// Config::max_concurrent_requests requests are in flight, later ones
+/// queue for a free slot, as with the connection pool of an HTTP client.
+/// The data itself is read from the inner reader, so any local file or
+/// buffer can stand for a remote object, e.g. to tune the batching of
+/// IOLimitedReader and FastReader (max_batch_size, max_gap_size) without a
+/// live service.
+///
+/// The reader is an AsyncRawReader whatever the inner reader: async reads
+/// are read synchronously from the inner reader on submission, and
+/// delivered by poll/wait_completions once their simulated completion time
+/// has passed.
+///
+/// Example:
+/// @code
+/// SimulatedRemoteReader<PreadFileReader> remote(PreadFileReader("image.tif"),
+///     {.latency = std::chrono::milliseconds(20), .bandwidth_bytes_per_second = 100 << 20});
+/// auto res = fast_reader.read_region<ImageLayoutSpec::DHWC>(remote, metadata, region, output);
+/// @endcode
+///
+/// @tparam Inner Underlying reader (owned)
+/// @note Thread-safe if Inner is
+template <RawReader Inner>
+class SimulatedRemoteReader {
+public:
+    using ReadViewType = simulated_remote_impl::RemoteReadView;
+    using AsyncReadResult = Result<ReadViewType>;
+    using Clock = std::chrono::steady_clock;
+
+    /// Handle of an async read
+    struct AsyncOperationHandle {
+        uint64_t id;
+
+        AsyncOperationHandle() noexcept : id(0) {}
+        explicit AsyncOperationHandle(uint64_t id_) noexcept : id(id_) {}
+
+        // Non-copyable
+        AsyncOperationHandle(const AsyncOperationHandle&) = delete;
+        AsyncOperationHandle& operator=(const AsyncOperationHandle&) = delete;
+
+        // Movable
+        AsyncOperationHandle(AsyncOperationHandle&& other) noexcept : id(other.id) {
+            other.id = 0;
+        }
+        AsyncOperationHandle& operator=(AsyncOperationHandle&& other) noexcept {
+            if (this != &other) {
+                id = other.id;
+                other.id = 0;
+            }
+            return *this;
+        }
+
+        bool operator==(const AsyncOperationHandle& other) const noexcept {
+            return id == other.id;
+        }
+    };
+
+    static constexpr bool read_must_allocate = Inner::read_must_allocate;
+
+    struct Config {
+        std::chrono::microseconds latency{20000};  ///< Time to first byte of every request
+        std::size_t bandwidth_bytes_per_second = 0;  ///< Shared link bandwidth (0 = unlimited)
+        std::size_t max_concurrent_requests = 0;     ///< Requests in flight (0 = unlimited)
+    };
+
+    explicit SimulatedRemoteReader(Inner inner, Config config = {})
+        : inner_(std::move(inner)),
+          config_(config),
+          state_(std::make_unique<State>()) {
+        if (auto size = inner_.size()) {
+            file_size_ = size.value();
+        }
+        state_->slots.assign(config_.max_concurrent_requests, Clock::time_point{});
+    }
+
+    SimulatedRemoteReader(SimulatedRemoteReader&&) noexcept = default;
+    SimulatedRemoteReader& operator=(SimulatedRemoteReader&&) noexcept = default;
+
+    [[nodiscard]] const Inner& inner() const noexcept { return inner_; }
+    [[nodiscard]] const Config& config() const noexcept { return config_; }
+
+    [[nodiscard]] bool is_valid() const noexcept { return state_ && inner_.is_valid(); }
+
+    [[nodiscard]] Result<std::size_t> size() const noexcept {
+        if (!is_valid()) [[unlikely]] {
+            return Err(Error::Code::ReadError, "Reader not open");
+        }
+        return Ok(file_size_);
+    }
+
+    [[nodiscard]] RemoteReaderStats stats() const noexcept {
+        std::lock_guard lock(state_->mutex);
+        return state_->stats;
+    }
+
+    [[nodiscard]] Result<ReadViewType> read(std::size_t offset, std::size_t size) const noexcept {
+        if (!is_valid()) [[unlikely]] {
+            return Err(Error::Code::ReadError, "Reader not open");
+        }
+        std::this_thread::sleep_until(schedule(offset, size));
+
+        auto res = inner_.read(offset, size);
+        if (!res) [[unlikely]] {
+            return res.error();
+        }
+        try {
+            auto view = std::make_shared<typename Inner::ReadViewType>(std::move(res.value()));
+            const std::span<const std::byte> data = view->data();
+            return Ok(ReadViewType(data, std::move(view)));
+        } catch (...) {
+            return Err(Error::Code::MemoryError, "Failed to allocate read view");
+        }
+    }
+
+    [[nodiscard]] Result<void> read_into(void* dest_buffer, std::size_t offset, std::size_t size) const noexcept {
+        if (!is_valid()) [[unlikely]] {
+            return Err(Error::Code::ReadError, "Reader not open");
+        }
+        std::this_thread::sleep_until(schedule(offset, size));
+        return inner_.read_into(dest_buffer, offset, size);
+    }
+
+    // ========================================================================
+    // AsyncRawReader
+    // ========================================================================
+
+    [[nodiscard]] Result<AsyncOperationHandle> async_read_into(
+        std::span<std::byte> buffer, std::size_t offset, std::size_t size) const noexcept {
+        if (!is_valid()) [[unlikely]] {
+            return Err(Error::Code::ReadError, "Reader not open");
+        }
+        if (buffer.size() < size) [[unlikely]] {
+            return Err(Error::Code::InvalidOperation, "Buffer too small for requested read size");
+        }
+        if (offset >= file_size_) [[unlikely]] {
+            return Err(Error::Code::OutOfBounds, "Read offset beyond file size");
+        }
+
+        const std::size_t bytes_to_read = std::min(size, file_size_ - offset);
+        auto res = inner_.read_into(buffer.data(), offset, bytes_to_read);
+        AsyncReadResult result = res
+            ? AsyncReadResult(Ok(ReadViewType(std::span<const std::byte>(buffer.data(), bytes_to_read), nullptr)))
+            : AsyncReadResult(res.error());
+
+        const Clock::time_point due = schedule(offset, size);
+        std::lock_guard lock(state_->mutex);
+        const uint64_t id = state_->next_id++;
+        try {
+            state_->in_flight.emplace(due, std::make_pair(id, std::move(result)));
+        } catch (...) {
+            return Err(Error::Code::MemoryError, "Failed to queue async read");
+        }
+        state_->completion_cv.notify_all();
+        return Ok(AsyncOperationHandle{id});
+    }
+
+    [[nodiscard]] std::vector<std::pair<AsyncOperationHandle, AsyncReadResult>>
+    poll_completions(std::size_t max_completions = 0) const noexcept {
+        std::lock_guard lock(state_->mutex);
+        return take_due(Clock::now(), max_completions);
+    }
+
+    [[nodiscard]] std::vector<std::pair<AsyncOperationHandle, AsyncReadResult>>
+    wait_completions(std::size_t max_completions = 0) const noexcept {
+        return wait_until(Clock::time_point::max(), max_completions);
+    }
+
+    [[nodiscard]] std::vector<std::pair<AsyncOperationHandle, AsyncReadResult>>
+    wait_completions_for(std::chrono::milliseconds timeout, std::size_t max_completions = 0) const noexcept {
+        return wait_until(Clock::now() + timeout, max_completions);
+    }
+
+    [[nodiscard]] std::size_t pending_operations() const noexcept {
+        std::lock_guard lock(state_->mutex);
+        return state_->in_flight.size();
+    }
+
+    /// Reads are "submitted" by async_read_into
+    [[nodiscard]] Result<std::size_t> submit_pending() const noexcept {
+        return Ok(std::size_t{0});
+    }
+
+private:
+    struct State {
+        mutable std::mutex mutex;
+        std::condition_variable completion_cv;
+        std::vector<Clock::time_point> slots;  // When each connection is free again
+        Clock::time_point link_free{};         // When the shared link is free again
+        RemoteReaderStats stats;
+        uint64_t next_id = 1;
+        std::multimap<Clock::time_point, std::pair<uint64_t, AsyncReadResult>> in_flight;  // By due time
+    };
+
+    /// Completion time of a request issued now
+    [[nodiscard]] Clock::time_point schedule(std::size_t offset, std::size_t size) const noexcept {
+        const std::size_t bytes = offset < file_size_ ? std::min(size, file_size_ - offset) : 0;
+        std::lock_guard lock(state_->mutex);
+        ++state_->stats.requests;
+        state_->stats.bytes += bytes;
+
+        // Wait for a connection
+        Clock::time_point start = Clock::now();
+        auto slot = std::min_element(state_->slots.begin(), state_->slots.end());
+        if (slot != state_->slots.end()) {
+            start = std::max(start, *slot);
+        }
+
+        // Then for the first byte, then for the link
+        Clock::time_point done = start + config_.latency;
+        if (config_.bandwidth_bytes_per_second > 0) {
+            const auto transfer = std::chrono::nanoseconds(static_cast<int64_t>(
+                static_cast<double>(bytes) * 1e9 / static_cast<double>(config_.bandwidth_bytes_per_second)));
+            done = std::max(done, state_->link_free) + transfer;
+            state_->link_free = done;
+        }
+        if (slot != state_->slots.end()) {
+            *slot = done;
+        }
+        return done;
+    }
+
+    /// Up to max_completions (0 = all) reads due at now, in completion order
+    [[nodiscard]] std::vector<std::pair<AsyncOperationHandle, AsyncReadResult>>
+    take_due(Clock::time_point now, std::size_t max_completions) const noexcept {
+        std::vector<std::pair<AsyncOperationHandle, AsyncReadResult>> results;
+        auto& in_flight = state_->in_flight;
+
+        // Reserve first: a completion is only removed once it has a place
+        std::size_t due = 0;
+        for (auto it = in_flight.begin(); it != in_flight.end() && it->first <= now &&
+             (max_completions == 0 || due < max_completions); ++it) {
+            ++due;
+        }
+        try {
+            results.reserve(due);
+        } catch (...) {
+            return results;  // Left in flight for the next call
+        }
+        for (; due > 0; --due) {
+            auto& [id, result] = in_flight.begin()->second;
+            results.emplace_back(AsyncOperationHandle{id}, std::move(result));
+            in_flight.erase(in_flight.begin());
+        }
+        return results;
+    }
+
+    [[nodiscard]] std::vector<std::pair<AsyncOperationHandle, AsyncReadResult>>
+    wait_until(Clock::time_point deadline, std::size_t max_completions) const noexcept {
+        std::unique_lock lock(state_->mutex);
+        while (!state_->in_flight.empty()) {
+            const Clock::time_point now = Clock::now();
+            const Clock::time_point due = state_->in_flight.begin()->first;
+            if (due <= now || now >= deadline) {
+                break;
+            }
+            // Woken early by submissions, which may complete sooner
+            state_->completion_cv.wait_until(lock, std::min(due, deadline));
+        }
+        return take_due(Clock::now(), max_completions);
+    }
+
+    Inner inner_;
+    Config config_;
+    std::size_t file_size_ = 0;
+    std::unique_ptr<State> state_;
+};
+
+} // namespace tiffconcept
@@ -4,8 +4,10 @@
 
 #include <algorithm>
 #include <atomic>
+#include <cerrno>
 #include <chrono>
 #include <cstddef>
+#include <cstdlib>
 #include <cstring>
 #include <deque>
 #include <fcntl.h>
@@ -17,10 +19,12 @@
 #include <string>
 #include <string_view>
 #include <sys/stat.h>
+#include <sys/uio.h>
 #include <unistd.h>
 #include <utility>
 #include <vector>
 #include "../reader_base.hpp"
+#include "unix_direct_io.hpp"
 
 namespace tiffconcept {
 namespace io_uring_impl {
@@ -52,6 +56,319 @@ public:
 static_assert(DataReadOnlyView<OwnedBufferReadView>, 
               "OwnedBufferReadView must satisfy DataReadOnlyView concept");
 
+/// Pool of equally sized, page aligned buffers registered with a ring
+/// (io_uring_register_buffers), so that reads into them skip the per-I/O
+/// page pinning of the kernel (IORING_OP_READ_FIXED)
+/// 
+/// The buffers are carved out of a single allocation: any span inside the
+/// pool maps back to its buffer index.
+/// Shared by the reader and the RegisteredBuffer leases, so that a lease
+/// may outlive the reader (its memory is then simply no longer registered).
+class RegisteredBufferPool {
+public:
+    static constexpr std::size_t alignment = 4096;
+    
+    /// Allocate count buffers of at least buffer_size bytes (rounded up to pages)
+    [[nodiscard]] static Result<std::shared_ptr<RegisteredBufferPool>> create(
+        uint32_t count, std::size_t buffer_size) noexcept {
+        if (count == 0 || buffer_size == 0) [[unlikely]] {
+            return Err(Error::Code::InvalidOperation, "Registered buffer pool must not be empty");
+        }
+        const std::size_t stride = (buffer_size + alignment - 1) / alignment * alignment;
+        void* memory = std::aligned_alloc(alignment, stride * count);
+        if (!memory) [[unlikely]] {
+            return Err(Error::Code::MemoryError, "Failed to allocate registered buffer pool");
+        }
+        try {
+            auto pool = std::shared_ptr<RegisteredBufferPool>(
+                new RegisteredBufferPool(static_cast<std::byte*>(memory), count, stride));
+            return Ok(std::move(pool));
+        } catch (...) {
+            std::free(memory);
+            return Err(Error::Code::MemoryError, "Failed to allocate registered buffer pool");
+        }
+    }
+    
+    ~RegisteredBufferPool() noexcept {
+        std::free(memory_);
+    }
+    
+    RegisteredBufferPool(const RegisteredBufferPool&) = delete;
+    RegisteredBufferPool& operator=(const RegisteredBufferPool&) = delete;
+    
+    [[nodiscard]] uint32_t count() const noexcept { return count_; }
+    [[nodiscard]] std::size_t buffer_size() const noexcept { return stride_; }
+    
+    [[nodiscard]] std::span<std::byte> buffer(uint32_t index) const noexcept {
+        return {memory_ + static_cast<std::size_t>(index) * stride_, stride_};
+    }
+    
+    /// iovec array describing the buffers, for io_uring_register_buffers
+    [[nodiscard]] std::vector<iovec> iovecs() const {
+        std::vector<iovec> vecs(count_);
+        for (uint32_t i = 0; i < count_; ++i) {
+            vecs[i].iov_base = memory_ + static_cast<std::size_t>(i) * stride_;
+            vecs[i].iov_len = stride_;
+        }
+        return vecs;
+    }
+    
+    /// Index of the buffer fully containing [data, data + size), or -1
+    [[nodiscard]] int32_t find(const std::byte* data, std::size_t size) const noexcept {
+        if (data < memory_ || data >= memory_ + stride_ * count_) {
+            return -1;
+        }
+        const std::size_t offset = static_cast<std::size_t>(data - memory_);
+        const std::size_t index = offset / stride_;
+        if (offset + size > (index + 1) * stride_) {
+            return -1;
+        }
+        return static_cast<int32_t>(index);
+    }
+    
+    /// Take a free buffer, -1 if all are in use
+    [[nodiscard]] int32_t try_acquire() noexcept {
+        std::lock_guard lock(mutex_);
+        if (free_.empty()) {
+            return -1;
+        }
+        uint32_t index = free_.back();
+        free_.pop_back();
+        return static_cast<int32_t>(index);
+    }
+    
+    void release(uint32_t index) noexcept {
+        std::lock_guard lock(mutex_);
+        free_.push_back(index);  // Capacity reserved for all the buffers
+    }
+    
+private:
+    RegisteredBufferPool(std::byte* memory, uint32_t count, std::size_t stride)
+        : memory_(memory), count_(count), stride_(stride) {
+        free_.reserve(count);
+        for (uint32_t i = count; i > 0; --i) {
+            free_.push_back(i - 1);
+        }
+    }
+    
+    std::byte* memory_;
+    uint32_t count_;
+    std::size_t stride_;
+    std::mutex mutex_;
+    std::vector<uint32_t> free_;
+};
+
+/// Buffer borrowed from a RegisteredBufferPool, returned on destruction
+/// Empty when no registered buffer was available (use a regular buffer instead)
+class RegisteredBuffer {
+private:
+    std::shared_ptr<RegisteredBufferPool> pool_;
+    uint32_t index_{0};
+
+public:
+    RegisteredBuffer() noexcept = default;
+    
+    RegisteredBuffer(std::shared_ptr<RegisteredBufferPool> pool, uint32_t index) noexcept
+        : pool_(std::move(pool)), index_(index) {}
+    
+    ~RegisteredBuffer() noexcept {
+        reset();
+    }
+    
+    // Move-only
+    RegisteredBuffer(RegisteredBuffer&& other) noexcept
+        : pool_(std::move(other.pool_)), index_(other.index_) {}
+    RegisteredBuffer& operator=(RegisteredBuffer&& other) noexcept {
+        if (this != &other) {
+            reset();
+            pool_ = std::move(other.pool_);
+            index_ = other.index_;
+        }
+        return *this;
+    }
+    RegisteredBuffer(const RegisteredBuffer&) = delete;
+    RegisteredBuffer& operator=(const RegisteredBuffer&) = delete;
+    
+    [[nodiscard]] std::span<std::byte> data() const noexcept {
+        return pool_ ? pool_->buffer(index_) : std::span<std::byte>{};
+    }
+    [[nodiscard]] uint32_t index() const noexcept { return index_; }
+    explicit operator bool() const noexcept { return pool_ != nullptr; }
+    
+    /// Return the buffer to its pool
+    void reset() noexcept {
+        if (pool_) {
+            pool_->release(index_);
+            pool_.reset();
+        }
+    }
+};
+
+/// Contexts of the operations between async_read_into() and their completion
+/// 
+/// Slots are addressed by the low 32 bits of the io_uring user_data, the high
+/// bits carry a generation so that handle ids stay unique across slot reuse.
+/// Nothing is locked or allocated per operation:
+/// - acquire()/release(): lock-free free list (tagged Treiber stack)
+/// - push_submission()/take_submissions(): lock-free MPSC list of operations
+///   whose SQE is not prepared yet (any thread pushes, the SQ owner drains)
+/// Slots live in fixed chunks that are only freed with the table; a chunk is
+/// added (under a mutex) when all the slots are in flight.
+class OperationSlots {
+public:
+    static constexpr uint32_t nil = static_cast<uint32_t>(-1);
+    static constexpr uint32_t chunk_size = 256;
+    static constexpr uint32_t max_chunks = 4096;   ///< Up to 1M operations in flight
+    
+    struct Slot {
+        std::byte* buffer;          ///< Destination of the read
+        std::size_t size;           ///< Expected read size
+        std::byte* io_buffer;       ///< Buffer read by the kernel (buffer, or bounce)
+        std::size_t io_size;        ///< Bytes requested from the kernel
+        std::size_t io_offset;      ///< File offset of the request
+        std::size_t skip;           ///< Offset of the requested bytes in io_buffer
+        std::shared_ptr<std::byte[]> bounce; ///< Aligned buffer of an unaligned O_DIRECT read
+        int32_t buffer_index;       ///< Registered buffer (READ_FIXED), or -1
+        uint32_t generation;        ///< Bumped by every acquire()
+        std::atomic<uint32_t> next; ///< Link in the free or submission list
+    };
+    
+    OperationSlots() : chunks_(new std::atomic<Slot*>[max_chunks]) {
+        for (uint32_t i = 0; i < max_chunks; ++i) {
+            chunks_[i].store(nullptr, std::memory_order_relaxed);
+        }
+    }
+    
+    ~OperationSlots() {
+        const uint32_t count = num_chunks_.load(std::memory_order_acquire);
+        for (uint32_t i = 0; i < count; ++i) {
+            delete[] chunks_[i].load(std::memory_order_relaxed);
+        }
+    }
+    
+    OperationSlots(const OperationSlots&) = delete;
+    OperationSlots& operator=(const OperationSlots&) = delete;
+    
+    [[nodiscard]] Slot& operator[](uint32_t index) const noexcept {
+        return chunks_[index / chunk_size].load(std::memory_order_acquire)[index % chunk_size];
+    }
+    
+    [[nodiscard]] uint64_t user_data(uint32_t index) const noexcept {
+        return (static_cast<uint64_t>((*this)[index].generation) << 32) | (static_cast<uint64_t>(index) + 1);
+    }
+    
+    [[nodiscard]] static uint32_t index_of(uint64_t user_data) noexcept {
+        return static_cast<uint32_t>(user_data) - 1;
+    }
+    
+    /// Take a free slot (its generation is bumped)
+    [[nodiscard]] Result<uint32_t> acquire() noexcept {
+        uint64_t head = free_head_.load(std::memory_order_acquire);
+        while (true) {
+            const uint32_t index = static_cast<uint32_t>(head);
+            if (index == nil) {
+                auto grow_res = grow();
+                if (!grow_res) [[unlikely]] {
+                    return grow_res.error();
+                }
+                head = free_head_.load(std::memory_order_acquire);
+                continue;
+            }
+            // May read the link of a slot taken meanwhile: the tag makes the CAS fail
+            const uint32_t next = (*this)[index].next.load(std::memory_order_relaxed);
+            const uint64_t new_head = (((head >> 32) + 1) << 32) | next;
+            if (free_head_.compare_exchange_weak(head, new_head,
+                                                 std::memory_order_acquire,
+                                                 std::memory_order_acquire)) {
+                ++(*this)[index].generation;
+                return Ok(index);
+            }
+        }
+    }
+    
+    /// Return a slot to the free list
+    void release(uint32_t index) noexcept {
+        Slot& slot = (*this)[index];
+        uint64_t head = free_head_.load(std::memory_order_relaxed);
+        uint64_t new_head;
+        do {
+            slot.next.store(static_cast<uint32_t>(head), std::memory_order_relaxed);
+            new_head = (((head >> 32) + 1) << 32) | index;
+        } while (!free_head_.compare_exchange_weak(head, new_head,
+                                                   std::memory_order_release,
+                                                   std::memory_order_relaxed));
+    }
+    
+    /// Queue a filled slot for SQE preparation (any thread)
+    void push_submission(uint32_t index) noexcept {
+        Slot& slot = (*this)[index];
+        uint32_t head = submit_head_.load(std::memory_order_relaxed);
+        do {
+            slot.next.store(head, std::memory_order_relaxed);
+        } while (!submit_head_.compare_exchange_weak(head, index,
+                                                     std::memory_order_release,
+                                                     std::memory_order_relaxed));
+    }
+    
+    [[nodiscard]] bool has_queued_submissions() const noexcept {
+        return submit_head_.load(std::memory_order_relaxed) != nil;
+    }
+    
+    /// Detach the queued slots, in submission order (linked by next, ends with nil)
+    [[nodiscard]] uint32_t take_submissions() noexcept {
+        uint32_t head = submit_head_.exchange(nil, std::memory_order_acquire);
+        uint32_t reversed = nil;
+        while (head != nil) {
+            const uint32_t next = (*this)[head].next.load(std::memory_order_relaxed);
+            (*this)[head].next.store(reversed, std::memory_order_relaxed);
+            reversed = head;
+            head = next;
+        }
+        return reversed;
+    }
+    
+private:
+    /// Add a chunk of free slots (no-op if another thread just did)
+    [[nodiscard]] Result<void> grow() noexcept {
+        std::lock_guard lock(grow_mutex_);
+        if (static_cast<uint32_t>(free_head_.load(std::memory_order_acquire)) != nil) {
+            return Ok();
+        }
+        const uint32_t chunk = num_chunks_.load(std::memory_order_relaxed);
+        if (chunk == max_chunks) [[unlikely]] {
+            return Err(Error::Code::ReadError, "Too many io_uring operations in flight");
+        }
+        Slot* slots = new (std::nothrow) Slot[chunk_size];
+        if (!slots) [[unlikely]] {
+            return Err(Error::Code::MemoryError, "Failed to allocate io_uring operation slots");
+        }
+        chunks_[chunk].store(slots, std::memory_order_release);
+        num_chunks_.store(chunk + 1, std::memory_order_release);
+        
+        const uint32_t first = chunk * chunk_size;
+        for (uint32_t i = 0; i < chunk_size; ++i) {
+            slots[i].generation = 0;
+            slots[i].next.store(i + 1 < chunk_size ? first + i + 1 : nil, std::memory_order_relaxed);
+        }
+        // Splice the chain in front of the (possibly refilled) free list
+        uint64_t head = free_head_.load(std::memory_order_relaxed);
+        uint64_t new_head;
+        do {
+            slots[chunk_size - 1].next.store(static_cast<uint32_t>(head), std::memory_order_relaxed);
+            new_head = (((head >> 32) + 1) << 32) | first;
+        } while (!free_head_.compare_exchange_weak(head, new_head,
+                                                   std::memory_order_release,
+                                                   std::memory_order_relaxed));
+        return Ok();
+    }
+    
+    std::unique_ptr<std::atomic<Slot*>[]> chunks_;
+    std::atomic<uint32_t> num_chunks_{0};
+    std::atomic<uint64_t> free_head_{nil};      ///< Tag (high 32 bits) | index
+    std::atomic<uint32_t> submit_head_{nil};
+    std::mutex grow_mutex_;
+};
+
 } // namespace io_uring_impl
 
 /// High-performance async file reader using Linux io_uring
@@ -59,8 +376,16 @@ static_assert(DataReadOnlyView<OwnedBufferReadView>,
 /// Design:
 /// - Zero-copy async I/O with user-provided buffers
 /// - Thread-safe: multiple threads can submit and poll concurrently
-/// - Lock-free fast path: submission and completion reaping use minimal locking
+/// - Lock-free submission: async_read_into() only fills a preallocated slot and
+///   queues it; SQEs are prepared in bulk by submit_pending() and the waits
+/// - Submission (SQ) and completion (CQ) sides have separate locks
 /// - Fallback: Provides sync read() methods for compatibility
+/// - Optional registered I/O (Config::use_registered_io): the file is registered
+///   with the ring and reads into the buffers of acquire_buffer() are issued as
+///   READ_FIXED, skipping the per-I/O file lookup and page pinning
+/// - Optional direct I/O (Config::use_direct_io): O_DIRECT bypasses the page
+///   cache. Requests are widened to io_alignment(); unaligned ones are read
+///   into a pooled aligned buffer and copied when they complete
 /// 
 /// Performance Characteristics:
 /// - Best for: High-latency I/O (NAS, cloud) or massively parallel local I/O
@@ -70,7 +395,8 @@ static_assert(DataReadOnlyView<OwnedBufferReadView>,
 /// 
 /// Thread Safety:
 /// - All methods are thread-safe and can be called concurrently
-/// - Submissions and completions use internal locking (minimal contention)
+/// - async_read_into() is lock-free, submit_pending() and the completion
+///   methods each lock one side of the ring
 /// - Each completion delivered to exactly one thread
 /// 
 /// Requirements:
@@ -148,6 +474,17 @@ public:
         bool use_iopoll = false;         ///< Use polling I/O (requires O_DIRECT, fast devices only)
         int32_t sq_thread_cpu = -1;      ///< CPU for SQPOLL thread (-1 = no affinity)
         uint32_t sq_thread_idle = 2000;  ///< SQPOLL idle timeout in ms
+        
+        /// Register the file and a pool of buffers with the ring (READ_FIXED)
+        /// Falls back to regular I/O if registration fails (see registered_io())
+        bool use_registered_io = false;
+        uint32_t registered_buffer_count = 32;              ///< Buffers in the pool
+        std::size_t registered_buffer_size = 128 * 1024;    ///< Bytes per buffer (rounded up to pages)
+        // Registered buffers are locked in memory and count against RLIMIT_MEMLOCK
+        
+        /// Bypass the page cache (O_DIRECT), for files streamed once
+        /// Falls back to buffered I/O if the file system has no direct I/O (see direct_io())
+        bool use_direct_io = false;
     };
     
     IoUringFileReader() noexcept = default;
@@ -181,11 +518,17 @@ public:
         , size_(other.size_)
         , path_(std::move(other.path_))
         , ring_(std::move(other.ring_))
-        , next_user_data_(other.next_user_data_.load())
+        , fixed_file_(other.fixed_file_)
+        , buffer_pool_(std::move(other.buffer_pool_))
+        , direct_pool_(std::move(other.direct_pool_))
+        , slots_(std::move(other.slots_))
+        , backlog_head_(other.backlog_head_)
+        , backlog_tail_(other.backlog_tail_)
+        , backlog_(other.backlog_.load())
         , pending_ops_(other.pending_ops_.load()) {
         other.fd_ = -1;
+        other.fixed_file_ = false;
         other.size_ = 0;
-        other.next_user_data_.store(1);
         other.pending_ops_.store(0);
     }
     
@@ -196,11 +539,17 @@ public:
             size_ = other.size_;
             path_ = std::move(other.path_);
             ring_ = std::move(other.ring_);
-            next_user_data_.store(other.next_user_data_.load());
+            fixed_file_ = other.fixed_file_;
+            buffer_pool_ = std::move(other.buffer_pool_);
+            direct_pool_ = std::move(other.direct_pool_);
+            slots_ = std::move(other.slots_);
+            backlog_head_ = other.backlog_head_;
+            backlog_tail_ = other.backlog_tail_;
+            backlog_.store(other.backlog_.load());
             pending_ops_.store(other.pending_ops_.load());
             other.fd_ = -1;
+            other.fixed_file_ = false;
             other.size_ = 0;
-            other.next_user_data_.store(1);
             other.pending_ops_.store(0);
         }
         return *this;
@@ -218,12 +567,15 @@ public:
         path_ = path;
         
         // Open file (O_DIRECT required for IOPOLL)
-        int flags = O_RDONLY;
+        bool direct = false;
         if (config.use_iopoll) {
-            flags |= O_DIRECT;
+            fd_ = ::open(path_.c_str(), O_RDONLY | O_DIRECT);
+            direct = true;
+        } else if (config.use_direct_io) {
+            fd_ = direct_io::open_read_only(path_.c_str(), 0, direct);
+        } else {
+            fd_ = ::open(path_.c_str(), O_RDONLY);
         }
-        
-        fd_ = ::open(path_.c_str(), flags);
         if (fd_ < 0) [[unlikely]] {
             return Err(Error::Code::FileNotFound, 
                       "Failed to open file: " + std::string(path) + 
@@ -285,6 +637,25 @@ public:
                       "Try increasing RLIMIT_MEMLOCK with: ulimit -l unlimited");
         }
         
+        try {
+            slots_ = std::make_unique<io_uring_impl::OperationSlots>();
+        } catch (...) {
+            close();
+            return Err(Error::Code::MemoryError, "Failed to allocate io_uring operation slots");
+        }
+        
+        if (direct) {
+            direct_pool_ = direct_io::AlignedBufferPool::create(direct_io::query_alignment(fd_));
+            if (!direct_pool_) {
+                close();
+                return Err(Error::Code::MemoryError, "Failed to allocate aligned buffer pool");
+            }
+        }
+        
+        if (config.use_registered_io) {
+            register_io(config);
+        }
+        
         return Ok();
     }
     
@@ -293,9 +664,16 @@ public:
         if (ring_) {
             // Cancel all pending operations
             // Note: This is automatic when io_uring is destroyed, but we make it explicit
+            // (also unregisters the file and the buffers)
             io_uring_queue_exit(ring_.get());
             ring_.reset();
         }
+        fixed_file_ = false;
+        buffer_pool_.reset();  // Outstanding leases keep the memory alive
+        direct_pool_.reset();  // Outstanding read views keep their buffers
+        slots_.reset();
+        backlog_head_ = backlog_tail_ = io_uring_impl::OperationSlots::nil;
+        backlog_.store(false);
         
         if (fd_ >= 0) {
             ::close(fd_);
@@ -304,7 +682,6 @@ public:
         }
         
         pending_ops_.store(0, std::memory_order_release);
-        next_user_data_.store(1, std::memory_order_release);
     }
     
     // ========================================================================
@@ -323,6 +700,16 @@ public:
         
         std::size_t bytes_to_read = std::min(size, size_ - offset);
         
+        if (direct_pool_) {
+            // Aligned read into a pooled buffer, viewed at the requested bytes
+            std::span<const std::byte> data_span;
+            auto buffer_res = direct_io::read(fd_, *direct_pool_, offset, bytes_to_read, data_span);
+            if (!buffer_res) [[unlikely]] {
+                return buffer_res.error();
+            }
+            return Ok(ReadViewType(data_span, std::move(buffer_res.value())));
+        }
+        
         // Allocate buffer
         auto buffer = std::shared_ptr<std::byte[]>(new std::byte[bytes_to_read]);
         
@@ -354,6 +741,11 @@ public:
         
         std::size_t bytes_to_read = std::min(size, size_ - offset);
         
+        if (direct_pool_) {
+            return direct_io::read_into(fd_, *direct_pool_, static_cast<std::byte*>(dest_buffer),
+                                        size, offset, bytes_to_read);
+        }
+        
         ssize_t bytes_read = ::pread(fd_, dest_buffer, bytes_to_read, static_cast<off_t>(offset));
         
         if (bytes_read < 0) [[unlikely]] {
@@ -376,13 +768,56 @@ public:
     }
     
     [[nodiscard]] bool is_valid() const noexcept {
-        return fd_ >= 0 && ring_ != nullptr;
+        return fd_ >= 0 && ring_ != nullptr && slots_ != nullptr;
     }
     
     [[nodiscard]] std::string_view path() const noexcept {
         return path_;
     }
     
+    /// Whether reads bypass the page cache (O_DIRECT)
+    [[nodiscard]] bool direct_io() const noexcept {
+        return direct_pool_ != nullptr;
+    }
+    
+    /// Alignment of in-place reads (see AlignedIoReader), 1 without direct I/O
+    [[nodiscard]] std::size_t io_alignment() const noexcept {
+        return direct_pool_ ? direct_pool_->alignment() : 1;
+    }
+    
+    // ========================================================================
+    // Registered I/O (Config::use_registered_io)
+    // ========================================================================
+    
+    /// Whether the file and the buffer pool are registered with the ring
+    [[nodiscard]] bool registered_io() const noexcept {
+        return buffer_pool_ != nullptr;
+    }
+    
+    /// Size of the registered buffers (0 without registered I/O)
+    [[nodiscard]] std::size_t registered_buffer_size() const noexcept {
+        return buffer_pool_ ? buffer_pool_->buffer_size() : 0;
+    }
+    
+    /// Borrow a registered buffer of at least size bytes
+    /// 
+    /// async_read_into() issues READ_FIXED for destinations inside the buffer.
+    /// The buffer returns to the pool when the lease is destroyed, which must
+    /// only happen once the reads into it have completed.
+    /// 
+    /// @return Empty lease without registered I/O, if size exceeds
+    ///         registered_buffer_size(), or if every buffer is in use
+    [[nodiscard]] io_uring_impl::RegisteredBuffer acquire_buffer(std::size_t size) const noexcept {
+        if (!buffer_pool_ || size > buffer_pool_->buffer_size()) {
+            return {};
+        }
+        int32_t index = buffer_pool_->try_acquire();
+        if (index < 0) {
+            return {};
+        }
+        return io_uring_impl::RegisteredBuffer(buffer_pool_, static_cast<uint32_t>(index));
+    }
+    
     // ========================================================================
     // AsyncRawReader Interface (Asynchronous Operations)
     // ========================================================================
@@ -392,6 +827,9 @@ public:
     /// The buffer MUST remain valid until completion is retrieved.
     /// Buffer is NOT copied - io_uring reads directly into it.
     /// 
+    /// Lock-free: the read is queued, and handed to the kernel by the next
+    /// submit_pending() (or wait_completions*()) from any thread.
+    /// 
     /// @param buffer User-provided buffer (must outlive operation)
     /// @param offset File offset to read from
     /// @param size Number of bytes to read
@@ -416,47 +854,41 @@ public:
         
         std::size_t bytes_to_read = std::min(size, size_ - offset);
         
-        // Allocate unique handle for this operation
-        uint64_t user_data = next_user_data_.fetch_add(1, std::memory_order_relaxed);
-        if (user_data == 0) [[unlikely]] {
-            // Wrapped around (extremely rare) - skip zero as it's often special
-            user_data = next_user_data_.fetch_add(1, std::memory_order_relaxed);
+        // Operation context, also providing the unique handle id
+        auto slot_res = slots_->acquire();
+        if (!slot_res) [[unlikely]] {
+            return slot_res.error();
         }
-        
-        // Get submission queue entry
-        std::lock_guard lock(ring_mutex_);
-        
-        io_uring_sqe* sqe = io_uring_get_sqe(ring_.get());
-        if (!sqe) [[unlikely]] {
-            // Queue full - try submitting pending operations
-            int submitted = io_uring_submit(ring_.get());
-            if (submitted < 0) {
-                return Err(Error::Code::ReadError, 
-                          "io_uring submission failed: " + std::string(std::strerror(-submitted)));
-            }
-            
-            // Try again after submission
-            sqe = io_uring_get_sqe(ring_.get());
-            if (!sqe) [[unlikely]] {
-                return Err(Error::Code::ReadError, "io_uring queue exhausted");
+        const uint32_t index = slot_res.value();
+        auto& slot = (*slots_)[index];
+        slot.buffer = buffer.data();
+        slot.size = bytes_to_read;
+        slot.io_buffer = buffer.data();
+        slot.io_size = bytes_to_read;
+        slot.io_offset = offset;
+        slot.skip = 0;
+        if (direct_pool_) {
+            // Whole blocks: in place when the request and the buffer allow it
+            const auto extent = direct_io::aligned_extent(offset, bytes_to_read, direct_pool_->alignment());
+            slot.io_offset = extent.offset;
+            slot.io_size = extent.size;
+            if (extent.skip != 0 || extent.size > buffer.size() ||
+                !direct_io::is_aligned(buffer.data(), direct_pool_->alignment())) {
+                slot.bounce = direct_pool_->acquire(extent.size);
+                if (!slot.bounce) [[unlikely]] {
+                    slots_->release(index);
+                    return Err(Error::Code::MemoryError, "Failed to allocate aligned read buffer");
+                }
+                slot.io_buffer = slot.bounce.get();
+                slot.skip = extent.skip;
             }
         }
-        
-        // Setup read operation
-        io_uring_prep_read(sqe, fd_, buffer.data(), bytes_to_read, static_cast<off_t>(offset));
-        io_uring_sqe_set_data(sqe, reinterpret_cast<void*>(user_data));
+        slot.buffer_index = buffer_pool_ ? buffer_pool_->find(slot.io_buffer, slot.io_size) : -1;
+        const uint64_t user_data = slots_->user_data(index);
         
         // Track pending operation
         pending_ops_.fetch_add(1, std::memory_order_release);
-        
-        // Store operation context for completion
-        {
-            std::lock_guard ctx_lock(context_mutex_);
-            operation_contexts_[user_data] = OperationContext{
-                buffer.data(),
-                bytes_to_read
-            };
-        }
+        slots_->push_submission(index);
         
         return Ok(AsyncOperationHandle{user_data});
     }
@@ -471,26 +903,8 @@ public:
         
         std::vector<std::pair<AsyncOperationHandle, AsyncReadResult>> results;
         
-        std::lock_guard lock(ring_mutex_);
-        
-        io_uring_cqe* cqe;
-        unsigned head;
-        unsigned count = 0;
-        
-        // Peek at all available completions without blocking
-        io_uring_for_each_cqe(ring_.get(), head, cqe) {
-            if (max_completions > 0 && count >= max_completions) {
-                break;
-            }
-            
-            results.push_back(process_completion(cqe));
-            count++;
-        }
-        
-        // Mark processed completions as seen
-        if (count > 0) {
-            io_uring_cq_advance(ring_.get(), count);
-        }
+        std::lock_guard lock(cq_mutex_);
+        collect_completions(results, max_completions);
         
         return results;
     }
@@ -504,20 +918,22 @@ public:
         }
         
         // Quick check: are completions already available?
-        {
-            std::lock_guard lock(ring_mutex_);
-            io_uring_cqe* cqe = nullptr;
-            int ret = io_uring_peek_cqe(ring_.get(), &cqe);
-            if (ret == 0 && cqe != nullptr) {
-                // Completions available, use poll_completions
-                return poll_completions(max_completions);
-            }
+        // (poll_completions takes cq_mutex_ itself, so it must not be held here)
+        auto results = poll_completions(max_completions);
+        if (!results.empty()) {
+            return results;
         }
         
-        // No completions available - wait for at least one
-        std::vector<std::pair<AsyncOperationHandle, AsyncReadResult>> results;
+        // Nothing in flight - waiting would block forever
+        if (pending_ops_.load(std::memory_order_acquire) == 0) {
+            return results;
+        }
         
-        std::lock_guard lock(ring_mutex_);
+        // Reads queued but not handed to the kernel would never complete
+        (void)submit_pending();
+        
+        // No completions available - wait for at least one
+        std::lock_guard lock(cq_mutex_);
         
         io_uring_cqe* cqe = nullptr;
         int ret = io_uring_wait_cqe(ring_.get(), &cqe);
@@ -527,26 +943,7 @@ public:
             return results;
         }
         
-        if (cqe) {
-            results.push_back(process_completion(cqe));
-            io_uring_cqe_seen(ring_.get(), cqe);
-            
-            // Also collect any other completions that arrived
-            unsigned head;
-            unsigned count = 0;
-            io_uring_for_each_cqe(ring_.get(), head, cqe) {
-                if (max_completions > 0 && count + 1 >= max_completions) {
-                    break;
-                }
-                results.push_back(process_completion(cqe));
-                count++;
-            }
-            
-            if (count > 0) {
-                io_uring_cq_advance(ring_.get(), count);
-            }
-        }
-        
+        collect_completions(results, max_completions);
         return results;
     }
     
@@ -561,7 +958,22 @@ public:
         
         std::vector<std::pair<AsyncOperationHandle, AsyncReadResult>> results;
         
-        std::lock_guard lock(ring_mutex_);
+        // Reads queued but not handed to the kernel would never complete
+        if (slots_->has_queued_submissions() || backlog_.load(std::memory_order_relaxed)) {
+            (void)submit_pending();
+        }
+        
+        // Without IORING_FEAT_EXT_ARG, liburing implements the timeout with an
+        // SQE: the submission side must then be locked as well
+        std::unique_lock sq_lock(sq_mutex_, std::defer_lock);
+#ifdef IORING_FEAT_EXT_ARG
+        if (!(ring_->features & IORING_FEAT_EXT_ARG)) {
+            sq_lock.lock();
+        }
+#else
+        sq_lock.lock();
+#endif
+        std::lock_guard lock(cq_mutex_);
         
         // Setup timeout
         __kernel_timespec ts{};
@@ -581,26 +993,7 @@ public:
             return results;
         }
         
-        if (cqe) {
-            results.push_back(process_completion(cqe));
-            io_uring_cqe_seen(ring_.get(), cqe);
-            
-            // Collect any other completions
-            unsigned head;
-            unsigned count = 0;
-            io_uring_for_each_cqe(ring_.get(), head, cqe) {
-                if (max_completions > 0 && count + 1 >= max_completions) {
-                    break;
-                }
-                results.push_back(process_completion(cqe));
-                count++;
-            }
-            
-            if (count > 0) {
-                io_uring_cq_advance(ring_.get(), count);
-            }
-        }
-        
+        collect_completions(results, max_completions);
         return results;
     }
     
@@ -611,30 +1004,174 @@ public:
     
     /// Force submission of queued operations to kernel
     /// 
-    /// io_uring batches submissions internally. This forces a flush.
+    /// Prepares the SQEs of every read queued by async_read_into() (from any
+    /// thread), then submits them with a single syscall.
     /// Call after submitting a batch of operations for optimal performance.
     [[nodiscard]] Result<std::size_t> submit_pending() const noexcept {
         if (!is_valid()) [[unlikely]] {
             return Err(Error::Code::ReadError, "File not open");
         }
         
-        std::lock_guard lock(ring_mutex_);
+        std::lock_guard lock(sq_mutex_);
         
-        int submitted = io_uring_submit(ring_.get());
-        if (submitted < 0) [[unlikely]] {
-            return Err(Error::Code::ReadError, 
-                      "io_uring_submit failed: " + std::string(std::strerror(-submitted)));
+        std::size_t total = 0;
+        bool more = true;
+        while (more) {
+            more = prepare_queued_sqes();
+            
+            int submitted = io_uring_submit(ring_.get());
+            if (submitted == -EBUSY || submitted == -EAGAIN) {
+                // CQ overflow / resource shortage: retried once completions are reaped
+                submitted = 0;
+            } else if (submitted < 0) [[unlikely]] {
+                backlog_.store(true, std::memory_order_relaxed);
+                return Err(Error::Code::ReadError, 
+                          "io_uring_submit failed: " + std::string(std::strerror(-submitted)));
+            }
+            total += static_cast<std::size_t>(submitted);
+            // Nothing consumed: go on once the kernel catches up
+            // (SQPOLL thread lagging, CQ full until completions are reaped)
+            if (submitted == 0) {
+                break;
+            }
         }
+        // Reads left in the backlog or in the SQ are submitted by the next call
+        backlog_.store(more || io_uring_sq_ready(ring_.get()) > 0, std::memory_order_relaxed);
         
-        return Ok(static_cast<std::size_t>(submitted));
+        return Ok(total);
     }
 
 private:
-    /// Context for a pending operation
-    struct OperationContext {
-        void* buffer;       ///< User-provided buffer
-        std::size_t size;   ///< Expected read size
-    };
+    /// Register the file and allocate + register the buffer pool
+    /// Failures leave the reader on regular I/O (reported by registered_io())
+    void register_io(const Config& config) noexcept {
+        if (io_uring_register_files(ring_.get(), &fd_, 1) == 0) {
+            fixed_file_ = true;
+        }
+        
+        auto pool = io_uring_impl::RegisteredBufferPool::create(
+            config.registered_buffer_count, config.registered_buffer_size);
+        if (!pool) {
+            return;
+        }
+        try {
+            auto iovecs = pool.value()->iovecs();
+            int ret = io_uring_register_buffers(ring_.get(), iovecs.data(),
+                                                static_cast<unsigned>(iovecs.size()));
+            if (ret < 0) {
+                return;  // RLIMIT_MEMLOCK too low?
+            }
+        } catch (...) {
+            return;
+        }
+        buffer_pool_ = std::move(pool.value());
+    }
+    
+    /// Prepare SQEs for the queued reads (sq_mutex_ held)
+    /// Reads that do not fit in the SQ stay in the backlog, in order
+    /// @return true if reads are left in the backlog
+    bool prepare_queued_sqes() const noexcept {
+        constexpr uint32_t nil = io_uring_impl::OperationSlots::nil;
+        
+        // Append the newly queued reads to the backlog
+        const uint32_t queued = slots_->take_submissions();
+        if (queued != nil) {
+            if (backlog_head_ == nil) {
+                backlog_head_ = queued;
+            } else {
+                (*slots_)[backlog_tail_].next.store(queued, std::memory_order_relaxed);
+            }
+            uint32_t tail = queued;
+            for (uint32_t next = (*slots_)[tail].next.load(std::memory_order_relaxed);
+                 next != nil;
+                 next = (*slots_)[tail].next.load(std::memory_order_relaxed)) {
+                tail = next;
+            }
+            backlog_tail_ = tail;
+        }
+        
+        const int fd = fixed_file_ ? 0 : fd_;
+        while (backlog_head_ != nil) {
+            io_uring_sqe* sqe = io_uring_get_sqe(ring_.get());
+            if (!sqe) {
+                return true;
+            }
+            const uint32_t index = backlog_head_;
+            const auto& slot = (*slots_)[index];
+            backlog_head_ = slot.next.load(std::memory_order_relaxed);
+            
+            // Setup read operation (registered file and buffer when available)
+            if (slot.buffer_index >= 0) {
+                io_uring_prep_read_fixed(sqe, fd, slot.io_buffer, static_cast<unsigned>(slot.io_size),
+                                         static_cast<off_t>(slot.io_offset), slot.buffer_index);
+            } else {
+                io_uring_prep_read(sqe, fd, slot.io_buffer, static_cast<unsigned>(slot.io_size),
+                                   static_cast<off_t>(slot.io_offset));
+            }
+            if (fixed_file_) {
+                io_uring_sqe_set_flags(sqe, IOSQE_FIXED_FILE);
+            }
+            io_uring_sqe_set_data(sqe, reinterpret_cast<void*>(slots_->user_data(index)));
+        }
+        backlog_tail_ = nil;
+        return false;
+    }
+    
+    /// Reap the available completions (cq_mutex_ held)
+    void collect_completions(
+        std::vector<std::pair<AsyncOperationHandle, AsyncReadResult>>& results,
+        std::size_t max_completions) const noexcept {
+        
+        // Reserve room for every completion taken below: process_completion
+        // releases the slot, so nothing may fail once it has run
+        std::size_t wanted = io_uring_cq_ready(ring_.get());
+        if (max_completions > 0) {
+            if (results.size() >= max_completions) {
+                return;
+            }
+            wanted = std::min(wanted, max_completions - results.size());
+        }
+        if (wanted == 0) {
+            return;
+        }
+        try {
+            results.reserve(results.size() + wanted);
+        } catch (...) {
+            return;  // Left in the CQ for the next call
+        }
+        
+        io_uring_cqe* cqe;
+        unsigned head;
+        unsigned count = 0;
+        
+        // Peek at the available completions without blocking
+        io_uring_for_each_cqe(ring_.get(), head, cqe) {
+            if (count == wanted) {
+                break;
+            }
+            results.push_back(process_completion(cqe));
+            count++;
+        }
+        
+        // Mark processed completions as seen
+        if (count > 0) {
+            io_uring_cq_advance(ring_.get(), count);
+        }
+    }
+    
+    /// Build the error of a failed completion (without a message if it cannot be allocated)
+    [[nodiscard]] static Error completion_error(Error::Code code, const char* what, int errnum = 0) noexcept {
+        try {
+            std::string message(what);
+            if (errnum != 0) {
+                message += ": ";
+                message += std::strerror(errnum);
+            }
+            return Err(code, std::move(message));
+        } catch (...) {
+            return Error{code, {}};
+        }
+    }
     
     /// Process a single completion queue entry
     [[nodiscard]] std::pair<AsyncOperationHandle, AsyncReadResult> 
@@ -646,36 +1183,36 @@ private:
         // Decrement pending counter
         pending_ops_.fetch_sub(1, std::memory_order_release);
         
-        // Retrieve operation context
-        OperationContext ctx{};
-        {
-            std::lock_guard lock(context_mutex_);
-            auto it = operation_contexts_.find(user_data);
-            if (it != operation_contexts_.end()) {
-                ctx = it->second;
-                operation_contexts_.erase(it);
-            }
-        }
+        // Retrieve and free the operation context
+        const uint32_t index = io_uring_impl::OperationSlots::index_of(user_data);
+        auto& slot = (*slots_)[index];
+        std::byte* buffer = slot.buffer;
+        const std::size_t expected_size = slot.size;
+        const std::size_t skip = slot.skip;
+        // Unaligned direct read: copy the requested bytes out of the bounce buffer
+        auto bounce = std::move(slot.bounce);
+        slots_->release(index);
         
         // Check for errors
         if (result < 0) [[unlikely]] {
-            return {AsyncOperationHandle{user_data}, Err(Error::Code::ReadError, 
-                   "io_uring read failed: " + std::string(std::strerror(-result)))};
+            return {AsyncOperationHandle{user_data}, completion_error(Error::Code::ReadError, 
+                   "io_uring read failed", -result)};
         }
         
-        // Check for short read
-        if (static_cast<std::size_t>(result) < ctx.size) [[unlikely]] {
-            return {AsyncOperationHandle{user_data}, Err(Error::Code::UnexpectedEndOfFile, 
+        // Check for short read (direct reads may go past the requested bytes)
+        if (static_cast<std::size_t>(result) < skip + expected_size) [[unlikely]] {
+            return {AsyncOperationHandle{user_data}, completion_error(Error::Code::UnexpectedEndOfFile, 
                    "io_uring read returned fewer bytes than requested")};
         }
         
+        if (bounce) {
+            std::memcpy(buffer, bounce.get() + skip, expected_size);
+        }
+        
         // Success - wrap buffer in ReadView
         // Note: We don't own the buffer, so we can't use shared_ptr here
         // The caller must ensure buffer remains valid
-        std::span<const std::byte> data_span(
-            static_cast<const std::byte*>(ctx.buffer), 
-            static_cast<std::size_t>(result)
-        );
+        std::span<const std::byte> data_span(buffer, expected_size);
         
         // Return view without ownership (buffer owned by caller)
         return {AsyncOperationHandle{user_data}, Ok(ReadViewType(data_span, nullptr))};
@@ -687,21 +1224,28 @@ private:
     
     // io_uring state (mutable for const methods)
     mutable std::unique_ptr<io_uring> ring_;
-    mutable std::mutex ring_mutex_;  // Protects ring access
+    mutable std::mutex sq_mutex_;  // Protects the submission side (and the backlog)
+    mutable std::mutex cq_mutex_;  // Protects the completion side
+    
+    // Registered I/O state (set once by open)
+    bool fixed_file_{false};                                       // fd_ registered at index 0
+    std::shared_ptr<io_uring_impl::RegisteredBufferPool> buffer_pool_;  // Registered buffers
+    std::shared_ptr<direct_io::AlignedBufferPool> direct_pool_;         // Set when opened with O_DIRECT
     
     // Operation tracking
-    mutable std::atomic<uint64_t> next_user_data_{1};
+    std::unique_ptr<io_uring_impl::OperationSlots> slots_;
+    mutable uint32_t backlog_head_{io_uring_impl::OperationSlots::nil};  // Queued reads without SQE
+    mutable uint32_t backlog_tail_{io_uring_impl::OperationSlots::nil};  // (sq_mutex_)
+    mutable std::atomic<bool> backlog_{false};                          // Backlog or unsubmitted SQEs left
     mutable std::atomic<std::size_t> pending_ops_{0};
-    
-    // Operation context storage
-    mutable std::mutex context_mutex_;
-    mutable std::unordered_map<uint64_t, OperationContext> operation_contexts_;
 };
 
 static_assert(RawReader<IoUringFileReader>, 
               "IoUringFileReader must satisfy RawReader concept");
 static_assert(AsyncRawReader<IoUringFileReader>, 
               "IoUringFileReader must satisfy AsyncRawReader concept");
+static_assert(AlignedIoReader<IoUringFileReader>, 
+              "IoUringFileReader must satisfy AlignedIoReader concept");
 
 } // namespace tiffconcept
 
@@ -11,6 +11,7 @@
 #include <sys/stat.h>
 #include <unistd.h>
 #include "../reader_base.hpp"
+#include "unix_direct_io.hpp"
 
 namespace tiffconcept {
 namespace pread_impl {
@@ -125,18 +126,29 @@ namespace detail {
         static constexpr int open_flags = O_RDONLY;
         static constexpr bool can_read = true;
         static constexpr bool can_write = false;
+        static constexpr bool direct_io = false;
+    };
+    
+    // Read-only, bypassing the page cache (O_DIRECT)
+    struct DirectReadOnlyAccess {
+        static constexpr int open_flags = O_RDONLY;
+        static constexpr bool can_read = true;
+        static constexpr bool can_write = false;
+        static constexpr bool direct_io = true;
     };
     
     struct WriteOnlyAccess {
         static constexpr int open_flags = O_RDWR;
         static constexpr bool can_read = false;
         static constexpr bool can_write = true;
+        static constexpr bool direct_io = false;
     };
     
     struct ReadWriteAccess {
         static constexpr int open_flags = O_RDWR;
         static constexpr bool can_read = true;
         static constexpr bool can_write = true;
+        static constexpr bool direct_io = false;
     };
 } // namespace detail
 
@@ -150,6 +162,7 @@ protected:
     int fd_{-1};
     std::size_t size_{0};
     std::string path_;
+    std::shared_ptr<direct_io::AlignedBufferPool> direct_pool_;  // Set when opened with O_DIRECT
 
 public:
     using ReadViewType = pread_impl::OwnedBufferReadView;
@@ -173,7 +186,8 @@ public:
     PreadFileBase(PreadFileBase&& other) noexcept
         : fd_(other.fd_)
         , size_(other.size_)
-        , path_(std::move(other.path_)) {
+        , path_(std::move(other.path_))
+        , direct_pool_(std::move(other.direct_pool_)) {
         other.fd_ = -1;
         other.size_ = 0;
     }
@@ -184,6 +198,7 @@ public:
             fd_ = other.fd_;
             size_ = other.size_;
             path_ = std::move(other.path_);
+            direct_pool_ = std::move(other.direct_pool_);
             other.fd_ = -1;
             other.size_ = 0;
         }
@@ -199,7 +214,13 @@ public:
             flags |= O_CREAT;
         }
         
-        fd_ = ::open(path_.c_str(), flags, 0644);
+        bool direct = false;
+        if constexpr (AccessPolicy::direct_io) {
+            // Regular descriptor if the file system has no direct I/O
+            fd_ = direct_io::open_read_only(path_.c_str(), 0, direct);
+        } else {
+            fd_ = ::open(path_.c_str(), flags, 0644);
+        }
         
         if (fd_ < 0) {
             return Err(Error::Code::FileNotFound, 
@@ -214,6 +235,14 @@ public:
         }
         
         size_ = static_cast<std::size_t>(st.st_size);
+        
+        if (direct) {
+            direct_pool_ = direct_io::AlignedBufferPool::create(direct_io::query_alignment(fd_));
+            if (!direct_pool_) {
+                close();
+                return Err(Error::Code::MemoryError, "Failed to allocate aligned buffer pool");
+            }
+        }
         return Ok();
     }
     
@@ -226,6 +255,7 @@ public:
             fd_ = -1;
             size_ = 0;
         }
+        direct_pool_.reset();  // Outstanding read views keep their buffers
     }
     
     /// Thread-safe read using pread (only available if can_read is true)
@@ -241,6 +271,16 @@ public:
         
         std::size_t bytes_to_read = std::min(size, size_ - offset);
         
+        if (direct_pool_) {
+            // Aligned read into a pooled buffer, viewed at the requested bytes
+            std::span<const std::byte> data_span;
+            auto buffer_res = direct_io::read(fd_, *direct_pool_, offset, bytes_to_read, data_span);
+            if (!buffer_res) [[unlikely]] {
+                return buffer_res.error();
+            }
+            return Ok(pread_impl::OwnedBufferReadView(data_span, std::move(buffer_res.value())));
+        }
+        
         // Allocate buffer
         auto buffer = std::shared_ptr<std::byte[]>(new std::byte[bytes_to_read]);
         
@@ -272,6 +312,11 @@ public:
 
         std::size_t bytes_to_read = std::min(size, size_ - offset);
 
+        if (direct_pool_) {
+            return direct_io::read_into(fd_, *direct_pool_, static_cast<std::byte*>(dest_buffer),
+                                        size, offset, bytes_to_read);
+        }
+
         ssize_t bytes_read = ::pread(fd_, dest_buffer, bytes_to_read, static_cast<off_t>(offset));
 
         if (bytes_read < 0) [[unlikely]] {
@@ -341,6 +386,17 @@ public:
         return fd_ >= 0;
     }
     
+    /// Whether reads bypass the page cache (O_DIRECT)
+    /// False if the file system does not support direct I/O
+    [[nodiscard]] bool direct_io() const noexcept {
+        return direct_pool_ != nullptr;
+    }
+    
+    /// Alignment of in-place reads (see AlignedIoReader), 1 without direct I/O
+    [[nodiscard]] std::size_t io_alignment() const noexcept {
+        return direct_pool_ ? direct_pool_->alignment() : 1;
+    }
+    
     [[nodiscard]] std::string_view path() const noexcept {
         return path_;
     }
@@ -351,6 +407,15 @@ using PreadFileReader = PreadFileBase<pread_impl::detail::ReadOnlyAccess>;
 
 static_assert(RawReader<PreadFileReader>, "PreadFileReader must satisfy RawReader concept");
 
+/// File reader using pread on an O_DIRECT descriptor - thread-safe without locks, read-only
+/// Bypasses the page cache: for files streamed once (cold scans) that should
+/// not evict the cached data of other processes. Unaligned requests are served
+/// through pooled aligned buffers; batch readers align their requests
+/// (io_alignment()) so that batches are read in place.
+using PreadDirectFileReader = PreadFileBase<pread_impl::detail::DirectReadOnlyAccess>;
+
+static_assert(AlignedIoReader<PreadDirectFileReader>, "PreadDirectFileReader must satisfy AlignedIoReader concept");
+
 /// File writer using pwrite (POSIX) - thread-safe without locks, write-only
 using PwriteFileWriter = PreadFileBase<pread_impl::detail::WriteOnlyAccess>;
 
@@ -41,6 +41,18 @@
 //    - For pre-loaded data
 //    - Platform: All
 //
+// DECORATORS (wrap any of the readers above):
+//
+// 7. CachingReader<Inner> (reader_caching.hpp) - All platforms
+//    - Caches aligned blocks of the file in a bounded LRU
+//    - Repeated metadata walks and tile reads are served from memory
+//    - Async (AsyncRawReader) when Inner is
+//
+// 8. SimulatedRemoteReader<Inner> (reader_simulated_remote.hpp) - All platforms
+//    - Adds per-request latency, a bandwidth cap and a concurrency limit
+//    - Benchmarks remote storage (object store, NAS) from a local file
+//    - Always async (AsyncRawReader)
+//
 // USAGE:
 // Include only the reader(s) you need:
 //   #include "tiff/reader_unix_mmap.hpp"
@@ -66,6 +78,8 @@
 #endif
 
 #include "reader_stream.hpp"
+#include "reader_caching.hpp"
+#include "reader_simulated_remote.hpp"
 
 // Automatic platform selection (opt-in with TIFF_AUTO_READER)
 #ifdef TIFF_AUTO_READER
@@ -0,0 +1,241 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+#include "../reader_base.hpp"
+
+namespace tiffconcept {
+
+/// Helpers for readers opened with O_DIRECT (pread and io_uring readers)
+///
+/// O_DIRECT bypasses the page cache, so streaming large files once does not
+/// evict the cached data of other processes. In exchange the file offset,
+/// the length and the memory address of every read must be multiples of the
+/// alignment of the file system. Requests are widened to aligned blocks and
+/// read into aligned pooled buffers; callers only see the requested bytes.
+namespace direct_io {
+
+/// Alignment used when the file system does not report one (page size)
+inline constexpr std::size_t default_alignment = 4096;
+
+[[nodiscard]] constexpr std::size_t align_down(std::size_t value, std::size_t alignment) noexcept {
+    return value & ~(alignment - 1);
+}
+
+[[nodiscard]] constexpr std::size_t align_up(std::size_t value, std::size_t alignment) noexcept {
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+[[nodiscard]] inline bool is_aligned(const void* ptr, std::size_t alignment) noexcept {
+    return (reinterpret_cast<std::uintptr_t>(ptr) & (alignment - 1)) == 0;
+}
+
+/// Alignment (power of two) of O_DIRECT reads on fd: file offsets, lengths
+/// and buffer addresses
+[[nodiscard]] inline std::size_t query_alignment([[maybe_unused]] int fd) noexcept {
+#if defined(STATX_DIOALIGN)
+    struct statx stx{};
+    if (::statx(fd, "", AT_EMPTY_PATH, STATX_DIOALIGN, &stx) == 0 &&
+        (stx.stx_mask & STATX_DIOALIGN) && stx.stx_dio_offset_align != 0) {
+        const std::size_t alignment = std::max<std::size_t>(stx.stx_dio_offset_align, stx.stx_dio_mem_align);
+        if (std::has_single_bit(alignment)) {
+            return alignment;
+        }
+    }
+#endif
+    return default_alignment;
+}
+
+/// Open path read-only with O_DIRECT
+/// Falls back to a regular descriptor if the file system does not support
+/// direct I/O (e.g. tmpfs): direct is set accordingly.
+/// @return File descriptor, or -1 (errno set)
+[[nodiscard]] inline int open_read_only(const char* path, int extra_flags, bool& direct) noexcept {
+    int fd = ::open(path, O_RDONLY | O_DIRECT | extra_flags);
+    direct = fd >= 0;
+    if (fd < 0 && errno == EINVAL) {
+        fd = ::open(path, O_RDONLY | extra_flags);
+    }
+    return fd;
+}
+
+/// Cache of aligned buffers, by power-of-two size class
+///
+/// acquire() hands out shared buffers that go back to the pool when the
+/// last reference is dropped (up to max_cached_per_class per class), so the
+/// read views of a reader can outlive it. Thread-safe.
+class AlignedBufferPool : public std::enable_shared_from_this<AlignedBufferPool> {
+public:
+    static constexpr std::size_t max_cached_per_class = 8;
+
+    [[nodiscard]] static std::shared_ptr<AlignedBufferPool> create(std::size_t alignment) noexcept {
+        try {
+            return std::shared_ptr<AlignedBufferPool>(new AlignedBufferPool(alignment));
+        } catch (...) {
+            return nullptr;
+        }
+    }
+
+    ~AlignedBufferPool() {
+        for (auto& buffers : free_) {
+            for (std::byte* buffer : buffers) {
+                std::free(buffer);
+            }
+        }
+    }
+
+    AlignedBufferPool(const AlignedBufferPool&) = delete;
+    AlignedBufferPool& operator=(const AlignedBufferPool&) = delete;
+
+    [[nodiscard]] std::size_t alignment() const noexcept { return alignment_; }
+
+    /// Aligned buffer of at least size bytes (rounded up to its size class)
+    /// @return nullptr if out of memory
+    [[nodiscard]] std::shared_ptr<std::byte[]> acquire(std::size_t size) noexcept {
+        const unsigned size_class = class_of(size);
+        std::byte* buffer = nullptr;
+        {
+            std::lock_guard lock(mutex_);
+            auto& buffers = free_[size_class];
+            if (!buffers.empty()) {
+                buffer = buffers.back();
+                buffers.pop_back();
+            }
+        }
+        if (!buffer) {
+            buffer = static_cast<std::byte*>(std::aligned_alloc(alignment_, std::size_t{1} << size_class));
+            if (!buffer) {
+                return nullptr;
+            }
+        }
+        try {
+            return std::shared_ptr<std::byte[]>(buffer, Recycle{weak_from_this(), size_class});
+        } catch (...) {
+            // The deleter has been called on buffer
+            return nullptr;
+        }
+    }
+
+private:
+    struct Recycle {
+        std::weak_ptr<AlignedBufferPool> pool;
+        unsigned size_class;
+
+        void operator()(std::byte* buffer) const noexcept {
+            if (auto owner = pool.lock()) {
+                std::lock_guard lock(owner->mutex_);
+                auto& buffers = owner->free_[size_class];
+                if (buffers.size() < max_cached_per_class) {
+                    try {
+                        buffers.push_back(buffer);
+                        return;
+                    } catch (...) {
+                    }
+                }
+            }
+            std::free(buffer);
+        }
+    };
+
+    explicit AlignedBufferPool(std::size_t alignment)
+        : alignment_(std::max<std::size_t>(alignment, alignof(std::max_align_t))) {
+        for (auto& buffers : free_) {
+            buffers.reserve(max_cached_per_class);
+        }
+    }
+
+    [[nodiscard]] unsigned class_of(std::size_t size) const noexcept {
+        return static_cast<unsigned>(std::bit_width(std::max(size, alignment_) - 1));
+    }
+
+    std::size_t alignment_;
+    std::mutex mutex_;
+    std::array<std::vector<std::byte*>, 64> free_;
+};
+
+/// Extent of the aligned read covering [offset, offset + size)
+struct AlignedExtent {
+    std::size_t offset;  ///< Aligned file offset
+    std::size_t size;    ///< Aligned length
+    std::size_t skip;    ///< Requested data starts skip bytes into the extent
+};
+
+[[nodiscard]] constexpr AlignedExtent aligned_extent(std::size_t offset, std::size_t size,
+                                                     std::size_t alignment) noexcept {
+    const std::size_t begin = align_down(offset, alignment);
+    return {begin, align_up(offset + size, alignment) - begin, offset - begin};
+}
+
+/// pread of an aligned extent; the last block may end at the end of file
+[[nodiscard]] inline Result<void> pread_extent(int fd, std::byte* buffer, const AlignedExtent& extent,
+                                               std::size_t required) noexcept {
+    ssize_t bytes_read = ::pread(fd, buffer, extent.size, static_cast<off_t>(extent.offset));
+    if (bytes_read < 0) [[unlikely]] {
+        return Err(Error::Code::ReadError, "pread failed: " + std::string(std::strerror(errno)));
+    }
+    if (static_cast<std::size_t>(bytes_read) < extent.skip + required) [[unlikely]] {
+        return Err(Error::Code::UnexpectedEndOfFile, "pread returned fewer bytes than requested");
+    }
+    return Ok();
+}
+
+/// Read size bytes at offset into dest (capacity bytes) from an O_DIRECT fd
+///
+/// Aligned requests (offset and dest aligned, capacity covering the aligned
+/// length) are read in place; others through a pooled bounce buffer.
+[[nodiscard]] inline Result<void> read_into(int fd, AlignedBufferPool& pool, std::byte* dest,
+                                            std::size_t capacity, std::size_t offset,
+                                            std::size_t size) noexcept {
+    const std::size_t alignment = pool.alignment();
+    const AlignedExtent extent = aligned_extent(offset, size, alignment);
+    if (extent.skip == 0 && extent.size <= capacity && is_aligned(dest, alignment)) {
+        return pread_extent(fd, dest, extent, size);
+    }
+
+    auto bounce = pool.acquire(extent.size);
+    if (!bounce) [[unlikely]] {
+        return Err(Error::Code::MemoryError, "Failed to allocate aligned read buffer");
+    }
+    auto res = pread_extent(fd, bounce.get(), extent, size);
+    if (!res) [[unlikely]] {
+        return res;
+    }
+    std::memcpy(dest, bounce.get() + extent.skip, size);
+    return Ok();
+}
+
+/// Read size bytes at offset into a pooled buffer from an O_DIRECT fd
+/// @param data Receives the requested bytes, inside the returned buffer
+[[nodiscard]] inline Result<std::shared_ptr<std::byte[]>> read(int fd, AlignedBufferPool& pool,
+                                                              std::size_t offset, std::size_t size,
+                                                              std::span<const std::byte>& data) noexcept {
+    const AlignedExtent extent = aligned_extent(offset, size, pool.alignment());
+    auto buffer = pool.acquire(extent.size);
+    if (!buffer) [[unlikely]] {
+        return Err(Error::Code::MemoryError, "Failed to allocate aligned read buffer");
+    }
+    auto res = pread_extent(fd, buffer.get(), extent, size);
+    if (!res) [[unlikely]] {
+        return res.error();
+    }
+    data = std::span<const std::byte>(buffer.get() + extent.skip, size);
+    return Ok(std::move(buffer));
+}
+
+} // namespace direct_io
+
+} // namespace tiffconcept
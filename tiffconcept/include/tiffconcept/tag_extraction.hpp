@@ -1,6 +1,7 @@
 #pragma once
 
 #include <algorithm>
+#include <bit>
 #include <tuple>
 #include <utility>
 #include "ifd.hpp"
@@ -90,6 +91,10 @@ public:
     /// Storage for tag values
     typename Implementation::Storage values;
 
+    /// Byte order of the file the tags were extracted from (set by extract()),
+    /// which is also the byte order of its image data
+    std::endian byte_order = std::endian::native;
+
     /// TagSpec
     using tag_spec_type = Spec;
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstring>
+#include <optional>
 #include <span>
 #include <vector>
 #include "lowlevel/encoder.hpp"
@@ -30,6 +31,11 @@ namespace tiffconcept {
 /// @note Supports both tiled and stripped image layouts
 /// @note Supports 2D and 3D images
 /// @note Validates user-provided tags against mandatory requirements
+/// @note Incremental writing: begin_tiled_image() / begin_stripped_image() open a
+///       session, write_tile() / write_strip() encode and append chunks in any
+///       order as they are produced, and finish_image() writes the offset and
+///       byte count arrays, the IFD and the header. Memory use is bounded by the
+///       chunk being encoded plus the per-chunk offset table, not the image size.
 template <
     typename PixelType,
     typename CompSpec,
@@ -55,6 +61,11 @@ public:
     /// @brief Construct with specific IFD placement strategy
     /// @param placement IFD placement configuration
     explicit TiffWriter(IFDPlacement placement);
+
+    /// @brief Construct with an image encoding configuration
+    /// @param writer_config Encoding configuration (e.g. number of parallel encoder threads)
+    /// @param placement IFD placement configuration
+    explicit TiffWriter(typename ImageWriterType::Config writer_config, IFDPlacement placement = IFDPlacement{});
     
     /// @brief Write a complete single-image 2D tiled TIFF file
     /// @tparam InputSpec Image data layout specification (DHWC, DCHW, or CDHW)
@@ -177,11 +188,132 @@ public:
         Predictor predictor,
         const ExtractedTags<TagArgs...>& additional_tags = ExtractedTags<TagArgs...>{}) noexcept;
     
+    /// @brief Start an incremental tiled image session
+    /// @tparam TagArgs Variadic template parameters for additional tags
+    /// @param image_width Image width in pixels
+    /// @param image_height Image height in pixels
+    /// @param image_depth Image depth in slices
+    /// @param tile_width Tile width in pixels
+    /// @param tile_height Tile height in pixels
+    /// @param tile_depth Tile depth in slices
+    /// @param samples_per_pixel Number of channels/samples per pixel
+    /// @param planar_config Planar configuration (Chunky or Planar)
+    /// @param compression Compression scheme to use
+    /// @param predictor Predictor to apply before compression
+    /// @param additional_tags Optional additional TIFF tags to include
+    /// @return Result<void> indicating success or error
+    /// @retval Success Session started
+    /// @retval InvalidOperation A session is already in progress
+    /// @retval InvalidTag User-provided tag conflicts with mandatory tags
+    /// @note Nothing is written until the first write_tile() call
+    /// @note With an IFD-before-data placement, space for the IFD is reserved
+    ///       after the header and the IFD is written there by finish_image()
+    template <typename... TagArgs>
+    [[nodiscard]] Result<void> begin_tiled_image(
+        uint32_t image_width,
+        uint32_t image_height,
+        uint32_t image_depth,
+        uint32_t tile_width,
+        uint32_t tile_height,
+        uint32_t tile_depth,
+        uint16_t samples_per_pixel,
+        PlanarConfiguration planar_config,
+        CompressionScheme compression,
+        Predictor predictor,
+        const ExtractedTags<TagArgs...>& additional_tags = ExtractedTags<TagArgs...>{}) noexcept;
+
+    /// @brief Start an incremental stripped image session
+    /// @tparam TagArgs Variadic template parameters for additional tags
+    /// @param image_width Image width in pixels
+    /// @param image_height Image height in pixels
+    /// @param rows_per_strip Number of rows per strip
+    /// @param samples_per_pixel Number of channels/samples per pixel
+    /// @param planar_config Planar configuration (Chunky or Planar)
+    /// @param compression Compression scheme to use
+    /// @param predictor Predictor to apply before compression
+    /// @param additional_tags Optional additional TIFF tags to include
+    /// @return Result<void> indicating success or error
+    /// @retval Success Session started
+    /// @retval InvalidOperation A session is already in progress
+    /// @retval InvalidTag User-provided tag conflicts with mandatory tags
+    /// @retval UnsupportedFeature rows_per_strip does not evenly divide image_height
+    /// @note Current limitation: rows_per_strip must evenly divide image_height
+    template <typename... TagArgs>
+    [[nodiscard]] Result<void> begin_stripped_image(
+        uint32_t image_width,
+        uint32_t image_height,
+        uint32_t rows_per_strip,
+        uint16_t samples_per_pixel,
+        PlanarConfiguration planar_config,
+        CompressionScheme compression,
+        Predictor predictor,
+        const ExtractedTags<TagArgs...>& additional_tags = ExtractedTags<TagArgs...>{}) noexcept;
+
+    /// @brief Encode one tile of the current session and append it to the file
+    /// @tparam Writer Writer type implementing RawWriter concept
+    /// @param writer The output writer (must be the same for the whole session)
+    /// @param tile_x Tile column index
+    /// @param tile_y Tile row index
+    /// @param tile_z Tile slice index (0 for 2D images)
+    /// @param plane Plane index for planar configuration (0 for chunky)
+    /// @param tile_data Tile pixels, DHWC for chunky and DHW for planar tiles
+    /// @return Result<void> indicating success or error
+    /// @retval Success Tile encoded and written
+    /// @retval InvalidOperation No session in progress, or tile already written
+    /// @retval OutOfBounds Tile index out of range, or tile_data has the wrong size
+    /// @retval WriteError Error during file write operation
+    /// @retval CompressionError Compression failed
+    /// @note Tiles may be written in any order; each is appended after the previous one
+    /// @note tile_data holds either a full tile or, for edge tiles, only the part
+    ///       inside the image, which is then padded using replicate strategy
+    template <typename Writer>
+        requires RawWriter<Writer>
+    [[nodiscard]] Result<void> write_tile(
+        Writer& writer,
+        uint32_t tile_x,
+        uint32_t tile_y,
+        uint32_t tile_z,
+        uint16_t plane,
+        std::span<const PixelType> tile_data) noexcept;
+
+    /// @brief Encode one strip of the current session and append it to the file
+    /// @tparam Writer Writer type implementing RawWriter concept
+    /// @param writer The output writer (must be the same for the whole session)
+    /// @param strip_index Strip index within the plane (top to bottom)
+    /// @param plane Plane index for planar configuration (0 for chunky)
+    /// @param strip_data Strip pixels, HWC for chunky and HW for planar strips
+    /// @return Result<void> indicating success or error
+    /// @note Same semantics and error codes as write_tile()
+    template <typename Writer>
+        requires RawWriter<Writer>
+    [[nodiscard]] Result<void> write_strip(
+        Writer& writer,
+        uint32_t strip_index,
+        uint16_t plane,
+        std::span<const PixelType> strip_data) noexcept;
+
+    /// @brief Complete the current session
+    /// @tparam Writer Writer type implementing RawWriter concept
+    /// @param writer The output writer (must be the same for the whole session)
+    /// @return Result<void> indicating success or error
+    /// @retval Success IFD and header written, session closed
+    /// @retval InvalidOperation No session in progress, or some chunks were never written
+    /// @retval WriteError Error during file write operation
+    /// @note On error the session stays open (e.g. missing chunks can still be written)
+    template <typename Writer>
+        requires RawWriter<Writer>
+    [[nodiscard]] Result<void> finish_image(Writer& writer) noexcept;
+
+    /// @brief Check whether an incremental session is in progress
+    [[nodiscard]] bool image_in_progress() const noexcept;
+
     /// @brief Clear writer state for reuse
-    /// @note Resets internal buffers and allows writing a new image
+    /// @note Resets internal buffers, aborts any incremental session and allows writing a new image
     void clear() noexcept;
 
 private:
+    using BufferingStrat = typename ImageWriterType::BufferingStrat;
+
     ImageWriterType image_writer_;
     IFDBuilderType ifd_builder_;
     IFDPlacement placement_strategy_;
@@ -219,6 +351,45 @@ private:
         OptTag_t<tiffconcept::TileDepthTag>
     >;
 
+    /// State of an incremental session opened by begin_tiled_image()/begin_stripped_image()
+    struct StreamState {
+        WritingTagsType mandatory_tags;       ///< Mandatory tags, offsets filled at finish
+        IFDBuilderType ifd_builder;           ///< Holds the user tags until finish
+        BufferingStrat buffering;             ///< Buffering strategy shared by all chunks
+        WrittenImageInfo info;                ///< Offsets and byte counts of written chunks
+        std::vector<PixelType> tile_buffer;   ///< Scratch buffer for padding edge tiles
+        TileSize tile_size{};                 ///< Tile dimensions (effective samples)
+        TileSize image_size{};                ///< Image dimensions (effective samples)
+        uint32_t tiles_across = 0;
+        uint32_t tiles_down = 0;
+        uint32_t tiles_deep = 0;
+        uint16_t num_planes = 0;
+        bool is_tiled = false;
+        CompressionScheme compression = CompressionScheme::None;
+        Predictor predictor = Predictor::None;
+        std::size_t ifd_start = 0;            ///< Reserved IFD position (IFD before data only)
+        std::size_t reserved_ifd_size = 0;    ///< Reserved IFD size (IFD before data only)
+        std::size_t current_file_pos = 0;     ///< Where the next chunk is appended
+        std::size_t chunks_written = 0;
+    };
+
+    std::optional<StreamState> stream_;
+
+    template <typename... TagArgs>
+    [[nodiscard]] Result<void> begin_image_impl(
+        uint32_t image_width,
+        uint32_t image_height,
+        uint32_t image_depth,
+        uint32_t tile_width,
+        uint32_t tile_height,
+        uint32_t tile_depth,
+        bool     is_tiled,
+        uint16_t samples_per_pixel,
+        PlanarConfiguration planar_config,
+        CompressionScheme compression,
+        Predictor predictor,
+        const ExtractedTags<TagArgs...>& additional_tags) noexcept;
+
     template <TagCode Code, typename... DstTagArgs, typename... SrcTagArgs, typename DefaultType>
     static inline void fill_tag_if_missing_in_src(
         ExtractedTags<DstTagArgs...>& metadata_dst,
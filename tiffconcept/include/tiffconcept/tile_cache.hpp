@@ -0,0 +1,126 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <unordered_map>
+#include <vector>
+#include "types/tile_info.hpp"
+
+namespace tiffconcept {
+
+/// @brief Image whose decoded tiles are cached (see DecodedTileCache)
+/// @note Two images share cached tiles iff they have the same scope
+struct TileCacheScope {
+    uint64_t file_id;     ///< Caller-chosen id of the file (e.g. from its device and inode numbers)
+    uint64_t ifd_offset;  ///< Offset of the IFD of the image in the file
+};
+
+/// @brief Key of a decoded tile in a DecodedTileCache
+struct TileCacheKey {
+    uint64_t file_id;     ///< TileCacheScope::file_id
+    uint64_t ifd_offset;  ///< TileCacheScope::ifd_offset
+    uint32_t tile_index;  ///< TileDescriptor::index (tile or strip index)
+
+    [[nodiscard]] static constexpr TileCacheKey of(const TileCacheScope& scope, const Tile& tile) noexcept {
+        return {scope.file_id, scope.ifd_offset, tile.id.index};
+    }
+
+    bool operator==(const TileCacheKey&) const noexcept = default;
+};
+
+/// @brief Counters of a DecodedTileCache (snapshot, see DecodedTileCache::stats)
+struct TileCacheStats {
+    uint64_t hits = 0;        ///< Lookups that found the tile
+    uint64_t misses = 0;      ///< Lookups that did not
+    uint64_t insertions = 0;  ///< Tiles added
+    uint64_t evictions = 0;   ///< Tiles removed to make room for others
+    size_t bytes = 0;         ///< Decoded bytes currently cached
+    size_t entries = 0;       ///< Tiles currently cached
+};
+
+/// @brief Byte-budgeted LRU cache of decoded tiles, shared by read_region calls
+///
+/// Plugged into CPULimitedReader and FastReader (Config::tile_cache), which
+/// copy the cached tiles of a region to the output and only read and decode
+/// the others. Tiles are full decoded tiles, so a tile cached by one region
+/// serves every region that overlaps it.
+///
+/// Keys are spread over independently locked shards (a power of two), each
+/// with its own LRU list and an equal share of the byte budget. Cached tiles
+/// are immutable and reference counted: a lookup keeps its tile alive even if
+/// it is evicted meanwhile.
+///
+/// @tparam PixelType Pixel type of the decoded tiles
+/// @note Thread-safe
+template <typename PixelType>
+class DecodedTileCache {
+public:
+    using TileData = std::shared_ptr<const std::vector<PixelType>>;
+
+    struct Config {
+        size_t max_bytes = 256 * 1024 * 1024;  ///< Byte budget of the decoded tiles
+        size_t shards = 16;                    ///< Number of shards (rounded up to a power of two)
+    };
+
+    explicit DecodedTileCache(Config config = {});
+
+    DecodedTileCache(const DecodedTileCache&) = delete;
+    DecodedTileCache& operator=(const DecodedTileCache&) = delete;
+
+    /// @brief Look up a tile, and mark it as most recently used
+    /// @return The decoded tile, or nullptr if it is not cached
+    [[nodiscard]] TileData find(const TileCacheKey& key) noexcept;
+
+    /// @brief Add a copy of a decoded tile, evicting least recently used tiles
+    ///        of its shard to stay within budget
+    /// @note No-op if the tile is already cached, or larger than a shard budget
+    void insert(const TileCacheKey& key, std::span<const PixelType> tile) noexcept;
+
+    /// @brief Remove every tile (counters are kept)
+    void clear() noexcept;
+
+    [[nodiscard]] TileCacheStats stats() const noexcept;
+    [[nodiscard]] size_t max_bytes() const noexcept { return shard_budget_ * shard_count_; }
+    [[nodiscard]] size_t shard_count() const noexcept { return shard_count_; }
+
+private:
+    struct Entry {
+        TileCacheKey key;
+        TileData data;
+        size_t bytes;
+    };
+
+    struct KeyHash {
+        size_t operator()(const TileCacheKey& key) const noexcept;
+    };
+
+    struct alignas(64) Shard {
+        std::mutex mutex;
+        std::list<Entry> lru;  // Most recently used first
+        std::unordered_map<TileCacheKey, typename std::list<Entry>::iterator, KeyHash> index;
+        size_t bytes = 0;
+    };
+
+    [[nodiscard]] Shard& shard_of(const TileCacheKey& key) noexcept;
+
+    size_t shard_count_;
+    size_t shard_budget_;
+    std::unique_ptr<Shard[]> shards_;
+
+    std::atomic<uint64_t> hits_{0};
+    std::atomic<uint64_t> misses_{0};
+    std::atomic<uint64_t> insertions_{0};
+    std::atomic<uint64_t> evictions_{0};
+    std::atomic<size_t> bytes_{0};
+    std::atomic<size_t> entries_{0};
+};
+
+} // namespace tiffconcept
+
+#define TIFFCONCEPT_TILE_CACHE_HEADER
+#include "impl/tile_cache_impl.hpp"
@@ -0,0 +1,217 @@
+#pragma once
+
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <vector>
+#include "tiff_spec.hpp"
+
+namespace tiffconcept {
+
+/// @brief Read-only array of unsigned integers decoded on access from their
+///        bytes in a TIFF file
+///
+/// Used as the value_type of a TagDescriptor (e.g. TileOffsetsTag_View), it
+/// makes parsing an array tag O(1): the array keeps the reader's view of the
+/// tag data alive (a shared mapping for MmapFileReader, the read buffer for
+/// readers that allocate) instead of copying and converting every element.
+/// Elements stored as BYTE, SHORT, LONG or LONG8 are widened to T, and
+/// byte-swapped if the file byte order is not the native one, by
+/// operator[].
+///
+/// Copies share the data. For readers whose views do not own their data
+/// (BufferReader, BufferViewReader), the array is only valid while the
+/// buffer is.
+///
+/// @tparam T Unsigned integer type of the decoded elements
+template <typename T>
+    requires std::is_unsigned_v<T> && (!std::is_same_v<T, bool>)
+class TagArrayView {
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+
+    class iterator {
+    public:
+        using iterator_concept = std::random_access_iterator_tag;
+        using iterator_category = std::input_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using reference = T;
+
+        iterator() noexcept = default;
+        iterator(const TagArrayView* view, std::size_t index) noexcept : view_(view), index_(index) {}
+
+        [[nodiscard]] T operator*() const noexcept { return (*view_)[index_]; }
+        [[nodiscard]] T operator[](difference_type n) const noexcept { return (*view_)[index_ + n]; }
+
+        iterator& operator++() noexcept { ++index_; return *this; }
+        iterator operator++(int) noexcept { auto copy = *this; ++index_; return copy; }
+        iterator& operator--() noexcept { --index_; return *this; }
+        iterator operator--(int) noexcept { auto copy = *this; --index_; return copy; }
+        iterator& operator+=(difference_type n) noexcept { index_ += n; return *this; }
+        iterator& operator-=(difference_type n) noexcept { index_ -= n; return *this; }
+        [[nodiscard]] friend iterator operator+(iterator it, difference_type n) noexcept { return it += n; }
+        [[nodiscard]] friend iterator operator+(difference_type n, iterator it) noexcept { return it += n; }
+        [[nodiscard]] friend iterator operator-(iterator it, difference_type n) noexcept { return it -= n; }
+        [[nodiscard]] friend difference_type operator-(const iterator& a, const iterator& b) noexcept {
+            return static_cast<difference_type>(a.index_) - static_cast<difference_type>(b.index_);
+        }
+        [[nodiscard]] friend bool operator==(const iterator& a, const iterator& b) noexcept { return a.index_ == b.index_; }
+        [[nodiscard]] friend auto operator<=>(const iterator& a, const iterator& b) noexcept { return a.index_ <=> b.index_; }
+
+    private:
+        const TagArrayView* view_ = nullptr;
+        std::size_t index_ = 0;
+    };
+    using const_iterator = iterator;
+
+    TagArrayView() noexcept = default;
+
+    /// @brief View over the stored bytes of a tag
+    /// @param owner Keeps data alive (e.g. the reader view it was read into); may be null
+    /// @param data Stored elements (size() * element_size bytes)
+    /// @param element_size Size of the stored elements: 1, 2, 4 or 8 (at most sizeof(T))
+    /// @param byteswap Whether the stored elements are in non-native byte order
+    TagArrayView(std::shared_ptr<const void> owner, std::span<const std::byte> data,
+                 std::size_t element_size, bool byteswap) noexcept
+        : owner_(std::move(owner))
+        , data_(data.data())
+        , size_(data.size() / element_size)
+        , element_size_(static_cast<uint8_t>(element_size))
+        , byteswap_(byteswap) {}
+
+    /// @brief The same stored elements, decoded as another unsigned type
+    /// @note Only widening conversions are allowed, so no element is truncated
+    template <typename U>
+        requires (!std::is_same_v<U, T> && sizeof(U) <= sizeof(T))
+    explicit TagArrayView(const TagArrayView<U>& other) noexcept
+        : owner_(other.owner_)
+        , data_(other.data_)
+        , size_(other.size_)
+        , element_size_(other.element_size_)
+        , byteswap_(other.byteswap_) {}
+
+    /// @brief Replace the content with a native copy of values
+    /// @note Reuses the buffer of a previous assign() when it is not shared
+    /// @throws std::bad_alloc
+    template <std::ranges::sized_range R>
+    void assign(const R& values) {
+        std::shared_ptr<std::vector<T>> buffer;
+        if (owns_buffer_ && owner_.use_count() == 1) {
+            buffer = std::static_pointer_cast<std::vector<T>>(std::const_pointer_cast<void>(owner_));
+        } else {
+            buffer = std::make_shared<std::vector<T>>();
+        }
+        buffer->resize(std::ranges::size(values));
+        std::size_t i = 0;
+        for (const auto value : values) {
+            (*buffer)[i++] = static_cast<T>(value);
+        }
+        data_ = reinterpret_cast<const std::byte*>(buffer->data());
+        size_ = buffer->size();
+        element_size_ = sizeof(T);
+        byteswap_ = false;
+        owns_buffer_ = true;
+        owner_ = std::move(buffer);
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept { return size_; }
+    [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+
+    /// @brief Size of the stored elements in bytes
+    [[nodiscard]] std::size_t element_size() const noexcept { return element_size_; }
+
+    /// @brief Whether elements are byte-swapped on access
+    [[nodiscard]] bool is_byteswapped() const noexcept { return byteswap_; }
+
+    [[nodiscard]] T operator[](std::size_t index) const noexcept {
+        switch (element_size_) {
+            case 8: return load<uint64_t>(index);
+            case 4: return load<uint32_t>(index);
+            case 2: return load<uint16_t>(index);
+            default: return static_cast<T>(std::to_integer<uint8_t>(data_[index]));
+        }
+    }
+
+    [[nodiscard]] iterator begin() const noexcept { return iterator(this, 0); }
+    [[nodiscard]] iterator end() const noexcept { return iterator(this, size_); }
+
+    void clear() noexcept { *this = TagArrayView(); }
+
+    /// @brief Element-wise equality (regardless of storage)
+    [[nodiscard]] friend bool operator==(const TagArrayView& a, const TagArrayView& b) noexcept {
+        if (a.size_ != b.size_) {
+            return false;
+        }
+        for (std::size_t i = 0; i < a.size_; ++i) {
+            if (a[i] != b[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+private:
+    template <typename U>
+        requires std::is_unsigned_v<U> && (!std::is_same_v<U, bool>)
+    friend class TagArrayView;
+
+    template <typename Stored>
+    [[nodiscard]] T load(std::size_t index) const noexcept {
+        Stored value;
+        std::memcpy(&value, data_ + index * sizeof(Stored), sizeof(Stored));
+        if (byteswap_) {
+            value = byteswap(value);
+        }
+        return static_cast<T>(value);
+    }
+
+    std::shared_ptr<const void> owner_;
+    const std::byte* data_ = nullptr;
+    std::size_t size_ = 0;
+    uint8_t element_size_ = sizeof(T);
+    bool byteswap_ = false;
+    bool owns_buffer_ = false;  // owner_ is a std::vector<T> created by assign()
+};
+
+namespace detail {
+
+template <typename T>
+struct is_tag_array_view : std::false_type {};
+
+template <typename T>
+struct is_tag_array_view<TagArrayView<T>> : std::true_type {};
+
+template <typename T>
+inline constexpr bool is_tag_array_view_v = is_tag_array_view<T>::value;
+
+/// Size of the elements a TagArrayView can decode for a TIFF data type (0 if not supported)
+[[nodiscard]] constexpr std::size_t tag_array_view_element_size(TiffDataType type) noexcept {
+    switch (type) {
+        case TiffDataType::Byte:
+        case TiffDataType::Undefined:
+            return 1;
+        case TiffDataType::Short:
+            return 2;
+        case TiffDataType::Long:
+        case TiffDataType::IFD:
+            return 4;
+        case TiffDataType::Long8:
+        case TiffDataType::IFD8:
+            return 8;
+        default:
+            return 0;
+    }
+}
+
+} // namespace detail
+
+} // namespace tiffconcept
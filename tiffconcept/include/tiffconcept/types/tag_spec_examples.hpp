@@ -3,6 +3,7 @@
 #include <cstdint>
 #include <string>
 #include <vector>
+#include "tag_array_view.hpp"
 #include "tag_codes.hpp"
 #include "tag_spec.hpp"
 
@@ -203,6 +204,14 @@ using TileOffsetsTag_BigTIFF = TagDescriptor<TagCode::TileOffsets, TiffDataType:
 using TileByteCountsTag_BigTIFF = TagDescriptor<TagCode::TileByteCounts, TiffDataType::Long8, std::vector<uint64_t>, false, TiffDataType::Short, TiffDataType::Long>;
 using SubIFDTag_BigTIFF = TagDescriptor<TagCode::SubIFD, TiffDataType::IFD8, std::vector<uint64_t>, false, TiffDataType::Short, TiffDataType::Long, TiffDataType::IFD, TiffDataType::Long8>;
 
+// Lazy array variants (reading only)
+// Elements are decoded on access from the data read by the reader (no copy with
+// MmapFileReader), see TagArrayView. SHORT, LONG and LONG8 are all accepted, so
+// they serve both Classic TIFF and BigTIFF files.
+
+using TileOffsetsTag_View = TagDescriptor<TagCode::TileOffsets, TiffDataType::Long8, TagArrayView<uint64_t>, false, TiffDataType::Short, TiffDataType::Long>;
+using TileByteCountsTag_View = TagDescriptor<TagCode::TileByteCounts, TiffDataType::Long8, TagArrayView<uint64_t>, false, TiffDataType::Short, TiffDataType::Long>;
+
 // Tag specification examples:
 
 // Minimal set for parsing simple strip-based images
@@ -263,6 +272,21 @@ using MinBigTiledSpec = TagSpec<
     OptTag_t<SampleFormatTag> // Default: 1 (unsigned)
 >;
 
+// Minimal set for parsing simple tile-based images, with lazy tile arrays (Classic TIFF or BigTIFF)
+using MinTiledViewSpec = TagSpec<
+    ImageWidthTag,
+    ImageLengthTag,
+    BitsPerSampleTag,
+    CompressionTag,
+    OptTag_t<SamplesPerPixelTag>, // Default: 1
+    OptTag_t<PredictorTag>, // Default: 1 (no predictor)
+    TileWidthTag,
+    TileLengthTag,
+    TileOffsetsTag_View,
+    TileByteCountsTag_View,
+    OptTag_t<SampleFormatTag> // Default: 1 (unsigned)
+>;
+
 // Extended minimal set to cover most image types (classic tiff)
 using MinImageSpec = TagSpec<
     ImageWidthTag,